@@ -1,6 +1,8 @@
 #include "ITKImageProcessing/Common/ITKArrayHelper.hpp"
 
 #include "simplnx/Common/TypesUtility.hpp"
+#include "simplnx/Core/Application.hpp"
+#include "simplnx/Core/Preferences.hpp"
 
 #include <fmt/ranges.h>
 
@@ -20,6 +22,22 @@ DataType ITK::detail::ConvertChoiceToDataType(types::usize choice)
   return DataType::uint8;
 }
 
+ITK::StreamingOptions ITK::GetStreamingOptions()
+{
+  StreamingOptions options;
+  auto application = Application::Instance();
+  if(application == nullptr)
+  {
+    return options;
+  }
+  nlohmann::json slabSize = application->getPreferences()->pluginValue("ITKImageProcessing", Constants::k_StreamingSlabSize_Key);
+  if(slabSize.is_number_integer() && slabSize.get<int64>() > 0)
+  {
+    options.slabSize = slabSize.get<usize>();
+  }
+  return options;
+}
+
 bool ITK::DoTuplesMatch(const IDataStore& dataStore, const ImageGeom& imageGeom)
 {
   return imageGeom.getNumberOfCells() == dataStore.getNumberOfTuples();
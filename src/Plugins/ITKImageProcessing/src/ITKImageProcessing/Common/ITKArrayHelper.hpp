@@ -10,6 +10,7 @@
 #include "simplnx/DataStructure/DataStructure.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/IDataStore.hpp"
+#include "simplnx/DataStructure/IO/HDF5/LazyDataStore.hpp"
 #include "simplnx/Filter/Actions/CreateArrayAction.hpp"
 #include "simplnx/Filter/Output.hpp"
 
@@ -23,6 +24,7 @@
 #include <fmt/core.h>
 #include <fmt/ranges.h>
 
+#include <optional>
 #include <stdexcept>
 #include <type_traits>
 #include <vector>
@@ -151,9 +153,31 @@ namespace Constants
 {
 inline constexpr int32 k_ImageGeometryDimensionMismatch = -2000;
 inline constexpr int32 k_ImageComponentDimensionMismatch = -2001;
+inline constexpr int32 k_OutOfCoreInputNotSupported = -9999;
 
+/**
+ * @brief The plugin preference holding the number of Z slices per streamed slab.
+ */
+inline constexpr StringLiteral k_StreamingSlabSize_Key = "streaming_slab_size";
 } // namespace Constants
 
+/**
+ * @brief Controls how ITK filters that support streaming are executed.
+ */
+struct StreamingOptions
+{
+  /**
+   * @brief The number of Z slices processed at once. 0 processes the whole volume in one pass.
+   */
+  usize slabSize = 0;
+};
+
+/**
+ * @brief Returns the streaming options stored in the ITKImageProcessing plugin preferences.
+ * @return StreamingOptions
+ */
+StreamingOptions GetStreamingOptions();
+
 /**
  * @brief Compares the total number of cells of the image geometry and the total number of tuples from the data store
  * @param dataStore
@@ -309,15 +333,22 @@ std::vector<usize> GetComponentDimensions()
   return {itk::NumericTraits<PixelT>::GetLength()};
 }
 
+/**
+ * @brief Wraps a buffer of values in an ITK image without copying it. The buffer must
+ * outlive the image.
+ * @param buffer
+ * @param size The number of values in the buffer
+ * @param imageGeom
+ */
 template <class PixelT, uint32 Dimensions>
-typename itk::Image<PixelT, Dimensions>::Pointer WrapDataStoreInImage(DataStore<UnderlyingType_t<PixelT>>& dataStore, const ImageGeomData& imageGeom)
+typename itk::Image<PixelT, Dimensions>::Pointer WrapBufferInImage(UnderlyingType_t<PixelT>* buffer, usize size, const ImageGeomData& imageGeom)
 {
   using T = ITK::UnderlyingType_t<PixelT>;
 
-  static_assert(std::is_standard_layout_v<PixelT>, "nx::core::ITK::WrapDataStoreInImage: PixelT must be standard layout");
-  // static_assert(std::is_trivial_v<PixelT>, "nx::core::ITK::WrapDataStoreInImage: PixelT must be trivial");
-  static_assert(std::is_arithmetic_v<T>, "nx::core::ITK::WrapDataStoreInImage: The underlying type T of PixelT must be arithmetic");
-  static_assert(sizeof(PixelT) % sizeof(T) == 0, "nx::core::ITK::WrapDataStoreInImage: The size of PixelT must be evenly divisible by T");
+  static_assert(std::is_standard_layout_v<PixelT>, "nx::core::ITK::WrapBufferInImage: PixelT must be standard layout");
+  // static_assert(std::is_trivial_v<PixelT>, "nx::core::ITK::WrapBufferInImage: PixelT must be trivial");
+  static_assert(std::is_arithmetic_v<T>, "nx::core::ITK::WrapBufferInImage: The underlying type T of PixelT must be arithmetic");
+  static_assert(sizeof(PixelT) % sizeof(T) == 0, "nx::core::ITK::WrapBufferInImage: The size of PixelT must be evenly divisible by T");
 
   using FilterType = itk::ImportImageFilter<PixelT, Dimensions>;
 
@@ -350,12 +381,18 @@ typename itk::Image<PixelT, Dimensions>::Pointer WrapDataStoreInImage(DataStore<
   importFilter->SetOrigin(imageOrigin);
   importFilter->SetSpacing(imageSpacing);
   importFilter->SetDirection(imageDirection);
-  importFilter->SetImportPointer(reinterpret_cast<PixelT*>(dataStore.data()), dataStore.getSize(), false);
+  importFilter->SetImportPointer(reinterpret_cast<PixelT*>(buffer), size, false);
   importFilter->Update();
 
   return importFilter->GetOutput();
 }
 
+template <class PixelT, uint32 Dimensions>
+typename itk::Image<PixelT, Dimensions>::Pointer WrapDataStoreInImage(DataStore<UnderlyingType_t<PixelT>>& dataStore, const ImageGeomData& imageGeom)
+{
+  return WrapBufferInImage<PixelT, Dimensions>(dataStore.data(), dataStore.getSize(), imageGeom);
+}
+
 template <class PixelT, uint32 Dimensions>
 typename itk::Image<PixelT, Dimensions>::Pointer WrapDataStoreInImage(DataStore<UnderlyingType_t<PixelT>>& dataStore, const ImageGeom& imageGeom)
 {
@@ -425,6 +462,63 @@ Result<> ConvertImageToDataStore(DataStore<NewStoreT>& dataStore, itk::Image<Pix
   return {};
 }
 
+/**
+ * @brief Frees the memory of an in memory output store before an ITK filter allocates
+ * its own output buffer, so the preallocated output and the ITK output are never held
+ * at the same time. The shape of the store is returned so it can be restored.
+ * Other stores are left untouched.
+ * @param dataStore
+ * @return The tuple shape of the store before its memory was released
+ */
+template <class T>
+IDataStore::ShapeType ReleaseDataStoreMemory(AbstractDataStore<T>& dataStore)
+{
+  IDataStore::ShapeType tupleShape = dataStore.getTupleShape();
+  if(auto* inMemoryStore = dynamic_cast<DataStore<T>*>(&dataStore); inMemoryStore != nullptr)
+  {
+    *inMemoryStore = DataStore<T>(IDataStore::ShapeType{0}, dataStore.getComponentShape(), std::nullopt);
+  }
+  return tupleShape;
+}
+
+/**
+ * @brief Reallocates an in memory store released by ReleaseDataStoreMemory, for example
+ * when the ITK filter failed.
+ * @param dataStore
+ * @param tupleShape
+ */
+template <class T>
+void RestoreDataStoreMemory(AbstractDataStore<T>& dataStore, const IDataStore::ShapeType& tupleShape)
+{
+  if(auto* inMemoryStore = dynamic_cast<DataStore<T>*>(&dataStore); inMemoryStore != nullptr && inMemoryStore->getSize() == 0)
+  {
+    *inMemoryStore = DataStore<T>(tupleShape, dataStore.getComponentShape(), static_cast<T>(0));
+  }
+}
+
+/**
+ * @brief Moves the pixels of an ITK image into the store. In memory stores adopt the
+ * ITK pixel buffer without copying it, any other store has the pixels copied into it.
+ * @param image
+ * @param dataStore
+ * @return Result<>
+ */
+template <class PixelT, uint32 Dimension>
+Result<> MoveImageIntoDataStore(itk::Image<PixelT, Dimension>& image, AbstractDataStore<UnderlyingType_t<PixelT>>& dataStore)
+{
+  using T = UnderlyingType_t<PixelT>;
+  if(auto* inMemoryStore = dynamic_cast<DataStore<T>*>(&dataStore); inMemoryStore != nullptr)
+  {
+    *inMemoryStore = ConvertImageToDataStore(image);
+    return {};
+  }
+
+  typename itk::Image<PixelT, Dimension>::PixelContainer* pixelContainer = image.GetPixelContainer();
+  const usize numValues = pixelContainer->Size() * (sizeof(PixelT) / sizeof(T));
+  const auto* bufferPtr = reinterpret_cast<const T*>(pixelContainer->GetBufferPointer());
+  return dataStore.copyFromBuffer(0, nonstd::span<const T>(bufferPtr, numValues));
+}
+
 struct ConvertImageToDatastoreFunctor
 {
   template <typename T, class... Args>
@@ -684,6 +778,30 @@ using HasInterMediateTypeHelper_t = typename HasIntermediateTypeHelper<T>::type;
 template <class T>
 inline constexpr bool HasIntermediateType_v = !std::is_same_v<HasInterMediateTypeHelper_t<T>, void>;
 
+template <class T>
+using StreamingRadius_t = decltype(std::declval<const T&>().getStreamingRadius());
+
+template <class T, class = void>
+struct HasStreamingRadiusHelper : std::false_type
+{
+};
+
+template <class T>
+struct HasStreamingRadiusHelper<T, std::void_t<StreamingRadius_t<T>>> : std::true_type
+{
+};
+
+/**
+ * @brief Filter creation functors that define 'usize getStreamingRadius() const' produce the same
+ * result for every voxel when the input is cut into Z slabs padded by that many slices, so they
+ * can be executed slab by slab.
+ */
+template <class T>
+inline constexpr bool HasStreamingRadius_v = HasStreamingRadiusHelper<T>::value;
+
+template <class T>
+inline constexpr bool IsStreamable_v = HasStreamingRadius_v<T> && !HasMeasurements_v<T> && !HasIntermediateType_v<T>;
+
 template <class InputT, class OutputT, uint32 Dimension>
 struct ITKFilterFunctor
 {
@@ -704,14 +822,26 @@ struct ITKFilterFunctor
     itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New(shouldCancel);
     filter->AddObserver(itk::ProgressEvent(), interruption);
     filter->SetInput(inputImage);
-    filter->Update();
+
+    auto& typedOutputDataStore = dynamic_cast<AbstractDataStore<ITK::UnderlyingType_t<OutputT>>&>(outputDataStore);
+    const IDataStore::ShapeType outputTupleShape = ITK::ReleaseDataStoreMemory(typedOutputDataStore);
+    try
+    {
+      filter->Update();
+    } catch(...)
+    {
+      ITK::RestoreDataStoreMemory(typedOutputDataStore, outputTupleShape);
+      throw;
+    }
 
     typename OutputImageType::Pointer outputImage = filter->GetOutput();
     outputImage->DisconnectPipeline();
 
-    auto& typedOutputDataStore = dynamic_cast<DataStore<ITK::UnderlyingType_t<OutputT>>&>(outputDataStore);
-    auto imageDataStore = ITK::ConvertImageToDataStore(*outputImage);
-    typedOutputDataStore = std::move(imageDataStore);
+    Result<> moveResult = ITK::MoveImageIntoDataStore(*outputImage, typedOutputDataStore);
+    if(moveResult.invalid())
+    {
+      return ConvertInvalidResult<ITKFilterFunctorResult_t<FilterCreationFunctorT>>(std::move(moveResult));
+    }
 
     if constexpr(HasMeasurements_v<FilterCreationFunctorT>)
     {
@@ -752,14 +882,26 @@ struct ITKFilterFunctor
     using CastImageFromIntermediateFilterType = itk::CastImageFilter<IntermediateImageType, OutputImageType>;
     auto castImageFromIntermediateFilter = CastImageFromIntermediateFilterType::New();
     castImageFromIntermediateFilter->SetInput(filter->GetOutput());
-    castImageFromIntermediateFilter->Update();
+
+    auto& typedOutputDataStore = dynamic_cast<AbstractDataStore<ITK::UnderlyingType_t<OutputT>>&>(outputDataStore);
+    const IDataStore::ShapeType outputTupleShape = ITK::ReleaseDataStoreMemory(typedOutputDataStore);
+    try
+    {
+      castImageFromIntermediateFilter->Update();
+    } catch(...)
+    {
+      ITK::RestoreDataStoreMemory(typedOutputDataStore, outputTupleShape);
+      throw;
+    }
 
     typename OutputImageType::Pointer outputImage = castImageFromIntermediateFilter->GetOutput();
     outputImage->DisconnectPipeline();
 
-    auto& typedOutputDataStore = dynamic_cast<DataStore<ITK::UnderlyingType_t<OutputT>>&>(outputDataStore);
-    auto imageDataStore = ITK::ConvertImageToDataStore(*outputImage);
-    typedOutputDataStore = std::move(imageDataStore);
+    Result<> moveResult = ITK::MoveImageIntoDataStore(*outputImage, typedOutputDataStore);
+    if(moveResult.invalid())
+    {
+      return ConvertInvalidResult<ITKFilterFunctorResult_t<FilterCreationFunctorT>>(std::move(moveResult));
+    }
 
     if constexpr(HasMeasurements_v<FilterCreationFunctorT>)
     {
@@ -771,10 +913,101 @@ struct ITKFilterFunctor
     }
   }
 
+  template <class FilterCreationFunctorT>
+  Result<> executeInSlabs(IDataStore& inputDataStore, const ImageGeom& imageGeom, IDataStore& outputDataStore, const std::atomic_bool& shouldCancel,
+                          const itk::ProgressObserver::Pointer progressObserver, const FilterCreationFunctorT& filterCreationFunctor, usize slabSize) const
+  {
+    using InputImageType = itk::Image<InputT, Dimension>;
+    using OutputImageType = itk::Image<OutputT, Dimension>;
+    using InputValueT = ITK::UnderlyingType_t<InputT>;
+    using OutputValueT = ITK::UnderlyingType_t<OutputT>;
+
+    auto& typedInputDataStore = dynamic_cast<AbstractDataStore<InputValueT>&>(inputDataStore);
+    auto& typedOutputDataStore = dynamic_cast<AbstractDataStore<OutputValueT>&>(outputDataStore);
+    auto* inMemoryInputDataStore = dynamic_cast<DataStore<InputValueT>*>(&inputDataStore);
+
+    const ImageGeomData geomData(imageGeom);
+    const usize numSlices = geomData.dims[2];
+    const usize inputSliceSize = geomData.dims[0] * geomData.dims[1] * inputDataStore.getNumberOfComponents();
+    const usize outputSliceSize = geomData.dims[0] * geomData.dims[1] * outputDataStore.getNumberOfComponents();
+    const usize radius = filterCreationFunctor.getStreamingRadius();
+
+    std::vector<InputValueT> inputBuffer;
+    for(usize slabStart = 0; slabStart < numSlices; slabStart += slabSize)
+    {
+      if(shouldCancel)
+      {
+        return {};
+      }
+
+      // Pad the slab so every voxel kept from it sees the same neighborhood as in the whole volume
+      const usize slabEnd = std::min(slabStart + slabSize, numSlices);
+      const usize paddedStart = slabStart - std::min(slabStart, radius);
+      const usize paddedEnd = std::min(slabEnd + radius, numSlices);
+      const usize paddedSize = (paddedEnd - paddedStart) * inputSliceSize;
+
+      ImageGeomData slabGeom = geomData;
+      slabGeom.dims[2] = paddedEnd - paddedStart;
+      slabGeom.origin[2] = geomData.origin[2] + static_cast<float32>(paddedStart) * geomData.spacing[2];
+
+      InputValueT* slabPtr = nullptr;
+      if(inMemoryInputDataStore != nullptr)
+      {
+        slabPtr = inMemoryInputDataStore->data() + paddedStart * inputSliceSize;
+      }
+      else
+      {
+        inputBuffer.resize(paddedSize);
+        Result<> readResult = typedInputDataStore.copyIntoBuffer(paddedStart * inputSliceSize, nonstd::span<InputValueT>(inputBuffer.data(), paddedSize));
+        if(readResult.invalid())
+        {
+          return readResult;
+        }
+        slabPtr = inputBuffer.data();
+      }
+      typename InputImageType::Pointer inputImage = ITK::WrapBufferInImage<InputT, Dimension>(slabPtr, paddedSize, slabGeom);
+
+      auto filter = filterCreationFunctor.template createFilter<InputImageType, OutputImageType, Dimension>();
+      if(progressObserver != nullptr)
+      {
+        filter->AddObserver(itk::ProgressEvent(), progressObserver);
+      }
+      itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New(shouldCancel);
+      filter->AddObserver(itk::ProgressEvent(), interruption);
+      filter->SetInput(inputImage);
+      filter->Update();
+
+      typename OutputImageType::Pointer outputImage = filter->GetOutput();
+      const auto* outputPtr = reinterpret_cast<const OutputValueT*>(outputImage->GetBufferPointer()) + (slabStart - paddedStart) * outputSliceSize;
+      Result<> writeResult = typedOutputDataStore.copyFromBuffer(slabStart * outputSliceSize, nonstd::span<const OutputValueT>(outputPtr, (slabEnd - slabStart) * outputSliceSize));
+      if(writeResult.invalid())
+      {
+        return writeResult;
+      }
+    }
+
+    return {};
+  }
+
   template <class FilterCreationFunctorT>
   Result<ITKFilterFunctorResult_t<FilterCreationFunctorT>> operator()(IDataStore& inputDataStore, const ImageGeom& imageGeom, IDataStore& outputDataStore, const std::atomic_bool& shouldCancel,
-                                                                      const itk::ProgressObserver::Pointer progressObserver, const FilterCreationFunctorT& filterCreationFunctor) const
+                                                                      const itk::ProgressObserver::Pointer progressObserver, const FilterCreationFunctorT& filterCreationFunctor,
+                                                                      const StreamingOptions& streamingOptions) const
   {
+    if constexpr(IsStreamable_v<FilterCreationFunctorT> && Dimension == 3)
+    {
+      if(streamingOptions.slabSize > 0 && streamingOptions.slabSize < imageGeom.getDimensions()[2])
+      {
+        return executeInSlabs<FilterCreationFunctorT>(inputDataStore, imageGeom, outputDataStore, shouldCancel, progressObserver, filterCreationFunctor, streamingOptions.slabSize);
+      }
+    }
+
+    if(dynamic_cast<DataStore<ITK::UnderlyingType_t<InputT>>*>(&inputDataStore) == nullptr)
+    {
+      return MakeErrorResult<ITKFilterFunctorResult_t<FilterCreationFunctorT>>(Constants::k_OutOfCoreInputNotSupported,
+                                                                               "Out-of-core input data is only supported by ITK filters that are executed in slabs.");
+    }
+
     if constexpr(HasIntermediateType_v<FilterCreationFunctorT>)
     {
       return executeWithCast<FilterCreationFunctorT>(inputDataStore, imageGeom, outputDataStore, shouldCancel, progressObserver, filterCreationFunctor);
@@ -894,25 +1127,33 @@ Result<OutputActions> DataCheck(const DataStructure& dataStructure, const DataPa
 template <class ArrayOptionsT, template <class> class OutputT = detail::DefaultOutput_t, class FilterCreationFunctorT>
 Result<detail::ITKFilterFunctorResult_t<FilterCreationFunctorT>> Execute(DataStructure& dataStructure, const DataPath& inputArrayPath, const DataPath& imageGeomPath, const DataPath& outputArrayPath,
                                                                          FilterCreationFunctorT&& filterCreationFunctor, const std::atomic_bool& shouldCancel,
-                                                                         const itk::ProgressObserver::Pointer progressObserver = nullptr)
+                                                                         const itk::ProgressObserver::Pointer progressObserver = nullptr, std::optional<StreamingOptions> streamingOptions = std::nullopt)
 {
   auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
   auto& inputArray = dataStructure.getDataRefAs<IDataArray>(inputArrayPath);
   auto& outputArray = dataStructure.getDataRefAs<IDataArray>(outputArrayPath);
-  auto& inputDataStore = inputArray.getIDataStoreRef();
-  auto& outputDataStore = outputArray.getIDataStoreRef();
 
   using ResultT = detail::ITKFilterFunctorResult_t<FilterCreationFunctorT>;
 
-  if(inputArray.getDataFormat() != "")
+  const StreamingOptions streaming = streamingOptions.value_or(GetStreamingOptions());
+  const bool executeInSlabs = detail::IsStreamable_v<std::decay_t<FilterCreationFunctorT>> && streaming.slabSize > 0 && streaming.slabSize < imageGeom.getDimensions()[2];
+  if(!executeInSlabs)
+  {
+    // The whole volume is wrapped in place, which requires an in-memory DataStore
+    HDF5::LoadLazyDataArray(inputArray);
+  }
+  auto& inputDataStore = inputArray.getIDataStoreRef();
+  auto& outputDataStore = outputArray.getIDataStoreRef();
+  if(inputArray.getDataFormat() != "" && !executeInSlabs)
   {
-    return MakeErrorResult(-9999, fmt::format("Input Array '{}' utilizes out-of-core data. This is not supported within ITK filters.", inputArrayPath.toString()));
+    return MakeErrorResult<ResultT>(Constants::k_OutOfCoreInputNotSupported,
+                                    fmt::format("Input Array '{}' utilizes out-of-core data. This is only supported by ITK filters that are executed in slabs.", inputArrayPath.toString()));
   }
 
   try
   {
     return ArraySwitchFunc<detail::ITKFilterFunctor, ArrayOptionsT, ResultT, OutputT>(inputDataStore, imageGeom, -1, inputDataStore, imageGeom, outputDataStore, shouldCancel, progressObserver,
-                                                                                      filterCreationFunctor);
+                                                                                      filterCreationFunctor, streaming);
   } catch(const itk::ExceptionObject& exception)
   {
     return MakeErrorResult<ResultT>(-222, exception.GetDescription());
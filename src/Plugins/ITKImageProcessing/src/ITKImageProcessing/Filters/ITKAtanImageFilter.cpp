@@ -22,6 +22,11 @@ using ArrayOptionsType = ITK::ScalarPixelIdTypeList;
 
 struct ITKAtanImageFunctor
 {
+  usize getStreamingRadius() const
+  {
+    return 0;
+  }
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
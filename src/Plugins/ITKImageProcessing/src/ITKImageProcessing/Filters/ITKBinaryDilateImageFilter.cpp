@@ -31,6 +31,11 @@ struct ITKBinaryDilateImageFunctor
   float64 foregroundValue = 1.0;
   bool boundaryToForeground = false;
 
+  usize getStreamingRadius() const
+  {
+    return kernelRadius[2];
+  }
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
@@ -31,6 +31,11 @@ struct ITKBinaryErodeImageFunctor
   float64 foregroundValue = 1.0;
   bool boundaryToForeground = true;
 
+  usize getStreamingRadius() const
+  {
+    return kernelRadius[2];
+  }
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
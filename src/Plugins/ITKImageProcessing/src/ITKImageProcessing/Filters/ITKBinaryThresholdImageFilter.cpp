@@ -29,6 +29,11 @@ struct ITKBinaryThresholdImageFunctor
   uint8 insideValue = 1u;
   uint8 outsideValue = 0u;
 
+  usize getStreamingRadius() const
+  {
+    return 0;
+  }
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
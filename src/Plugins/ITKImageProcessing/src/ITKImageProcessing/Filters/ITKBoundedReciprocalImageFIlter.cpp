@@ -20,6 +20,11 @@ using FilterOutputType = double;
 
 struct ITKBoundedReciprocalImageFilterFunctor
 {
+  usize getStreamingRadius() const
+  {
+    return 0;
+  }
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
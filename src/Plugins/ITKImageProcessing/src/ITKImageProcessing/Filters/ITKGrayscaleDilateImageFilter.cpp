@@ -26,6 +26,11 @@ struct ITKGrayscaleDilateImageFunctor
   std::vector<uint32> kernelRadius = {1, 1, 1};
   itk::simple::KernelEnum kernelType = itk::simple::sitkBall;
 
+  usize getStreamingRadius() const
+  {
+    return kernelRadius[2];
+  }
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
@@ -4,6 +4,7 @@
 #include "simplnx/DataStructure/DataPath.hpp"
 #include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/DataStructure/IO/HDF5/LazyDataStore.hpp"
 #include "simplnx/Parameters/ArraySelectionParameter.hpp"
 #include "simplnx/Parameters/ChoicesParameter.hpp"
 #include "simplnx/Parameters/DataGroupSelectionParameter.hpp"
@@ -355,7 +356,8 @@ Result<> ITKImageWriterFilter::executeImpl(DataStructure& dataStructure, const A
   auto imageArrayPath = filterArgs.value<DataPath>(k_ImageArrayPath_Key);
   auto imageGeomPath = filterArgs.value<DataPath>(k_ImageGeomPath_Key);
 
-  const IDataArray* inputArray = dataStructure.getDataAs<IDataArray>(imageArrayPath);
+  auto* inputArray = dataStructure.getDataAs<IDataArray>(imageArrayPath);
+  HDF5::LoadLazyDataArray(*inputArray);
   if(inputArray->getDataFormat() != "")
   {
     return MakeErrorResult(-9999, fmt::format("Input Array '{}' utilizes out-of-core data. This is not supported within ITK filters.", imageArrayPath.toString()));
@@ -17,13 +17,16 @@
 #include "simplnx/Parameters/NumberParameter.hpp"
 #include "simplnx/Parameters/VectorParameter.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include <itkImageFileReader.h>
 #include <itkImageIOBase.h>
 
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
+#include <atomic>
 #include <filesystem>
+#include <mutex>
 
 namespace fs = std::filesystem;
 
@@ -140,188 +143,243 @@ void FlipAboutXAxis(DataArray<T>& dataArray, Vec3<usize>& dims)
 
 namespace cxITKImportImageStackFilter
 {
+/**
+ * @brief Reads, resamples, converts and flips one slice of the stack and copies it into
+ * its z offset of the output store. Every call works in its own DataStructure, so
+ * slices can be read concurrently.
+ */
 template <class T>
-Result<> ReadImageStack(DataStructure& dataStructure, const DataPath& imageGeomPath, const std::string& cellDataName, const std::string& imageArrayName, const std::vector<std::string>& files,
-                        ChoicesParameter::ValueType transformType, bool convertToGrayscale, const VectorFloat32Parameter::ValueType& luminosityValues, ChoicesParameter::ValueType resample,
-                        float32 scalingFactor, const VectorUInt64Parameter::ValueType& exactDims, bool changeDataType, ChoicesParameter::ValueType destType,
-                        const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel)
+Result<> ReadImageSlice(const DataPath& imageGeomPath, const std::string& cellDataName, const std::string& imageArrayName, const std::string& filePath, usize slice, const SizeVec3& dims,
+                        AbstractDataStore<T>& outputDataStore, const IFilter* grayScaleFilter, const IFilter* resampleImageGeomFilter, ChoicesParameter::ValueType transformType,
+                        bool convertToGrayscale, const VectorFloat32Parameter::ValueType& luminosityValues, ChoicesParameter::ValueType resample, float32 scalingFactor,
+                        const VectorUInt64Parameter::ValueType& exactDims, bool changeDataType, ChoicesParameter::ValueType destType)
 {
-  auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
   DataPath imageDataPath = imageGeomPath.createChildPath(cellDataName).createChildPath(imageArrayName);
-  SizeVec3 dims = imageGeom.getDimensions();
   const usize tuplesPerSlice = dims[0] * dims[1];
-
-  auto& outputData = dataStructure.getDataRefAs<DataArray<T>>(imageDataPath);
-  auto& outputDataStore = outputData.getDataStoreRef();
-
-  // Variables for the progress Reporting
-  usize slice = 0;
-
-  auto* filterListPtr = Application::Instance()->getFilterList();
-
-  if((convertToGrayscale || resample != k_NoResampleModeIndex) && !filterListPtr->containsPlugin(k_SimplnxCorePluginId))
-  {
-    return MakeErrorResult(-18542, "SimplnxCore was not instantiated in this instance, so color to grayscale is not a valid option.");
-  }
-  auto grayScaleFilter = filterListPtr->createFilter(k_ColorToGrayScaleFilterHandle);
-  auto resampleImageGeomFilter = filterListPtr->createFilter(k_ResampleImageGeomFilterHandle);
+  SizeVec3 sliceDims = dims;
   Result<> outputResult = {};
 
-  // Loop over all the files importing them one by one and copying the data into the data array
-  for(const auto& filePath : files)
+  DataStructure importedDataStructure;
   {
-    messageHandler(IFilter::Message::Type::Info, fmt::format("Importing: {}", filePath));
-
-    DataStructure importedDataStructure;
+    // Create a sub-filter to read each image, although for preflight we are going to read the first image in the
+    // list and hope the rest are correct.
+    const ITKImageReaderFilter imageReader;
+
+    Arguments args;
+    args.insertOrAssign(ITKImageReaderFilter::k_ImageGeometryPath_Key, std::make_any<DataPath>(imageGeomPath));
+    args.insertOrAssign(ITKImageReaderFilter::k_CellDataName_Key, std::make_any<std::string>(cellDataName));
+    args.insertOrAssign(ITKImageReaderFilter::k_ImageDataArrayPath_Key, std::make_any<std::string>(imageArrayName));
+    args.insertOrAssign(ITKImageReaderFilter::k_FileName_Key, std::make_any<fs::path>(filePath));
+    args.insertOrAssign(ITKImageReaderFilter::k_ChangeDataType_Key, std::make_any<bool>(changeDataType));
+    args.insertOrAssign(ITKImageReaderFilter::k_ImageDataType_Key, std::make_any<ChoicesParameter::ValueType>(destType));
+
+    auto executeResult = imageReader.execute(importedDataStructure, args);
+    if(executeResult.result.invalid())
     {
-      // Create a sub-filter to read each image, although for preflight we are going to read the first image in the
-      // list and hope the rest are correct.
-      const ITKImageReaderFilter imageReader;
-
-      Arguments args;
-      args.insertOrAssign(ITKImageReaderFilter::k_ImageGeometryPath_Key, std::make_any<DataPath>(imageGeomPath));
-      args.insertOrAssign(ITKImageReaderFilter::k_CellDataName_Key, std::make_any<std::string>(cellDataName));
-      args.insertOrAssign(ITKImageReaderFilter::k_ImageDataArrayPath_Key, std::make_any<std::string>(imageArrayName));
-      args.insertOrAssign(ITKImageReaderFilter::k_FileName_Key, std::make_any<fs::path>(filePath));
-      args.insertOrAssign(ITKImageReaderFilter::k_ChangeDataType_Key, std::make_any<bool>(changeDataType));
-      args.insertOrAssign(ITKImageReaderFilter::k_ImageDataType_Key, std::make_any<ChoicesParameter::ValueType>(destType));
-
-      auto executeResult = imageReader.execute(importedDataStructure, args);
-      if(executeResult.result.invalid())
-      {
-        return executeResult.result;
-      }
+      return executeResult.result;
     }
+  }
 
-    // ======================= Resample Image Geometry Section ===================
-    switch(resample)
+  // ======================= Resample Image Geometry Section ===================
+  switch(resample)
+  {
+  case k_NoResampleModeIndex: {
+    break;
+  }
+  case k_ScalingModeIndex: {
+    if(scalingFactor == 100.0f)
     {
-    case k_NoResampleModeIndex: {
       break;
     }
-    case k_ScalingModeIndex: {
-      if(scalingFactor == 100.0f)
-      {
-        break;
-      }
 
-      Arguments resampleImageGeomArgs;
-      resampleImageGeomArgs.insertOrAssign("input_image_geometry_path", std::make_any<DataPath>(imageGeomPath));
-      resampleImageGeomArgs.insertOrAssign("remove_original_geometry", std::make_any<bool>(true));
+    Arguments resampleImageGeomArgs;
+    resampleImageGeomArgs.insertOrAssign("input_image_geometry_path", std::make_any<DataPath>(imageGeomPath));
+    resampleImageGeomArgs.insertOrAssign("remove_original_geometry", std::make_any<bool>(true));
 
-      resampleImageGeomArgs.insertOrAssign("resampling_mode_index", std::make_any<ChoicesParameter::ValueType>(1));
-      resampleImageGeomArgs.insertOrAssign("scaling", std::make_any<VectorFloat32Parameter::ValueType>(std::vector<float32>{scalingFactor, scalingFactor, 100.0f}));
+    resampleImageGeomArgs.insertOrAssign("resampling_mode_index", std::make_any<ChoicesParameter::ValueType>(1));
+    resampleImageGeomArgs.insertOrAssign("scaling", std::make_any<VectorFloat32Parameter::ValueType>(std::vector<float32>{scalingFactor, scalingFactor, 100.0f}));
 
-      // Run resample image geometry filter and process results and messages
-      auto result = resampleImageGeomFilter->execute(importedDataStructure, resampleImageGeomArgs).result;
-      if(result.invalid())
-      {
-        return result;
-      }
-      break;
+    // Run resample image geometry filter and process results and messages
+    auto result = resampleImageGeomFilter->execute(importedDataStructure, resampleImageGeomArgs).result;
+    if(result.invalid())
+    {
+      return result;
     }
-    case k_ExactDimensionsModeIndex: {
-      Arguments resampleImageGeomArgs;
-      resampleImageGeomArgs.insertOrAssign("input_image_geometry_path", std::make_any<DataPath>(imageGeomPath));
-      resampleImageGeomArgs.insertOrAssign("remove_original_geometry", std::make_any<bool>(true));
+    break;
+  }
+  case k_ExactDimensionsModeIndex: {
+    Arguments resampleImageGeomArgs;
+    resampleImageGeomArgs.insertOrAssign("input_image_geometry_path", std::make_any<DataPath>(imageGeomPath));
+    resampleImageGeomArgs.insertOrAssign("remove_original_geometry", std::make_any<bool>(true));
 
-      resampleImageGeomArgs.insertOrAssign("resampling_mode_index", std::make_any<ChoicesParameter::ValueType>(2));
-      resampleImageGeomArgs.insertOrAssign("exact_dimensions", std::make_any<VectorUInt64Parameter::ValueType>(std::vector<uint64>{exactDims[0], exactDims[1], 1}));
+    resampleImageGeomArgs.insertOrAssign("resampling_mode_index", std::make_any<ChoicesParameter::ValueType>(2));
+    resampleImageGeomArgs.insertOrAssign("exact_dimensions", std::make_any<VectorUInt64Parameter::ValueType>(std::vector<uint64>{exactDims[0], exactDims[1], 1}));
 
-      // Run resample image geometry filter and process results and messages
-      auto result = resampleImageGeomFilter->execute(importedDataStructure, resampleImageGeomArgs).result;
-      if(result.invalid())
-      {
-        return result;
-      }
-      break;
+    // Run resample image geometry filter and process results and messages
+    auto result = resampleImageGeomFilter->execute(importedDataStructure, resampleImageGeomArgs).result;
+    if(result.invalid())
+    {
+      return result;
     }
-    default: {
-      break;
+    break;
+  }
+  default: {
+    break;
+  }
+  }
+
+  // ======================= Convert to GrayScale Section ===================
+  bool validInputForGrayScaleConversion = importedDataStructure.getDataRefAs<IDataArray>(imageDataPath).getDataType() == DataType::uint8;
+  if(convertToGrayscale && validInputForGrayScaleConversion && nullptr != grayScaleFilter)
+  {
+    // This same filter was used to preflight so as long as nothing changes on disk this really should work....
+    Arguments colorToGrayscaleArgs;
+    colorToGrayscaleArgs.insertOrAssign("conversion_algorithm", std::make_any<ChoicesParameter::ValueType>(0));
+    colorToGrayscaleArgs.insertOrAssign("color_weights", std::make_any<VectorFloat32Parameter::ValueType>(luminosityValues));
+    colorToGrayscaleArgs.insertOrAssign("input_data_array_paths", std::make_any<std::vector<DataPath>>(std::vector<DataPath>{imageDataPath}));
+    colorToGrayscaleArgs.insertOrAssign("output_array_prefix", std::make_any<std::string>("gray"));
+
+    // Run grayscale filter and process results and messages
+    auto result = grayScaleFilter->execute(importedDataStructure, colorToGrayscaleArgs).result;
+    if(result.invalid())
+    {
+      return result;
     }
+
+    // deletion of non-grayscale array
+    DataObject::IdType id;
+    { // scoped for safety since this reference will be nonexistent in a moment
+      auto& oldArray = importedDataStructure.getDataRefAs<IDataArray>(imageDataPath);
+      id = oldArray.getId();
     }
+    importedDataStructure.removeData(id);
 
-    // ======================= Convert to GrayScale Section ===================
-    bool validInputForGrayScaleConversion = importedDataStructure.getDataRefAs<IDataArray>(imageDataPath).getDataType() == DataType::uint8;
-    if(convertToGrayscale && validInputForGrayScaleConversion && nullptr != grayScaleFilter.get())
+    // rename grayscale array to reflect original
     {
-      // This same filter was used to preflight so as long as nothing changes on disk this really should work....
-      Arguments colorToGrayscaleArgs;
-      colorToGrayscaleArgs.insertOrAssign("conversion_algorithm", std::make_any<ChoicesParameter::ValueType>(0));
-      colorToGrayscaleArgs.insertOrAssign("color_weights", std::make_any<VectorFloat32Parameter::ValueType>(luminosityValues));
-      colorToGrayscaleArgs.insertOrAssign("input_data_array_paths", std::make_any<std::vector<DataPath>>(std::vector<DataPath>{imageDataPath}));
-      colorToGrayscaleArgs.insertOrAssign("output_array_prefix", std::make_any<std::string>("gray"));
-
-      // Run grayscale filter and process results and messages
-      auto result = grayScaleFilter->execute(importedDataStructure, colorToGrayscaleArgs).result;
-      if(result.invalid())
+      auto& gray = importedDataStructure.getDataRefAs<IDataArray>(imageDataPath.replaceName("gray" + imageDataPath.getTargetName()));
+      if(!gray.canRename(imageDataPath.getTargetName()))
       {
-        return result;
+        return MakeErrorResult(-64543, fmt::format("Unable to rename the internal grayscale array to {}", imageDataPath.getTargetName()));
       }
+      gray.rename(imageDataPath.getTargetName());
+    }
+  }
+  else if(convertToGrayscale && !validInputForGrayScaleConversion)
+  {
+    outputResult.warnings().emplace_back(Warning{
+        -74320, fmt::format("The array ({}) resulting from reading the input image file is not a UInt8Array. The input image will not be converted to grayscale.", imageDataPath.getTargetName())});
+  }
 
-      // deletion of non-grayscale array
-      DataObject::IdType id;
-      { // scoped for safety since this reference will be nonexistent in a moment
-        auto& oldArray = importedDataStructure.getDataRefAs<IDataArray>(imageDataPath);
-        id = oldArray.getId();
-      }
-      importedDataStructure.removeData(id);
+  // Check the ImageGeometry of the imported Image matches the destination
+  const auto& importedImageGeom = importedDataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
+  SizeVec3 importedDims = importedImageGeom.getDimensions();
+  if(dims[0] != importedDims[0] || dims[1] != importedDims[1])
+  {
+    return MakeErrorResult(-64510, fmt::format("Image dimensions are different than expected dimensions.\n  Expected Slice Dims are:  {} x {}\n  Received Slice Dims are: {} x {}\n", dims[0], dims[1],
+                                               importedDims[0], importedDims[1]));
+  }
 
-      // rename grayscale array to reflect original
-      {
-        auto& gray = importedDataStructure.getDataRefAs<IDataArray>(imageDataPath.replaceName("gray" + imageDataPath.getTargetName()));
-        if(!gray.canRename(imageDataPath.getTargetName()))
-        {
-          return MakeErrorResult(-64543, fmt::format("Unable to rename the internal grayscale array to {}", imageDataPath.getTargetName()));
-        }
-        gray.rename(imageDataPath.getTargetName());
-      }
-    }
-    else if(convertToGrayscale && !validInputForGrayScaleConversion)
-    {
-      outputResult.warnings().emplace_back(Warning{
-          -74320, fmt::format("The array ({}) resulting from reading the input image file is not a UInt8Array. The input image will not be converted to grayscale.", imageDataPath.getTargetName())});
-    }
+  // Compute the Tuple Index we are at:
+  const usize tupleIndex = (slice * dims[0] * dims[1]);
 
-    // Check the ImageGeometry of the imported Image matches the destination
-    const auto& importedImageGeom = importedDataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
-    SizeVec3 importedDims = importedImageGeom.getDimensions();
-    if(dims[0] != importedDims[0] || dims[1] != importedDims[1])
-    {
-      return MakeErrorResult(-64510, fmt::format("Slice {} image dimensions are different than expected dimensions.\n  Expected Slice Dims are:  {} x {}\n  Received Slice Dims are: {} x {}\n", slice,
-                                                 dims[0], dims[1], importedDims[0], importedDims[1]));
-    }
+  // get the current Slice data...
+  auto& tempData = importedDataStructure.getDataRefAs<DataArray<T>>(imageDataPath);
+  auto& tempDataStore = tempData.getDataStoreRef();
 
-    // Compute the Tuple Index we are at:
-    const usize tupleIndex = (slice * dims[0] * dims[1]);
+  if(transformType == k_FlipAboutYAxis)
+  {
+    FlipAboutYAxis<T>(tempData, sliceDims);
+  }
+  else if(transformType == k_FlipAboutXAxis)
+  {
+    FlipAboutXAxis<T>(tempData, sliceDims);
+  }
 
-    // get the current Slice data...
-    auto& tempData = importedDataStructure.getDataRefAs<DataArray<T>>(imageDataPath);
-    auto& tempDataStore = tempData.getDataStoreRef();
+  // Copy that into the output array...
+  auto result = outputDataStore.copyFrom(tupleIndex, tempDataStore, 0, tuplesPerSlice);
+  if(result.invalid())
+  {
+    return result;
+  }
 
-    if(transformType == k_FlipAboutYAxis)
-    {
-      FlipAboutYAxis<T>(tempData, dims);
-    }
-    else if(transformType == k_FlipAboutXAxis)
-    {
-      FlipAboutXAxis<T>(tempData, dims);
-    }
+  return outputResult;
+}
 
-    // Copy that into the output array...
-    auto result = outputDataStore.copyFrom(tupleIndex, tempDataStore, 0, tuplesPerSlice);
-    if(result.invalid())
+template <class T>
+Result<> ReadImageStack(DataStructure& dataStructure, const DataPath& imageGeomPath, const std::string& cellDataName, const std::string& imageArrayName, const std::vector<std::string>& files,
+                        ChoicesParameter::ValueType transformType, bool convertToGrayscale, const VectorFloat32Parameter::ValueType& luminosityValues, ChoicesParameter::ValueType resample,
+                        float32 scalingFactor, const VectorUInt64Parameter::ValueType& exactDims, bool changeDataType, ChoicesParameter::ValueType destType,
+                        const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel)
+{
+  auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
+  DataPath imageDataPath = imageGeomPath.createChildPath(cellDataName).createChildPath(imageArrayName);
+  SizeVec3 dims = imageGeom.getDimensions();
+
+  auto& outputData = dataStructure.getDataRefAs<DataArray<T>>(imageDataPath);
+  auto& outputDataStore = outputData.getDataStoreRef();
+
+  auto* filterListPtr = Application::Instance()->getFilterList();
+
+  if((convertToGrayscale || resample != k_NoResampleModeIndex) && !filterListPtr->containsPlugin(k_SimplnxCorePluginId))
+  {
+    return MakeErrorResult(-18542, "SimplnxCore was not instantiated in this instance, so color to grayscale is not a valid option.");
+  }
+
+  // Each slice is decoded and transformed by a worker and written straight into its z offset
+  // of the output array. The workers only hold one slice each, so the memory used is bounded
+  // by the number of threads. Slices are read one at a time when the output is not in memory.
+  // Every result is kept per slice and only slices above the lowest failure seen so far are
+  // skipped, so the error reported is always the one of the lowest failing slice no matter
+  // how the ranges were scheduled.
+  std::vector<Result<>> sliceResults(files.size());
+  std::atomic<usize> firstFailedSlice = files.size();
+  std::mutex messageMutex;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, files.size());
+  dataAlg.requireStoresInMemory({&outputDataStore});
+  dataAlg.execute([&](const Range& range) {
+    auto grayScaleFilter = filterListPtr->createFilter(k_ColorToGrayScaleFilterHandle);
+    auto resampleImageGeomFilter = filterListPtr->createFilter(k_ResampleImageGeomFilterHandle);
+    for(usize slice = range.min(); slice < range.max(); slice++)
     {
-      return result;
+      if(shouldCancel || slice > firstFailedSlice)
+      {
+        return;
+      }
+      {
+        std::lock_guard<std::mutex> lock(messageMutex);
+        messageHandler(IFilter::Message::Type::Info, fmt::format("Importing: {}", files[slice]));
+      }
+      sliceResults[slice] = ReadImageSlice<T>(imageGeomPath, cellDataName, imageArrayName, files[slice], slice, dims, outputDataStore, grayScaleFilter.get(), resampleImageGeomFilter.get(),
+                                              transformType, convertToGrayscale, luminosityValues, resample, scalingFactor, exactDims, changeDataType, destType);
+      if(sliceResults[slice].invalid())
+      {
+        usize lowestSlice = firstFailedSlice;
+        while(slice < lowestSlice && !firstFailedSlice.compare_exchange_weak(lowestSlice, slice))
+        {
+        }
+        return;
+      }
     }
+  });
 
-    slice++;
-
-    // Check to see if the filter got canceled.
-    if(shouldCancel)
+  if(firstFailedSlice < files.size())
+  {
+    Result<> failedResult = std::move(sliceResults[firstFailedSlice]);
+    // ReadImageSlice leaves the slice out of its messages so it is only named once here
+    for(auto& error : failedResult.errors())
     {
-      return outputResult;
+      error.message = fmt::format("Slice {} ({}): {}", firstFailedSlice.load(), files[firstFailedSlice], error.message);
     }
+    return failedResult;
+  }
+
+  // Report the warnings of the slices in stack order
+  Result<> outputResult = {};
+  for(auto& sliceResult : sliceResults)
+  {
+    outputResult.warnings().insert(outputResult.warnings().end(), sliceResult.warnings().begin(), sliceResult.warnings().end());
   }
 
   return outputResult;
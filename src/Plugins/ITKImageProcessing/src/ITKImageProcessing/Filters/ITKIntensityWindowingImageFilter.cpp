@@ -27,6 +27,11 @@ struct ITKIntensityWindowingImageFunctor
   float64 outputMinimum = 0.0;
   float64 outputMaximum = 255.0;
 
+  usize getStreamingRadius() const
+  {
+    return 0;
+  }
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
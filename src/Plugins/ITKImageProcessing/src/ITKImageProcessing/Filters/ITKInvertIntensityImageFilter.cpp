@@ -25,6 +25,11 @@ struct ITKInvertIntensityImageFunctor
 {
   float64 maximum = 255;
 
+  usize getStreamingRadius() const
+  {
+    return 0;
+  }
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
@@ -212,6 +212,7 @@ Result<> ITKMaskImageFilter::executeImpl(DataStructure& dataStructure, const Arg
 
   ImageGeom& imageGeom = dataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
   IDataArray& maskArray = dataStructure.getDataRefAs<IDataArray>(maskArrayPath);
+  HDF5::LoadLazyDataArray(maskArray);
   IDataStore& maskStore = maskArray.getIDataStoreRef();
 
   cxITKMaskImageFilter::ITKMaskImageFilterFunctor itkFunctor = {outsideValue, imageGeom, maskStore};
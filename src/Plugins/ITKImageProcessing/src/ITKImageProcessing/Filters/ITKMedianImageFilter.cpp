@@ -26,6 +26,11 @@ struct ITKMedianImageFunctor
   using RadiusInputRadiusType = std::vector<uint32>;
   RadiusInputRadiusType radius = std::vector<unsigned int>(3, 1);
 
+  usize getStreamingRadius() const
+  {
+    return radius[2];
+  }
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
@@ -27,6 +27,11 @@ struct ITKSigmoidImageFunctor
   float64 outputMaximum = 255;
   float64 outputMinimum = 0;
 
+  usize getStreamingRadius() const
+  {
+    return 0;
+  }
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
@@ -21,6 +21,11 @@ using ArrayOptionsType = ITK::ScalarPixelIdTypeList;
 
 struct ITKSqrtImageFunctor
 {
+  usize getStreamingRadius() const
+  {
+    return 0;
+  }
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
@@ -21,6 +21,11 @@ using ArrayOptionsType = ITK::ScalarPixelIdTypeList;
 
 struct ITKSquareImageFunctor
 {
+  usize getStreamingRadius() const
+  {
+    return 0;
+  }
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
@@ -26,6 +26,11 @@ struct ITKThresholdImageFunctor
   float64 upper = 1.0;
   float64 outsideValue = 0.0;
 
+  usize getStreamingRadius() const
+  {
+    return 0;
+  }
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
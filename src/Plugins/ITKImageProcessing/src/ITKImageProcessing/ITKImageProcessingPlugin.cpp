@@ -1,5 +1,6 @@
 #include "ITKImageProcessingPlugin.hpp"
 
+#include "ITKImageProcessing/Common/ITKArrayHelper.hpp"
 #include "ITKImageProcessing/ITKImageProcessing_filter_registration.hpp"
 #include "ITKImageProcessingLegacyUUIDMapping.hpp"
 
@@ -34,6 +35,8 @@ ITKImageProcessingPlugin::ITKImageProcessingPlugin()
   {
     addFilter(filterFunc);
   }
+  // Filters that support it process the volume in Z slabs of this many slices. 0 disables streaming.
+  addDefaultValue(ITK::Constants::k_StreamingSlabSize_Key, 0);
   RegisterITKImageIO();
 }
 
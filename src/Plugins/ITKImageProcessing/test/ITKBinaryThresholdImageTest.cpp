@@ -1,10 +1,13 @@
 #include <catch2/catch.hpp>
 
+#include "ITKImageProcessing/Common/ITKArrayHelper.hpp"
 #include "ITKImageProcessing/Common/sitkCommon.hpp"
 #include "ITKImageProcessing/Filters/ITKBinaryThresholdImageFilter.hpp"
 #include "ITKImageProcessing/ITKImageProcessing_test_dirs.hpp"
 #include "ITKTestBase.hpp"
 
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Parameters/DataObjectNameParameter.hpp"
 #include "simplnx/Parameters/NumberParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
@@ -81,3 +84,63 @@ TEST_CASE("ITKImageProcessing::ITKBinaryThresholdImageFilter(NarrowThreshold)",
   const std::string md5Hash = ITKTestBase::ComputeMd5Hash(dataStructure, cellDataPath.createChildPath(outputArrayName));
   REQUIRE(md5Hash == "fc4ce029c088096a69d033ccc5bc1ae2");
 }
+
+TEST_CASE("ITKImageProcessing::ITKBinaryThresholdImageFilter(FailedUpdate)", "[ITKImageProcessing][ITKBinaryThresholdImage][FailedUpdate]")
+{
+  DataStructure dataStructure;
+  const ITKBinaryThresholdImageFilter filter;
+
+  const DataPath inputGeometryPath({ITKTestBase::k_ImageGeometryPath});
+  const DataPath cellDataPath = inputGeometryPath.createChildPath(ITKTestBase::k_ImageCellDataName);
+  const DataPath inputDataPath = cellDataPath.createChildPath(ITKTestBase::k_InputDataName);
+  const DataObjectNameParameter::ValueType outputArrayName = ITKTestBase::k_OutputDataPath;
+
+  { // Start Image Comparison Scope
+    const fs::path inputFilePath = fs::path(unit_test::k_SourceDir.view()) / unit_test::k_DataDir.view() / "JSONFilters" / "Input/RA-Short.nrrd";
+    Result<> imageReadResult = ITKTestBase::ReadImage(dataStructure, inputFilePath, inputGeometryPath, ITKTestBase::k_ImageCellDataName, ITKTestBase::k_InputDataName);
+    SIMPLNX_RESULT_REQUIRE_VALID(imageReadResult)
+  } // End Image Comparison Scope
+
+  // ITK throws from Update() when the lower threshold is above the upper threshold
+  Arguments args;
+  args.insertOrAssign(ITKBinaryThresholdImageFilter::k_InputImageGeomPath_Key, std::make_any<DataPath>(inputGeometryPath));
+  args.insertOrAssign(ITKBinaryThresholdImageFilter::k_InputImageDataPath_Key, std::make_any<DataPath>(inputDataPath));
+  args.insertOrAssign(ITKBinaryThresholdImageFilter::k_OutputImageArrayName_Key, std::make_any<DataObjectNameParameter::ValueType>(outputArrayName));
+  args.insertOrAssign(ITKBinaryThresholdImageFilter::k_LowerThreshold_Key, std::make_any<Float64Parameter::ValueType>(100));
+  args.insertOrAssign(ITKBinaryThresholdImageFilter::k_UpperThreshold_Key, std::make_any<Float64Parameter::ValueType>(10));
+
+  const std::string inputMd5Hash = ITKTestBase::ComputeMd5Hash(dataStructure, inputDataPath);
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_INVALID(executeResult.result)
+
+  // The wrapped input is untouched and the released output store is reallocated at full size
+  REQUIRE(ITKTestBase::ComputeMd5Hash(dataStructure, inputDataPath) == inputMd5Hash);
+  const auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(inputGeometryPath);
+  const auto& inputArray = dataStructure.getDataRefAs<IDataArray>(inputDataPath);
+  const auto& outputArray = dataStructure.getDataRefAs<IDataArray>(cellDataPath.createChildPath(outputArrayName));
+  REQUIRE(inputArray.getNumberOfTuples() == imageGeom.getNumberOfCells());
+  REQUIRE(outputArray.getNumberOfTuples() == imageGeom.getNumberOfCells());
+  REQUIRE(outputArray.getIDataStoreRef().getSize() == inputArray.getIDataStoreRef().getSize());
+}
+
+TEST_CASE("ITKImageProcessing::ITKArrayHelper: Release and Restore DataStore Memory", "[ITKImageProcessing][ITKArrayHelper]")
+{
+  DataStore<uint8> dataStore({4, 3}, {2}, 7);
+  const IDataStore::ShapeType tupleShape = ITK::ReleaseDataStoreMemory(dataStore);
+  REQUIRE(tupleShape == IDataStore::ShapeType{4, 3});
+  REQUIRE(dataStore.getSize() == 0);
+  REQUIRE(dataStore.getComponentShape() == IDataStore::ShapeType{2});
+
+  ITK::RestoreDataStoreMemory(dataStore, tupleShape);
+  REQUIRE(dataStore.getTupleShape() == tupleShape);
+  REQUIRE(dataStore.getSize() == 24);
+
+  // A store that still holds its memory is left alone
+  dataStore[5] = 9;
+  ITK::RestoreDataStoreMemory(dataStore, tupleShape);
+  REQUIRE(dataStore[5] == 9);
+}
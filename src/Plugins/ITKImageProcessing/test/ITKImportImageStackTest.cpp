@@ -13,6 +13,7 @@
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
 
 #include <filesystem>
+#include <fstream>
 
 using namespace nx::core;
 using namespace nx::core::UnitTest;
@@ -645,3 +646,86 @@ TEST_CASE("ITKImageProcessing::ITKImportImageStackFilter: Resampled Exact Dims",
   const std::string md5Hash = ITKTestBase::ComputeMd5Hash(dataStructure, k_ImageDataPath);
   REQUIRE(md5Hash == "e1e892c7e11eb55a57919053eee66f22");
 }
+
+TEST_CASE("ITKImageProcessing::ITKImportImageStackFilter: Parallel Slices", "[ITKImageProcessing][ITKImportImageStackFilter]")
+{
+  auto app = Application::GetOrCreateInstance();
+  app->loadPlugins(unit_test::k_BuildDir.view());
+
+  // Six slices cycling through the three stack images so that every worker gets more than one slice
+  const fs::path stackDir = fs::path(fmt::format("{}/import_image_stack_parallel_slices", unit_test::k_BinaryTestOutputDir.view()));
+  fs::remove_all(stackDir);
+  fs::create_directories(stackDir);
+  constexpr usize k_NumSlices = 6;
+  for(usize slice = 0; slice < k_NumSlices; slice++)
+  {
+    fs::copy_file(fs::path(fmt::format("{}/slice_{}.tif", k_ImageStackDir, 11 + slice % 3)), stackDir / fmt::format("slice_{:02d}.tif", slice));
+  }
+
+  GeneratedFileListParameter::ValueType fileListInfo;
+  fileListInfo.inputPath = stackDir.string();
+  fileListInfo.startIndex = 0;
+  fileListInfo.endIndex = k_NumSlices - 1;
+  fileListInfo.incrementIndex = 1;
+  fileListInfo.fileExtension = ".tif";
+  fileListInfo.filePrefix = "slice_";
+  fileListInfo.fileSuffix = "";
+  fileListInfo.paddingDigits = 2;
+  fileListInfo.ordering = GeneratedFileListParameter::Ordering::LowToHigh;
+
+  ITKImportImageStackFilter filter;
+  DataStructure dataStructure;
+  Arguments args;
+  args.insertOrAssign(ITKImportImageStackFilter::k_InputFileListInfo_Key, std::make_any<GeneratedFileListParameter::ValueType>(fileListInfo));
+  args.insertOrAssign(ITKImportImageStackFilter::k_Origin_Key, std::make_any<std::vector<float32>>(std::vector<float32>{0.0f, 0.0f, 0.0f}));
+  args.insertOrAssign(ITKImportImageStackFilter::k_Spacing_Key, std::make_any<std::vector<float32>>(std::vector<float32>{1.0f, 1.0f, 1.0f}));
+  args.insertOrAssign(ITKImportImageStackFilter::k_ImageGeometryPath_Key, std::make_any<DataPath>(k_ImageGeomPath));
+
+  SECTION("Every slice lands at its own z offset")
+  {
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+    const auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(k_ImageGeomPath);
+    REQUIRE(imageGeom.getDimensions() == SizeVec3{524, 390, k_NumSlices});
+
+    // Slice z was read from the same image as slice z + 3 and from a different one than slice z + 1
+    const auto& imageData = dataStructure.getDataRefAs<UInt8Array>(k_ImageDataPath);
+    const usize sliceSize = 524 * 390;
+    for(usize slice = 0; slice < 3; slice++)
+    {
+      for(usize index = 0; index < sliceSize; index++)
+      {
+        REQUIRE(imageData[slice * sliceSize + index] == imageData[(slice + 3) * sliceSize + index]);
+      }
+    }
+    bool slicesDiffer = false;
+    for(usize index = 0; index < sliceSize && !slicesDiffer; index++)
+    {
+      slicesDiffer = imageData[index] != imageData[sliceSize + index];
+    }
+    REQUIRE(slicesDiffer);
+  }
+
+  SECTION("The lowest failing slice is reported")
+  {
+    // The first slice stays valid so that preflight succeeds
+    for(usize slice : {4, 2})
+    {
+      std::ofstream outFile(stackDir / fmt::format("slice_{:02d}.tif", slice), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+      outFile << "not an image";
+    }
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_INVALID(executeResult.result)
+    const std::string& message = executeResult.result.errors()[0].message;
+    REQUIRE(message.find("Slice 2 (") == 0);
+    REQUIRE(message.find("slice_02.tif") != std::string::npos);
+  }
+
+  fs::remove_all(stackDir);
+}
@@ -1,9 +1,14 @@
 #include <catch2/catch.hpp>
 
+#include "ITKImageProcessing/Common/ITKArrayHelper.hpp"
 #include "ITKImageProcessing/Filters/ITKMedianImageFilter.hpp"
 #include "ITKImageProcessing/ITKImageProcessing_test_dirs.hpp"
 #include "ITKTestBase.hpp"
 
+#include "simplnx/Core/Application.hpp"
+#include "simplnx/Core/Preferences.hpp"
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Parameters/DataObjectNameParameter.hpp"
 #include "simplnx/Parameters/VectorParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
@@ -84,3 +89,58 @@ TEST_CASE("ITKImageProcessing::ITKMedianImageFilter(by23)", "[ITKImageProcessing
   // REQUIRE(md5Hash == "03610a1cb421d145fe985478d4eb9c0a");
   REQUIRE(md5Hash == "4afeba184100773dc279a776b1ae493b");
 }
+
+TEST_CASE("ITKImageProcessing::ITKMedianImageFilter(streaming)", "[ITKImageProcessing][ITKMedianImageFilter][streaming]")
+{
+  DataStructure dataStructure;
+  ITKMedianImageFilter filter;
+
+  const DataPath inputGeometryPath({ITKTestBase::k_ImageGeometryPath});
+  const DataPath cellDataPath = inputGeometryPath.createChildPath(ITKTestBase::k_ImageCellDataName);
+  const DataPath inputDataPath = cellDataPath.createChildPath(ITKTestBase::k_InputDataName);
+  const std::string wholeOutputName = "Whole Volume";
+  const std::string slabOutputName = "Slabs";
+
+  const SizeVec3 dims = {9, 8, 11};
+  const std::vector<usize> tupleShape = {dims[2], dims[1], dims[0]};
+  auto* imageGeom = ImageGeom::Create(dataStructure, ITKTestBase::k_ImageGeometryPath);
+  imageGeom->setDimensions(dims);
+  imageGeom->setSpacing({1.0f, 1.0f, 1.0f});
+  imageGeom->setOrigin({0.0f, 0.0f, 0.0f});
+  auto* cellData = AttributeMatrix::Create(dataStructure, ITKTestBase::k_ImageCellDataName, tupleShape, imageGeom->getId());
+  imageGeom->setCellData(*cellData);
+  auto* inputArray = UnitTest::CreateTestDataArray<uint16>(dataStructure, ITKTestBase::k_InputDataName, tupleShape, {1}, cellData->getId());
+  auto& inputStore = inputArray->getDataStoreRef();
+  for(usize i = 0; i < inputStore.getSize(); i++)
+  {
+    inputStore[i] = static_cast<uint16>((i * 7919) % 1000);
+  }
+
+  auto runMedian = [&](const std::string& outputName, int64 slabSize) {
+    Application::GetOrCreateInstance()->getPreferences()->setPluginValue("ITKImageProcessing", ITK::Constants::k_StreamingSlabSize_Key, slabSize);
+
+    Arguments args;
+    args.insertOrAssign(ITKMedianImageFilter::k_InputImageGeomPath_Key, std::make_any<DataPath>(inputGeometryPath));
+    args.insertOrAssign(ITKMedianImageFilter::k_InputImageDataPath_Key, std::make_any<DataPath>(inputDataPath));
+    args.insertOrAssign(ITKMedianImageFilter::k_OutputImageArrayName_Key, std::make_any<DataObjectNameParameter::ValueType>(outputName));
+    args.insertOrAssign(ITKMedianImageFilter::k_Radius_Key, std::make_any<VectorUInt32Parameter::ValueType>(VectorUInt32Parameter::ValueType{1, 1, 2}));
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+  };
+
+  runMedian(wholeOutputName, 0);
+  runMedian(slabOutputName, 3);
+  Application::GetOrCreateInstance()->getPreferences()->setPluginValue("ITKImageProcessing", ITK::Constants::k_StreamingSlabSize_Key, 0);
+
+  const auto& wholeStore = dataStructure.getDataRefAs<UInt16Array>(cellDataPath.createChildPath(wholeOutputName)).getDataStoreRef();
+  const auto& slabStore = dataStructure.getDataRefAs<UInt16Array>(cellDataPath.createChildPath(slabOutputName)).getDataStoreRef();
+  REQUIRE(wholeStore.getSize() == slabStore.getSize());
+  for(usize i = 0; i < wholeStore.getSize(); i++)
+  {
+    REQUIRE(wholeStore[i] == slabStore[i]);
+  }
+}
@@ -6,7 +6,7 @@
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
 
-#include "EbsdLib/LaueOps/LaueOps.h"
+#include "OrientationAnalysis/utilities/MisorientationEngine.hpp"
 
 #include <iostream>
 
@@ -108,7 +108,11 @@ Result<> AlignSectionsMisorientation::findShifts(std::vector<int64_t>& xShifts,
       static_cast<int64_t>(udims[2]),
   };
 
-  std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
+  // The sampled voxel pairs of each candidate shift are evaluated as one batch. Which shifts are
+  // tried depends on the results of the previous ones, so the batches cannot be merged across shifts.
+  MisorientationEngine misorientationEngine;
+  std::vector<MisorientationEngine::Pair> pairs;
+  std::vector<float32> angles;
 
   int32_t progInt = 0;
 
@@ -164,6 +168,7 @@ Result<> AlignSectionsMisorientation::findShifts(std::vector<int64_t>& xShifts,
           int64_t idx = (dims[0] * yIdx) + xIdx;
           if(!misorients[idx] && llabs(k + oldxshift) < halfDim0 && llabs(j + oldyshift) < halfDim1)
           {
+            pairs.clear();
             for(int64_t l = 0; l < dims[1]; l = l + 4)
             {
               for(int64_t n = 0; n < dims[0]; n = n + 4)
@@ -175,20 +180,12 @@ Result<> AlignSectionsMisorientation::findShifts(std::vector<int64_t>& xShifts,
                   int64_t curposition = (slice * dims[0] * dims[1]) + ((l + j + oldyshift) * dims[0]) + (n + k + oldxshift);
                   if(!m_InputValues->useGoodVoxels || maskCompare->bothTrue(refposition, curposition))
                   {
-                    float angle = std::numeric_limits<float>::max();
-                    if(cellPhases[refposition] > 0 && cellPhases[curposition] > 0)
+                    if(cellPhases[refposition] > 0 && cellPhases[curposition] > 0 && crystalStructures[cellPhases[refposition]] == crystalStructures[cellPhases[curposition]])
                     {
-                      QuatF quat1(quats[refposition * 4], quats[refposition * 4 + 1], quats[refposition * 4 + 2], quats[refposition * 4 + 3]); // Makes a copy into voxQuat!!!!
-                      auto phase1 = static_cast<int32_t>(crystalStructures[cellPhases[refposition]]);
-                      QuatF quat2(quats[curposition * 4], quats[curposition * 4 + 1], quats[curposition * 4 + 2], quats[curposition * 4 + 3]); // Makes a copy into voxQuat!!!!
-                      auto phase2 = static_cast<int32_t>(crystalStructures[cellPhases[curposition]]);
-                      if(phase1 == phase2 && phase1 < static_cast<uint32_t>(orientationOps.size()))
-                      {
-                        OrientationF axisAngle = orientationOps[phase1]->calculateMisorientation(quat1, quat2);
-                        angle = axisAngle[3];
-                      }
+                      // Unknown crystal structures come back as MisorientationEngine::k_InvalidAngle and count as disoriented
+                      pairs.push_back({static_cast<usize>(refposition), static_cast<usize>(curposition), crystalStructures[cellPhases[refposition]]});
                     }
-                    if(angle > misorientationTolerance)
+                    else
                     {
                       disorientation++;
                     }
@@ -207,6 +204,15 @@ Result<> AlignSectionsMisorientation::findShifts(std::vector<int64_t>& xShifts,
                 }
               }
             }
+            angles.assign(pairs.size(), 0.0f);
+            misorientationEngine.computeAngles(quats.getDataStoreRef(), pairs, angles, m_ShouldCancel);
+            for(float32 angle : angles)
+            {
+              if(angle > misorientationTolerance)
+              {
+                disorientation++;
+              }
+            }
             disorientation = disorientation / count;
             xIdx = k + oldxshift + halfDim0;
             yIdx = j + oldyshift + halfDim1;
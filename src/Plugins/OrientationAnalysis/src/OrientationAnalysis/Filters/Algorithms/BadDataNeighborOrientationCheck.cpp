@@ -6,8 +6,9 @@
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 
-#include "EbsdLib/Core/Orientation.hpp"
-#include "EbsdLib/LaueOps/LaueOps.h"
+#include "OrientationAnalysis/utilities/MisorientationEngine.hpp"
+
+#include <optional>
 
 using namespace nx::core;
 
@@ -54,93 +55,64 @@ Result<> BadDataNeighborOrientationCheck::operator()()
     return MakeErrorResult(-54900, message);
   }
 
-  int64_t dims[3] = {
-      static_cast<int64_t>(udims[0]),
-      static_cast<int64_t>(udims[1]),
-      static_cast<int64_t>(udims[2]),
-  };
+  const std::array<int64, NeighborMisorientationCache::k_NumFaceNeighbors> neighborOffsets = NeighborMisorientationCache::FaceNeighborOffsets(udims);
 
-  int32_t good = 1;
-  int64_t neighbor = 0;
-  int64_t column = 0, row = 0, plane = 0;
+  // Only the voxels that start out bad are ever compared with their neighbors, so their
+  // face neighbor misorientations are computed once up front and reused by every level.
+  std::vector<usize> badVoxels;
+  for(usize i = 0; i < totalPoints; i++)
+  {
+    if(!maskCompare->isTrue(i))
+    {
+      badVoxels.push_back(i);
+    }
+  }
+  const usize numBadVoxels = badVoxels.size();
 
-  int64_t neighpoints[6] = {0, 0, 0, 0, 0, 0};
-  neighpoints[0] = static_cast<int64_t>(-dims[0] * dims[1]);
-  neighpoints[1] = static_cast<int64_t>(-dims[0]);
-  neighpoints[2] = static_cast<int64_t>(-1);
-  neighpoints[3] = static_cast<int64_t>(1);
-  neighpoints[4] = static_cast<int64_t>(dims[0]);
-  neighpoints[5] = static_cast<int64_t>(dims[0] * dims[1]);
+  m_MessageHandler({IFilter::Message::Type::Info, fmt::format("Computing neighbor misorientations of {} voxels", numBadVoxels)});
+  MisorientationEngine misorientationEngine;
+  NeighborMisorientationCache misorientationCache(misorientationEngine, udims, quats.getDataStoreRef(), cellPhases.getDataStoreRef(), crystalStructures.getDataStoreRef());
+  misorientationCache.compute(badVoxels, m_ShouldCancel);
+  if(m_ShouldCancel)
+  {
+    return {};
+  }
 
+  // A pair of voxels in different phases keeps the previous misorientation, as it always has
   float w = 10000.0f;
 
-  uint32_t phase1 = 0;
-
-  std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
-
   std::vector<int32_t> neighborCount(totalPoints, 0);
 
   int64_t progressInt = 0;
   auto start = std::chrono::steady_clock::now();
-  for(size_t i = 0; i < totalPoints; i++)
+  for(usize badIndex = 0; badIndex < numBadVoxels; badIndex++)
   {
     auto now = std::chrono::steady_clock::now();
     if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
     {
-      progressInt = static_cast<int64_t>((static_cast<float>(i) / totalPoints) * 100.0f);
+      progressInt = static_cast<int64_t>((static_cast<float>(badIndex) / numBadVoxels) * 100.0f);
       std::string ss = fmt::format("Processing Data '{}'% completed", progressInt);
       m_MessageHandler({IFilter::Message::Type::Info, ss});
       start = std::chrono::steady_clock::now();
     }
 
-    if(!maskCompare->isTrue(i))
+    const usize i = badVoxels[badIndex];
+    for(usize j = 0; j < NeighborMisorientationCache::k_NumFaceNeighbors; j++)
     {
-      column = i % dims[0];
-      row = (i / dims[0]) % dims[1];
-      plane = i / (dims[0] * dims[1]);
-      for(int32_t j = 0; j < 6; j++)
+      if(!NeighborMisorientationCache::HasFaceNeighbor(udims, i, j))
       {
-        good = 1;
-        neighbor = i + neighpoints[j];
-        if(j == 0 && plane == 0)
-        {
-          good = 0;
-        }
-        if(j == 5 && plane == (dims[2] - 1))
-        {
-          good = 0;
-        }
-        if(j == 1 && row == 0)
-        {
-          good = 0;
-        }
-        if(j == 4 && row == (dims[1] - 1))
-        {
-          good = 0;
-        }
-        if(j == 2 && column == 0)
-        {
-          good = 0;
-        }
-        if(j == 3 && column == (dims[0] - 1))
+        continue;
+      }
+      const auto neighbor = static_cast<usize>(static_cast<int64>(i) + neighborOffsets[j]);
+      if(maskCompare->isTrue(neighbor))
+      {
+        if(std::optional<float32> angle = misorientationCache.angle(i, j); angle.has_value())
         {
-          good = 0;
+          w = *angle;
         }
-        if(good == 1 && maskCompare->isTrue(neighbor))
+        if(w < misorientationTolerance)
         {
-          phase1 = crystalStructures[cellPhases[i]];
-          QuatF quat1(quats[i * 4], quats[i * 4 + 1], quats[i * 4 + 2], quats[i * 4 + 3]);
-          QuatF quat2(quats[neighbor * 4], quats[neighbor * 4 + 1], quats[neighbor * 4 + 2], quats[neighbor * 4 + 3]);
-
-          if(cellPhases[i] == cellPhases[neighbor] && cellPhases[i] > 0)
-          {
-            OrientationD axisAngle = orientationOps[phase1]->calculateMisorientation(quat1, quat2);
-            w = axisAngle[3];
-          }
-          if(w < misorientationTolerance)
-          {
-            neighborCount[i]++;
-          }
+          neighborCount[i]++;
         }
       }
     }
@@ -156,65 +128,42 @@ Result<> BadDataNeighborOrientationCheck::operator()()
     int32_t loopNumber = 0;
     while(counter > 0)
     {
+      if(m_ShouldCancel)
+      {
+        return {};
+      }
       counter = 0;
       progressInt = 0;
       start = std::chrono::steady_clock::now();
-      for(size_t i = 0; i < totalPoints; i++)
+      for(usize badIndex = 0; badIndex < numBadVoxels; badIndex++)
       {
         auto now = std::chrono::steady_clock::now();
         if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
         {
-          progressInt = static_cast<int64_t>((static_cast<float>(i) / totalPoints) * 100.0f);
+          progressInt = static_cast<int64_t>((static_cast<float>(badIndex) / numBadVoxels) * 100.0f);
           std::string ss =
               fmt::format("Level '{}' of '{}' || Processing Data ('{}') '{}'% completed", (startLevel - currentLevel) + 1, startLevel - m_InputValues->NumberOfNeighbors, loopNumber, progressInt);
           m_MessageHandler({IFilter::Message::Type::Info, ss});
           start = std::chrono::steady_clock::now();
         }
 
+        const usize i = badVoxels[badIndex];
         if(neighborCount[i] >= currentLevel && !maskCompare->isTrue(i))
         {
           maskCompare->setValue(i, true);
           counter++;
-          column = i % dims[0];
-          row = (i / dims[0]) % dims[1];
-          plane = i / (dims[0] * dims[1]);
-          for(int64_t j = 0; j < 6; j++)
+          for(usize j = 0; j < NeighborMisorientationCache::k_NumFaceNeighbors; j++)
           {
-            good = 1;
-            neighbor = i + neighpoints[j];
-            if(j == 0 && plane == 0)
-            {
-              good = 0;
-            }
-            if(j == 5 && plane == (dims[2] - 1))
-            {
-              good = 0;
-            }
-            if(j == 1 && row == 0)
-            {
-              good = 0;
-            }
-            if(j == 4 && row == (dims[1] - 1))
+            if(!NeighborMisorientationCache::HasFaceNeighbor(udims, i, j))
             {
-              good = 0;
+              continue;
             }
-            if(j == 2 && column == 0)
+            const auto neighbor = static_cast<usize>(static_cast<int64>(i) + neighborOffsets[j]);
+            if(!maskCompare->isTrue(neighbor))
             {
-              good = 0;
-            }
-            if(j == 3 && column == (dims[0] - 1))
-            {
-              good = 0;
-            }
-            if(good == 1 && !maskCompare->isTrue(neighbor))
-            {
-              QuatF quat1(quats[i * 4], quats[i * 4 + 1], quats[i * 4 + 2], quats[i * 4 + 3]);
-              QuatF quat2(quats[neighbor * 4], quats[neighbor * 4 + 1], quats[neighbor * 4 + 2], quats[neighbor * 4 + 3]);
-
-              if(cellPhases[i] == cellPhases[neighbor] && cellPhases[i] > 0)
+              if(std::optional<float32> angle = misorientationCache.angle(i, j); angle.has_value())
               {
-                OrientationD axisAngle = orientationOps[phase1]->calculateMisorientation(quat1, quat2);
-                w = axisAngle[3];
+                w = *angle;
               }
               if(w < misorientationTolerance)
               {
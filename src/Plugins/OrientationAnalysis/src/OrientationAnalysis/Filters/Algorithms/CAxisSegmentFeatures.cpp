@@ -38,8 +38,8 @@ Result<> CAxisSegmentFeatures::operator()()
   {
     try
     {
-      m_GoodVoxelsArray = InstantiateMaskCompare(m_DataStructure, m_InputValues->MaskArrayPath);
-    } catch(const std::out_of_range&)
+      m_GoodVoxelsArray = std::make_unique<PackedMaskView>(m_DataStructure.getDataRefAs<IDataArray>(m_InputValues->MaskArrayPath));
+    } catch(const std::exception&)
     {
       // This really should NOT be happening as the path was verified during preflight BUT we may be calling this from
       // somewhere else that is NOT going through the normal nx::core::IFilter API of Preflight and Execute
@@ -64,7 +64,16 @@ Result<> CAxisSegmentFeatures::operator()()
   active->fill(1);
 
   // Run the segmentation algorithm
-  execute(imageGeometry);
+  IParallelAlgorithm::AlgorithmArrays inputArrays = {m_QuatsArray, m_CellPhases};
+  if(m_InputValues->UseMask)
+  {
+    inputArrays.push_back(m_DataStructure.getDataAs<IDataArray>(m_InputValues->MaskArrayPath));
+  }
+  Result<> segmentResult = executeParallel(imageGeometry, *m_FeatureIdsArray, inputArrays);
+  if(segmentResult.invalid())
+  {
+    return segmentResult;
+  }
   // Sanity check the result.
   if(this->m_FoundFeatures < 1)
   {
@@ -86,102 +95,49 @@ Result<> CAxisSegmentFeatures::operator()()
   // would look like a smooth gradient. This is a user input parameter
   if(m_InputValues->RandomizeFeatureIds)
   {
-    randomizeFeatureIds(m_FeatureIdsArray, this->m_FoundFeatures + 1);
+    return randomizeFeatureIds(m_FeatureIdsArray, this->m_FoundFeatures + 1);
   }
 
   return {};
 }
 
 // -----------------------------------------------------------------------------
-int64 CAxisSegmentFeatures::getSeed(int32 gnum, int64 nextSeed) const
+bool CAxisSegmentFeatures::isValidVoxel(int64 point) const
 {
-  DataArray<int32>::store_type& featureIds = m_FeatureIdsArray->getDataStoreRef();
-  const usize totalPoints = featureIds.getNumberOfTuples();
-  AbstractDataStore<int32>& cellPhases = m_CellPhases->getDataStoreRef();
-
-  // start with the next voxel after the last seed
-  auto randPoint = static_cast<usize>(nextSeed);
-  int64 seed = -1;
-  while(seed == -1 && randPoint < totalPoints)
-  {
-    if(featureIds[randPoint] == 0) // If the GrainId of the voxel is ZERO then we can use this as a seed point
-    {
-      if((!m_InputValues->UseMask || m_GoodVoxelsArray->isTrue(randPoint)) && cellPhases[randPoint] > 0)
-      {
-        seed = static_cast<int64>(randPoint);
-      }
-      else
-      {
-        randPoint += 1;
-      }
-    }
-    else
-    {
-      randPoint += 1;
-    }
-  }
-  if(seed >= 0)
-  {
-    auto& cellFeatureAM = m_DataStructure.getDataRefAs<AttributeMatrix>(m_InputValues->CellFeatureAttributeMatrixPath);
-    featureIds[static_cast<usize>(seed)] = gnum;
-    const std::vector<usize> tDims = {static_cast<usize>(gnum) + 1};
-    cellFeatureAM.resizeTuples(tDims); // This will resize the active array
-  }
-  return seed;
+  return (!m_InputValues->UseMask || m_GoodVoxelsArray->isTrue(point)) && m_CellPhases->getDataStoreRef().getValue(point) > 0;
 }
 
 // -----------------------------------------------------------------------------
-bool CAxisSegmentFeatures::determineGrouping(int64 referencepoint, int64 neighborpoint, int32 gnum) const
+bool CAxisSegmentFeatures::areNeighborsSimilar(int64 referencepoint, int64 neighborpoint) const
 {
-  bool group = false;
-  float32 w = std::numeric_limits<float32>::max();
-
-  Matrix3fR g1T;
-  g1T.fill(0.0f);
-  Matrix3fR g2T;
-  g2T.fill(0.0f);
-  const Eigen::Vector3f cAxis{0.0f, 0.0f, 1.0f};
-  Eigen::Vector3f c1{0.0f, 0.0f, 0.0f};
-  Eigen::Vector3f c2{0.0f, 0.0f, 0.0f};
-  Float32Array& currentQuat = *m_QuatsArray;
-  Int32Array& featureIds = *m_FeatureIdsArray;
-  Int32Array& cellPhases = *m_CellPhases;
-  bool neighborPointIsGood = false;
-  if(m_GoodVoxelsArray != nullptr)
+  const AbstractDataStore<int32>& cellPhases = m_CellPhases->getDataStoreRef();
+  if(cellPhases.getValue(referencepoint) != cellPhases.getValue(neighborpoint))
   {
-    neighborPointIsGood = m_GoodVoxelsArray->isTrue(neighborpoint);
+    return false;
   }
-  if(featureIds[neighborpoint] == 0 && (!m_InputValues->UseMask || neighborPointIsGood))
-  {
-    const QuatF q1(currentQuat[referencepoint * 4], currentQuat[referencepoint * 4 + 1], currentQuat[referencepoint * 4 + 2], currentQuat[referencepoint * 4 + 3]);
-    const QuatF q2(currentQuat[neighborpoint * 4 + 0], currentQuat[neighborpoint * 4 + 1], currentQuat[neighborpoint * 4 + 2], currentQuat[neighborpoint * 4 + 3]);
 
-    if(cellPhases[referencepoint] == cellPhases[neighborpoint])
-    {
-      const OrientationF oMatrix1 = OrientationTransformation::qu2om<QuatF, Orientation<float32>>(q1);
-      const OrientationF oMatrix2 = OrientationTransformation::qu2om<QuatF, Orientation<float32>>(q2);
-
-      // Convert the quaternion matrices to transposed g matrices so when caxis is multiplied by it, it will give the sample direction that the caxis is along
-      g1T = OrientationMatrixToGMatrixTranspose(oMatrix1);
-      g2T = OrientationMatrixToGMatrixTranspose(oMatrix2);
-
-      c1 = g1T * cAxis;
-      c2 = g2T * cAxis;
-
-      // normalize so that the dot product can be taken below without
-      // dividing by the magnitudes (they would be 1)
-      c1.normalize();
-      c2.normalize();
-
-      // Validate value of w falls between [-1, 1] to ensure that acos returns a valid value
-      w = std::clamp(((c1[0] * c2[0]) + (c1[1] * c2[1]) + (c1[2] * c2[2])), -1.0F, 1.0F);
-      w = acosf(w);
-      if(w <= m_InputValues->MisorientationTolerance || (Constants::k_PiD - w) <= m_InputValues->MisorientationTolerance)
-      {
-        group = true;
-        featureIds[neighborpoint] = gnum;
-      }
-    }
-  }
-  return group;
+  const AbstractDataStore<float32>& currentQuat = m_QuatsArray->getDataStoreRef();
+  const QuatF q1(currentQuat.getValue(referencepoint * 4), currentQuat.getValue(referencepoint * 4 + 1), currentQuat.getValue(referencepoint * 4 + 2), currentQuat.getValue(referencepoint * 4 + 3));
+  const QuatF q2(currentQuat.getValue(neighborpoint * 4), currentQuat.getValue(neighborpoint * 4 + 1), currentQuat.getValue(neighborpoint * 4 + 2), currentQuat.getValue(neighborpoint * 4 + 3));
+
+  const OrientationF oMatrix1 = OrientationTransformation::qu2om<QuatF, Orientation<float32>>(q1);
+  const OrientationF oMatrix2 = OrientationTransformation::qu2om<QuatF, Orientation<float32>>(q2);
+
+  // Convert the quaternion matrices to transposed g matrices so when caxis is multiplied by it, it will give the sample direction that the caxis is along
+  const Matrix3fR g1T = OrientationMatrixToGMatrixTranspose(oMatrix1);
+  const Matrix3fR g2T = OrientationMatrixToGMatrixTranspose(oMatrix2);
+
+  const Eigen::Vector3f cAxis{0.0f, 0.0f, 1.0f};
+  Eigen::Vector3f c1 = g1T * cAxis;
+  Eigen::Vector3f c2 = g2T * cAxis;
+
+  // normalize so that the dot product can be taken below without
+  // dividing by the magnitudes (they would be 1)
+  c1.normalize();
+  c2.normalize();
+
+  // Validate value of w falls between [-1, 1] to ensure that acos returns a valid value
+  float32 w = std::clamp(((c1[0] * c2[0]) + (c1[1] * c2[1]) + (c1[2] * c2[2])), -1.0F, 1.0F);
+  w = acosf(w);
+  return w <= m_InputValues->MisorientationTolerance || (Constants::k_PiD - w) <= m_InputValues->MisorientationTolerance;
 }
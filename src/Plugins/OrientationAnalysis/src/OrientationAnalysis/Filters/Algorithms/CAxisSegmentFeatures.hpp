@@ -47,15 +47,15 @@ public:
   const std::atomic_bool& getCancel();
 
 protected:
-  int64 getSeed(int32 gnum, int64 nextSeed) const override;
-  bool determineGrouping(int64 referencePoint, int64 neighborPoint, int32 gnum) const override;
+  bool isValidVoxel(int64 point) const override;
+  bool areNeighborsSimilar(int64 referencePoint, int64 neighborPoint) const override;
 
 private:
   const CAxisSegmentFeaturesInputValues* m_InputValues = nullptr;
 
   Float32Array* m_QuatsArray = nullptr;
   Int32Array* m_CellPhases = nullptr;
-  std::unique_ptr<MaskCompare> m_GoodVoxelsArray = nullptr;
+  std::unique_ptr<PackedMaskView> m_GoodVoxelsArray = nullptr;
   Int32Array* m_FeatureIdsArray = nullptr;
 };
 
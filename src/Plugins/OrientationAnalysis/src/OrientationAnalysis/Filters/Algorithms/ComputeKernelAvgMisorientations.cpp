@@ -6,7 +6,7 @@
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/ParallelData3DAlgorithm.hpp"
 
-#include "EbsdLib/LaueOps/LaueOps.h"
+#include "OrientationAnalysis/utilities/MisorientationEngine.hpp"
 
 #include <chrono>
 
@@ -18,10 +18,11 @@ class FindKernelAvgMisorientationsImpl
 {
 public:
   FindKernelAvgMisorientationsImpl(ComputeKernelAvgMisorientations* filter, DataStructure& dataStructure, const ComputeKernelAvgMisorientationsInputValues* inputValues,
-                                   const std::atomic_bool& shouldCancel)
+                                   const MisorientationEngine& misorientationEngine, const std::atomic_bool& shouldCancel)
   : m_Filter(filter)
   , m_DataStructure(dataStructure)
   , m_InputValues(inputValues)
+  , m_MisorientationEngine(misorientationEngine)
   , m_ShouldCancel(shouldCancel)
   {
   }
@@ -43,8 +44,6 @@ public:
     auto& kernelAvgMisorientationsArray = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->KernelAverageMisorientationsArrayName);
     auto& kernelAvgMisorientations = kernelAvgMisorientationsArray.getDataStoreRef();
 
-    std::vector<LaueOps::Pointer> m_OrientationOps = LaueOps::GetAllOrientationOps();
-
     auto* gridGeom = m_DataStructure.getDataAs<ImageGeom>(m_InputValues->InputImageGeometry);
     SizeVec3 udims = gridGeom->getDimensions();
 
@@ -122,8 +121,8 @@ public:
                     q2[1] = quats[quatIndex + 1];
                     q2[2] = quats[quatIndex + 2];
                     q2[3] = quats[quatIndex + 3];
-                    OrientationF axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
-                    totalMisorientation = totalMisorientation + (axisAngle[3] * nx::core::Constants::k_180OverPiD);
+                    const auto angle = static_cast<float32>(m_MisorientationEngine.angle(phase1, q1, q2));
+                    totalMisorientation = totalMisorientation + (angle * nx::core::Constants::k_180OverPiD);
                     numVoxel++;
                   }
                 }
@@ -156,6 +155,7 @@ private:
   ComputeKernelAvgMisorientations* m_Filter = nullptr;
   DataStructure& m_DataStructure;
   const ComputeKernelAvgMisorientationsInputValues* m_InputValues = nullptr;
+  const MisorientationEngine& m_MisorientationEngine;
   const std::atomic_bool& m_ShouldCancel;
 };
 
@@ -216,10 +216,13 @@ Result<> ComputeKernelAvgMisorientations::operator()()
   algArrays.push_back(m_DataStructure.getDataAs<IDataArray>(m_InputValues->KernelAverageMisorientationsArrayName));
   algArrays.push_back(m_DataStructure.getDataAs<IDataArray>(m_InputValues->QuatsArrayPath));
 
+  // The symmetry operators are created once and shared by every thread
+  MisorientationEngine misorientationEngine;
+
   ParallelData3DAlgorithm parallelAlgorithm;
   parallelAlgorithm.setRange(Range3D(0, udims[0], 0, udims[1], 0, udims[2]));
   parallelAlgorithm.requireArraysInMemory(algArrays);
-  parallelAlgorithm.execute(FindKernelAvgMisorientationsImpl(this, m_DataStructure, m_InputValues, m_ShouldCancel));
+  parallelAlgorithm.execute(FindKernelAvgMisorientationsImpl(this, m_DataStructure, m_InputValues, misorientationEngine, m_ShouldCancel));
 
   return {};
 }
@@ -5,7 +5,7 @@
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/NeighborList.hpp"
 
-#include "EbsdLib/LaueOps/LaueOps.h"
+#include "OrientationAnalysis/utilities/MisorientationEngine.hpp"
 
 using namespace nx::core;
 
@@ -32,8 +32,6 @@ const std::atomic_bool& ComputeMisorientations::getCancel()
 Result<> ComputeMisorientations::operator()()
 {
 
-  std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
-
   // Input Arrays
   const auto& inFeaturePhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeaturePhasesArrayPath);
   const auto& inAvgQuats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->AvgQuatsArrayPath);
@@ -44,72 +42,73 @@ Result<> ComputeMisorientations::operator()()
   // not exist in the DataStructure. We cannot get it by reference.
   auto* avgMisorientations = m_DataStructure.getDataAs<Float32Array>(m_InputValues->AvgMisorientationsArrayName);
 
-  size_t tempMisoList = 0;
-
   size_t totalFeatures = inFeaturePhases.getNumberOfTuples();
 
-  std::vector<std::vector<float>> tempMisorientationLists(totalFeatures);
-  usize quatIndex = 0;
+  // The misorientation lists have the same shape as the neighbor lists so they are written straight into compact storage
+  NeighborList<float32>::Builder misorientationListBuilder(totalFeatures);
   for(size_t i = 1; i < totalFeatures; i++)
   {
-    quatIndex = i * 4;
-
-    QuatF q1(inAvgQuats[quatIndex], inAvgQuats[quatIndex + 1], inAvgQuats[quatIndex + 2], inAvgQuats[quatIndex + 3]);
-    uint32_t xtalType1 = inXtalStruct[inFeaturePhases[i]];
-
-    const NeighborList<int32_t>::VectorType& featureNeighborList = inNeighborList.getListReference(static_cast<int32_t>(i));
+    misorientationListBuilder.setListSize(i, inNeighborList.getListSpan(i).size());
+  }
+  misorientationListBuilder.allocate();
 
-    tempMisorientationLists[i].assign(featureNeighborList.size(), -1.0);
+  // Every feature/neighbor pair is gathered in list order so the angles can be computed in one batch.
+  // Pairs whose crystal structures differ get an invalid Laue class so the engine reports them as invalid.
+  MisorientationEngine misorientationEngine;
+  std::vector<MisorientationEngine::Pair> pairs;
+  for(size_t i = 1; i < totalFeatures; i++)
+  {
+    uint32 xtalType1 = inXtalStruct[inFeaturePhases[i]];
+    for(int32 neighborFeatureId : inNeighborList.getListSpan(i))
+    {
+      uint32 xtalType2 = inXtalStruct[inFeaturePhases[neighborFeatureId]];
+      uint32 laueClass = xtalType1 == xtalType2 ? xtalType1 : std::numeric_limits<uint32>::max();
+      pairs.push_back({i, static_cast<usize>(neighborFeatureId), laueClass});
+    }
+  }
+  std::vector<float32> angles(pairs.size(), MisorientationEngine::k_InvalidAngle);
+  misorientationEngine.computeAngles(inAvgQuats.getDataStoreRef(), pairs, angles, m_ShouldCancel);
+  if(getCancel())
+  {
+    return {};
+  }
 
-    for(size_t j = 0; j < featureNeighborList.size(); j++)
+  usize pairIndex = 0;
+  for(size_t i = 1; i < totalFeatures; i++)
+  {
+    nonstd::span<float32> misorientationList = misorientationListBuilder.getListSpan(i);
+    size_t validCount = 0;
+    for(float32& misorientation : misorientationList)
     {
-      int32_t neighborFeatureId = featureNeighborList[j];
-      quatIndex = neighborFeatureId * 4;
-      QuatF q2(inAvgQuats[quatIndex], inAvgQuats[quatIndex + 1], inAvgQuats[quatIndex + 2], inAvgQuats[quatIndex + 3]);
-      uint32_t xtalType2 = inXtalStruct[inFeaturePhases[neighborFeatureId]];
-      tempMisoList = featureNeighborList.size();
-      if(xtalType1 == xtalType2 && static_cast<int64_t>(xtalType1) < static_cast<int64_t>(orientationOps.size()))
+      float32 angle = angles[pairIndex++];
+      if(angle == MisorientationEngine::k_InvalidAngle)
       {
-        OrientationD axisAngle = orientationOps[xtalType1]->calculateMisorientation(q1, q2);
-
-        tempMisorientationLists[i][j] = static_cast<float>(axisAngle[3] * nx::core::Constants::k_180OverPiF);
-        if(m_InputValues->ComputeAvgMisors)
-        {
-          (*avgMisorientations)[i] += tempMisorientationLists[i][j];
-        }
+        misorientation = NAN;
+        continue;
       }
-      else
+      misorientation = angle * nx::core::Constants::k_180OverPiF;
+      validCount++;
+      if(m_InputValues->ComputeAvgMisors)
       {
-        if(m_InputValues->ComputeAvgMisors)
-        {
-          tempMisoList--;
-        }
-        tempMisorientationLists[i][j] = NAN;
+        (*avgMisorientations)[i] += misorientation;
       }
     }
     if(m_InputValues->ComputeAvgMisors)
     {
-      if(tempMisoList != 0)
+      if(validCount != 0)
       {
-        (*avgMisorientations)[i] /= static_cast<float>(tempMisoList);
+        (*avgMisorientations)[i] /= static_cast<float>(validCount);
       }
       else
       {
         (*avgMisorientations)[i] = NAN;
       }
-      tempMisoList = 0;
     }
   }
 
   // Output Variables
   auto& outMisorientationList = m_DataStructure.getDataRefAs<NeighborList<float32>>(m_InputValues->MisorientationListArrayName);
-  // Set the vector for each list into the NeighborList Object
-  for(size_t i = 1; i < totalFeatures; i++)
-  {
-    // Construct a shared vector<float> through the std::vector<> copy constructor.
-    NeighborList<float>::SharedVectorType sharedMisorientationList(new std::vector<float>(tempMisorientationLists[i]));
-    outMisorientationList.setList(static_cast<int32_t>(i), sharedMisorientationList);
-  }
+  misorientationListBuilder.commit(outMisorientationList);
 
   return {};
 }
@@ -29,8 +29,8 @@ Result<> EBSDSegmentFeatures::operator()()
   {
     try
     {
-      m_GoodVoxelsArray = std::move(InstantiateMaskCompare(m_DataStructure, m_InputValues->MaskArrayPath));
-    } catch(const std::out_of_range& exception)
+      m_GoodVoxelsArray = std::make_unique<PackedMaskView>(m_DataStructure.getDataRefAs<IDataArray>(m_InputValues->MaskArrayPath));
+    } catch(const std::exception& exception)
     {
       // This really should NOT be happening as the path was verified during preflight BUT we may be calling this from
       // somewhere else that is NOT going through the normal nx::core::IFilter API of Preflight and Execute
@@ -44,7 +44,16 @@ Result<> EBSDSegmentFeatures::operator()()
   m_FeatureIdsArray->fill(0); // initialize the output array with zeros
 
   // Run the segmentation algorithm
-  execute(gridGeom);
+  IParallelAlgorithm::AlgorithmArrays inputArrays = {m_QuatsArray, m_CellPhases, m_CrystalStructures};
+  if(m_InputValues->UseMask)
+  {
+    inputArrays.push_back(m_DataStructure.getDataAs<IDataArray>(m_InputValues->MaskArrayPath));
+  }
+  Result<> segmentResult = executeParallel(gridGeom, *m_FeatureIdsArray, inputArrays);
+  if(segmentResult.invalid())
+  {
+    return segmentResult;
+  }
   // Sanity check the result.
   if(this->m_FoundFeatures < 1)
   {
@@ -66,89 +75,41 @@ Result<> EBSDSegmentFeatures::operator()()
   // would look like a smooth gradient. This is a user input parameter
   if(m_InputValues->RandomizeFeatureIds)
   {
-    randomizeFeatureIds(m_FeatureIdsArray, this->m_FoundFeatures + 1);
+    return randomizeFeatureIds(m_FeatureIdsArray, this->m_FoundFeatures + 1);
   }
 
   return {};
 }
 
 // -----------------------------------------------------------------------------
-int64_t EBSDSegmentFeatures::getSeed(int32 gnum, int64 nextSeed) const
+bool EBSDSegmentFeatures::isValidVoxel(int64 point) const
 {
-  nx::core::DataArray<int32>::store_type* featureIds = m_FeatureIdsArray->getDataStore();
-  usize totalPoints = featureIds->getNumberOfTuples();
-
-  nx::core::AbstractDataStore<int32>* cellPhases = m_CellPhases->getDataStore();
-
-  int64 seed = -1;
-  // start with the next voxel after the last seed
-  auto randPoint = static_cast<usize>(nextSeed);
-  while(seed == -1 && randPoint < totalPoints)
-  {
-    if(featureIds->getValue(randPoint) == 0) // If the GrainId of the voxel is ZERO then we can use this as a seed point
-    {
-      if((!m_InputValues->UseMask || m_GoodVoxelsArray->isTrue(randPoint)) && cellPhases->getValue(randPoint) > 0)
-      {
-        seed = static_cast<int64>(randPoint);
-      }
-      else
-      {
-        randPoint += 1;
-      }
-    }
-    else
-    {
-      randPoint += 1;
-    }
-  }
-  if(seed >= 0)
-  {
-    featureIds->setValue(static_cast<usize>(seed), gnum);
-  }
-  return seed;
+  return (!m_InputValues->UseMask || m_GoodVoxelsArray->isTrue(point)) && m_CellPhases->getDataStoreRef().getValue(point) > 0;
 }
 
 // -----------------------------------------------------------------------------
-bool EBSDSegmentFeatures::determineGrouping(int64 referencePoint, int64 neighborPoint, int32 gnum) const
+bool EBSDSegmentFeatures::areNeighborsSimilar(int64 referencePoint, int64 neighborPoint) const
 {
-  bool group = false;
-
   // Get the phases for each voxel
-  nx::core::AbstractDataStore<int32>* cellPhases = m_CellPhases->getDataStore();
+  const AbstractDataStore<int32>& cellPhases = m_CellPhases->getDataStoreRef();
+  const AbstractDataStore<uint32>& crystalStructures = m_CrystalStructures->getDataStoreRef();
 
-  int32_t phase1 = (*m_CrystalStructures)[(*cellPhases)[referencePoint]];
-  int32_t phase2 = (*m_CrystalStructures)[(*cellPhases)[neighborPoint]];
+  const int32 referencePhase = cellPhases.getValue(referencePoint);
+  const uint32 phase1 = crystalStructures.getValue(referencePhase);
+  const uint32 phase2 = crystalStructures.getValue(cellPhases.getValue(neighborPoint));
   // If either of the phases is 999 then we bail out now.
   if(phase1 >= m_OrientationOps.size() || phase2 >= m_OrientationOps.size())
   {
-    return group;
-  }
-  Float32Array& currentQuatPtr = *m_QuatsArray;
-  Int32Array& featureIds = *m_FeatureIdsArray;
-
-  bool neighborPointIsGood = false;
-  if(m_GoodVoxelsArray != nullptr)
-  {
-    neighborPointIsGood = m_GoodVoxelsArray->isTrue(neighborPoint);
+    return false;
   }
-
-  if(featureIds[neighborPoint] == 0 && (m_GoodVoxelsArray == nullptr || neighborPointIsGood))
+  if(referencePhase != cellPhases.getValue(neighborPoint))
   {
-    float w = std::numeric_limits<float>::max();
-    QuatF q1(currentQuatPtr[referencePoint * 4], currentQuatPtr[referencePoint * 4 + 1], currentQuatPtr[referencePoint * 4 + 2], currentQuatPtr[referencePoint * 4 + 3]);
-    QuatF q2(currentQuatPtr[neighborPoint * 4 + 0], currentQuatPtr[neighborPoint * 4 + 1], currentQuatPtr[neighborPoint * 4 + 2], currentQuatPtr[neighborPoint * 4 + 3]);
-
-    if((*cellPhases)[referencePoint] == (*cellPhases)[neighborPoint])
-    {
-      OrientationF axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
-      w = axisAngle[3];
-    }
-    if(w < m_InputValues->MisorientationTolerance)
-    {
-      group = true;
-      featureIds[neighborPoint] = gnum;
-    }
+    return false;
   }
 
-  return group;
+  const AbstractDataStore<float32>& quats = m_QuatsArray->getDataStoreRef();
+  const QuatF q1(quats.getValue(referencePoint * 4), quats.getValue(referencePoint * 4 + 1), quats.getValue(referencePoint * 4 + 2), quats.getValue(referencePoint * 4 + 3));
+  const QuatF q2(quats.getValue(neighborPoint * 4), quats.getValue(neighborPoint * 4 + 1), quats.getValue(neighborPoint * 4 + 2), quats.getValue(neighborPoint * 4 + 3));
+  const OrientationF axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
+  return axisAngle[3] < m_InputValues->MisorientationTolerance;
 }
@@ -55,31 +55,26 @@ public:
 
 protected:
   /**
-   * @brief
-   * @param data
-   * @param args
-   * @param gnum
-   * @param nextSeed
-   * @return int64
+   * @brief Returns true if the voxel is not excluded by the mask and has a phase.
+   * @param point
+   * @return bool
    */
-  int64_t getSeed(int32 gnum, int64 nextSeed) const override;
+  bool isValidVoxel(int64 point) const override;
 
   /**
-   * @brief
-   * @param data
-   * @param args
-   * @param referencepoint
-   * @param neighborpoint
-   * @param gnum
+   * @brief Returns true if both voxels have the same phase and their
+   * misorientation is below the tolerance.
+   * @param referencePoint
+   * @param neighborPoint
    * @return bool
    */
-  bool determineGrouping(int64 referencePoint, int64 neighborPoint, int32 gnum) const override;
+  bool areNeighborsSimilar(int64 referencePoint, int64 neighborPoint) const override;
 
 private:
   const EBSDSegmentFeaturesInputValues* m_InputValues = nullptr;
   Float32Array* m_QuatsArray = nullptr;
   FeatureIdsArrayType* m_CellPhases = nullptr;
-  std::unique_ptr<MaskCompare> m_GoodVoxelsArray = nullptr;
+  std::unique_ptr<PackedMaskView> m_GoodVoxelsArray = nullptr;
   DataArray<uint32>* m_CrystalStructures = nullptr;
 
   FeatureIdsArrayType* m_FeatureIdsArray = nullptr;
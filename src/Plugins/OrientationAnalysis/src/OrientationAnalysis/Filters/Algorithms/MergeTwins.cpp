@@ -134,7 +134,7 @@ Result<> MergeTwins::operator()()
   featureParentIds[0] = 0; // set feature 0 to be parent 0
 
   { // This code used to be in GroupFeatures Superclass
-    auto& contNeighborList = m_DataStructure.getDataRefAs<NeighborList<int32>>(m_InputValues->ContiguousNeighborListArrayPath);
+    const auto& contNeighborList = m_DataStructure.getDataRefAs<NeighborList<int32>>(m_InputValues->ContiguousNeighborListArrayPath);
 
     int32 parentCount = 1;
     int32 seed = getSeed(parentCount);
@@ -145,10 +145,11 @@ Result<> MergeTwins::operator()()
       for(std::vector<int32>::size_type j = 0; j < groupList.size(); j++)
       {
         int32 firstFeature = groupList[j];
-        auto list1size = static_cast<int32>(contNeighborList[firstFeature].size());
+        nonstd::span<const int32> firstFeatureNeighbors = contNeighborList.getListSpan(firstFeature);
+        auto list1size = static_cast<int32>(firstFeatureNeighbors.size());
         for(int32 l = 0; l < list1size; l++)
         {
-          neigh = contNeighborList[firstFeature][l];
+          neigh = firstFeatureNeighbors[l];
           if(neigh != firstFeature)
           {
             if(determineGrouping(firstFeature, neigh, parentCount))
@@ -5,16 +5,17 @@
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 
+#include "OrientationAnalysis/utilities/MisorientationEngine.hpp"
+
 #ifdef SIMPLNX_ENABLE_MULTICORE
 #define RUN_TASK g->run
 #else
 #define RUN_TASK
 #endif
 
-#include "EbsdLib/LaueOps/LaueOps.h"
-
 using namespace nx::core;
 
 class NeighborOrientationCorrelationTransferDataImpl
@@ -92,15 +93,12 @@ void NeighborOrientationCorrelation::updateProgress(const std::string& progMessa
 // -----------------------------------------------------------------------------
 Result<> NeighborOrientationCorrelation::operator()()
 {
-  size_t progress = 0;
-  size_t totalProgress = 0;
-
-  std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
+  MisorientationEngine misorientationEngine;
 
-  const auto& confidenceIndex = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->ConfidenceIndexArrayPath);
-  const auto& cellPhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->CellPhasesArrayPath);
-  const auto& quats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->QuatsArrayPath);
-  const auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath);
+  const auto& confidenceIndex = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->ConfidenceIndexArrayPath).getDataStoreRef();
+  const auto& cellPhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->CellPhasesArrayPath).getDataStoreRef();
+  const auto& quats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->QuatsArrayPath).getDataStoreRef();
+  const auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath).getDataStoreRef();
   size_t totalPoints = confidenceIndex.getNumberOfTuples();
 
   float misorientationToleranceR = m_InputValues->MisorientationTolerance * numbers::pi_v<float> / 180.0f;
@@ -108,35 +106,12 @@ Result<> NeighborOrientationCorrelation::operator()()
   auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->ImageGeomPath);
   SizeVec3 udims = imageGeom.getDimensions();
 
-  int64_t dims[3] = {
-      static_cast<int64_t>(udims[0]),
-      static_cast<int64_t>(udims[1]),
-      static_cast<int64_t>(udims[2]),
-  };
+  const std::array<int64, NeighborMisorientationCache::k_NumFaceNeighbors> neighpoints = NeighborMisorientationCache::FaceNeighborOffsets(udims);
 
-  size_t count = 1;
-  int32_t best = 0;
-  bool good = true;
-  bool good2 = true;
-  int64_t neighbor = 0;
-  int64_t neighbor2 = 0;
-  int64_t column = 0, row = 0, plane = 0;
+  auto readQuat = [&quats](usize index) { return QuatF(quats[index * 4], quats[index * 4 + 1], quats[index * 4 + 2], quats[index * 4 + 3]); };
 
-  int64_t neighpoints[6] = {0, 0, 0, 0, 0, 0};
-  neighpoints[0] = static_cast<int64_t>(-dims[0] * dims[1]);
-  neighpoints[1] = static_cast<int64_t>(-dims[0]);
-  neighpoints[2] = static_cast<int64_t>(-1);
-  neighpoints[3] = static_cast<int64_t>(1);
-  neighpoints[4] = static_cast<int64_t>(dims[0]);
-  neighpoints[5] = static_cast<int64_t>(dims[0] * dims[1]);
-
-  uint32_t phase1 = 0;
-
-  std::vector<int32_t> neighborDiffCount(totalPoints, 0);
-  std::vector<int32_t> neighborSimCount(6, 0);
   std::vector<int64_t> bestNeighbor(totalPoints, -1);
   const int32_t startLevel = 6;
-  float* currentQuatPtr = nullptr;
 
   for(int32_t currentLevel = startLevel; currentLevel > m_InputValues->Level; currentLevel--)
   {
@@ -145,155 +120,71 @@ Result<> NeighborOrientationCorrelation::operator()()
       break;
     }
 
-    int64_t progressInt = 0;
-    auto start = std::chrono::steady_clock::now();
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      auto now = std::chrono::steady_clock::now();
-      if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+    m_MessageHandler({IFilter::Message::Type::Info, fmt::format("Level '{}' of '{}' || Processing Data", (startLevel - currentLevel) + 1, startLevel - m_InputValues->Level)});
+
+    // Every low confidence voxel only reads the orientations of its neighbors, which do not
+    // change until the data is transferred at the end of the level, so the voxels are independent.
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, totalPoints);
+    dataAlg.requireStoresInMemory({&confidenceIndex, &cellPhases, &quats});
+    dataAlg.execute([&](const Range& range) {
+      std::array<int32, NeighborMisorientationCache::k_NumFaceNeighbors> neighborSimCount = {0, 0, 0, 0, 0, 0};
+      std::array<bool, NeighborMisorientationCache::k_NumFaceNeighbors> hasNeighbor = {};
+      for(usize i = range.min(); i < range.max(); i++)
       {
-        progressInt = static_cast<int64_t>((static_cast<float>(i) / totalPoints) * 100.0f);
-        std::string ss = fmt::format("Level '{}' of '{}' || Processing Data '{}'% completed", (startLevel - currentLevel) + 1, startLevel - m_InputValues->Level, progressInt);
-        m_MessageHandler({IFilter::Message::Type::Info, ss});
-        start = std::chrono::steady_clock::now();
-      }
-
-      if(confidenceIndex[i] < m_InputValues->MinConfidence)
-      {
-        count = 0;
-        column = static_cast<int64_t>(i % dims[0]);
-        row = (i / dims[0]) % dims[1];
-        plane = i / (dims[0] * dims[1]);
-        for(size_t j = 0; j < 6; j++)
+        if(getCancel())
         {
-          good = true;
-          neighbor = int64_t(i) + neighpoints[j];
-          if(j == 0 && plane == 0)
-          {
-            good = false;
-          }
-          if(j == 5 && plane == (dims[2] - 1))
-          {
-            good = false;
-          }
-          if(j == 1 && row == 0)
-          {
-            good = false;
-          }
-          if(j == 4 && row == (dims[1] - 1))
-          {
-            good = false;
-          }
-          if(j == 2 && column == 0)
-          {
-            good = false;
-          }
-          if(j == 3 && column == (dims[0] - 1))
+          return;
+        }
+        if(!(confidenceIndex[i] < m_InputValues->MinConfidence))
+        {
+          continue;
+        }
+        for(usize j = 0; j < NeighborMisorientationCache::k_NumFaceNeighbors; j++)
+        {
+          hasNeighbor[j] = NeighborMisorientationCache::HasFaceNeighbor(udims, i, j);
+        }
+        for(usize j = 0; j < NeighborMisorientationCache::k_NumFaceNeighbors; j++)
+        {
+          if(!hasNeighbor[j])
           {
-            good = false;
+            continue;
           }
-          if(good)
+          const int64 neighbor = static_cast<int64>(i) + neighpoints[j];
+          const int32 neighborPhase = cellPhases[neighbor];
+          for(usize k = j + 1; k < NeighborMisorientationCache::k_NumFaceNeighbors; k++)
           {
-            phase1 = crystalStructures[cellPhases[i]];
-            QuatF quat1(quats[i * 4], quats[i * 4 + 1], quats[i * 4 + 2], quats[i * 4 + 3]);
-            QuatF quat2(quats[neighbor * 4], quats[neighbor * 4 + 1], quats[neighbor * 4 + 2], quats[neighbor * 4 + 3]);
-            OrientationD axisAngle(0.0, 0.0, 0.0, std::numeric_limits<double>::max());
-            if(cellPhases[i] == cellPhases[neighbor] && cellPhases[i] > 0)
+            if(!hasNeighbor[k])
             {
-              axisAngle = orientationOps[phase1]->calculateMisorientation(quat1, quat2);
+              continue;
             }
-            if(axisAngle[3] > misorientationToleranceR)
+            const int64 neighbor2 = static_cast<int64>(i) + neighpoints[k];
+            float32 angle = std::numeric_limits<float32>::max();
+            if(cellPhases[neighbor2] == neighborPhase && neighborPhase > 0)
             {
-              neighborDiffCount[i]++;
+              angle = misorientationEngine.angle(crystalStructures[neighborPhase], readQuat(neighbor2), readQuat(neighbor));
             }
-            for(size_t k = j + 1; k < 6; k++)
+            if(angle < misorientationToleranceR)
             {
-              good2 = true;
-              neighbor2 = int64_t(i) + neighpoints[k];
-              if(k == 0 && plane == 0)
-              {
-                good2 = false;
-              }
-              if(k == 5 && plane == (dims[2] - 1))
-              {
-                good2 = false;
-              }
-              if(k == 1 && row == 0)
-              {
-                good2 = false;
-              }
-              if(k == 4 && row == (dims[1] - 1))
-              {
-                good2 = false;
-              }
-              if(k == 2 && column == 0)
-              {
-                good2 = false;
-              }
-              if(k == 3 && column == (dims[0] - 1))
-              {
-                good2 = false;
-              }
-              if(good2)
-              {
-                phase1 = crystalStructures[cellPhases[neighbor2]];
-                quat1 = QuatF(quats[neighbor2 * 4], quats[neighbor2 * 4 + 1], quats[neighbor2 * 4 + 2], quats[neighbor2 * 4 + 3]);
-                quat2 = QuatF(quats[neighbor * 4], quats[neighbor * 4 + 1], quats[neighbor * 4 + 2], quats[neighbor * 4 + 3]);
-                axisAngle = OrientationD(0.0, 0.0, 0.0, std::numeric_limits<double>::max());
-                if(cellPhases[neighbor2] == cellPhases[neighbor] && cellPhases[neighbor2] > 0)
-                {
-                  axisAngle = orientationOps[phase1]->calculateMisorientation(quat1, quat2);
-                }
-                if(axisAngle[3] < misorientationToleranceR)
-                {
-                  neighborSimCount[j]++;
-                  neighborSimCount[k]++;
-                }
-              }
+              neighborSimCount[j]++;
+              neighborSimCount[k]++;
             }
           }
         }
-        for(size_t j = 0; j < 6; j++)
+        for(usize j = 0; j < NeighborMisorientationCache::k_NumFaceNeighbors; j++)
         {
-          best = 0;
-          good = true;
-          neighbor = int64_t(i) + neighpoints[j];
-          if(j == 0 && plane == 0)
+          if(hasNeighbor[j])
           {
-            good = false;
-          }
-          if(j == 5 && plane == (dims[2] - 1))
-          {
-            good = false;
-          }
-          if(j == 1 && row == 0)
-          {
-            good = false;
-          }
-          if(j == 4 && row == (dims[1] - 1))
-          {
-            good = false;
-          }
-          if(j == 2 && column == 0)
-          {
-            good = false;
-          }
-          if(j == 3 && column == (dims[0] - 1))
-          {
-            good = false;
-          }
-          if(good)
-          {
-            if(neighborSimCount[j] > best)
+            // The best count is reset for every face, so the last similar neighbor wins
+            if(neighborSimCount[j] > 0)
             {
-              best = neighborSimCount[j];
-              bestNeighbor[i] = neighbor;
+              bestNeighbor[i] = static_cast<int64>(i) + neighpoints[j];
             }
             neighborSimCount[j] = 0;
           }
         }
       }
-    }
+    });
 
     if(getCancel())
     {
@@ -1,18 +1,52 @@
 #include "ReadAngData.hpp"
 
+#include "OrientationAnalysis/utilities/EbsdTextDataParser.hpp"
+
 #include "simplnx/Common/RgbColor.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/StringArray.hpp"
 #include "simplnx/Utilities/Math/MatrixMath.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/Parsing/Text/MappedTextFile.hpp"
+#include "simplnx/Utilities/Parsing/Text/TextChunks.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
 #include "EbsdLib/Core/Orientation.hpp"
 
+#include <fmt/format.h>
+
 using namespace nx::core;
 
 using FloatVec3Type = std::vector<float>;
 
+namespace
+{
+constexpr int32 k_FileMappingError = -19524;
+
+/**
+ * @brief Returns the offset of the first data row. Every line of the header starts with '#'.
+ * @param text
+ * @return usize
+ */
+usize FindDataSectionStart(std::string_view text)
+{
+  usize offset = 0;
+  while(offset < text.size())
+  {
+    const usize lineStart = offset;
+    const std::string_view line = TextChunks::NextLine(text, offset);
+    usize tokenOffset = 0;
+    const std::string_view firstToken = TextChunks::NextToken(line, tokenOffset);
+    if(!firstToken.empty() && firstToken.front() != '#')
+    {
+      return lineStart;
+    }
+  }
+  return text.size();
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 ReadAngData::ReadAngData(DataStructure& dataStructure, const IFilter::MessageHandler& msgHandler, const std::atomic_bool& shouldCancel, ReadAngDataInputValues* inputValues)
 : m_DataStructure(dataStructure)
@@ -28,9 +62,10 @@ ReadAngData::~ReadAngData() noexcept = default;
 // -----------------------------------------------------------------------------
 Result<> ReadAngData::operator()()
 {
+  // Only the header is read through the AngReader, the data rows are parsed in parallel straight into the arrays
   AngReader reader;
   reader.setFileName(m_InputValues->InputFile.string());
-  const int32_t err = reader.readFile();
+  const int32_t err = reader.readHeaderOnly();
   if(err < 0)
   {
     return MakeErrorResult(reader.getErrorCode(), reader.getErrorMessage());
@@ -42,9 +77,7 @@ Result<> ReadAngData::operator()()
     return MakeErrorResult(result.first, result.second);
   }
 
-  copyRawEbsdData(&reader);
-
-  return {};
+  return readRawEbsdData();
 }
 
 // -----------------------------------------------------------------------------
@@ -96,82 +129,60 @@ std::pair<int32, std::string> ReadAngData::loadMaterialInfo(AngReader* reader) c
 }
 
 // -----------------------------------------------------------------------------
-void ReadAngData::copyRawEbsdData(AngReader* reader) const
+Result<> ReadAngData::readRawEbsdData() const
 {
-  const DataPath CellAttributeMatrixPath = m_InputValues->DataContainerName.createChildPath(m_InputValues->CellAttributeMatrixName);
-
-  std::vector<size_t> cDims = {1};
+  const DataPath cellAttributeMatrixPath = m_InputValues->DataContainerName.createChildPath(m_InputValues->CellAttributeMatrixName);
 
   const auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->DataContainerName);
-  const size_t totalCells = imageGeom.getNumberOfCells();
-
-  // Prepare the Cell Attribute Matrix with the correct number of tuples based on the total Cells being read from the file.
-  std::vector<size_t> tDims = {imageGeom.getNumXCells(), imageGeom.getNumYCells(), imageGeom.getNumZCells()};
-
-  // Adjust the values of the 'phase' data to correct for invalid values and assign the read Phase Data into the actual DataArray
-  {
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::AngFile::Phases));
-    int* phasePtr = reinterpret_cast<int32_t*>(reader->getPointerByName(EbsdLib::Ang::PhaseData));
-    for(size_t i = 0; i < totalCells; i++)
-    {
-      if(phasePtr[i] < 1)
-      {
-        phasePtr[i] = 1;
-      }
-      targetArray[i] = phasePtr[i];
-    }
-  }
+  const usize totalCells = imageGeom.getNumberOfCells();
 
-  // Condense the Euler Angles from 3 separate arrays into a single 1x3 array
+  std::unique_ptr<MappedTextFile> mappedFile;
+  try
   {
-    const auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi1));
-    const auto* fComp1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi));
-    const auto* fComp2 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi2));
-    cDims[0] = 3;
-
-    auto& cellEulerAngles = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::AngFile::EulerAngles));
-    for(size_t i = 0; i < totalCells; i++)
-    {
-      cellEulerAngles[3 * i] = fComp0[i];
-      cellEulerAngles[3 * i + 1] = fComp1[i];
-      cellEulerAngles[3 * i + 2] = fComp2[i];
-    }
-  }
-
-  cDims[0] = 1;
+    mappedFile = std::make_unique<MappedTextFile>(m_InputValues->InputFile);
+  } catch(const std::exception& exception)
   {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::ImageQuality));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::ImageQuality));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
+    return MakeErrorResult(k_FileMappingError, exception.what());
   }
-
+  const std::string_view text = mappedFile->text();
+
+  auto& phases = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::AngFile::Phases)).getDataStoreRef();
+
+  // The data rows hold: phi1 PHI phi2 x y IQ CI Phase [SEM Signal] [Fit]. Older files omit the last two columns.
+  EbsdTextDataParser parser(text.substr(FindDataSectionStart(text)), totalCells);
+  parser.setRequiredColumns(8);
+  auto& eulerAngles = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::AngFile::EulerAngles)).getDataStoreRef();
+  parser.addColumn(0, eulerAngles, 0);
+  parser.addColumn(1, eulerAngles, 1);
+  parser.addColumn(2, eulerAngles, 2);
+  parser.addColumn(3, m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ang::XPosition)).getDataStoreRef());
+  parser.addColumn(4, m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ang::YPosition)).getDataStoreRef());
+  parser.addColumn(5, m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ang::ImageQuality)).getDataStoreRef());
+  parser.addColumn(6, m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ang::ConfidenceIndex)).getDataStoreRef());
+  parser.addColumn(7, phases);
+  parser.addColumn(8, m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ang::SEMSignal)).getDataStoreRef());
+  parser.addColumn(9, m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ang::Fit)).getDataStoreRef());
+
+  m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Parsing {} rows of data", totalCells));
+  Result<> parseResult = parser.parse(m_ShouldCancel);
+  if(parseResult.invalid() || m_ShouldCancel)
   {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::ConfidenceIndex));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::ConfidenceIndex));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
+    return parseResult;
   }
 
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::SEMSignal));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::SEMSignal));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Fit));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::Fit));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::XPosition));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::XPosition));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
+  // Single phase files store a phase of 0 for every point. Those points belong to the first phase.
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, totalCells);
+  dataAlg.requireStoresInMemory({&phases});
+  dataAlg.execute([&phases](const Range& range) {
+    for(usize index = range.min(); index < range.max(); index++)
+    {
+      if(phases[index] < 1)
+      {
+        phases[index] = 1;
+      }
+    }
+  });
 
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::YPosition));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::YPosition));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
+  return {};
 }
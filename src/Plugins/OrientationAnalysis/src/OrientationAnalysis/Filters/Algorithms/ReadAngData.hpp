@@ -82,10 +82,10 @@ private:
   std::pair<int32, std::string> loadMaterialInfo(AngReader* reader) const;
 
   /**
-   * @brief
-   * @param reader
+   * @brief Parses the data rows of the .ang file in parallel straight into the cell arrays.
+   * @return Result<>
    */
-  void copyRawEbsdData(AngReader* reader) const;
+  Result<> readRawEbsdData() const;
 };
 
 } // namespace nx::core
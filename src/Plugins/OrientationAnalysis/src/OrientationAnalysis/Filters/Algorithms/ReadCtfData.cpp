@@ -1,16 +1,32 @@
 #include "ReadCtfData.hpp"
 
+#include "OrientationAnalysis/utilities/EbsdTextDataParser.hpp"
+
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/StringArray.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/Parsing/Text/MappedTextFile.hpp"
+#include "simplnx/Utilities/Parsing/Text/TextChunks.hpp"
 
 #include "EbsdLib/IO/HKL/CtfConstants.h"
 #include "EbsdLib/Math/EbsdLibMath.h"
 
+#include <fmt/format.h>
+
+#include <optional>
+#include <tuple>
+
 using namespace nx::core;
 
 using FloatVec3Type = std::vector<float>;
 
+namespace
+{
+constexpr int32 k_FileMappingError = -19526;
+constexpr int32 k_MissingColumnError = -19527;
+} // namespace
+
 // -----------------------------------------------------------------------------
 ReadCtfData::ReadCtfData(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, ReadCtfDataInputValues* inputValues)
 : m_DataStructure(dataStructure)
@@ -32,9 +48,10 @@ const std::atomic_bool& ReadCtfData::getCancel()
 // -----------------------------------------------------------------------------
 Result<> ReadCtfData::operator()()
 {
+  // Only the header is read through the CtfReader, the data rows are parsed in parallel straight into the arrays
   CtfReader reader;
   reader.setFileName(m_InputValues->InputFile.string());
-  const int32_t err = reader.readFile();
+  const int32_t err = reader.readHeaderOnly();
   if(err < 0)
   {
     return MakeErrorResult(reader.getErrorCode(), reader.getErrorMessage());
@@ -46,9 +63,7 @@ Result<> ReadCtfData::operator()()
     return MakeErrorResult(result.first, result.second);
   }
 
-  copyRawEbsdData(&reader);
-
-  return {};
+  return readRawEbsdData();
 }
 
 // -----------------------------------------------------------------------------
@@ -97,45 +112,114 @@ std::pair<int32, std::string> ReadCtfData::loadMaterialInfo(CtfReader* reader) c
 }
 
 // -----------------------------------------------------------------------------
-void ReadCtfData::copyRawEbsdData(CtfReader* reader) const
+Result<> ReadCtfData::readRawEbsdData() const
 {
   const DataPath cellAttributeMatrixPath = m_InputValues->DataContainerName.createChildPath(m_InputValues->CellAttributeMatrixName);
   const DataPath cellEnsembleAttributeMatrixPath = m_InputValues->DataContainerName.createChildPath(m_InputValues->CellEnsembleAttributeMatrixName);
-  std::vector<size_t> cDims = {1};
 
   const auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->DataContainerName);
-  const size_t totalCells = imageGeom.getNumberOfCells();
+  const usize totalCells = imageGeom.getNumberOfCells();
 
-  // Prepare the Cell Attribute Matrix with the correct number of tuples based on the total Cells being read from the file.
-  std::vector<size_t> tDims = {imageGeom.getNumXCells(), imageGeom.getNumYCells(), imageGeom.getNumZCells()};
+  std::unique_ptr<MappedTextFile> mappedFile;
+  try
+  {
+    mappedFile = std::make_unique<MappedTextFile>(m_InputValues->InputFile);
+  } catch(const std::exception& exception)
+  {
+    return MakeErrorResult(k_FileMappingError, exception.what());
+  }
+  const std::string_view text = mappedFile->text();
+
+  // The last header line names the columns of the data rows, the order of the columns differs between files
+  usize dataStart = 0;
+  std::vector<std::string_view> columnNames;
+  while(dataStart < text.size() && columnNames.empty())
+  {
+    const std::string_view line = TextChunks::NextLine(text, dataStart);
+    usize tokenOffset = 0;
+    if(TextChunks::NextToken(line, tokenOffset) != EbsdLib::Ctf::Phase)
+    {
+      continue;
+    }
+    tokenOffset = 0;
+    for(std::string_view name = TextChunks::NextToken(line, tokenOffset); !name.empty(); name = TextChunks::NextToken(line, tokenOffset))
+    {
+      columnNames.push_back(name);
+    }
+  }
 
-  // Copy the Phase Array
+  auto findColumn = [&columnNames](const std::string& name) -> std::optional<usize> {
+    auto iter = std::find(columnNames.begin(), columnNames.end(), name);
+    if(iter == columnNames.end())
+    {
+      return {};
+    }
+    return static_cast<usize>(iter - columnNames.begin());
+  };
+
+  EbsdTextDataParser parser(text.substr(dataStart), totalCells);
+  parser.setRequiredColumns(columnNames.size());
+
+  auto& cellPhases = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::Phases)).getDataStoreRef();
+  auto& cellEulerAngles = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::EulerAngles)).getDataStoreRef();
+
+  const std::vector<std::tuple<std::string, AbstractDataStore<int32>*, AbstractDataStore<float32>*, usize>> targets = {
+      {EbsdLib::Ctf::Phase, &cellPhases, nullptr, 0},
+      {EbsdLib::Ctf::X, nullptr, &m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::X)).getDataStoreRef(), 0},
+      {EbsdLib::Ctf::Y, nullptr, &m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::Y)).getDataStoreRef(), 0},
+      {EbsdLib::Ctf::Bands, &m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::Bands)).getDataStoreRef(), nullptr, 0},
+      {EbsdLib::Ctf::Error, &m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::Error)).getDataStoreRef(), nullptr, 0},
+      {EbsdLib::Ctf::Euler1, nullptr, &cellEulerAngles, 0},
+      {EbsdLib::Ctf::Euler2, nullptr, &cellEulerAngles, 1},
+      {EbsdLib::Ctf::Euler3, nullptr, &cellEulerAngles, 2},
+      {EbsdLib::Ctf::MAD, nullptr, &m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::MAD)).getDataStoreRef(), 0},
+      {EbsdLib::Ctf::BC, &m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::BC)).getDataStoreRef(), nullptr, 0},
+      {EbsdLib::Ctf::BS, &m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::BS)).getDataStoreRef(), nullptr, 0},
+  };
+  for(const auto& [name, intStore, floatStore, component] : targets)
   {
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::Phases));
-    int* phasePtr = reinterpret_cast<int32_t*>(reader->getPointerByName(EbsdLib::Ctf::Phase));
-    for(size_t i = 0; i < totalCells; i++)
+    const std::optional<usize> column = findColumn(name);
+    if(!column.has_value())
     {
-      targetArray[i] = phasePtr[i];
+      return MakeErrorResult(k_MissingColumnError, fmt::format("The file '{}' does not contain a '{}' column", m_InputValues->InputFile.string(), name));
+    }
+    if(intStore != nullptr)
+    {
+      parser.addColumn(*column, *intStore, component);
+    }
+    else
+    {
+      parser.addColumn(*column, *floatStore, component);
     }
   }
 
-  // Condense the Euler Angles from 3 separate arrays into a single 1x3 array
+  m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Parsing {} rows of data", totalCells));
+  Result<> parseResult = parser.parse(m_ShouldCancel);
+  if(parseResult.invalid() || m_ShouldCancel)
   {
-    auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(cellEnsembleAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::CrystalStructures));
-    auto& cellPhases = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::Phases));
+    return parseResult;
+  }
 
-    const auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler1));
-    const auto* fComp1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler2));
-    const auto* fComp2 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler3));
-    cDims[0] = 3;
+  if(!m_InputValues->EdaxHexagonalAlignment && !m_InputValues->DegreesToRadians)
+  {
+    return {};
+  }
 
-    auto& cellEulerAngles = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::EulerAngles));
-    for(size_t i = 0; i < totalCells; i++)
+  const auto& crystalStructureStore = m_DataStructure.getDataRefAs<UInt32Array>(cellEnsembleAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::CrystalStructures)).getDataStoreRef();
+  std::vector<uint32> crystalStructures(crystalStructureStore.getSize());
+  for(usize phase = 0; phase < crystalStructures.size(); phase++)
+  {
+    crystalStructures[phase] = crystalStructureStore[phase];
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, totalCells);
+  dataAlg.requireStoresInMemory({&cellPhases, &cellEulerAngles});
+  dataAlg.execute([&](const Range& range) {
+    for(usize i = range.min(); i < range.max(); i++)
     {
-      cellEulerAngles[3 * i] = fComp0[i];
-      cellEulerAngles[3 * i + 1] = fComp1[i];
-      cellEulerAngles[3 * i + 2] = fComp2[i];
-      if(crystalStructures[cellPhases[i]] == EbsdLib::CrystalStructure::Hexagonal_High && m_InputValues->EdaxHexagonalAlignment)
+      const auto phase = static_cast<usize>(cellPhases[i]);
+      if(m_InputValues->EdaxHexagonalAlignment && phase < crystalStructures.size() && crystalStructures[phase] == EbsdLib::CrystalStructure::Hexagonal_High)
       {
         cellEulerAngles[3 * i + 2] = cellEulerAngles[3 * i + 2] + 30.0F; // See the documentation for this correction factor
       }
@@ -147,48 +231,7 @@ void ReadCtfData::copyRawEbsdData(CtfReader* reader) const
         cellEulerAngles[3 * i + 2] = cellEulerAngles[3 * i + 2] * EbsdLib::Constants::k_PiOver180F;
       }
     }
-  }
-
-  cDims[0] = 1;
-  {
-    auto* fComp0 = reinterpret_cast<int32*>(reader->getPointerByName(EbsdLib::Ctf::Bands));
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::Bands));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<int32*>(reader->getPointerByName(EbsdLib::Ctf::Error));
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::Error));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::MAD));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::MAD));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
+  });
 
-  {
-    auto* fComp0 = reinterpret_cast<int32*>(reader->getPointerByName(EbsdLib::Ctf::BC));
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::BC));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<int32*>(reader->getPointerByName(EbsdLib::Ctf::BS));
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::BS));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::X));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::X));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Y));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::Y));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
+  return {};
 }
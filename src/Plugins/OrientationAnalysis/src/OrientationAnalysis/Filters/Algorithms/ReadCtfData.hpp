@@ -87,10 +87,10 @@ private:
   std::pair<int32, std::string> loadMaterialInfo(CtfReader* reader) const;
 
   /**
-   * @brief
-   * @param reader
+   * @brief Parses the data rows of the .ctf file in parallel straight into the cell arrays.
+   * @return Result<>
    */
-  void copyRawEbsdData(CtfReader* reader) const;
+  Result<> readRawEbsdData() const;
 };
 
 } // namespace nx::core
@@ -0,0 +1,182 @@
+#include "EbsdTextDataParser.hpp"
+
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/Parsing/Text/TextChunks.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+using namespace nx::core;
+
+// -----------------------------------------------------------------------------
+EbsdTextDataParser::EbsdTextDataParser(std::string_view dataSection, usize numRows)
+: m_DataSection(dataSection)
+, m_NumRows(numRows)
+{
+}
+
+// -----------------------------------------------------------------------------
+EbsdTextDataParser::~EbsdTextDataParser() noexcept = default;
+
+// -----------------------------------------------------------------------------
+usize EbsdTextDataParser::findOrAddStore(AbstractDataStore<float32>* floatStore, AbstractDataStore<int32>* intStore)
+{
+  for(usize storeIndex = 0; storeIndex < m_Stores.size(); storeIndex++)
+  {
+    if(m_Stores[storeIndex].floatStore == floatStore && m_Stores[storeIndex].intStore == intStore)
+    {
+      return storeIndex;
+    }
+  }
+  m_Stores.push_back({floatStore, intStore});
+  return m_Stores.size() - 1;
+}
+
+// -----------------------------------------------------------------------------
+void EbsdTextDataParser::addColumn(usize column, AbstractDataStore<float32>& store, usize component)
+{
+  m_Columns.push_back({column, findOrAddStore(&store, nullptr), component});
+}
+
+// -----------------------------------------------------------------------------
+void EbsdTextDataParser::addColumn(usize column, AbstractDataStore<int32>& store, usize component)
+{
+  m_Columns.push_back({column, findOrAddStore(nullptr, &store), component});
+}
+
+// -----------------------------------------------------------------------------
+void EbsdTextDataParser::setRequiredColumns(usize numColumns)
+{
+  m_RequiredColumns = numColumns;
+}
+
+// -----------------------------------------------------------------------------
+Result<> EbsdTextDataParser::parse(const std::atomic_bool& shouldCancel) const
+{
+  const std::vector<TextChunks::LineChunk> chunks = TextChunks::SplitIntoLineChunks(m_DataSection);
+  const usize numFileRows = chunks.empty() ? 0 : chunks.back().firstRow + chunks.back().numRows;
+  if(numFileRows < m_NumRows)
+  {
+    return MakeErrorResult(k_MissingRowsError, fmt::format("The file contains {} rows of data but its header describes {} rows", numFileRows, m_NumRows));
+  }
+
+  std::vector<ColumnTarget> columns = m_Columns;
+  std::sort(columns.begin(), columns.end(), [](const ColumnTarget& lhs, const ColumnTarget& rhs) { return lhs.column < rhs.column; });
+  const usize numColumnsToRead = std::max(m_RequiredColumns, columns.empty() ? usize(0) : columns.back().column + 1);
+
+  std::vector<usize> storeComponents;
+  IParallelAlgorithm::AlgorithmStores stores;
+  for(const StoreTarget& target : m_Stores)
+  {
+    const IDataStore* store = (target.floatStore != nullptr) ? static_cast<const IDataStore*>(target.floatStore) : static_cast<const IDataStore*>(target.intStore);
+    storeComponents.push_back(store->getNumberOfComponents());
+    stores.push_back(store);
+  }
+
+  std::vector<Result<>> chunkResults(chunks.size());
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, chunks.size());
+  dataAlg.requireStoresInMemory(stores);
+  dataAlg.execute([&](const Range& range) {
+    std::vector<std::vector<float32>> floatBuffers(m_Stores.size());
+    std::vector<std::vector<int32>> intBuffers(m_Stores.size());
+    std::vector<std::string_view> tokens(numColumnsToRead);
+
+    for(usize chunkIndex = range.min(); chunkIndex < range.max(); chunkIndex++)
+    {
+      const TextChunks::LineChunk& chunk = chunks[chunkIndex];
+      if(shouldCancel || chunk.firstRow >= m_NumRows)
+      {
+        continue;
+      }
+      const usize numChunkRows = std::min(chunk.numRows, m_NumRows - chunk.firstRow);
+      for(usize storeIndex = 0; storeIndex < m_Stores.size(); storeIndex++)
+      {
+        if(m_Stores[storeIndex].floatStore != nullptr)
+        {
+          floatBuffers[storeIndex].assign(numChunkRows * storeComponents[storeIndex], 0.0f);
+        }
+        else
+        {
+          intBuffers[storeIndex].assign(numChunkRows * storeComponents[storeIndex], 0);
+        }
+      }
+
+      const std::string_view chunkText = m_DataSection.substr(chunk.begin, chunk.end - chunk.begin);
+      usize offset = 0;
+      usize row = 0;
+      while(row < numChunkRows && chunkResults[chunkIndex].valid())
+      {
+        const std::string_view line = TextChunks::NextLine(chunkText, offset);
+        if(TextChunks::IsBlank(line))
+        {
+          continue;
+        }
+
+        usize lineOffset = 0;
+        usize numTokens = 0;
+        for(; numTokens < numColumnsToRead; numTokens++)
+        {
+          tokens[numTokens] = TextChunks::NextToken(line, lineOffset);
+          if(tokens[numTokens].empty())
+          {
+            break;
+          }
+        }
+        const usize fileRow = chunk.firstRow + row;
+        if(numTokens < m_RequiredColumns)
+        {
+          chunkResults[chunkIndex] = MakeErrorResult(k_MissingColumnsError, fmt::format("Row {} of the data has {} columns but at least {} columns are required", fileRow, numTokens, m_RequiredColumns));
+          break;
+        }
+
+        for(const ColumnTarget& target : columns)
+        {
+          if(target.column >= numTokens)
+          {
+            break;
+          }
+          const usize index = row * storeComponents[target.storeIndex] + target.component;
+          const bool parsed = (m_Stores[target.storeIndex].floatStore != nullptr) ? TextChunks::ParseValue(tokens[target.column], floatBuffers[target.storeIndex][index]) :
+                                                                                    TextChunks::ParseValue(tokens[target.column], intBuffers[target.storeIndex][index]);
+          if(!parsed)
+          {
+            chunkResults[chunkIndex] =
+                MakeErrorResult(k_InvalidValueError, fmt::format("Could not convert '{}' in column {} of row {} of the data into a number", tokens[target.column], target.column, fileRow));
+            break;
+          }
+        }
+        row++;
+      }
+      if(chunkResults[chunkIndex].invalid())
+      {
+        continue;
+      }
+
+      for(usize storeIndex = 0; storeIndex < m_Stores.size(); storeIndex++)
+      {
+        const usize start = chunk.firstRow * storeComponents[storeIndex];
+        Result<> copyResult = (m_Stores[storeIndex].floatStore != nullptr) ?
+                                  m_Stores[storeIndex].floatStore->copyFromBuffer(start, nonstd::span<const float32>(floatBuffers[storeIndex].data(), floatBuffers[storeIndex].size())) :
+                                  m_Stores[storeIndex].intStore->copyFromBuffer(start, nonstd::span<const int32>(intBuffers[storeIndex].data(), intBuffers[storeIndex].size()));
+        if(copyResult.invalid())
+        {
+          chunkResults[chunkIndex] = MakeErrorResult(k_WriteError, fmt::format("Could not write rows {} to {} of the data into the output arrays", chunk.firstRow, chunk.firstRow + numChunkRows));
+          break;
+        }
+      }
+    }
+  });
+
+  // Report the failure closest to the start of the file so the message does not depend on thread scheduling
+  for(Result<>& chunkResult : chunkResults)
+  {
+    if(chunkResult.invalid())
+    {
+      return std::move(chunkResult);
+    }
+  }
+  return {};
+}
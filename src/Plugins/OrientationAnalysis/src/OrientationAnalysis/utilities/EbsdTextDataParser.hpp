@@ -0,0 +1,98 @@
+#pragma once
+
+#include "OrientationAnalysis/OrientationAnalysis_export.hpp"
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+
+#include <atomic>
+#include <string_view>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @class EbsdTextDataParser
+ * @brief Parses the whitespace delimited data section of a text based EBSD file (.ang, .ctf)
+ * straight into the destination data stores.
+ *
+ * The data section is split into chunks on line boundaries and the chunks are parsed in
+ * parallel with std::from_chars. Each chunk is converted into small per-store buffers
+ * that are copied into the stores, so the file is never held in memory twice. Row i of
+ * the data section is written into tuple i of every store; blank lines are ignored.
+ */
+class ORIENTATIONANALYSIS_EXPORT EbsdTextDataParser
+{
+public:
+  static inline constexpr int32 k_MissingRowsError = -19520;
+  static inline constexpr int32 k_MissingColumnsError = -19521;
+  static inline constexpr int32 k_InvalidValueError = -19522;
+  static inline constexpr int32 k_WriteError = -19523;
+
+  /**
+   * @param dataSection The text following the header of the file
+   * @param numRows The number of rows declared by the header. Any rows beyond it are ignored.
+   */
+  EbsdTextDataParser(std::string_view dataSection, usize numRows);
+  ~EbsdTextDataParser() noexcept;
+
+  EbsdTextDataParser(const EbsdTextDataParser&) = delete;
+  EbsdTextDataParser(EbsdTextDataParser&&) noexcept = delete;
+  EbsdTextDataParser& operator=(const EbsdTextDataParser&) = delete;
+  EbsdTextDataParser& operator=(EbsdTextDataParser&&) noexcept = delete;
+
+  /**
+   * @brief Parses the given column into one component of a float store.
+   * @param column Zero based column index within a row
+   * @param store
+   * @param component
+   */
+  void addColumn(usize column, AbstractDataStore<float32>& store, usize component = 0);
+
+  /**
+   * @brief Parses the given column into one component of an int store.
+   * @param column Zero based column index within a row
+   * @param store
+   * @param component
+   */
+  void addColumn(usize column, AbstractDataStore<int32>& store, usize component = 0);
+
+  /**
+   * @brief Sets the number of columns every row must have. Columns at or beyond this count
+   * that are missing from a row are written as 0.
+   * @param numColumns
+   */
+  void setRequiredColumns(usize numColumns);
+
+  /**
+   * @brief Parses the data section into the stores. Chunks are parsed in parallel when all
+   * stores are held in memory.
+   * @param shouldCancel
+   * @return Result<>
+   */
+  Result<> parse(const std::atomic_bool& shouldCancel) const;
+
+private:
+  struct StoreTarget
+  {
+    AbstractDataStore<float32>* floatStore = nullptr;
+    AbstractDataStore<int32>* intStore = nullptr;
+  };
+
+  struct ColumnTarget
+  {
+    usize column = 0;
+    usize storeIndex = 0;
+    usize component = 0;
+  };
+
+  usize findOrAddStore(AbstractDataStore<float32>* floatStore, AbstractDataStore<int32>* intStore);
+
+  std::string_view m_DataSection;
+  usize m_NumRows = 0;
+  usize m_RequiredColumns = 0;
+  std::vector<StoreTarget> m_Stores;
+  std::vector<ColumnTarget> m_Columns;
+};
+} // namespace nx::core
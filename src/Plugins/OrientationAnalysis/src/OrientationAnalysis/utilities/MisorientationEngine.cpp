@@ -0,0 +1,198 @@
+#include "MisorientationEngine.hpp"
+
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <algorithm>
+
+using namespace nx::core;
+
+namespace
+{
+// Misorientation angles are never negative, so this marks the pairs that were not computed
+constexpr float32 k_NotStored = -1.0f;
+} // namespace
+
+// -----------------------------------------------------------------------------
+MisorientationEngine::MisorientationEngine()
+: m_OrientationOps(LaueOps::GetAllOrientationOps())
+{
+}
+
+// -----------------------------------------------------------------------------
+MisorientationEngine::~MisorientationEngine() noexcept = default;
+
+// -----------------------------------------------------------------------------
+usize MisorientationEngine::getNumberOfLaueClasses() const
+{
+  return m_OrientationOps.size();
+}
+
+// -----------------------------------------------------------------------------
+void MisorientationEngine::computeAngles(const AbstractDataStore<float32>& quats, nonstd::span<const Pair> pairs, nonstd::span<float32> angles, const std::atomic_bool& shouldCancel) const
+{
+  const usize numClasses = m_OrientationOps.size();
+
+  // Counting sort of the pairs by Laue class so each thread sees long runs of the same symmetry operators
+  std::vector<usize> classOffsets(numClasses + 1, 0);
+  for(const auto& pair : pairs)
+  {
+    if(pair.laueClass < numClasses)
+    {
+      classOffsets[pair.laueClass + 1]++;
+    }
+  }
+  for(usize laueClass = 0; laueClass < numClasses; laueClass++)
+  {
+    classOffsets[laueClass + 1] += classOffsets[laueClass];
+  }
+  std::vector<usize> order(classOffsets[numClasses]);
+  std::vector<usize> insertPosition(classOffsets.begin(), classOffsets.end() - 1);
+  for(usize pairIndex = 0; pairIndex < pairs.size(); pairIndex++)
+  {
+    const uint32 laueClass = pairs[pairIndex].laueClass;
+    if(laueClass < numClasses)
+    {
+      order[insertPosition[laueClass]++] = pairIndex;
+    }
+    else
+    {
+      angles[pairIndex] = k_InvalidAngle;
+    }
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, order.size());
+  dataAlg.requireStoresInMemory({&quats});
+  dataAlg.execute([&](const Range& range) {
+    for(usize orderIndex = range.min(); orderIndex < range.max(); orderIndex++)
+    {
+      if(shouldCancel)
+      {
+        return;
+      }
+      const usize pairIndex = order[orderIndex];
+      const Pair& pair = pairs[pairIndex];
+      const usize firstIndex = pair.first * 4;
+      const usize secondIndex = pair.second * 4;
+      QuatF quat1(quats[firstIndex], quats[firstIndex + 1], quats[firstIndex + 2], quats[firstIndex + 3]);
+      QuatF quat2(quats[secondIndex], quats[secondIndex + 1], quats[secondIndex + 2], quats[secondIndex + 3]);
+      OrientationF axisAngle = m_OrientationOps[pair.laueClass]->calculateMisorientation(quat1, quat2);
+      angles[pairIndex] = axisAngle[3];
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+std::array<int64, NeighborMisorientationCache::k_NumFaceNeighbors> NeighborMisorientationCache::FaceNeighborOffsets(const SizeVec3& dims)
+{
+  const auto xPoints = static_cast<int64>(dims[0]);
+  const auto yPoints = static_cast<int64>(dims[1]);
+  return {-xPoints * yPoints, -xPoints, -1, 1, xPoints, xPoints * yPoints};
+}
+
+// -----------------------------------------------------------------------------
+bool NeighborMisorientationCache::HasFaceNeighbor(const SizeVec3& dims, usize voxel, usize face)
+{
+  const usize column = voxel % dims[0];
+  const usize row = (voxel / dims[0]) % dims[1];
+  const usize plane = voxel / (dims[0] * dims[1]);
+  switch(face)
+  {
+  case 0:
+    return plane != 0;
+  case 1:
+    return row != 0;
+  case 2:
+    return column != 0;
+  case 3:
+    return column != dims[0] - 1;
+  case 4:
+    return row != dims[1] - 1;
+  case 5:
+    return plane != dims[2] - 1;
+  default:
+    return false;
+  }
+}
+
+// -----------------------------------------------------------------------------
+NeighborMisorientationCache::NeighborMisorientationCache(const MisorientationEngine& engine, const SizeVec3& dims, const AbstractDataStore<float32>& quats,
+                                                         const AbstractDataStore<int32>& cellPhases, const AbstractDataStore<uint32>& crystalStructures)
+: m_Engine(engine)
+, m_Dims(dims)
+, m_Quats(quats)
+, m_CellPhases(cellPhases)
+, m_CrystalStructures(crystalStructures)
+{
+}
+
+// -----------------------------------------------------------------------------
+NeighborMisorientationCache::~NeighborMisorientationCache() noexcept = default;
+
+// -----------------------------------------------------------------------------
+void NeighborMisorientationCache::compute(std::vector<usize> voxels, const std::atomic_bool& shouldCancel)
+{
+  m_Voxels = std::move(voxels);
+  m_Angles.assign(m_Voxels.size() * k_NumFaceNeighbors, k_NotStored);
+
+  const std::array<int64, k_NumFaceNeighbors> neighborOffsets = FaceNeighborOffsets(m_Dims);
+  std::vector<MisorientationEngine::Pair> pairs;
+  std::vector<usize> slots;
+  for(usize voxelIndex = 0; voxelIndex < m_Voxels.size(); voxelIndex++)
+  {
+    const usize voxel = m_Voxels[voxelIndex];
+    const int32 phase = m_CellPhases[voxel];
+    if(phase <= 0)
+    {
+      continue;
+    }
+    for(usize face = 0; face < k_NumFaceNeighbors; face++)
+    {
+      if(!HasFaceNeighbor(m_Dims, voxel, face))
+      {
+        continue;
+      }
+      const auto neighbor = static_cast<usize>(static_cast<int64>(voxel) + neighborOffsets[face]);
+      if(m_CellPhases[neighbor] == phase)
+      {
+        pairs.push_back({voxel, neighbor, m_CrystalStructures[phase]});
+        slots.push_back(voxelIndex * k_NumFaceNeighbors + face);
+      }
+    }
+  }
+
+  std::vector<float32> pairAngles(pairs.size());
+  m_Engine.computeAngles(m_Quats, pairs, pairAngles, shouldCancel);
+  for(usize pairIndex = 0; pairIndex < pairs.size(); pairIndex++)
+  {
+    m_Angles[slots[pairIndex]] = pairAngles[pairIndex];
+  }
+}
+
+// -----------------------------------------------------------------------------
+usize NeighborMisorientationCache::getNumberOfVoxels() const
+{
+  return m_Voxels.size();
+}
+
+// -----------------------------------------------------------------------------
+bool NeighborMisorientationCache::contains(usize voxel) const
+{
+  return std::binary_search(m_Voxels.begin(), m_Voxels.end(), voxel);
+}
+
+// -----------------------------------------------------------------------------
+std::optional<float32> NeighborMisorientationCache::angle(usize voxel, usize face) const
+{
+  auto iter = std::lower_bound(m_Voxels.begin(), m_Voxels.end(), voxel);
+  if(iter == m_Voxels.end() || *iter != voxel || face >= k_NumFaceNeighbors)
+  {
+    return {};
+  }
+  const float32 value = m_Angles[static_cast<usize>(iter - m_Voxels.begin()) * k_NumFaceNeighbors + face];
+  if(value == k_NotStored)
+  {
+    return {};
+  }
+  return value;
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "OrientationAnalysis/OrientationAnalysis_export.hpp"
+
+#include "simplnx/Common/Array.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+
+#include "EbsdLib/Core/Orientation.hpp"
+#include "EbsdLib/Core/Quaternion.hpp"
+#include "EbsdLib/LaueOps/LaueOps.h"
+
+#include <nonstd/span.hpp>
+
+#include <array>
+#include <atomic>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @class MisorientationEngine
+ * @brief Evaluates misorientation angles for many quaternion pairs at once.
+ *
+ * The LaueOps for every crystal structure are created once and shared by all
+ * threads. Batches of pairs are grouped by Laue class before they are evaluated
+ * so that each thread works through long runs of pairs that use the same
+ * symmetry operators.
+ */
+class ORIENTATIONANALYSIS_EXPORT MisorientationEngine
+{
+public:
+  /**
+   * @brief The angle reported for pairs that have no valid Laue class.
+   */
+  static inline constexpr float32 k_InvalidAngle = std::numeric_limits<float32>::max();
+
+  /**
+   * @brief A pair of tuple indices into a quaternion array and the Laue class
+   * used to compare them.
+   */
+  struct Pair
+  {
+    usize first = 0;
+    usize second = 0;
+    uint32 laueClass = 0;
+  };
+
+  MisorientationEngine();
+  ~MisorientationEngine() noexcept;
+
+  MisorientationEngine(const MisorientationEngine&) = delete;
+  MisorientationEngine(MisorientationEngine&&) noexcept = default;
+  MisorientationEngine& operator=(const MisorientationEngine&) = delete;
+  MisorientationEngine& operator=(MisorientationEngine&&) noexcept = default;
+
+  /**
+   * @brief Returns the number of Laue classes known to the engine.
+   * @return usize
+   */
+  usize getNumberOfLaueClasses() const;
+
+  /**
+   * @brief Returns the misorientation angle in radians between q1 and q2 using the
+   * symmetry operators of laueClass. Unknown Laue classes return the largest value of T.
+   * @param laueClass
+   * @param q1
+   * @param q2
+   * @return T
+   */
+  template <typename T>
+  T angle(uint32 laueClass, const Quaternion<T>& q1, const Quaternion<T>& q2) const
+  {
+    if(laueClass >= m_OrientationOps.size())
+    {
+      return std::numeric_limits<T>::max();
+    }
+    Orientation<T> axisAngle = m_OrientationOps[laueClass]->calculateMisorientation(q1, q2);
+    return axisAngle[3];
+  }
+
+  /**
+   * @brief Computes the misorientation angle in radians of every pair. The pairs are
+   * grouped by Laue class and the groups are evaluated in parallel when the
+   * quaternions are held in memory. angles must hold one value per pair.
+   * @param quats Quaternions with 4 components per tuple
+   * @param pairs
+   * @param angles
+   * @param shouldCancel
+   */
+  void computeAngles(const AbstractDataStore<float32>& quats, nonstd::span<const Pair> pairs, nonstd::span<float32> angles, const std::atomic_bool& shouldCancel) const;
+
+private:
+  std::vector<LaueOps::Pointer> m_OrientationOps;
+};
+
+/**
+ * @class NeighborMisorientationCache
+ * @brief Holds the misorientation angles between a set of voxels of an image and
+ * their 6 face neighbors.
+ *
+ * The angles are computed in one batch so that algorithms which visit the same
+ * voxel pairs several times (for example while iterating over cleanup levels) only
+ * evaluate the symmetry operators once. An angle is only stored when the neighbor
+ * exists and both voxels belong to the same phase (> 0). Each angle is measured
+ * from the voxel to its neighbor using the crystal structure of the voxel.
+ */
+class ORIENTATIONANALYSIS_EXPORT NeighborMisorientationCache
+{
+public:
+  static inline constexpr usize k_NumFaceNeighbors = 6;
+
+  /**
+   * @brief Returns the index offsets of the face neighbors in the order
+   * -Z, -Y, -X, +X, +Y, +Z.
+   * @param dims
+   * @return std::array<int64, 6>
+   */
+  static std::array<int64, k_NumFaceNeighbors> FaceNeighborOffsets(const SizeVec3& dims);
+
+  /**
+   * @brief Returns true if the voxel has a neighbor in the given face direction.
+   * @param dims
+   * @param voxel
+   * @param face
+   * @return bool
+   */
+  static bool HasFaceNeighbor(const SizeVec3& dims, usize voxel, usize face);
+
+  NeighborMisorientationCache(const MisorientationEngine& engine, const SizeVec3& dims, const AbstractDataStore<float32>& quats, const AbstractDataStore<int32>& cellPhases,
+                              const AbstractDataStore<uint32>& crystalStructures);
+  ~NeighborMisorientationCache() noexcept;
+
+  NeighborMisorientationCache(const NeighborMisorientationCache&) = delete;
+  NeighborMisorientationCache(NeighborMisorientationCache&&) noexcept = default;
+  NeighborMisorientationCache& operator=(const NeighborMisorientationCache&) = delete;
+  NeighborMisorientationCache& operator=(NeighborMisorientationCache&&) noexcept = delete;
+
+  /**
+   * @brief Computes the face neighbor misorientations of the given voxels, replacing
+   * anything that was cached before.
+   * @param voxels Voxel indices sorted in ascending order
+   * @param shouldCancel
+   */
+  void compute(std::vector<usize> voxels, const std::atomic_bool& shouldCancel);
+
+  /**
+   * @brief Returns the number of voxels held by the cache.
+   * @return usize
+   */
+  usize getNumberOfVoxels() const;
+
+  /**
+   * @brief Returns true if the cache holds the neighbor misorientations of voxel.
+   * @param voxel
+   * @return bool
+   */
+  bool contains(usize voxel) const;
+
+  /**
+   * @brief Returns the misorientation angle in radians between voxel and its neighbor in
+   * the given face direction. Nothing is returned when the voxel is not cached, the
+   * neighbor does not exist or the two voxels do not share a phase.
+   * @param voxel
+   * @param face
+   * @return std::optional<float32>
+   */
+  std::optional<float32> angle(usize voxel, usize face) const;
+
+private:
+  const MisorientationEngine& m_Engine;
+  SizeVec3 m_Dims;
+  const AbstractDataStore<float32>& m_Quats;
+  const AbstractDataStore<int32>& m_CellPhases;
+  const AbstractDataStore<uint32>& m_CrystalStructures;
+  std::vector<usize> m_Voxels;
+  std::vector<float32> m_Angles;
+};
+} // namespace nx::core
@@ -0,0 +1,168 @@
+#include <catch2/catch.hpp>
+
+#include "OrientationAnalysis/utilities/EbsdTextDataParser.hpp"
+
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/Utilities/Parsing/Text/MappedTextFile.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr usize k_NumRows = 3;
+
+struct ParsedColumns
+{
+  DataStore<int32> phases = DataStore<int32>({k_NumRows}, {1}, -1);
+  DataStore<float32> eulers = DataStore<float32>({k_NumRows}, {2}, -1.0f);
+};
+
+// Column 0 goes into phases and columns 1 and 2 into the two components of eulers
+Result<> Parse(std::string_view dataSection, ParsedColumns& columns, usize requiredColumns = 3)
+{
+  EbsdTextDataParser parser(dataSection, k_NumRows);
+  parser.addColumn(0, columns.phases);
+  parser.addColumn(2, columns.eulers, 1);
+  parser.addColumn(1, columns.eulers, 0);
+  parser.setRequiredColumns(requiredColumns);
+  std::atomic_bool shouldCancel = false;
+  return parser.parse(shouldCancel);
+}
+
+void CheckValues(const ParsedColumns& columns)
+{
+  REQUIRE(columns.phases[0] == 1);
+  REQUIRE(columns.phases[1] == 2);
+  REQUIRE(columns.phases[2] == 3);
+  REQUIRE(columns.eulers[0] == 0.5f);
+  REQUIRE(columns.eulers[1] == -1.25f);
+  REQUIRE(columns.eulers[2] == 1.5f);
+  REQUIRE(columns.eulers[3] == 2.0f);
+  REQUIRE(columns.eulers[4] == 2.5f);
+  REQUIRE(columns.eulers[5] == 3.0e-2f);
+}
+} // namespace
+
+TEST_CASE("OrientationAnalysis::EbsdTextDataParser: Valid Data", "[OrientationAnalysis][EbsdTextDataParser]")
+{
+  ParsedColumns columns;
+
+  SECTION("LF")
+  {
+    Result<> result = Parse("1 0.5 -1.25\n2\t1.5 2.0\n  3 2.5 3.0e-2\n", columns);
+    REQUIRE(result.valid());
+    CheckValues(columns);
+  }
+
+  SECTION("CRLF with blank lines")
+  {
+    Result<> result = Parse("\r\n1 0.5 -1.25\r\n\r\n2 1.5 2.0\r\n3 2.5 3.0e-2\r\n", columns);
+    REQUIRE(result.valid());
+    CheckValues(columns);
+  }
+
+  SECTION("Rows beyond the header count and no final newline")
+  {
+    Result<> result = Parse("1 0.5 -1.25\n2 1.5 2.0\n3 2.5 3.0e-2\n4 not a number", columns);
+    REQUIRE(result.valid());
+    CheckValues(columns);
+  }
+
+  SECTION("Optional columns are written as 0")
+  {
+    Result<> result = Parse("1 0.5\n2 1.5 2.0\n3\n", columns, 1);
+    REQUIRE(result.valid());
+    REQUIRE(columns.phases[2] == 3);
+    REQUIRE(columns.eulers[0] == 0.5f);
+    REQUIRE(columns.eulers[1] == 0.0f);
+    REQUIRE(columns.eulers[4] == 0.0f);
+    REQUIRE(columns.eulers[5] == 0.0f);
+  }
+}
+
+TEST_CASE("OrientationAnalysis::EbsdTextDataParser: Errors", "[OrientationAnalysis][EbsdTextDataParser]")
+{
+  ParsedColumns columns;
+
+  SECTION("Missing rows")
+  {
+    Result<> result = Parse("1 0.5 -1.25\n\n2 1.5 2.0\n   \n", columns);
+    REQUIRE(result.invalid());
+    REQUIRE(result.errors()[0].code == EbsdTextDataParser::k_MissingRowsError);
+  }
+
+  SECTION("Missing columns")
+  {
+    Result<> result = Parse("1 0.5 -1.25\n2 1.5\n3 2.5 3.0e-2\n", columns);
+    REQUIRE(result.invalid());
+    REQUIRE(result.errors()[0].code == EbsdTextDataParser::k_MissingColumnsError);
+    REQUIRE(result.errors()[0].message.find("Row 1 ") != std::string::npos);
+  }
+
+  SECTION("Invalid value")
+  {
+    Result<> result = Parse("1 0.5 -1.25\r\n2 1.5 2.0\r\n3 2.5x 3.0\r\n", columns);
+    REQUIRE(result.invalid());
+    REQUIRE(result.errors()[0].code == EbsdTextDataParser::k_InvalidValueError);
+    REQUIRE(result.errors()[0].message.find("'2.5x' in column 1 of row 2") != std::string::npos);
+  }
+
+  SECTION("Integer column holding a float")
+  {
+    Result<> result = Parse("1 0.5 -1.25\n2.0 1.5 2.0\n3 2.5 3.0\n", columns);
+    REQUIRE(result.invalid());
+    REQUIRE(result.errors()[0].code == EbsdTextDataParser::k_InvalidValueError);
+  }
+}
+
+TEST_CASE("OrientationAnalysis::EbsdTextDataParser: Truncated File", "[OrientationAnalysis][EbsdTextDataParser]")
+{
+  const std::filesystem::path filePath = std::filesystem::temp_directory_path() / "simplnx_ebsd_text_data_parser_truncated.txt";
+  const std::string header = "# Header line\r\n# NROWS: 3\r\n";
+  const std::string completeData = "1 0.5 -1.25\r\n2 1.5 2.0\r\n3 2.5 3.0e-2\r\n";
+
+  ParsedColumns columns;
+  Result<> result;
+
+  SECTION("Cut inside the last row")
+  {
+    {
+      std::ofstream outFile(filePath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+      outFile << header << completeData.substr(0, completeData.size() - 8);
+    }
+    MappedTextFile mappedFile(filePath);
+    result = Parse(mappedFile.text().substr(header.size()), columns);
+    REQUIRE(result.invalid());
+    REQUIRE(result.errors()[0].code == EbsdTextDataParser::k_MissingColumnsError);
+  }
+
+  SECTION("Cut after a complete row")
+  {
+    {
+      std::ofstream outFile(filePath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+      outFile << header << completeData.substr(0, completeData.find('\n') + 1);
+    }
+    MappedTextFile mappedFile(filePath);
+    result = Parse(mappedFile.text().substr(header.size()), columns);
+    REQUIRE(result.invalid());
+    REQUIRE(result.errors()[0].code == EbsdTextDataParser::k_MissingRowsError);
+  }
+
+  SECTION("Complete file")
+  {
+    {
+      std::ofstream outFile(filePath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+      outFile << header << completeData;
+    }
+    MappedTextFile mappedFile(filePath);
+    result = Parse(mappedFile.text().substr(header.size()), columns);
+    REQUIRE(result.valid());
+    CheckValues(columns);
+  }
+
+  std::filesystem::remove(filePath);
+}
@@ -0,0 +1,147 @@
+#include <catch2/catch.hpp>
+
+#include "OrientationAnalysis/utilities/MisorientationEngine.hpp"
+
+#include "simplnx/DataStructure/DataStore.hpp"
+
+#include "EbsdLib/LaueOps/LaueOps.h"
+
+#include <cmath>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr usize k_NumQuats = 8;
+
+// Fills the store with a deterministic set of unit quaternions spread over orientation space
+void FillQuats(DataStore<float32>& quats)
+{
+  const usize numTuples = quats.getNumberOfTuples();
+  for(usize i = 0; i < numTuples; i++)
+  {
+    const float32 angle = 0.37f * static_cast<float32>(i + 1);
+    std::array<float32, 3> axis = {std::cos(1.3f * static_cast<float32>(i)), std::sin(0.7f * static_cast<float32>(i)), 0.5f + 0.1f * static_cast<float32>(i)};
+    const float32 norm = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+    const float32 halfSin = std::sin(angle * 0.5f);
+    quats[i * 4] = axis[0] / norm * halfSin;
+    quats[i * 4 + 1] = axis[1] / norm * halfSin;
+    quats[i * 4 + 2] = axis[2] / norm * halfSin;
+    quats[i * 4 + 3] = std::cos(angle * 0.5f);
+  }
+}
+
+QuatF GetQuat(const DataStore<float32>& quats, usize index)
+{
+  return {quats[index * 4], quats[index * 4 + 1], quats[index * 4 + 2], quats[index * 4 + 3]};
+}
+} // namespace
+
+TEST_CASE("OrientationAnalysis::MisorientationEngine: Matches LaueOps", "[OrientationAnalysis][MisorientationEngine]")
+{
+  std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
+  MisorientationEngine engine;
+  REQUIRE(engine.getNumberOfLaueClasses() == orientationOps.size());
+
+  DataStore<float32> quats({k_NumQuats}, {4}, 0.0f);
+  FillQuats(quats);
+
+  // Every Laue class is mixed into one batch, followed by a pair with an unknown Laue class
+  std::vector<MisorientationEngine::Pair> pairs;
+  for(usize i = 0; i < k_NumQuats; i++)
+  {
+    for(usize j = 0; j < k_NumQuats; j++)
+    {
+      for(usize laueClass = 0; laueClass < orientationOps.size(); laueClass++)
+      {
+        pairs.push_back({i, j, static_cast<uint32>(laueClass)});
+      }
+    }
+  }
+  pairs.push_back({0, 1, static_cast<uint32>(orientationOps.size())});
+
+  std::vector<float32> angles(pairs.size(), 0.0f);
+  std::atomic_bool shouldCancel = false;
+  engine.computeAngles(quats, pairs, angles, shouldCancel);
+
+  for(usize pairIndex = 0; pairIndex < pairs.size() - 1; pairIndex++)
+  {
+    const auto& pair = pairs[pairIndex];
+    const QuatF q1 = GetQuat(quats, pair.first);
+    const QuatF q2 = GetQuat(quats, pair.second);
+    OrientationF axisAngle = orientationOps[pair.laueClass]->calculateMisorientation(q1, q2);
+    REQUIRE(angles[pairIndex] == axisAngle[3]);
+    REQUIRE(engine.angle(pair.laueClass, q1, q2) == axisAngle[3]);
+  }
+  REQUIRE(angles.back() == MisorientationEngine::k_InvalidAngle);
+  REQUIRE(engine.angle(static_cast<uint32>(orientationOps.size()), GetQuat(quats, 0), GetQuat(quats, 1)) == std::numeric_limits<float32>::max());
+}
+
+TEST_CASE("OrientationAnalysis::NeighborMisorientationCache: Hits and Misses", "[OrientationAnalysis][MisorientationEngine]")
+{
+  // 3 x 3 x 2 image. Voxel 4 is the center of the first plane and voxel 13 sits above it.
+  const SizeVec3 dims = {3, 3, 2};
+  const usize numVoxels = dims[0] * dims[1] * dims[2];
+
+  MisorientationEngine engine;
+  DataStore<float32> quats({numVoxels}, {4}, 0.0f);
+  FillQuats(quats);
+  DataStore<int32> cellPhases({numVoxels}, {1}, 1);
+  DataStore<uint32> crystalStructures({3}, {1}, 999);
+  crystalStructures[1] = 1; // Cubic m-3m
+  crystalStructures[2] = 0; // Hexagonal 6/mmm
+
+  cellPhases[3] = 2; // -X neighbor of voxel 4 is in another phase
+  cellPhases[1] = 0; // -Y neighbor of voxel 4 is unindexed
+  cellPhases[8] = 0; // Voxel 8 is unindexed
+
+  NeighborMisorientationCache cache(engine, dims, quats, cellPhases, crystalStructures);
+  std::atomic_bool shouldCancel = false;
+  cache.compute({0, 4, 8}, shouldCancel);
+
+  REQUIRE(cache.getNumberOfVoxels() == 3);
+  REQUIRE(cache.contains(4));
+  REQUIRE_FALSE(cache.contains(5));
+
+  SECTION("Cached angles match the engine")
+  {
+    const std::array<std::pair<usize, usize>, 3> facesOf4 = {{{3, 5}, {4, 7}, {5, 13}}}; // +X, +Y, +Z
+    for(const auto& [face, neighbor] : facesOf4)
+    {
+      std::optional<float32> angle = cache.angle(4, face);
+      REQUIRE(angle.has_value());
+      REQUIRE(*angle == engine.angle(1, GetQuat(quats, 4), GetQuat(quats, neighbor)));
+    }
+  }
+
+  SECTION("Misses")
+  {
+    // Voxel is not cached
+    REQUIRE_FALSE(cache.angle(5, 3).has_value());
+    // Neighbor is outside of the image
+    REQUIRE_FALSE(cache.angle(4, 0).has_value());
+    REQUIRE_FALSE(cache.angle(0, 2).has_value());
+    // Neighbor belongs to another phase or is unindexed
+    REQUIRE_FALSE(cache.angle(4, 2).has_value());
+    REQUIRE_FALSE(cache.angle(4, 1).has_value());
+    // Voxel itself is unindexed
+    for(usize face = 0; face < NeighborMisorientationCache::k_NumFaceNeighbors; face++)
+    {
+      REQUIRE_FALSE(cache.angle(8, face).has_value());
+    }
+    // Face index is out of range
+    REQUIRE_FALSE(cache.angle(4, NeighborMisorientationCache::k_NumFaceNeighbors).has_value());
+  }
+
+  SECTION("Recomputing replaces the cached voxels")
+  {
+    cache.compute({5}, shouldCancel);
+    REQUIRE(cache.getNumberOfVoxels() == 1);
+    REQUIRE(cache.contains(5));
+    REQUIRE_FALSE(cache.contains(4));
+    REQUIRE_FALSE(cache.angle(4, 3).has_value());
+    std::optional<float32> angle = cache.angle(5, 2);
+    REQUIRE(angle.has_value());
+    REQUIRE(*angle == engine.angle(1, GetQuat(quats, 5), GetQuat(quats, 4)));
+  }
+}
@@ -7,6 +7,7 @@
 #include "SimplnxCore/utils/AdditionOperator.hpp"
 #include "SimplnxCore/utils/CalculatorArray.hpp"
 #include "SimplnxCore/utils/CalculatorOperator.hpp"
+#include "SimplnxCore/utils/CalculatorProgram.hpp"
 #include "SimplnxCore/utils/CeilOperator.hpp"
 #include "SimplnxCore/utils/CommaSeparator.hpp"
 #include "SimplnxCore/utils/CosOperator.hpp"
@@ -49,52 +50,6 @@ struct CreateCalculatorArrayFunctor
     return itemPtr;
   }
 };
-
-struct CopyArrayFunctor
-{
-  template <typename T>
-  void operator()(DataStructure& dataStructure, const DataPath& calculatedArrayPath, const Float64Array* inputArray)
-  {
-    const auto& inputDataStore = inputArray->getDataStoreRef();
-    if(nullptr != inputArray)
-    {
-      auto& convertedDataStore = dataStructure.getDataAsUnsafe<DataArray<T>>(calculatedArrayPath)->getDataStoreRef();
-
-      const usize count = inputDataStore.getSize();
-      for(usize i = 0; i < count; i++)
-      {
-        if constexpr(std::is_same_v<float64, T>)
-        {
-          convertedDataStore[i] = inputDataStore[i];
-        }
-        else
-        {
-          convertedDataStore[i] = static_cast<T>(inputDataStore[i]);
-        }
-      }
-    }
-  }
-};
-
-struct InitializeArrayFunctor
-{
-  template <typename T>
-  void operator()(DataStructure& dataStructure, const DataPath& calculatedArrayPath, const Float64Array* inputArray)
-  {
-    auto& convertedDataStore = dataStructure.getDataAsUnsafe<DataArray<T>>(calculatedArrayPath)->getDataStoreRef();
-    if(nullptr != inputArray && inputArray->getSize() == 1)
-    {
-      if constexpr(std::is_same_v<float64, T>)
-      {
-        convertedDataStore.fill(inputArray->at(0));
-      }
-      else
-      {
-        convertedDataStore.fill(static_cast<T>(inputArray->at(0)));
-      }
-    }
-  }
-};
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -120,8 +75,10 @@ Result<> ArrayCalculator::operator()()
 {
   Result<> results;
 
-  // Parse the infix expression from the user interface
+  // Parse the infix expression from the user interface. The compiled program reads the
+  // input arrays directly, so the parser does not need to copy them into Float64 arrays
   ArrayCalculatorParser parser(m_DataStructure, m_InputValues->SelectedGroup, m_InputValues->InfixEquation, false);
+  parser.setAllocateArrays(false);
   std::vector<CalculatorItem::Pointer> parsedInfix;
   Result<> parsedEquationResults = parser.parseInfixEquation(parsedInfix);
   results.warnings() = parsedEquationResults.warnings();
@@ -145,64 +102,21 @@ Result<> ArrayCalculator::operator()()
     return results;
   }
 
-  // Execute the RPN expression
-  DataPath temporaryCalculatedArrayPath = DataPath({m_InputValues->CalculatedArray.getTargetName() + "_TEMPORARY"});
-  std::stack<ICalculatorArray::Pointer> executionStack;
-  int totalItems = rpn.size();
-  for(int rpnCount = 0; rpnCount < totalItems; rpnCount++)
+  // Fuse the whole expression into a single pass over the input arrays
+  m_MessageHandler({IFilter::Message::Type::Info, "Compiling Expression"});
+  Result<CalculatorProgram> programResult = CalculatorProgram::Compile(rpn, m_InputValues->Units);
+  if(programResult.invalid())
   {
-    m_MessageHandler({IFilter::Message::Type::Info, "Computing Operator " + StringUtilities::number(rpnCount + 1) + "/" + StringUtilities::number(totalItems)});
-
-    CalculatorItem::Pointer rpnItem = rpn[rpnCount];
-    ICalculatorArray::Pointer calcArray = std::dynamic_pointer_cast<ICalculatorArray>(rpnItem);
-    if(nullptr != calcArray)
-    {
-      // This is an array
-      executionStack.push(calcArray);
-    }
-    else
-    {
-      // This is an operator
-      CalculatorOperator::Pointer rpnOperator = std::dynamic_pointer_cast<CalculatorOperator>(rpnItem);
-
-      rpnOperator->calculate(parser.m_TemporaryDataStructure, m_InputValues->Units, temporaryCalculatedArrayPath, executionStack);
-    }
-
-    if(getCancel())
-    {
-      return results;
-    }
-  }
-
-  // Grab the result from the stack
-  ICalculatorArray::Pointer arrayItem = ICalculatorArray::NullPointer();
-  if(executionStack.size() != 1)
-  {
-    results.errors().push_back(Error{static_cast<int>(CalculatorItem::ErrorCode::InvalidEquation), "The chosen infix equation is not a valid equation."});
+    results.errors() = programResult.errors();
     return results;
   }
-  if(!executionStack.empty())
-  {
-    arrayItem = executionStack.top();
-    executionStack.pop();
-  }
 
-  if(arrayItem != ICalculatorArray::NullPointer())
-  {
-    const Float64Array* resultArray = arrayItem->getArray();
-    if(arrayItem->isNumber() && m_DataStructure.getDataAs<AttributeMatrix>(m_InputValues->CalculatedArray.getParent()) != nullptr)
-    {
-      ExecuteDataFunction(InitializeArrayFunctor{}, ConvertNumericTypeToDataType(m_InputValues->ScalarType), m_DataStructure, m_InputValues->CalculatedArray, resultArray);
-    }
-    else
-    {
-      ExecuteDataFunction(CopyArrayFunctor{}, ConvertNumericTypeToDataType(m_InputValues->ScalarType), m_DataStructure, m_InputValues->CalculatedArray, resultArray);
-    }
-  }
-  else
+  m_MessageHandler({IFilter::Message::Type::Info, "Evaluating Expression"});
+  auto& calculatedArray = m_DataStructure.getDataRefAs<IDataArray>(m_InputValues->CalculatedArray);
+  Result<> executeResults = programResult.value().execute(calculatedArray, m_ShouldCancel);
+  if(executeResults.invalid())
   {
-    results.errors().push_back(Error{static_cast<int>(CalculatorItem::ErrorCode::UnexpectedOutput), "Unexpected output item from chosen infix expression; the output item must be an array\n"
-                                                                                                    "Please contact the DREAM.3D developers for more information"});
+    results.errors() = executeResults.errors();
     return results;
   }
 
@@ -214,10 +128,17 @@ ArrayCalculatorParser::ArrayCalculatorParser(const DataStructure& dataStruct, co
 , m_SelectedGroupPath(selectedGroupPath)
 , m_InfixEquation(infixEquation)
 , m_IsPreflight(isPreflight)
+, m_AllocateArrays(!isPreflight)
 {
   createSymbolMap();
 }
 
+// -----------------------------------------------------------------------------
+void ArrayCalculatorParser::setAllocateArrays(bool allocateArrays)
+{
+  m_AllocateArrays = allocateArrays;
+}
+
 // -----------------------------------------------------------------------------
 Result<> ArrayCalculatorParser::parseInfixEquation(ParsedEquation& parsedInfix)
 {
@@ -351,7 +272,7 @@ Result<> ArrayCalculatorParser::parseNumericValue(std::string token, std::vector
   Float64Array* ptr = Float64Array::CreateWithStore<Float64DataStore>(m_TemporaryDataStructure, "INTERNAL_USE_ONLY_NumberArray" + StringUtilities::number(m_TemporaryDataStructure.getSize()),
                                                                       std::vector<size_t>{1}, std::vector<size_t>{1});
   (*ptr)[0] = number;
-  CalculatorItem::Pointer itemPtr = CalculatorArray<float64>::New(m_TemporaryDataStructure, ptr, ICalculatorArray::Number, !m_IsPreflight);
+  CalculatorItem::Pointer itemPtr = CalculatorArray<float64>::New(m_TemporaryDataStructure, ptr, ICalculatorArray::Number, m_AllocateArrays);
   parsedInfix.push_back(itemPtr);
 
   std::string ss = fmt::format("Item '{}' in the infix expression is the name of an array in the selected Attribute Matrix, but it is currently being used as a number", token);
@@ -429,8 +350,9 @@ Result<> ArrayCalculatorParser::parseIndexOperator(std::string token, std::vecto
 
   parsedInfix.pop_back();
 
-  Float64Array* reducedArray = calcArray->reduceToOneComponent(index, !m_IsPreflight);
-  CalculatorItem::Pointer itemPtr = CalculatorArray<float64>::New(m_TemporaryDataStructure, reducedArray, ICalculatorArray::Array, !m_IsPreflight);
+  Float64Array* reducedArray = calcArray->reduceToOneComponent(index, m_AllocateArrays);
+  ICalculatorArray::Pointer itemPtr = CalculatorArray<float64>::New(m_TemporaryDataStructure, reducedArray, ICalculatorArray::Array, m_AllocateArrays);
+  itemPtr->setSourceArray(calcArray->getSourceArray(), index);
   parsedInfix.push_back(itemPtr);
 
   std::string ss = fmt::format("Item '{}' in the infix expression is the name of an array in the selected Attribute Matrix, but it is currently being used as an indexing operator", token);
@@ -497,7 +419,8 @@ Result<> ArrayCalculatorParser::parseArray(std::string token, std::vector<Calcul
     return MakeErrorResult(static_cast<int>(CalculatorItem::ErrorCode::InconsistentTuples), ss);
   }
 
-  CalculatorItem::Pointer itemPtr = ExecuteDataFunction(CreateCalculatorArrayFunctor{}, dataArray->getDataType(), m_TemporaryDataStructure, !m_IsPreflight, dataArray);
+  CalculatorItem::Pointer itemPtr = ExecuteDataFunction(CreateCalculatorArrayFunctor{}, dataArray->getDataType(), m_TemporaryDataStructure, m_AllocateArrays, dataArray);
+  std::dynamic_pointer_cast<ICalculatorArray>(itemPtr)->setSourceArray(dataArray);
   parsedInfix.push_back(itemPtr);
   return {};
 }
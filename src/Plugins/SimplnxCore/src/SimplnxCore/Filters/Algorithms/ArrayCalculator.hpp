@@ -31,6 +31,14 @@ public:
 
   Result<> parseInfixEquation(ParsedEquation& parsedInfix);
 
+  /**
+   * @brief Sets whether parsed arrays are copied into temporary Float64 arrays. The
+   * copies are only needed when the operators are evaluated one at a time through
+   * CalculatorOperator::calculate. Defaults to true outside of preflight.
+   * @param allocateArrays
+   */
+  void setAllocateArrays(bool allocateArrays);
+
   static Result<ArrayCalculatorParser::ParsedEquation> ToRPN(const std::string& unparsedInfixExpression, std::vector<CalculatorItem::Pointer> infixEquation);
 
   friend class ArrayCalculator;
@@ -50,6 +58,7 @@ private:
   DataPath m_SelectedGroupPath;
   std::string m_InfixEquation;
   bool m_IsPreflight;
+  bool m_AllocateArrays;
 
   std::map<std::string, std::shared_ptr<CalculatorItem>> m_SymbolMap;
 
@@ -13,6 +13,9 @@ using namespace nx::core;
 
 namespace
 {
+// Number of tuples read from the input DataStores per bulk copy
+constexpr usize k_ChunkSize = 65536;
+
 // -----------------------------------------------------------------------------
 bool CheckArraysInMemory(const nx::core::IParallelAlgorithm::AlgorithmArrays& arrays)
 {
@@ -37,12 +40,12 @@ bool CheckArraysInMemory(const nx::core::IParallelAlgorithm::AlgorithmArrays& ar
   return true;
 }
 
-template <typename T>
+template <typename T, typename MaskT>
 class ComputeArrayStatisticsByIndexImpl
 {
 public:
   ComputeArrayStatisticsByIndexImpl(bool length, bool min, bool max, bool mean, bool mode, bool stdDeviation, bool summation, bool hist, float64 histmin, float64 histmax, bool histfullrange,
-                                    int32 numBins, bool modalBinRanges, const std::unique_ptr<MaskCompare>& mask, const Int32Array* featureIds, const DataArray<T>& source,
+                                    int32 numBins, bool modalBinRanges, const MaskT& mask, const Int32Array* featureIds, const DataArray<T>& source,
                                     BoolArray* featureHasDataArray, UInt64Array* lengthArray, DataArray<T>* minArray, DataArray<T>* maxArray, Float32Array* meanArray, NeighborList<T>* modeArray,
                                     Float32Array* stdDevArray, Float32Array* summationArray, UInt64Array* histBinCountsArray, DataArray<T>* histBinRangesArray, UInt64Array* mostPopulatedBinArray,
                                     NeighborList<T>* modalBinRangesArray, ComputeArrayStatistics* filter)
@@ -97,47 +100,56 @@ public:
 
     usize progressIncrement = numTuples / 100;
 
-    for(usize i = 0; i < numTuples; ++i)
+    const auto& featureIdsStore = m_FeatureIds->getDataStoreRef();
+    const auto& sourceStore = m_Source.getDataStoreRef();
+
+    for(usize chunkStart = 0; chunkStart < numTuples; chunkStart += k_ChunkSize)
     {
-      if(shouldCancel)
-      {
-        return;
-      }
-      if(m_Mask != nullptr && !m_Mask->isTrue(i))
-      {
-        continue;
-      }
-      for(usize j = 0; j < numCurrentFeatures; j++)
+      const usize chunkSize = std::min(k_ChunkSize, numTuples - chunkStart);
+      const auto featureIdsChunk = featureIdsStore.createChunkView(chunkStart, chunkSize);
+      const auto sourceChunk = sourceStore.createChunkView(chunkStart, chunkSize);
+      for(usize chunkIndex = 0; chunkIndex < chunkSize; chunkIndex++)
       {
-        if((*m_FeatureIds)[i] != static_cast<int32>(start + j))
+        const usize i = chunkStart + chunkIndex;
+        if(shouldCancel)
+        {
+          return;
+        }
+        if(!m_Mask.isTrue(i))
         {
           continue;
         }
+        const int32 featureId = featureIdsChunk[chunkIndex];
+        if(featureId >= static_cast<int32>(start) && featureId < static_cast<int32>(end))
+        {
+          const usize j = featureId - start;
+          const T value = sourceChunk[chunkIndex];
 
-        ++length[j];
+          ++length[j];
 
-        if(m_Source[i] < min[j])
-        {
-          min[j] = m_Source[i];
-        }
+          if(value < min[j])
+          {
+            min[j] = value;
+          }
 
-        if(m_Source[i] > max[j])
-        {
-          max[j] = m_Source[i];
-        }
+          if(value > max[j])
+          {
+            max[j] = value;
+          }
 
-        summation[j] = summation[j] + m_Source[i];
+          summation[j] = summation[j] + value;
 
-        modalMaps[j][m_Source[i]]++;
-      }
+          modalMaps[j][value]++;
+        }
 
-      progressCount++;
-      now = std::chrono::steady_clock::now();
-      if(progressCount > progressIncrement && std::chrono::duration_cast<std::chrono::milliseconds>(now - initialTime).count() > milliDelay)
-      {
-        m_Filter->sendThreadSafeInfoMessage(fmt::format("Calculating FeatureHasData Array [{}-{}]: {:.2f}%", start, end, 100.0f * static_cast<float>(i) / static_cast<float>(numTuples)));
-        progressCount = 0;
-        initialTime = std::chrono::steady_clock::now();
+        progressCount++;
+        now = std::chrono::steady_clock::now();
+        if(progressCount > progressIncrement && std::chrono::duration_cast<std::chrono::milliseconds>(now - initialTime).count() > milliDelay)
+        {
+          m_Filter->sendThreadSafeInfoMessage(fmt::format("Calculating FeatureHasData Array [{}-{}]: {:.2f}%", start, end, 100.0f * static_cast<float>(i) / static_cast<float>(numTuples)));
+          progressCount = 0;
+          initialTime = std::chrono::steady_clock::now();
+        }
       }
     }
 
@@ -145,7 +157,7 @@ public:
     progressIncrement = numCurrentFeatures / 100;
     progressCount = 0;
     std::vector<float32> meanArray;
-    if(m_StdDeviation && !m_Mean)
+    if(m_StdDeviation)
     {
       meanArray.resize(numCurrentFeatures);
     }
@@ -192,7 +204,7 @@ public:
       {
         m_MeanArray->initializeTuple(j, meanValue);
       }
-      else if(m_StdDeviation)
+      if(m_StdDeviation)
       {
         meanArray[localFeatureIndex] = meanValue;
       }
@@ -258,25 +270,31 @@ public:
           }
           else
           {
-            for(usize i = 0; i < numTuples; ++i)
+            for(usize chunkStart = 0; chunkStart < numTuples; chunkStart += k_ChunkSize)
             {
-              if(shouldCancel)
-              {
-                return;
-              }
-              if(m_Mask != nullptr && !m_Mask->isTrue(i))
-              {
-                continue;
-              }
-              if((*m_FeatureIds)[i] != static_cast<int32>(j))
+              const usize chunkSize = std::min(k_ChunkSize, numTuples - chunkStart);
+              const auto featureIdsChunk = featureIdsStore.createChunkView(chunkStart, chunkSize);
+              const auto sourceChunk = sourceStore.createChunkView(chunkStart, chunkSize);
+              for(usize chunkIndex = 0; chunkIndex < chunkSize; chunkIndex++)
               {
-                continue;
-              }
-              const T value = m_Source[i];
-              const auto bin = static_cast<int32>(HistogramUtilities::serial::CalculateBin(value, histMin, increment)); // find bin for this input array value
-              if((bin >= 0) && (bin < m_NumBins))                                                                       // make certain bin is in range
-              {
-                histogram[bin]++; // increment histogram element corresponding to this input array value
+                if(shouldCancel)
+                {
+                  return;
+                }
+                if(!m_Mask.isTrue(chunkStart + chunkIndex))
+                {
+                  continue;
+                }
+                if(featureIdsChunk[chunkIndex] != static_cast<int32>(j))
+                {
+                  continue;
+                }
+                const T value = sourceChunk[chunkIndex];
+                const auto bin = static_cast<int32>(HistogramUtilities::serial::CalculateBin(value, histMin, increment)); // find bin for this input array value
+                if((bin >= 0) && (bin < m_NumBins))                                                                       // make certain bin is in range
+                {
+                  histogram[bin]++; // increment histogram element corresponding to this input array value
+                }
               }
             } // end of numTuples loop
           }   // end of increment else
@@ -332,34 +350,43 @@ public:
       std::vector<float64> sumOfDiffs(numCurrentFeatures, 0.0f);
       progressCount = 0;
 
-      for(usize tupleIndex = 0; tupleIndex < numTuples; tupleIndex++)
+      for(usize chunkStart = 0; chunkStart < numTuples; chunkStart += k_ChunkSize)
       {
-        if(shouldCancel)
+        const usize chunkSize = std::min(k_ChunkSize, numTuples - chunkStart);
+        const auto featureIdsChunk = featureIdsStore.createChunkView(chunkStart, chunkSize);
+        const auto sourceChunk = sourceStore.createChunkView(chunkStart, chunkSize);
+        for(usize chunkIndex = 0; chunkIndex < chunkSize; chunkIndex++)
         {
-          return;
-        }
-        // Is the value in a mask and if so, is that mask TRUE
-        if(m_Mask != nullptr && !m_Mask->isTrue(tupleIndex))
-        {
-          continue;
-        }
-        // Is the featureId within our range that we care about
-        const int32 featureId = (*m_FeatureIds)[tupleIndex];
-        if(featureId < start || featureId >= end)
-        {
-          continue;
-        }
+          const usize tupleIndex = chunkStart + chunkIndex;
+          if(shouldCancel)
+          {
+            return;
+          }
+          // Is the value in a mask and if so, is that mask TRUE
+          if(!m_Mask.isTrue(tupleIndex))
+          {
+            continue;
+          }
+          // Is the featureId within our range that we care about
+          const int32 featureId = featureIdsChunk[chunkIndex];
+          if(featureId < start || featureId >= end)
+          {
+            continue;
+          }
 
-        const float32 meanVal = m_Mean ? m_MeanArray->operator[](featureId) : meanArray[featureId - start];
-        sumOfDiffs[featureId - start] += static_cast<float64>((m_Source[tupleIndex] - meanVal) * (m_Source[tupleIndex] - meanVal));
+          const float32 meanVal = meanArray[featureId - start];
+          const T value = sourceChunk[chunkIndex];
+          sumOfDiffs[featureId - start] += static_cast<float64>((value - meanVal) * (value - meanVal));
 
-        progressCount++;
-        now = std::chrono::steady_clock::now();
-        if(progressCount > progressIncrement && std::chrono::duration_cast<std::chrono::milliseconds>(now - initialTime).count() > milliDelay)
-        {
-          m_Filter->sendThreadSafeInfoMessage(fmt::format("StdDev Calculation Feature/Ensemble [{}-{}]: {:.2f}%", start, end, 100.0f * static_cast<float>(tupleIndex) / static_cast<float>(numTuples)));
-          progressCount = 0;
-          initialTime = std::chrono::steady_clock::now();
+          progressCount++;
+          now = std::chrono::steady_clock::now();
+          if(progressCount > progressIncrement && std::chrono::duration_cast<std::chrono::milliseconds>(now - initialTime).count() > milliDelay)
+          {
+            m_Filter->sendThreadSafeInfoMessage(
+                fmt::format("StdDev Calculation Feature/Ensemble [{}-{}]: {:.2f}%", start, end, 100.0f * static_cast<float>(tupleIndex) / static_cast<float>(numTuples)));
+            progressCount = 0;
+            initialTime = std::chrono::steady_clock::now();
+          }
         }
       }
 
@@ -392,7 +419,7 @@ private:
   float64 m_HistMax;
   bool m_HistFullRange;
   int32 m_NumBins;
-  const std::unique_ptr<MaskCompare>& m_Mask = nullptr;
+  const MaskT& m_Mask;
   const Int32Array* m_FeatureIds = nullptr;
   const DataArray<T>& m_Source;
   BoolArray* m_FeatureHasDataArray = nullptr;
@@ -410,11 +437,11 @@ private:
   ComputeArrayStatistics* m_Filter = nullptr;
 };
 
-template <typename T>
+template <typename T, typename MaskT>
 class FindArrayMedianUniqueByIndexImpl
 {
 public:
-  FindArrayMedianUniqueByIndexImpl(const std::unique_ptr<MaskCompare>& mask, const Int32Array* featureIds, const DataArray<T>& source, bool findMedian, bool findNumUnique, Float32Array* medianArray,
+  FindArrayMedianUniqueByIndexImpl(const MaskT& mask, const Int32Array* featureIds, const DataArray<T>& source, bool findMedian, bool findNumUnique, Float32Array* medianArray,
                                    Int32Array* numUniqueValuesArray, DataArray<uint64>* lengthArray, ComputeArrayStatistics* filter)
   : m_FindMedian(findMedian)
   , m_FindNumUniqueValues(findNumUnique)
@@ -450,20 +477,26 @@ public:
     const auto& featureIds = m_FeatureIds->getDataStoreRef();
     const auto& source = m_Source.getDataStoreRef();
 
-    for(usize tupleIndex = 0; tupleIndex < numTuples; tupleIndex++)
+    for(usize chunkStart = 0; chunkStart < numTuples; chunkStart += k_ChunkSize)
     {
-      // Is the value in a mask and if so, is that mask TRUE
-      if(m_Mask != nullptr && !m_Mask->isTrue(tupleIndex))
-      {
-        continue;
-      }
-      // Is the featureId within our range that we care about
-      const int32 featureId = featureIds[tupleIndex];
-      if(featureId < start || featureId >= end)
+      const usize chunkSize = std::min(k_ChunkSize, numTuples - chunkStart);
+      const auto featureIdsChunk = featureIds.createChunkView(chunkStart, chunkSize);
+      const auto sourceChunk = source.createChunkView(chunkStart, chunkSize);
+      for(usize chunkIndex = 0; chunkIndex < chunkSize; chunkIndex++)
       {
-        continue;
+        // Is the value in a mask and if so, is that mask TRUE
+        if(!m_Mask.isTrue(chunkStart + chunkIndex))
+        {
+          continue;
+        }
+        // Is the featureId within our range that we care about
+        const int32 featureId = featureIdsChunk[chunkIndex];
+        if(featureId < start || featureId >= end)
+        {
+          continue;
+        }
+        featureSources[featureId - start].push_back(sourceChunk[chunkIndex]);
       }
-      featureSources[featureId - start].push_back(source[tupleIndex]);
     }
 
     for(usize featureSourceIndex = 0; featureSourceIndex < numFeatureSources; featureSourceIndex++)
@@ -491,7 +524,7 @@ private:
   bool m_FindNumUniqueValues;
   Float32Array* m_MedianArray;
   Int32Array* m_NumUniqueValuesArray;
-  const std::unique_ptr<MaskCompare>& m_Mask = nullptr;
+  const MaskT& m_Mask;
   const Int32Array* m_FeatureIds = nullptr;
   const DataArray<T>& m_Source;
   const DataArray<uint64>* m_LengthArray = nullptr;
@@ -690,8 +723,8 @@ void FindStatisticsImpl(const ContainerType& data, std::vector<IArray*>& arrays,
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void FindStatistics(const DataArray<T>& source, const Int32Array* featureIds, const std::unique_ptr<MaskCompare>& mask, const ComputeArrayStatisticsInputValues* inputValues,
+template <typename T, typename MaskT>
+void FindStatistics(const DataArray<T>& source, const Int32Array* featureIds, const MaskT& mask, const ComputeArrayStatisticsInputValues* inputValues,
                     std::vector<IArray*>& arrays, usize numFeatures, ComputeArrayStatistics* filter)
 {
   if(inputValues->ComputeByIndex)
@@ -731,7 +764,7 @@ void FindStatistics(const DataArray<T>& source, const Int32Array* featureIds, co
       const size_t grainSize = 500;
       const tbb::blocked_range<size_t> tbbRange(0, numFeatures, grainSize);
       tbb::parallel_for(tbbRange,
-                        ComputeArrayStatisticsByIndexImpl<T>(inputValues->FindLength, inputValues->FindMin, inputValues->FindMax, inputValues->FindMean, inputValues->FindMode,
+                        ComputeArrayStatisticsByIndexImpl<T, MaskT>(inputValues->FindLength, inputValues->FindMin, inputValues->FindMax, inputValues->FindMean, inputValues->FindMode,
                                                              inputValues->FindStdDeviation, inputValues->FindSummation, inputValues->FindHistogram, inputValues->MinRange, inputValues->MaxRange,
                                                              inputValues->UseFullRange, inputValues->NumBins, inputValues->FindModalBinRanges, mask, featureIds, source, featureHasDataPtr,
                                                              lengthArrayPtr, minArrayPtr, maxArrayPtr, meanArrayPtr, modeArrayPtr, stdDevArrayPtr, summationArrayPtr, histBinCountsArrayPtr,
@@ -743,7 +776,7 @@ void FindStatistics(const DataArray<T>& source, const Int32Array* featureIds, co
       ParallelDataAlgorithm indexAlg;
       indexAlg.setRange(0, numFeatures);
       indexAlg.requireArraysInMemory(indexAlgArrays);
-      indexAlg.execute(ComputeArrayStatisticsByIndexImpl<T>(inputValues->FindLength, inputValues->FindMin, inputValues->FindMax, inputValues->FindMean, inputValues->FindMode,
+      indexAlg.execute(ComputeArrayStatisticsByIndexImpl<T, MaskT>(inputValues->FindLength, inputValues->FindMin, inputValues->FindMax, inputValues->FindMean, inputValues->FindMode,
                                                             inputValues->FindStdDeviation, inputValues->FindSummation, inputValues->FindHistogram, inputValues->MinRange, inputValues->MaxRange,
                                                             inputValues->UseFullRange, inputValues->NumBins, inputValues->FindModalBinRanges, mask, featureIds, source, featureHasDataPtr,
                                                             lengthArrayPtr, minArrayPtr, maxArrayPtr, meanArrayPtr, modeArrayPtr, stdDevArrayPtr, summationArrayPtr, histBinCountsArrayPtr,
@@ -769,7 +802,7 @@ void FindStatistics(const DataArray<T>& source, const Int32Array* featureIds, co
       medianDataAlg.requireArraysInMemory(medianAlgArrays);
       medianDataAlg.setRange(0, numFeatures);
       medianDataAlg.execute(
-          FindArrayMedianUniqueByIndexImpl<T>(mask, featureIds, source, inputValues->FindMedian, inputValues->FindNumUniqueValues, medianArrayPtr, numUniqueValuesArrayPtr, lengthArrayPtr, filter));
+          FindArrayMedianUniqueByIndexImpl<T, MaskT>(mask, featureIds, source, inputValues->FindMedian, inputValues->FindNumUniqueValues, medianArrayPtr, numUniqueValuesArrayPtr, lengthArrayPtr, filter));
     }
   }
   else
@@ -783,7 +816,7 @@ void FindStatistics(const DataArray<T>& source, const Int32Array* featureIds, co
       data.reserve(numTuples);
       for(usize i = 0; i < numTuples; i++)
       {
-        if(mask->isTrue(i))
+        if(mask.isTrue(i))
         {
           data.push_back(source[i]);
         }
@@ -801,8 +834,8 @@ void FindStatistics(const DataArray<T>& source, const Int32Array* featureIds, co
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void StandardizeDataByIndex(const DataArray<T>& dataArray, bool useMask, const std::unique_ptr<MaskCompare>& mask, const Int32Array* featureIdsArray, const Float32Array& muArray,
+template <typename T, typename MaskT>
+void StandardizeDataByIndex(const DataArray<T>& dataArray, const MaskT& mask, const Int32Array* featureIdsArray, const Float32Array& muArray,
                             const Float32Array& sigArray, Float32Array& standardizedArray)
 {
   auto& data = dataArray.getDataStoreRef();
@@ -814,14 +847,7 @@ void StandardizeDataByIndex(const DataArray<T>& dataArray, bool useMask, const s
   const usize numTuples = data.getNumberOfTuples();
   for(usize i = 0; i < numTuples; i++)
   {
-    if(useMask)
-    {
-      if(mask->isTrue(i))
-      {
-        standardized.setValue(i, (static_cast<float32>(data[i]) - mu[featureIds.at(i)]) / sig[featureIds.at(i)]);
-      }
-    }
-    else
+    if(mask.isTrue(i))
     {
       standardized.setValue(i, (static_cast<float32>(data[i]) - mu[featureIds.at(i)]) / sig[featureIds.at(i)]);
     }
@@ -829,8 +855,8 @@ void StandardizeDataByIndex(const DataArray<T>& dataArray, bool useMask, const s
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void StandardizeData(const DataArray<T>& dataArray, bool useMask, const std::unique_ptr<MaskCompare>& mask, const Float32Array& muArray, const Float32Array& sigArray, Float32Array& standardizedArray)
+template <typename T, typename MaskT>
+void StandardizeData(const DataArray<T>& dataArray, const MaskT& mask, const Float32Array& muArray, const Float32Array& sigArray, Float32Array& standardizedArray)
 {
   auto& data = dataArray.getDataStoreRef();
   auto& standardized = standardizedArray.getDataStoreRef();
@@ -841,14 +867,7 @@ void StandardizeData(const DataArray<T>& dataArray, bool useMask, const std::uni
 
   for(usize i = 0; i < numTuples; i++)
   {
-    if(useMask)
-    {
-      if(mask->isTrue(i))
-      {
-        standardized.setValue(i, (static_cast<float32>(data[i]) - mu[0]) / sig[0]);
-      }
-    }
-    else
+    if(mask.isTrue(i))
     {
       standardized.setValue(i, (static_cast<float32>(data[i]) - mu[0]) / sig[0]);
     }
@@ -868,13 +887,11 @@ struct ComputeArrayStatisticsFunctor
     {
       featureIdsPtr = dataStructure.getDataAs<Int32Array>(inputValues->FeatureIdsArrayPath);
     }
-    std::unique_ptr<MaskCompare> maskCompare = nullptr;
+    const IDataArray* maskArray = nullptr;
     if(inputValues->UseMask)
     {
-      try
-      {
-        maskCompare = InstantiateMaskCompare(dataStructure, inputValues->MaskArrayPath);
-      } catch(const std::out_of_range& exception)
+      maskArray = dataStructure.getDataAs<IDataArray>(inputValues->MaskArrayPath);
+      if(maskArray == nullptr || (maskArray->getDataType() != DataType::boolean && maskArray->getDataType() != DataType::uint8))
       {
         // This really should NOT be happening as the path was verified during preflight BUT we may be calling this from
         // somewhere else that is NOT going through the normal nx::core::IFilter API of Preflight and Execute
@@ -996,25 +1013,28 @@ struct ComputeArrayStatisticsFunctor
     }
     // End Initialization
 
-    // this level checks whether computing by index or not and preps the calculations accordingly
-    FindStatistics<T>(inputArray, featureIdsPtr, maskCompare, inputValues, arrays, numFeatures, filter);
-
-    // compute the standardized data based on whether computing by index or not
-    if(inputValues->StandardizeData)
-    {
-      const auto& mean = dataStructure.getDataRefAs<Float32Array>(inputValues->MeanArrayName);
-      const auto& std = dataStructure.getDataRefAs<Float32Array>(inputValues->StdDeviationArrayName);
-      auto& standardized = dataStructure.getDataRefAs<Float32Array>(inputValues->StandardizedArrayName);
+    // The type of the mask is resolved once here so the per tuple mask checks below are inlined
+    ExecuteWithMaskView(maskArray, [&](const auto& mask) {
+      // this level checks whether computing by index or not and preps the calculations accordingly
+      FindStatistics<T>(inputArray, featureIdsPtr, mask, inputValues, arrays, numFeatures, filter);
 
-      if(inputValues->ComputeByIndex)
+      // compute the standardized data based on whether computing by index or not
+      if(inputValues->StandardizeData)
       {
-        StandardizeDataByIndex<T>(inputArray, inputValues->UseMask, maskCompare, featureIdsPtr, mean, std, standardized);
-      }
-      else
-      {
-        StandardizeData<T>(inputArray, inputValues->UseMask, maskCompare, mean, std, standardized);
+        const auto& mean = dataStructure.getDataRefAs<Float32Array>(inputValues->MeanArrayName);
+        const auto& std = dataStructure.getDataRefAs<Float32Array>(inputValues->StdDeviationArrayName);
+        auto& standardized = dataStructure.getDataRefAs<Float32Array>(inputValues->StandardizedArrayName);
+
+        if(inputValues->ComputeByIndex)
+        {
+          StandardizeDataByIndex<T>(inputArray, mask, featureIdsPtr, mean, std, standardized);
+        }
+        else
+        {
+          StandardizeData<T>(inputArray, mask, mean, std, standardized);
+        }
       }
-    }
+    });
     return {};
   }
 };
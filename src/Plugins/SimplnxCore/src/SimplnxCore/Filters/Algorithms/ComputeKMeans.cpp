@@ -15,12 +15,12 @@ template <typename T>
 class ComputeKMeansTemplate
 {
 public:
-  ComputeKMeansTemplate(ComputeKMeans* filter, const IDataArray* inputIDataArray, IDataArray* meansIDataArray, const std::unique_ptr<MaskCompare>& maskDataArray, usize numClusters,
+  ComputeKMeansTemplate(ComputeKMeans* filter, const IDataArray* inputIDataArray, IDataArray* meansIDataArray, const std::vector<uint8>& mask, usize numClusters,
                         Int32AbstractDataStore& fIds, ClusterUtilities::DistanceMetric distMetric, std::mt19937_64::result_type seed)
   : m_Filter(filter)
   , m_InputArray(inputIDataArray->template getIDataStoreRefAs<AbstractDataStoreT>())
   , m_Means(meansIDataArray->template getIDataStoreRefAs<AbstractDataStoreT>())
-  , m_Mask(maskDataArray)
+  , m_Mask(mask)
   , m_NumClusters(numClusters)
   , m_FeatureIds(fIds)
   , m_DistMetric(distMetric)
@@ -33,10 +33,10 @@ public:
   void operator=(const ComputeKMeansTemplate&) = delete;        // Move assignment Not Implemented
 
   // -----------------------------------------------------------------------------
-  void operator()()
+  Result<> operator()()
   {
     usize numTuples = m_InputArray.getNumberOfTuples();
-    int32 numCompDims = m_InputArray.getNumberOfComponents();
+    usize numComps = m_InputArray.getNumberOfComponents();
 
     const usize rangeMax = numTuples - 1;
 
@@ -49,54 +49,44 @@ public:
     while(clusterChoices < m_NumClusters)
     {
       usize index = std::floor(dist(gen) * static_cast<float64>(rangeMax));
-      if(m_Mask->isTrue(index))
+      if(m_Mask[index] != 0)
       {
         clusterIdxs[clusterChoices] = index;
         clusterChoices++;
       }
     }
 
+    std::vector<float64> means((m_NumClusters + 1) * numComps, 0.0);
     for(usize i = 0; i < m_NumClusters; i++)
     {
-      for(int32 j = 0; j < numCompDims; j++)
+      for(usize j = 0; j < numComps; j++)
       {
-        m_Means[numCompDims * (i + 1) + j] = m_InputArray[numCompDims * clusterIdxs[i] + j];
+        means[numComps * (i + 1) + j] = static_cast<float64>(m_InputArray[numComps * clusterIdxs[i] + j]);
       }
     }
 
-    std::vector<float64> oldMeans(m_NumClusters);
-    std::vector<float64> differences(m_NumClusters);
-    usize iteration = 1;
-    usize updateCheck = 0;
-    while(updateCheck != m_NumClusters)
+    std::vector<int32> labels(numTuples, 0);
+    Result<> readResult = m_FeatureIds.copyIntoBuffer(0, nonstd::span<int32>(labels.data(), labels.size()));
+    if(readResult.invalid())
     {
-      if(m_Filter->getCancel())
-      {
-        return;
-      }
-      findClusters(numTuples, numCompDims);
-
-      for(usize i = 0; i < m_NumClusters; i++)
-      {
-        oldMeans[i] = m_Means[i + 1];
-      }
-
-      findMeans(numTuples, numCompDims);
+      return readResult;
+    }
 
-      updateCheck = 0;
-      for(usize i = 0; i < m_NumClusters; i++)
-      {
-        differences[i] = oldMeans[i] - m_Means[i + 1];
-        if(closeEnough<float64>(differences[i], 0.0))
-        {
-          updateCheck++;
-        }
-      }
+    ClusterUtilities::VisitDistanceMetric(m_DistMetric, [&](auto metric) {
+      ClusterUtilities::RunKMeans<decltype(metric)::value>(m_InputArray, m_Mask, m_NumClusters, labels, means, m_Filter->getCancel(), [this](usize iteration, float64 totalShift) {
+        m_Filter->updateProgress(fmt::format("Clustering Data || Iteration {} || Total Mean Shift: {}", iteration, totalShift));
+      });
+    });
+    if(m_Filter->getCancel())
+    {
+      return {};
+    }
 
-      float64 sum = std::accumulate(std::begin(differences), std::end(differences), 0.0);
-      m_Filter->updateProgress(fmt::format("Clustering Data || Iteration {} || Total Mean Shift: {}", iteration, sum));
-      iteration++;
+    for(usize i = 0; i < means.size(); i++)
+    {
+      m_Means[i] = static_cast<T>(means[i]);
     }
+    return m_FeatureIds.copyFromBuffer(0, nonstd::span<const int32>(labels.data(), labels.size()));
   }
 
 private:
@@ -104,79 +94,11 @@ private:
   ComputeKMeans* m_Filter;
   const AbstractDataStoreT& m_InputArray;
   AbstractDataStoreT& m_Means;
-  const std::unique_ptr<MaskCompare>& m_Mask;
+  const std::vector<uint8>& m_Mask;
   usize m_NumClusters;
   Int32AbstractDataStore& m_FeatureIds;
   ClusterUtilities::DistanceMetric m_DistMetric;
   std::mt19937_64::result_type m_Seed;
-
-  // -----------------------------------------------------------------------------
-  template <typename K>
-  bool closeEnough(const K& a, const K& b, const K& epsilon = std::numeric_limits<K>::epsilon())
-  {
-    return (epsilon > fabs(a - b));
-  }
-
-  // -----------------------------------------------------------------------------
-  void findClusters(usize tuples, int32 dims)
-  {
-    for(usize i = 0; i < tuples; i++)
-    {
-      if(m_Filter->getCancel())
-      {
-        return;
-      }
-      if(m_Mask->isTrue(i))
-      {
-        float64 minDist = std::numeric_limits<float64>::max();
-        for(int32 j = 0; j < m_NumClusters; j++)
-        {
-          float64 dist = ClusterUtilities::GetDistance(m_InputArray, (dims * i), m_Means, (dims * (j + 1)), dims, m_DistMetric);
-          if(dist < minDist)
-          {
-            minDist = dist;
-            m_FeatureIds[i] = j + 1;
-          }
-        }
-      }
-    }
-  }
-
-  // -----------------------------------------------------------------------------
-  void findMeans(usize tuples, int32 dims)
-  {
-    std::vector<usize> counts(m_NumClusters + 1, 0);
-
-    for(usize i = 0; i <= m_NumClusters; i++)
-    {
-      for(usize j = 0; j < dims; j++)
-      {
-        m_Means[dims * i + j] = 0.0;
-      }
-    }
-
-    for(usize i = 0; i < dims; i++)
-    {
-      for(usize j = 0; j < tuples; j++)
-      {
-        int32 feature = m_FeatureIds[j];
-        m_Means[dims * feature + i] += static_cast<float64>(m_InputArray[dims * j + i]);
-        counts[feature] += 1;
-      }
-      for(usize j = 0; j <= m_NumClusters; j++)
-      {
-        if(counts[j] == 0)
-        {
-          m_Means[dims * j + i] = 0.0;
-        }
-        else
-        {
-          m_Means[dims * j + i] /= static_cast<float64>(counts[j]);
-        }
-      }
-      std::fill(std::begin(counts), std::end(counts), 0);
-    }
-  }
 };
 } // namespace
 
@@ -209,11 +131,8 @@ Result<> ComputeKMeans::operator()()
 {
   auto* clusteringArray = m_DataStructure.getDataAs<IDataArray>(m_InputValues->ClusteringArrayPath);
 
-  std::unique_ptr<MaskCompare> maskCompare;
-  try
-  {
-    maskCompare = InstantiateMaskCompare(m_DataStructure, m_InputValues->MaskArrayPath);
-  } catch(const std::out_of_range& exception)
+  const auto* maskArray = m_DataStructure.getDataAs<IDataArray>(m_InputValues->MaskArrayPath);
+  if(maskArray == nullptr || (maskArray->getDataType() != DataType::boolean && maskArray->getDataType() != DataType::uint8))
   {
     // This really should NOT be happening as the path was verified during preflight BUT we may be calling this from
     // somewhere else that is NOT going through the normal nx::core::IFilter API of Preflight and Execute
@@ -221,9 +140,11 @@ Result<> ComputeKMeans::operator()()
     return MakeErrorResult(-54060, message);
   }
 
-  RunTemplateClass<ComputeKMeansTemplate, types::NoBooleanType>(clusteringArray->getDataType(), this, clusteringArray, m_DataStructure.getDataAs<IDataArray>(m_InputValues->MeansArrayPath),
-                                                                maskCompare, m_InputValues->InitClusters, m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef(),
-                                                                m_InputValues->DistanceMetric, m_InputValues->Seed);
+  // The mask is read once into a flat vector that is shared by the worker threads
+  const usize numTuples = clusteringArray->getNumberOfTuples();
+  const std::vector<uint8> mask = ExecuteWithMaskView(maskArray, [numTuples](const auto& maskView) { return ClusterUtilities::ReadMask(maskView, numTuples); });
 
-  return {};
+  return RunTemplateClass<ComputeKMeansTemplate, types::NoBooleanType>(clusteringArray->getDataType(), this, clusteringArray, m_DataStructure.getDataAs<IDataArray>(m_InputValues->MeansArrayPath),
+                                                                       mask, m_InputValues->InitClusters, m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef(),
+                                                                       m_InputValues->DistanceMetric, m_InputValues->Seed);
 }
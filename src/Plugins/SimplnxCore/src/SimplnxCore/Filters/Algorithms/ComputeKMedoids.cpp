@@ -5,6 +5,7 @@
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
 
+#include <numeric>
 #include <random>
 
 using namespace nx::core;
@@ -15,12 +16,12 @@ template <typename T>
 class KMedoidsTemplate
 {
 public:
-  KMedoidsTemplate(ComputeKMedoids* filter, const IDataArray* inputIDataArray, IDataArray* medoidsIDataArray, const std::unique_ptr<MaskCompare>& maskDataArray, usize numClusters,
+  KMedoidsTemplate(ComputeKMedoids* filter, const IDataArray* inputIDataArray, IDataArray* medoidsIDataArray, const std::vector<uint8>& mask, usize numClusters,
                    Int32AbstractDataStore& fIds, ClusterUtilities::DistanceMetric distMetric, std::mt19937_64::result_type seed)
   : m_Filter(filter)
   , m_InputArray(inputIDataArray->template getIDataStoreRefAs<AbstractDataStore<T>>())
   , m_Medoids(medoidsIDataArray->template getIDataStoreRefAs<AbstractDataStore<T>>())
-  , m_Mask(maskDataArray)
+  , m_Mask(mask)
   , m_NumClusters(numClusters)
   , m_FeatureIds(fIds)
   , m_DistMetric(distMetric)
@@ -33,10 +34,10 @@ public:
   void operator=(const KMedoidsTemplate&) = delete;   // Move assignment Not Implemented
 
   // -----------------------------------------------------------------------------
-  void operator()()
+  Result<> operator()()
   {
     usize numTuples = m_InputArray.getNumberOfTuples();
-    int32 numCompDims = m_InputArray.getNumberOfComponents();
+    usize numComps = m_InputArray.getNumberOfComponents();
 
     std::mt19937_64 gen(m_Seed);
     std::uniform_int_distribution<usize> dist(0, numTuples - 1);
@@ -47,44 +48,73 @@ public:
     while(clusterChoices < m_NumClusters)
     {
       usize index = dist(gen);
-      if(m_Mask->isTrue(index))
+      if(m_Mask[index] != 0)
       {
         clusterIdxs[clusterChoices] = index;
         clusterChoices++;
       }
     }
 
-    for(usize i = 0; i < m_NumClusters; i++)
+    std::vector<int32> labels(numTuples, 0);
+    Result<> readResult = m_FeatureIds.copyIntoBuffer(0, nonstd::span<int32>(labels.data(), labels.size()));
+    if(readResult.invalid())
     {
-      for(int32 j = 0; j < numCompDims; j++)
-      {
-        m_Medoids[numCompDims * (i + 1) + j] = m_InputArray[numCompDims * clusterIdxs[i] + j];
-      }
+      return readResult;
     }
 
-    findClusters(numTuples, numCompDims);
+    ClusterUtilities::VisitDistanceMetric(m_DistMetric, [&](auto metric) {
+      constexpr ClusterUtilities::DistanceMetric k_Metric = decltype(metric)::value;
+      const std::atomic_bool& shouldCancel = m_Filter->getCancel();
+      std::vector<float64> medoids(m_NumClusters * numComps);
 
-    std::vector<usize> optClusterIdxs(clusterIdxs);
+      auto findClusters = [&]() {
+        for(usize i = 0; i < m_NumClusters; i++)
+        {
+          for(usize j = 0; j < numComps; j++)
+          {
+            medoids[numComps * i + j] = static_cast<float64>(m_InputArray[numComps * clusterIdxs[i] + j]);
+          }
+        }
+        ClusterUtilities::AssignToNearestCenter<k_Metric>(m_InputArray, m_Mask, medoids.data(), m_NumClusters, labels, shouldCancel);
+      };
 
-    std::vector<float64> costs = optimizeClusters(numTuples, numCompDims, clusterIdxs);
+      findClusters();
 
-    bool update = optClusterIdxs == clusterIdxs ? false : true;
-    usize iteration = 1;
+      std::vector<usize> optClusterIdxs(clusterIdxs);
 
-    while(update)
-    {
-      findClusters(numTuples, numCompDims);
+      std::vector<float64> costs = ClusterUtilities::UpdateMedoids<k_Metric>(m_InputArray, m_Mask, m_NumClusters, labels, clusterIdxs, shouldCancel);
 
-      optClusterIdxs = clusterIdxs;
+      bool update = optClusterIdxs == clusterIdxs ? false : true;
+      usize iteration = 1;
 
-      costs = optimizeClusters(numTuples, numCompDims, clusterIdxs);
+      while(update && !shouldCancel)
+      {
+        findClusters();
+
+        optClusterIdxs = clusterIdxs;
+
+        costs = ClusterUtilities::UpdateMedoids<k_Metric>(m_InputArray, m_Mask, m_NumClusters, labels, clusterIdxs, shouldCancel);
+
+        update = optClusterIdxs == clusterIdxs ? false : true;
 
-      update = optClusterIdxs == clusterIdxs ? false : true;
+        float64 sum = std::accumulate(std::begin(costs), std::end(costs), 0.0);
+        m_Filter->updateProgress(fmt::format("Clustering Data || Iteration {} || Total Cost: {}", iteration, sum));
+        iteration++;
+      }
+    });
+    if(m_Filter->getCancel())
+    {
+      return {};
+    }
 
-      float64 sum = std::accumulate(std::begin(costs), std::end(costs), 0.0);
-      m_Filter->updateProgress(fmt::format("Clustering Data || Iteration {} || Total Cost: {}", iteration, sum));
-      iteration++;
+    for(usize i = 0; i < m_NumClusters; i++)
+    {
+      for(usize j = 0; j < numComps; j++)
+      {
+        m_Medoids[numComps * (i + 1) + j] = m_InputArray[numComps * clusterIdxs[i] + j];
+      }
     }
+    return m_FeatureIds.copyFromBuffer(0, nonstd::span<const int32>(labels.data(), labels.size()));
   }
 
 private:
@@ -93,91 +123,11 @@ private:
   ComputeKMedoids* m_Filter;
   const AbstractDataStoreT& m_InputArray;
   AbstractDataStoreT& m_Medoids;
-  const std::unique_ptr<MaskCompare>& m_Mask;
+  const std::vector<uint8>& m_Mask;
   usize m_NumClusters;
   Int32AbstractDataStore& m_FeatureIds;
   ClusterUtilities::DistanceMetric m_DistMetric;
   std::mt19937_64::result_type m_Seed;
-
-  // -----------------------------------------------------------------------------
-  void findClusters(usize tuples, int32 dims)
-  {
-    for(usize i = 0; i < tuples; i++)
-    {
-      if(m_Filter->getCancel())
-      {
-        return;
-      }
-      if(m_Mask->isTrue(i))
-      {
-        float64 minDist = std::numeric_limits<float64>::max();
-        for(int32 j = 0; j < m_NumClusters; j++)
-        {
-          float64 dist = ClusterUtilities::GetDistance(m_InputArray, (dims * i), m_Medoids, (dims * (j + 1)), dims, m_DistMetric);
-          if(dist < minDist)
-          {
-            minDist = dist;
-            m_FeatureIds[i] = j + 1;
-          }
-        }
-      }
-    }
-  }
-
-  // -----------------------------------------------------------------------------
-  std::vector<float64> optimizeClusters(usize tuples, int32 dims, std::vector<usize>& clusterIdxs)
-  {
-    std::vector<float64> minCosts(m_NumClusters, std::numeric_limits<float64>::max());
-
-    for(usize i = 0; i < m_NumClusters; i++)
-    {
-      if(m_Filter->getCancel())
-      {
-        return {};
-      }
-      for(usize j = 0; j < tuples; j++)
-      {
-        if(m_Filter->getCancel())
-        {
-          return {};
-        }
-        if(m_Mask->isTrue(j))
-        {
-          if(m_FeatureIds[j] == i + 1)
-          {
-            float64 cost = 0.0;
-            for(usize k = 0; k < tuples; k++)
-            {
-              if(m_Filter->getCancel())
-              {
-                return {};
-              }
-              if(m_FeatureIds[k] == i + 1 && m_Mask->isTrue(k))
-              {
-                cost += ClusterUtilities::GetDistance(m_InputArray, (dims * k), m_InputArray, (dims * j), dims, m_DistMetric);
-              }
-            }
-
-            if(cost < minCosts[i])
-            {
-              minCosts[i] = cost;
-              clusterIdxs[i] = j;
-            }
-          }
-        }
-      }
-    }
-
-    for(usize i = 0; i < m_NumClusters; i++)
-    {
-      for(int32 j = 0; j < dims; j++)
-      {
-        m_Medoids[dims * (i + 1) + j] = m_InputArray[dims * clusterIdxs[i] + j];
-      }
-    }
-
-    return minCosts;
-  }
 };
 } // namespace
 
@@ -209,20 +159,19 @@ const std::atomic_bool& ComputeKMedoids::getCancel()
 Result<> ComputeKMedoids::operator()()
 {
   auto* clusteringArray = m_DataStructure.getDataAs<IDataArray>(m_InputValues->ClusteringArrayPath);
-  std::unique_ptr<MaskCompare> maskCompare;
-  try
-  {
-    maskCompare = InstantiateMaskCompare(m_DataStructure, m_InputValues->MaskArrayPath);
-  } catch(const std::out_of_range& exception)
+  const auto* maskArray = m_DataStructure.getDataAs<IDataArray>(m_InputValues->MaskArrayPath);
+  if(maskArray == nullptr || (maskArray->getDataType() != DataType::boolean && maskArray->getDataType() != DataType::uint8))
   {
     // This really should NOT be happening as the path was verified during preflight BUT we may be calling this from
     // somewhere else that is NOT going through the normal nx::core::IFilter API of Preflight and Execute
     std::string message = fmt::format("Mask Array DataPath does not exist or is not of the correct type (Bool | UInt8) {}", m_InputValues->MaskArrayPath.toString());
     return MakeErrorResult(-54070, message);
   }
-  RunTemplateClass<KMedoidsTemplate, types::NoBooleanType>(clusteringArray->getDataType(), this, clusteringArray, m_DataStructure.getDataAs<IDataArray>(m_InputValues->MedoidsArrayPath), maskCompare,
-                                                           m_InputValues->InitClusters, m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef(),
-                                                           m_InputValues->DistanceMetric, m_InputValues->Seed);
 
-  return {};
+  // The mask is read once into a flat vector that is shared by the worker threads
+  const usize numTuples = clusteringArray->getNumberOfTuples();
+  const std::vector<uint8> mask = ExecuteWithMaskView(maskArray, [numTuples](const auto& maskView) { return ClusterUtilities::ReadMask(maskView, numTuples); });
+  return RunTemplateClass<KMedoidsTemplate, types::NoBooleanType>(clusteringArray->getDataType(), this, clusteringArray, m_DataStructure.getDataAs<IDataArray>(m_InputValues->MedoidsArrayPath),
+                                                                  mask, m_InputValues->InitClusters, m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef(),
+                                                                  m_InputValues->DistanceMetric, m_InputValues->Seed);
 }
@@ -71,7 +71,7 @@ Result<> ConcatenateNeighborListsImpl(DataStructure& dataStructure, const std::v
     const auto& inputNeighborList = dataStructure.getDataRefAs<NeighborList<T>>(inputNeighborListPath);
     for(int32 listIdx = 0; listIdx < inputNeighborList.getNumberOfLists(); ++listIdx)
     {
-      outputNeighborList.setList(currentOutputTuple, inputNeighborList.getList(listIdx));
+      outputNeighborList.setList(currentOutputTuple, std::make_shared<std::vector<T>>(inputNeighborList.copyOfList(listIdx)));
       currentOutputTuple++;
     }
   }
@@ -2,49 +2,208 @@
 
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelAlgorithmUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
+
+#include <algorithm>
+#include <thread>
 
 using namespace nx::core;
 
 namespace
 {
+/**
+ * @brief Copies, for every voxel that was filled, the tuple of the good voxel it was filled from.
+ * Sources are voxels that were good before the filter ran and are never written, so each array
+ * is updated by its own task in a single pass.
+ */
 template <typename T>
-void FillBadDataUpdateTuples(const Int32AbstractDataStore& featureIds, AbstractDataStore<T>& outputDataStore, const std::vector<int32>& neighbors)
+class FillBadDataUpdateTuples
 {
-  usize start = 0;
-  usize stop = outputDataStore.getNumberOfTuples();
-  const usize numComponents = outputDataStore.getNumberOfComponents();
-  for(usize tupleIndex = start; tupleIndex < stop; tupleIndex++)
+public:
+  FillBadDataUpdateTuples(IDataArray& outputIDataArray, const std::vector<int64>& sources, const std::atomic_bool& shouldCancel)
+  : m_OutputStore(outputIDataArray.template getIDataStoreRefAs<AbstractDataStore<T>>())
+  , m_Sources(sources)
+  , m_ShouldCancel(shouldCancel)
   {
-    const int32 featureName = featureIds[tupleIndex];
-    const int32 neighbor = neighbors[tupleIndex];
-    if(neighbor == tupleIndex)
-    {
-      continue;
-    }
+  }
 
-    if(featureName < 0 && neighbor != -1 && featureIds[static_cast<size_t>(neighbor)] > 0)
+  void operator()() const
+  {
+    const usize numTuples = m_OutputStore.getNumberOfTuples();
+    const usize numComponents = m_OutputStore.getNumberOfComponents();
+    for(usize tupleIndex = 0; tupleIndex < numTuples; tupleIndex++)
     {
+      const int64 source = m_Sources[tupleIndex];
+      if(source < 0)
+      {
+        continue;
+      }
+      if(m_ShouldCancel)
+      {
+        return;
+      }
       for(usize i = 0; i < numComponents; i++)
       {
-        auto value = outputDataStore[neighbor * numComponents + i];
-        outputDataStore[tupleIndex * numComponents + i] = value;
+        m_OutputStore[tupleIndex * numComponents + i] = m_OutputStore[static_cast<usize>(source) * numComponents + i];
       }
     }
   }
+
+private:
+  AbstractDataStore<T>& m_OutputStore;
+  const std::vector<int64>& m_Sources;
+  const std::atomic_bool& m_ShouldCancel;
+};
+
+/**
+ * @brief Writes the face neighbors of the voxel in the order -z, -y, -x, +x, +y, +z and returns
+ * how many there are.
+ */
+usize FindFaceNeighbors(const std::array<int64, 3>& dims, int64 index, std::array<int64, 6>& neighbors)
+{
+  const int64 column = index % dims[0];
+  const int64 row = (index / dims[0]) % dims[1];
+  const int64 plane = index / (dims[0] * dims[1]);
+
+  usize numNeighbors = 0;
+  if(plane > 0)
+  {
+    neighbors[numNeighbors++] = index - dims[0] * dims[1];
+  }
+  if(row > 0)
+  {
+    neighbors[numNeighbors++] = index - dims[0];
+  }
+  if(column > 0)
+  {
+    neighbors[numNeighbors++] = index - 1;
+  }
+  if(column < dims[0] - 1)
+  {
+    neighbors[numNeighbors++] = index + 1;
+  }
+  if(row < dims[1] - 1)
+  {
+    neighbors[numNeighbors++] = index + dims[0];
+  }
+  if(plane < dims[2] - 1)
+  {
+    neighbors[numNeighbors++] = index + dims[0] * dims[1];
+  }
+  return numNeighbors;
 }
 
-struct FillBadDataUpdateTuplesFunctor
+/**
+ * @brief Returns the face neighbor whose feature the bad voxel takes: the neighbor at which a
+ * feature first holds more of the good neighbors than any other, or -1 if there are no good
+ * neighbors.
+ */
+int64 VoteForSource(nonstd::span<const int32> featureIds, const std::array<int64, 3>& dims, int64 index)
 {
-  template <typename T>
-  void operator()(const Int32AbstractDataStore& featureIds, IDataArray* outputIDataArray, const std::vector<int32>& neighbors)
+  std::array<int64, 6> neighbors = {};
+  const usize numNeighbors = FindFaceNeighbors(dims, index, neighbors);
+
+  std::array<int32, 6> features = {};
+  std::array<int32, 6> counts = {};
+  usize numFeatures = 0;
+  int32 most = 0;
+  int64 source = -1;
+  for(usize j = 0; j < numNeighbors; j++)
   {
-    auto& outputStore = outputIDataArray->template getIDataStoreRefAs<AbstractDataStore<T>>();
-    FillBadDataUpdateTuples(featureIds, outputStore, neighbors);
+    const int32 feature = featureIds[neighbors[j]];
+    if(feature <= 0)
+    {
+      continue;
+    }
+    usize featureIndex = 0;
+    while(featureIndex < numFeatures && features[featureIndex] != feature)
+    {
+      featureIndex++;
+    }
+    if(featureIndex == numFeatures)
+    {
+      features[numFeatures] = feature;
+      counts[numFeatures] = 0;
+      numFeatures++;
+    }
+    counts[featureIndex]++;
+    if(counts[featureIndex] > most)
+    {
+      most = counts[featureIndex];
+      source = neighbors[j];
+    }
   }
-};
+  return source;
+}
+
+/**
+ * @brief Union-find over voxel indices where a root holds the negated size of its region.
+ * Concurrent callers must only touch indices of disjoint regions.
+ */
+int64 FindRegionRoot(std::vector<int64>& parents, int64 index)
+{
+  while(parents[index] >= 0)
+  {
+    const int64 parent = parents[index];
+    if(parents[parent] >= 0)
+    {
+      parents[index] = parents[parent];
+    }
+    index = parent;
+  }
+  return index;
+}
+
+int64 FindRegionRootConst(const std::vector<int64>& parents, int64 index)
+{
+  while(parents[index] >= 0)
+  {
+    index = parents[index];
+  }
+  return index;
+}
+
+void UnionRegions(std::vector<int64>& parents, int64 indexA, int64 indexB)
+{
+  int64 rootA = FindRegionRoot(parents, indexA);
+  int64 rootB = FindRegionRoot(parents, indexB);
+  if(rootA == rootB)
+  {
+    return;
+  }
+  // Attach the smaller region to the larger one
+  if(parents[rootA] > parents[rootB])
+  {
+    std::swap(rootA, rootB);
+  }
+  parents[rootA] += parents[rootB];
+  parents[rootB] = rootA;
+}
+
+/**
+ * @brief Concatenates the per block lists in block order.
+ */
+std::vector<int64> JoinBlocks(const std::vector<std::vector<int64>>& blocks)
+{
+  usize size = 0;
+  for(const auto& block : blocks)
+  {
+    size += block.size();
+  }
+  std::vector<int64> joined;
+  joined.reserve(size);
+  for(const auto& block : blocks)
+  {
+    joined.insert(joined.end(), block.begin(), block.end());
+  }
+  return joined;
+}
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -69,239 +228,252 @@ const std::atomic_bool& FillBadData::getCancel()
 Result<> FillBadData::operator()()
 {
   auto& featureIdsStore = m_DataStructure.getDataAs<Int32Array>(m_InputValues->featureIdsArrayPath)->getDataStoreRef();
-  const size_t totalPoints = featureIdsStore.getNumberOfTuples();
-
-  std::vector<int32> neighbors(totalPoints, -1);
-
-  std::vector<bool> alreadyChecked(totalPoints, false);
+  const usize totalPoints = featureIdsStore.getNumberOfTuples();
 
   const auto& selectedImageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->inputImageGeometry);
-
   const SizeVec3 udims = selectedImageGeom.getDimensions();
+  const std::array<int64, 3> dims = {static_cast<int64>(udims[0]), static_cast<int64>(udims[1]), static_cast<int64>(udims[2])};
+  const int64 planeSize = dims[0] * dims[1];
 
-  Int32Array* cellPhasesPtr = nullptr;
-
+  Int32AbstractDataStore* cellPhasesStore = nullptr;
+  int32 maxPhase = 0;
   if(m_InputValues->storeAsNewPhase)
   {
-    cellPhasesPtr = m_DataStructure.getDataAs<Int32Array>(m_InputValues->cellPhasesArrayPath);
-  }
-
-  std::array<int64_t, 3> dims = {
-      static_cast<int64_t>(udims[0]),
-      static_cast<int64_t>(udims[1]),
-      static_cast<int64_t>(udims[2]),
-  };
-
-  size_t count = 1;
-  // int32_t good = 1;
-  // int64_t neighbor = 0;
-  // int64_t index = 0;
-  // float32 x = 0.0F;
-  //  float32 y = 0.0F;
-  //  float32 z = 0.0F;
-  // int64 column = 0;
-  // int64 row = 0;
-  // int64 plane = 0;
-  //  int64 neighborPoint = 0;
-  //  int32 featureName = 0;
-  //  int32 feature = 0;
-  size_t numFeatures = 0;
-  size_t maxPhase = 0;
-
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    int32 featureName = featureIdsStore[i];
-    if(featureName > numFeatures)
+    cellPhasesStore = &m_DataStructure.getDataAs<Int32Array>(m_InputValues->cellPhasesArrayPath)->getDataStoreRef();
+    for(usize i = 0; i < totalPoints; i++)
     {
-      numFeatures = featureName;
+      maxPhase = std::max(maxPhase, cellPhasesStore->getValue(i));
     }
   }
 
-  if(m_InputValues->storeAsNewPhase)
+  // Besides the feature ids and the frontier lists of bad voxels the filter needs 8 bytes per voxel: one
+  // int64 buffer that first holds the union-find parents and then the voxel each filled voxel copies
+  // its values from. Feature ids held in memory are updated in place; other stores are copied into a
+  // buffer (4 bytes per voxel) that is written back at the end.
+  std::vector<int32> featureIdsBuffer;
+  nonstd::span<int32> featureIds;
+  auto* inMemoryFeatureIds = dynamic_cast<DataStore<int32>*>(&featureIdsStore);
+  if(inMemoryFeatureIds != nullptr)
   {
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      if((*cellPhasesPtr)[i] > maxPhase)
-      {
-        maxPhase = (*cellPhasesPtr)[i];
-      }
-    }
+    featureIds = nonstd::span<int32>(inMemoryFeatureIds->data(), totalPoints);
   }
-
-  std::array<int64_t, 6> neighborPoints = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
-  std::vector<int64_t> currentVisitedList;
-
-  for(size_t iter = 0; iter < totalPoints; iter++)
+  else
   {
-    alreadyChecked[iter] = false;
-    if(featureIdsStore[iter] != 0)
+    featureIdsBuffer.resize(totalPoints);
+    Result<> readResult = featureIdsStore.copyIntoBuffer(0, nonstd::span<int32>(featureIdsBuffer.data(), featureIdsBuffer.size()));
+    if(readResult.invalid())
     {
-      alreadyChecked[iter] = true;
+      return readResult;
     }
+    featureIds = nonstd::span<int32>(featureIdsBuffer.data(), featureIdsBuffer.size());
   }
 
-  for(size_t i = 0; i < totalPoints; i++)
+  // The voxels are split into z slabs so that each slab can be worked on by its own thread
+  const auto numSlabs = static_cast<usize>(std::clamp<int64>(static_cast<int64>(std::thread::hardware_concurrency()) * 4, 1, std::max<int64>(dims[2], 1)));
+  auto slabStart = [&dims, numSlabs](usize slab) { return static_cast<int64>(slab) * dims[2] / static_cast<int64>(numSlabs); };
+
+  // Holds the union-find parents while sizing the bad regions and afterwards the good voxel each
+  // filled voxel takes its values from
+  std::vector<int64> neighbors(totalPoints, -1);
+
+  m_MessageHandler("Sizing the bad data regions...");
   {
-    if(!alreadyChecked[i] && featureIdsStore[i] == 0)
-    {
-      currentVisitedList.push_back(static_cast<int64_t>(i));
-      count = 0;
-      while(count < currentVisitedList.size())
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numSlabs);
+    dataAlg.execute([&](const Range& range) {
+      for(usize slab = range.min(); slab < range.max(); slab++)
       {
-        int64_t index = currentVisitedList[count];
-        int64 column = index % dims[0];
-        int64 row = (index / dims[0]) % dims[1];
-        int64 plane = index / (dims[0] * dims[1]);
-        for(int32_t j = 0; j < 6; j++)
+        const int64 zStart = slabStart(slab);
+        for(int64 index = zStart * planeSize; index < slabStart(slab + 1) * planeSize; index++)
         {
-          int64_t neighbor = index + neighborPoints[j];
-          if(j == 0 && plane == 0)
-          {
-            continue;
-          }
-          if(j == 5 && plane == (dims[2] - 1))
-          {
-            continue;
-          }
-          if(j == 1 && row == 0)
+          if(featureIds[index] != 0)
           {
             continue;
           }
-          if(j == 4 && row == (dims[1] - 1))
+          const int64 column = index % dims[0];
+          const int64 row = (index / dims[0]) % dims[1];
+          if(column > 0 && featureIds[index - 1] == 0)
           {
-            continue;
+            UnionRegions(neighbors, index, index - 1);
           }
-          if(j == 2 && column == 0)
+          if(row > 0 && featureIds[index - dims[0]] == 0)
           {
-            continue;
+            UnionRegions(neighbors, index, index - dims[0]);
           }
-          if(j == 3 && column == (dims[0] - 1))
+          if(index / planeSize > zStart && featureIds[index - planeSize] == 0)
           {
-            continue;
-          }
-          if(featureIdsStore[neighbor] == 0 && !alreadyChecked[neighbor])
-          {
-            currentVisitedList.push_back(neighbor);
-            alreadyChecked[neighbor] = true;
+            UnionRegions(neighbors, index, index - planeSize);
           }
         }
-        count++;
       }
-      if((int32_t)currentVisitedList.size() >= m_InputValues->minAllowedDefectSizeValue)
+    });
+  }
+  for(usize slab = 1; slab < numSlabs; slab++)
+  {
+    const int64 planeStart = slabStart(slab) * planeSize;
+    for(int64 index = planeStart; index < planeStart + planeSize; index++)
+    {
+      if(featureIds[index] == 0 && featureIds[index - planeSize] == 0)
+      {
+        UnionRegions(neighbors, index, index - planeSize);
+      }
+    }
+  }
+  if(m_ShouldCancel)
+  {
+    return {};
+  }
+
+  // Regions of at least the minimum size stay 0 and the smaller ones are marked -1 to be filled
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numSlabs);
+    if(cellPhasesStore != nullptr)
+    {
+      dataAlg.requireStoresInMemory({cellPhasesStore});
+    }
+    dataAlg.execute([&](const Range& range) {
+      for(int64 index = slabStart(range.min()) * planeSize; index < slabStart(range.max()) * planeSize; index++)
       {
-        for(const auto& currentIndex : currentVisitedList)
+        if(featureIds[index] != 0)
+        {
+          continue;
+        }
+        int64 regionSize = -neighbors[FindRegionRootConst(neighbors, index)];
+        // The previous serial flood fill counted the seed voxel of a multi voxel region twice. That
+        // count is kept so existing pipelines keep classifying the same regions.
+        if(regionSize > 1)
         {
-          featureIdsStore[currentIndex] = 0;
-          if(m_InputValues->storeAsNewPhase)
+          regionSize++;
+        }
+        if(regionSize >= m_InputValues->minAllowedDefectSizeValue)
+        {
+          if(cellPhasesStore != nullptr)
           {
-            (*cellPhasesPtr)[currentIndex] = static_cast<int32>(maxPhase) + 1;
+            cellPhasesStore->setValue(static_cast<usize>(index), maxPhase + 1);
           }
         }
-      }
-      if((int32_t)currentVisitedList.size() < m_InputValues->minAllowedDefectSizeValue)
-      {
-        for(const auto& currentIndex : currentVisitedList)
+        else
         {
-          featureIdsStore[currentIndex] = -1;
+          featureIds[index] = -1;
         }
       }
-      currentVisitedList.clear();
-    }
+    });
+  }
+  std::fill(neighbors.begin(), neighbors.end(), -1);
+  if(m_ShouldCancel)
+  {
+    return {};
   }
 
-  std::vector<int32_t> featureNumber(numFeatures + 1, 0);
-
-  while(count != 0)
+  // The frontier holds the bad voxels that touch a good voxel
+  std::vector<int64> frontier;
   {
-    count = 0;
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      int32 featureName = featureIdsStore[i];
-      if(featureName < 0)
+    std::vector<std::vector<int64>> slabFrontiers(numSlabs);
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numSlabs);
+    dataAlg.execute([&](const Range& range) {
+      std::array<int64, 6> faceNeighbors = {};
+      for(usize slab = range.min(); slab < range.max(); slab++)
       {
-        count++;
-        // int32 current = 0;
-        int32 most = 0;
-        auto xIndex = static_cast<float32>(i % dims[0]);
-        auto yIndex = static_cast<float32>((i / dims[0]) % dims[1]);
-        auto zIndex = static_cast<float32>(i / (dims[0] * dims[1]));
-        for(int32_t j = 0; j < 6; j++)
+        for(int64 index = slabStart(slab) * planeSize; index < slabStart(slab + 1) * planeSize; index++)
         {
-          auto neighborPoint = static_cast<int64_t>(i + neighborPoints[j]);
-          if(j == 0 && zIndex == 0)
-          {
-            continue;
-          }
-          if(j == 5 && zIndex == static_cast<float32>(dims[2] - 1))
-          {
-            continue;
-          }
-          if(j == 1 && yIndex == 0)
+          if(featureIds[index] >= 0)
           {
             continue;
           }
-          if(j == 4 && yIndex == static_cast<float32>(dims[1] - 1))
+          const usize numNeighbors = FindFaceNeighbors(dims, index, faceNeighbors);
+          for(usize j = 0; j < numNeighbors; j++)
           {
-            continue;
-          }
-          if(j == 2 && xIndex == 0)
-          {
-            continue;
-          }
-          if(j == 3 && xIndex == static_cast<float32>(dims[0] - 1))
-          {
-            continue;
-          }
-
-          int32 feature = featureIdsStore[neighborPoint];
-          if(feature > 0)
-          {
-            featureNumber[feature]++;
-            int32 current = featureNumber[feature];
-            if(current > most)
+            if(featureIds[faceNeighbors[j]] > 0)
             {
-              most = current;
-              neighbors[i] = static_cast<int32>(neighborPoint);
+              slabFrontiers[slab].push_back(index);
+              break;
             }
           }
         }
-        for(int32_t j = 0; j < 6; j++)
+      }
+    });
+    frontier = JoinBlocks(slabFrontiers);
+  }
+
+  // Every iteration fills the frontier from the feature ids of the previous iteration, so the
+  // result does not depend on the order the voxels are visited in
+  usize numFilled = 0;
+  usize iteration = 0;
+  std::vector<int64> sources;
+  while(!frontier.empty())
+  {
+    if(m_ShouldCancel)
+    {
+      return {};
+    }
+    iteration++;
+    m_MessageHandler(fmt::format("Filling bad data || Iteration {} || {} voxels", iteration, frontier.size()));
+
+    sources.resize(frontier.size());
+    {
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, frontier.size());
+      dataAlg.execute([&](const Range& range) {
+        for(usize i = range.min(); i < range.max(); i++)
         {
-          int64 neighborPoint = static_cast<int64>(i) + neighborPoints[j];
-          if(j == 0 && zIndex == 0)
-          {
-            continue;
-          }
-          if(j == 5 && zIndex == static_cast<float32>(dims[2] - 1))
-          {
-            continue;
-          }
-          if(j == 1 && yIndex == 0)
-          {
-            continue;
-          }
-          if(j == 4 && yIndex == static_cast<float32>(dims[1] - 1))
-          {
-            continue;
-          }
-          if(j == 2 && xIndex == 0)
-          {
-            continue;
-          }
-          if(j == 3 && xIndex == static_cast<float32>(dims[0] - 1))
+          sources[i] = VoteForSource(featureIds, dims, frontier[i]);
+        }
+      });
+    }
+
+    // Sources are good voxels, so they are not written while the frontier is filled. Each filled
+    // voxel records the originally good voxel its values are copied from.
+    {
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, frontier.size());
+      dataAlg.execute([&](const Range& range) {
+        for(usize i = range.min(); i < range.max(); i++)
+        {
+          const int64 source = sources[i];
+          if(source < 0)
           {
             continue;
           }
+          featureIds[frontier[i]] = featureIds[source];
+          neighbors[frontier[i]] = neighbors[source] < 0 ? source : neighbors[source];
+        }
+      });
+    }
+    numFilled += frontier.size();
 
-          int32 feature = featureIdsStore[neighborPoint];
-          if(feature > 0)
+    // The next frontier is made of the bad voxels next to the voxels that were just filled
+    const usize numBlocks = std::min<usize>(frontier.size(), numSlabs);
+    std::vector<std::vector<int64>> blockFrontiers(numBlocks);
+    {
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, numBlocks);
+      dataAlg.execute([&](const Range& range) {
+        std::array<int64, 6> faceNeighbors = {};
+        for(usize block = range.min(); block < range.max(); block++)
+        {
+          for(usize i = block * frontier.size() / numBlocks; i < (block + 1) * frontier.size() / numBlocks; i++)
           {
-            featureNumber[feature] = 0;
+            const usize numNeighbors = FindFaceNeighbors(dims, frontier[i], faceNeighbors);
+            for(usize j = 0; j < numNeighbors; j++)
+            {
+              if(featureIds[faceNeighbors[j]] < 0)
+              {
+                blockFrontiers[block].push_back(faceNeighbors[j]);
+              }
+            }
           }
         }
-      }
+      });
     }
+    frontier = JoinBlocks(blockFrontiers);
+    std::sort(frontier.begin(), frontier.end());
+    frontier.erase(std::unique(frontier.begin(), frontier.end()), frontier.end());
+  }
 
+  if(numFilled > 0)
+  {
     std::optional<std::vector<DataPath>> allChildArrays = GetAllChildDataPaths(m_DataStructure, selectedImageGeom.getCellDataPath(), DataObject::Type::DataArray, m_InputValues->ignoredDataArrayPaths);
     std::vector<DataPath> voxelArrayNames;
     if(allChildArrays.has_value())
@@ -309,6 +481,7 @@ Result<> FillBadData::operator()()
       voxelArrayNames = allChildArrays.value();
     }
 
+    ParallelTaskAlgorithm taskRunner;
     for(const auto& cellArrayPath : voxelArrayNames)
     {
       if(cellArrayPath == m_InputValues->featureIdsArrayPath)
@@ -316,12 +489,15 @@ Result<> FillBadData::operator()()
         continue;
       }
       auto* oldCellArray = m_DataStructure.getDataAs<IDataArray>(cellArrayPath);
-
-      ExecuteDataFunction(FillBadDataUpdateTuplesFunctor{}, oldCellArray->getDataType(), featureIdsStore, oldCellArray, neighbors);
+      m_MessageHandler(fmt::format("Filling bad data || Updating {}", cellArrayPath.toString()));
+      ExecuteParallelFunction<FillBadDataUpdateTuples>(oldCellArray->getDataType(), taskRunner, *oldCellArray, neighbors, m_ShouldCancel);
     }
+    taskRunner.wait();
+  }
 
-    // We need to update the FeatureIds array _LAST_ since the above operations depend on that values in that array
-    FillBadDataUpdateTuples<int32>(featureIdsStore, featureIdsStore, neighbors);
+  if(inMemoryFeatureIds != nullptr)
+  {
+    return {};
   }
-  return {};
+  return featureIdsStore.copyFromBuffer(0, nonstd::span<const int32>(featureIdsBuffer.data(), featureIdsBuffer.size()));
 }
@@ -5,9 +5,133 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/INodeGeometry2D.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
 
 using namespace nx::core;
 
+namespace
+{
+// -----------------------------------------------------------------------------
+void UpdateMaximum(std::atomic<float32>& maximum, float32 value)
+{
+  float32 current = maximum.load();
+  while(value > current && !maximum.compare_exchange_weak(current, value))
+  {
+  }
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * @brief Moves every vertex towards the average of its neighbors: next = current + lambda * (mean(neighbors) - current).
+ * Each vertex gathers from its own adjacency row and only writes its own position, so the vertices can be updated
+ * in any order and by any number of threads. The neighbor differences are summed in adjacency order, so the result
+ * does not depend on the thread count. Vertices without neighbors do not move.
+ * @return The largest distance any vertex moved
+ */
+template <typename AccumT, typename IndexT>
+float32 SmoothVerticesPass(const LaplacianSmoothing::VertexAdjacency<IndexT>& adjacency, const float32* current, float32* next, const std::vector<float>& lambdas)
+{
+  std::atomic<float32> maxDisplacement = 0.0f;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, adjacency.getNumberOfVertices());
+  dataAlg.execute([&](const Range& range) {
+    AccumT rangeMaxDisplacement = 0;
+    for(usize vertex = range.min(); vertex < range.max(); vertex++)
+    {
+      const float32* position = current + 3 * vertex;
+      float32* nextPosition = next + 3 * vertex;
+      const usize rowStart = adjacency.offsets[vertex];
+      const usize rowEnd = adjacency.offsets[vertex + 1];
+      if(rowStart == rowEnd)
+      {
+        std::copy(position, position + 3, nextPosition);
+        continue;
+      }
+
+      AccumT delta[3] = {0, 0, 0};
+      for(usize n = rowStart; n < rowEnd; n++)
+      {
+        const float32* neighbor = current + 3 * static_cast<usize>(adjacency.neighbors[n]);
+        for(usize j = 0; j < 3; j++)
+        {
+          delta[j] += static_cast<AccumT>(neighbor[j] - position[j]);
+        }
+      }
+
+      const AccumT numConnections = static_cast<AccumT>(rowEnd - rowStart);
+      const float32 lambda = lambdas[vertex];
+      AccumT displacement = 0;
+      for(usize j = 0; j < 3; j++)
+      {
+        nextPosition[j] = static_cast<float32>(position[j] + lambda * (delta[j] / numConnections));
+        const AccumT moved = static_cast<AccumT>(nextPosition[j] - position[j]);
+        displacement += moved * moved;
+      }
+      rangeMaxDisplacement = std::max(rangeMaxDisplacement, displacement);
+    }
+    UpdateMaximum(maxDisplacement, static_cast<float32>(std::sqrt(rangeMaxDisplacement)));
+  });
+
+  return maxDisplacement;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+template <typename IndexT>
+LaplacianSmoothing::VertexAdjacency<IndexT> LaplacianSmoothing::VertexAdjacency<IndexT>::Create(const AbstractDataStore<IGeometry::SharedEdgeList::value_type>& edges, usize numVertices)
+{
+  VertexAdjacency adjacency;
+  adjacency.offsets.assign(numVertices + 1, 0);
+
+  const usize numEdges = edges.getNumberOfTuples();
+  const usize edgesPerBlock = 65536;
+
+  // Count the connections of every vertex, then place the neighbors in edge order
+  for(usize blockStart = 0; blockStart < numEdges; blockStart += edgesPerBlock)
+  {
+    const usize blockEdges = std::min(edgesPerBlock, numEdges - blockStart);
+    AbstractDataStore<IGeometry::SharedEdgeList::value_type>::ConstChunkView view(edges, 2 * blockStart, 2 * blockEdges);
+    for(usize i = 0; i < 2 * blockEdges; i++)
+    {
+      adjacency.offsets[view[i] + 1]++;
+    }
+  }
+  for(usize i = 0; i < numVertices; i++)
+  {
+    adjacency.offsets[i + 1] += adjacency.offsets[i];
+  }
+
+  adjacency.neighbors.resize(adjacency.offsets[numVertices]);
+  std::vector<usize> insertPositions(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+  for(usize blockStart = 0; blockStart < numEdges; blockStart += edgesPerBlock)
+  {
+    const usize blockEdges = std::min(edgesPerBlock, numEdges - blockStart);
+    AbstractDataStore<IGeometry::SharedEdgeList::value_type>::ConstChunkView view(edges, 2 * blockStart, 2 * blockEdges);
+    for(usize i = 0; i < blockEdges; i++)
+    {
+      const auto in1 = view[2 * i];     // row of the first vertex
+      const auto in2 = view[2 * i + 1]; // row the second vertex
+      adjacency.neighbors[insertPositions[in1]++] = static_cast<IndexT>(in2);
+      adjacency.neighbors[insertPositions[in2]++] = static_cast<IndexT>(in1);
+    }
+  }
+
+  return adjacency;
+}
+
+// -----------------------------------------------------------------------------
+template <typename IndexT>
+usize LaplacianSmoothing::VertexAdjacency<IndexT>::getNumberOfVertices() const
+{
+  return offsets.empty() ? 0 : offsets.size() - 1;
+}
+
 LaplacianSmoothing::LaplacianSmoothing(DataStructure& dataStructure, LaplacianSmoothingInputValues* inputValues, const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& mesgHandler)
 : m_DataStructure(dataStructure)
 , m_InputValues(inputValues)
@@ -43,107 +167,95 @@ Result<> LaplacianSmoothing::edgeBasedSmoothing()
     return MakeErrorResult(-560, "Error retrieving the shared edge list");
   }
 
-  AbstractDataStore<IGeometry::SharedEdgeList::value_type>& edges = surfaceMesh.getEdges()->getDataStoreRef();
-  IGeometry::MeshIndexType numEdges = edges.getNumberOfTuples();
-
-  std::vector<int32> numConnections(nvert, 0);
+  // 32 bit neighbor indices halve the memory traffic of the gather for all but the largest meshes
+  if(nvert <= static_cast<IGeometry::MeshIndexType>(std::numeric_limits<uint32>::max()))
+  {
+    return smoothVertices(VertexAdjacency<uint32>::Create(surfaceMesh.getEdges()->getDataStoreRef(), nvert), verts, lambdas);
+  }
+  return smoothVertices(VertexAdjacency<IGeometry::MeshIndexType>::Create(surfaceMesh.getEdges()->getDataStoreRef(), nvert), verts, lambdas);
+}
 
-  std::vector<double> deltaArray(nvert * 3);
-  double dlta = 0.0;
+// -----------------------------------------------------------------------------
+template <typename IndexT>
+Result<> LaplacianSmoothing::smoothVertices(const VertexAdjacency<IndexT>& adjacency, Float32AbstractDataStore& verts, const std::vector<float>& lambdas)
+{
+  const usize numValues = verts.getSize();
 
-  for(int32_t q = 0; q < m_InputValues->pIterationSteps; q++)
+  // Ping-pong between two position buffers. The vertex store is used directly as one of them when it is contiguous in memory.
+  std::vector<float32> stagedPositions;
+  float32* current = verts.getContiguousSpan().data();
+  if(current == nullptr)
   {
-    if(m_ShouldCancel)
+    stagedPositions.resize(numValues);
+    Result<> readResult = verts.copyIntoBuffer(0, nonstd::span<float32>(stagedPositions.data(), numValues));
+    if(readResult.invalid())
     {
-      return {};
+      return readResult;
     }
-    m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Iteration {} of {}", q, m_InputValues->pIterationSteps));
-    // Compute the Deltas for each point
-    for(IGeometry::MeshIndexType i = 0; i < numEdges; i++)
-    {
-      IGeometry::MeshIndexType in1 = edges[2 * i];     // row of the first vertex
-      IGeometry::MeshIndexType in2 = edges[2 * i + 1]; // row the second vertex
+    current = stagedPositions.data();
+  }
+  float32* const original = current;
+  std::vector<float32> scratchPositions(numValues);
+  float32* next = scratchPositions.data();
 
-      for(IGeometry::MeshIndexType j = 0; j < 3; j++)
-      {
-#if 0
-        Q_ASSERT(static_cast<size_t>(3 * in1 + j) < static_cast<size_t>(nvert * 3));
-        Q_ASSERT(static_cast<size_t>(3 * in2 + j) < static_cast<size_t>(nvert * 3));
-#endif
-        dlta = static_cast<double>(verts[3 * in2 + j] - verts[3 * in1 + j]);
-        deltaArray[3 * in1 + j] += dlta;
-        deltaArray[3 * in2 + j] += -1.0 * dlta;
-      }
-      numConnections[in1] += 1;
-      numConnections[in2] += 1;
+  std::vector<float> muLambdas;
+  if(m_InputValues->pUseTaubinSmoothing)
+  {
+    muLambdas.resize(lambdas.size());
+    for(usize i = 0; i < lambdas.size(); i++)
+    {
+      muLambdas[i] = lambdas[i] * m_InputValues->pMuFactor;
     }
+  }
 
-    // Move each point
-    for(IGeometry::MeshIndexType i = 0; i < nvert; i++)
-    {
-      for(IGeometry::MeshIndexType j = 0; j < 3; j++)
-      {
-        IGeometry::MeshIndexType in0 = 3 * i + j;
-        dlta = deltaArray[in0] / numConnections[i];
+  auto smoothPass = [&](const std::vector<float>& passLambdas) {
+    float32 maxDisplacement = m_InputValues->pUseSinglePrecision ? SmoothVerticesPass<float32>(adjacency, current, next, passLambdas) : SmoothVerticesPass<float64>(adjacency, current, next, passLambdas);
+    std::swap(current, next);
+    return maxDisplacement;
+  };
 
-        float ll = lambdas[i];
-        verts[3 * i + j] += ll * dlta;
-        deltaArray[in0] = 0.0; // reset for next iteration
-      }
-      numConnections[i] = 0; // reset for next iteration
+  for(int32_t q = 0; q < m_InputValues->pIterationSteps; q++)
+  {
+    if(m_ShouldCancel)
+    {
+      return {};
     }
+    m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Iteration {} of {}", q, m_InputValues->pIterationSteps));
+    float32 maxDisplacement = smoothPass(lambdas);
 
     // Now optionally apply a negative lambda based on the mu Factor value.
     // This is from Taubin's paper on smoothing without shrinkage. This effectively
     // runs a low pass filter on the data
     if(m_InputValues->pUseTaubinSmoothing)
     {
-
       if(m_ShouldCancel)
       {
         return {};
       }
-      m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Iteration {} of {}", q, m_InputValues->pIterationSteps));
-      // Compute the Delta's
-      for(IGeometry::MeshIndexType i = 0; i < numEdges; i++)
-      {
-        IGeometry::MeshIndexType in1 = edges[2 * i];     // row of the first vertex
-        IGeometry::MeshIndexType in2 = edges[2 * i + 1]; // row the second vertex
-
-        for(int32_t j = 0; j < 3; j++)
-        {
-#if 0
-          Q_ASSERT(static_cast<size_t>(3 * in1 + j) < static_cast<size_t>(nvert * 3));
-          Q_ASSERT(static_cast<size_t>(3 * in2 + j) < static_cast<size_t>(nvert * 3));
-#endif
-          dlta = verts[3 * in2 + j] - verts[3 * in1 + j];
-          deltaArray[3 * in1 + j] += dlta;
-          deltaArray[3 * in2 + j] += -1.0 * dlta;
-        }
-        numConnections[in1] += 1;
-        numConnections[in2] += 1;
-      }
-
-      // MOve the points
-      for(IGeometry::MeshIndexType i = 0; i < nvert; i++)
-      {
-        for(IGeometry::MeshIndexType j = 0; j < 3; j++)
-        {
-          IGeometry::MeshIndexType in0 = 3 * i + j;
-          dlta = deltaArray[in0] / numConnections[i];
+      maxDisplacement = std::max(maxDisplacement, smoothPass(muLambdas));
+    }
 
-          float ll = lambdas[i] * m_InputValues->pMuFactor;
-          verts[3 * i + j] += ll * dlta;
-          deltaArray[in0] = 0.0; // reset for next iteration
-        }
-        numConnections[i] = 0; // reset for next iteration
-      }
+    if(maxDisplacement < m_InputValues->pConvergenceTolerance)
+    {
+      m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Converged after {} of {} iterations", q + 1, m_InputValues->pIterationSteps));
+      break;
     }
   }
 
+  if(current != original)
+  {
+    std::copy(current, current + numValues, original);
+  }
+  if(!stagedPositions.empty())
+  {
+    return verts.copyFromBuffer(0, nonstd::span<const float32>(stagedPositions.data(), numValues));
+  }
   return {};
 }
 
+template struct LaplacianSmoothing::VertexAdjacency<uint32>;
+template struct LaplacianSmoothing::VertexAdjacency<IGeometry::MeshIndexType>;
+
 // -----------------------------------------------------------------------------
 std::vector<float> LaplacianSmoothing::generateLambdaArray()
 {
@@ -4,6 +4,7 @@
 
 #include "simplnx/DataStructure/DataPath.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/DataStructure/Geometry/IGeometry.hpp"
 #include "simplnx/Filter/IFilter.hpp"
 
 #include <vector>
@@ -24,6 +25,8 @@ struct SIMPLNXCORE_EXPORT LaplacianSmoothingInputValues
   float32 pSurfaceTripleLineLambda;
   float32 pSurfaceQuadPointLambda;
   DataPath pSurfaceMeshNodeTypeArrayPath;
+  bool pUseSinglePrecision = false;
+  float32 pConvergenceTolerance = 0.0f;
 };
 
 /**
@@ -42,6 +45,22 @@ public:
 
   Result<> operator()();
 
+  /**
+   * @brief Compressed sparse row vertex adjacency built from the shared edge list. The
+   * neighbors of vertex i are neighbors[offsets[i]] to neighbors[offsets[i + 1] - 1] and
+   * are listed in the order of the edges that connect them.
+   */
+  template <typename IndexT>
+  struct VertexAdjacency
+  {
+    std::vector<usize> offsets;
+    std::vector<IndexT> neighbors;
+
+    static VertexAdjacency Create(const AbstractDataStore<IGeometry::SharedEdgeList::value_type>& edges, usize numVertices);
+
+    usize getNumberOfVertices() const;
+  };
+
 private:
   DataStructure& m_DataStructure;
   const LaplacianSmoothingInputValues* m_InputValues = nullptr;
@@ -50,6 +69,9 @@ private:
 
   std::vector<float> generateLambdaArray();
   Result<> edgeBasedSmoothing();
+
+  template <typename IndexT>
+  Result<> smoothVertices(const VertexAdjacency<IndexT>& adjacency, Float32AbstractDataStore& verts, const std::vector<float>& lambdas);
 };
 
 } // namespace nx::core
@@ -7,8 +7,11 @@
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/ParallelData3DAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
+#include <algorithm>
 #include <array>
+#include <limits>
 #include <unordered_map>
 
 using namespace nx::core;
@@ -310,6 +313,262 @@ void FlipProblemVoxelCase3(Int32AbstractDataStore& featureIds, QuickSurfaceMesh:
     featureIds[v3] = featureIds[v1];
   }
 }
+
+// -----------------------------------------------------------------------------
+// The corners of a voxel are encoded as x + 2 * y + 4 * z, where each of x, y and z is 0 or 1
+using FaceWinding = std::array<std::array<uint8, 3>, 2>;
+constexpr FaceWinding k_WindingA = {{{0, 1, 2}, {1, 3, 2}}};
+constexpr FaceWinding k_WindingB = {{{0, 2, 1}, {1, 2, 3}}};
+
+/**
+ * @brief The four corners of a voxel face, in the order the nodes are numbered, and the
+ * triangle winding used for the face on the grid boundary and between two features. The
+ * interior winding is reversed when the voxel's feature id is smaller than its neighbor's.
+ */
+struct FaceTemplate
+{
+  std::array<uint8, 4> corners;
+  bool boundaryWindingA;
+  bool interiorWindingA;
+};
+
+constexpr usize k_XMinFace = 0;
+constexpr usize k_YMinFace = 1;
+constexpr usize k_ZMinFace = 2;
+constexpr usize k_XMaxFace = 3;
+constexpr usize k_YMaxFace = 4;
+constexpr usize k_ZMaxFace = 5;
+
+constexpr std::array<FaceTemplate, 6> k_FaceTemplates = {{
+    {{0, 2, 4, 6}, false, false}, // -X
+    {{0, 1, 4, 5}, true, true},   // -Y
+    {{0, 1, 2, 3}, false, false}, // -Z
+    {{1, 3, 5, 7}, true, true},   // +X
+    {{3, 2, 7, 6}, true, false},  // +Y
+    {{5, 4, 7, 6}, false, true},  // +Z
+}};
+
+/**
+ * @brief Answers which faces, nodes and node types a voxel contributes to the surface mesh.
+ * Faces are visited in the order the mesh has always been written in: the -X, -Y and -Z
+ * faces on the grid boundary, then the +X, +Y and +Z faces on the grid boundary or between
+ * two features. A node belongs to the first voxel in x-fastest order that creates a face
+ * touching it, which only depends on the voxels around the node, so every z slab can find
+ * its own nodes without looking at the rest of the volume.
+ */
+class SurfaceMeshVoxels
+{
+public:
+  SurfaceMeshVoxels(const Int32AbstractDataStore& featureIds, const SizeVec3& dims)
+  : m_FeatureIds(featureIds)
+  , m_Dims(dims)
+  , m_XP(dims[0])
+  , m_YP(dims[1])
+  , m_ZP(dims[2])
+  {
+  }
+
+  const SizeVec3& dims() const
+  {
+    return m_Dims;
+  }
+
+  usize voxelIndex(usize i, usize j, usize k) const
+  {
+    return (k * m_XP * m_YP) + (j * m_XP) + i;
+  }
+
+  static SizeVec3 CornerPosition(usize i, usize j, usize k, uint8 corner)
+  {
+    return {i + (corner & 1), j + ((corner >> 1) & 1), k + ((corner >> 2) & 1)};
+  }
+
+  usize cornerIndex(usize i, usize j, usize k, uint8 corner) const
+  {
+    const SizeVec3 pos = CornerPosition(i, j, k, corner);
+    return (pos[2] * (m_XP + 1) * (m_YP + 1)) + (pos[1] * (m_XP + 1)) + pos[0];
+  }
+
+  /**
+   * @brief Calls func(face, neighbor, boundary) for every face the voxel creates. neighbor
+   * is the voxel on the other side of an interior face.
+   */
+  template <typename FuncT>
+  void forEachFace(usize i, usize j, usize k, FuncT&& func) const
+  {
+    const usize point = voxelIndex(i, j, k);
+    if(i == 0)
+    {
+      func(k_XMinFace, point, true);
+    }
+    if(j == 0)
+    {
+      func(k_YMinFace, point, true);
+    }
+    if(k == 0)
+    {
+      func(k_ZMinFace, point, true);
+    }
+    const int32 feature = m_FeatureIds.getValue(point);
+    if(i == m_XP - 1)
+    {
+      func(k_XMaxFace, point, true);
+    }
+    else if(feature != m_FeatureIds.getValue(point + 1))
+    {
+      func(k_XMaxFace, point + 1, false);
+    }
+    if(j == m_YP - 1)
+    {
+      func(k_YMaxFace, point, true);
+    }
+    else if(feature != m_FeatureIds.getValue(point + m_XP))
+    {
+      func(k_YMaxFace, point + m_XP, false);
+    }
+    if(k == m_ZP - 1)
+    {
+      func(k_ZMaxFace, point, true);
+    }
+    else if(feature != m_FeatureIds.getValue(point + m_XP * m_YP))
+    {
+      func(k_ZMaxFace, point + m_XP * m_YP, false);
+    }
+  }
+
+  /**
+   * @brief Calls func(corner) for every node that is first used by this voxel, in the
+   * order the nodes are numbered.
+   */
+  template <typename FuncT>
+  void forEachNewNode(usize i, usize j, usize k, FuncT&& func) const
+  {
+    uint8 visitedCorners = 0;
+    forEachFace(i, j, k, [&](usize face, usize, bool) {
+      for(const uint8 corner : k_FaceTemplates[face].corners)
+      {
+        const auto cornerBit = static_cast<uint8>(1 << corner);
+        if((visitedCorners & cornerBit) != 0)
+        {
+          continue;
+        }
+        visitedCorners |= cornerBit;
+        if(!isUsedByEarlierVoxel(i, j, k, corner))
+        {
+          func(corner);
+        }
+      }
+    });
+  }
+
+  /**
+   * @brief Returns the node type of the node at the grid corner: the number of distinct
+   * features around it, capped at 4, plus 10 if it is on the grid boundary.
+   */
+  int8 nodeType(const SizeVec3& cornerPos) const
+  {
+    std::array<int32, 9> owners = {};
+    usize numOwners = 0;
+    const auto addOwner = [&owners, &numOwners](int32 owner) {
+      if(std::find(owners.begin(), owners.begin() + numOwners, owner) == owners.begin() + numOwners)
+      {
+        owners[numOwners++] = owner;
+      }
+    };
+
+    if(cornerPos[0] == 0 || cornerPos[0] == m_XP || cornerPos[1] == 0 || cornerPos[1] == m_YP || cornerPos[2] == 0 || cornerPos[2] == m_ZP)
+    {
+      addOwner(-1);
+    }
+    for(uint8 corner = 0; corner < 8; corner++)
+    {
+      usize voxel = 0;
+      if(voxelAtCorner(cornerPos, corner, voxel))
+      {
+        addOwner(m_FeatureIds.getValue(voxel));
+      }
+    }
+
+    auto nodeType = static_cast<int8>(std::min<usize>(numOwners, 4));
+    if(std::find(owners.begin(), owners.begin() + numOwners, -1) != owners.begin() + numOwners)
+    {
+      nodeType += 10;
+    }
+    return nodeType;
+  }
+
+private:
+  /**
+   * @brief Finds the voxel that has the grid corner as the given corner.
+   */
+  bool voxelAtCorner(const SizeVec3& cornerPos, uint8 corner, usize& voxel) const
+  {
+    const SizeVec3 offset = CornerPosition(0, 0, 0, corner);
+    if(cornerPos[0] < offset[0] || cornerPos[1] < offset[1] || cornerPos[2] < offset[2])
+    {
+      return false;
+    }
+    const SizeVec3 voxelPos = {cornerPos[0] - offset[0], cornerPos[1] - offset[1], cornerPos[2] - offset[2]};
+    if(voxelPos[0] >= m_XP || voxelPos[1] >= m_YP || voxelPos[2] >= m_ZP)
+    {
+      return false;
+    }
+    voxel = voxelIndex(voxelPos[0], voxelPos[1], voxelPos[2]);
+    return true;
+  }
+
+  /**
+   * @brief Returns true if any face created by the voxel touches the given corner of it.
+   */
+  bool createsFaceAtCorner(usize voxel, const SizeVec3& voxelPos, uint8 corner) const
+  {
+    const int32 feature = m_FeatureIds.getValue(voxel);
+    const std::array<usize, 3> strides = {1, m_XP, m_XP * m_YP};
+    for(usize axis = 0; axis < 3; axis++)
+    {
+      const bool maxSide = ((corner >> axis) & 1) != 0;
+      if(!maxSide && voxelPos[axis] == 0)
+      {
+        return true;
+      }
+      if(maxSide && (voxelPos[axis] == m_Dims[axis] - 1 || feature != m_FeatureIds.getValue(voxel + strides[axis])))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Returns true if a voxel that comes before (i, j, k) in x-fastest order creates a
+   * face touching the given corner of (i, j, k).
+   */
+  bool isUsedByEarlierVoxel(usize i, usize j, usize k, uint8 corner) const
+  {
+    const usize point = voxelIndex(i, j, k);
+    const SizeVec3 cornerPos = CornerPosition(i, j, k, corner);
+    for(uint8 otherCorner = 0; otherCorner < 8; otherCorner++)
+    {
+      usize voxel = 0;
+      if(otherCorner == corner || !voxelAtCorner(cornerPos, otherCorner, voxel) || voxel > point)
+      {
+        continue;
+      }
+      const SizeVec3 offset = CornerPosition(0, 0, 0, otherCorner);
+      if(createsFaceAtCorner(voxel, {cornerPos[0] - offset[0], cornerPos[1] - offset[1], cornerPos[2] - offset[2]}, otherCorner))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const Int32AbstractDataStore& m_FeatureIds;
+  SizeVec3 m_Dims;
+  usize m_XP = 0;
+  usize m_YP = 0;
+  usize m_ZP = 0;
+};
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -328,32 +587,23 @@ QuickSurfaceMesh::~QuickSurfaceMesh() noexcept = default;
 // -----------------------------------------------------------------------------
 Result<> QuickSurfaceMesh::operator()()
 {
-  // Get the ImageGeometry
-  auto& grid = m_DataStructure.getDataRefAs<IGridGeometry>(m_InputValues->GridGeomDataPath);
-
   // Get the Created Triangle Geometry
   auto& triangleGeom = m_DataStructure.getDataRefAs<TriangleGeom>(m_InputValues->TriangleGeometryPath);
 
-  SizeVec3 udims = grid.getDimensions();
-
-  size_t xP = udims[0];
-  size_t yP = udims[1];
-  size_t zP = udims[2];
-
-  std::vector<std::set<int32_t>> ownerLists;
-
-  size_t possibleNumNodes = (xP + 1) * (yP + 1) * (zP + 1);
-  std::vector<MeshIndexType> nodeIds(possibleNumNodes, std::numeric_limits<size_t>::max());
-
-  MeshIndexType nodeCount = 0;
-  MeshIndexType triangleCount = 0;
-
   if(m_InputValues->FixProblemVoxels)
   {
     correctProblemVoxels();
   }
 
-  determineActiveNodes(nodeIds, nodeCount, triangleCount);
+  std::vector<MeshIndexType> slabNodeOffsets;
+  std::vector<MeshIndexType> slabTriangleOffsets;
+  determineActiveNodes(slabNodeOffsets, slabTriangleOffsets);
+  if(m_ShouldCancel)
+  {
+    return {};
+  }
+  const MeshIndexType nodeCount = slabNodeOffsets.back();
+  const MeshIndexType triangleCount = slabTriangleOffsets.back();
 
   // now create node and triangle arrays knowing the number that will be needed
   std::vector<usize> tupleShape = {triangleCount};
@@ -368,7 +618,7 @@ Result<> QuickSurfaceMesh::operator()()
     Result<> result = nx::core::ResizeAndReplaceDataArray(m_DataStructure, dataPath, tupleShape, nx::core::IDataAction::Mode::Execute);
   }
 
-  createNodesAndTriangles(nodeIds, nodeCount, triangleCount);
+  createNodesAndTriangles(slabNodeOffsets, slabTriangleOffsets);
 
 #ifdef QSM_CREATE_TRIPLE_LINES
   if(m_InputValues->pGenerateTripleLines)
@@ -611,888 +861,172 @@ void QuickSurfaceMesh::correctProblemVoxels()
 }
 
 // -----------------------------------------------------------------------------
-void QuickSurfaceMesh::determineActiveNodes(std::vector<MeshIndexType>& nodeIds, MeshIndexType& nodeCount, MeshIndexType& triangleCount)
+void QuickSurfaceMesh::determineActiveNodes(std::vector<MeshIndexType>& slabNodeOffsets, std::vector<MeshIndexType>& slabTriangleOffsets)
 {
   m_MessageHandler(IFilter::Message::Type::Info, "Determining active Nodes");
 
   auto* grid = m_DataStructure.getDataAs<IGridGeometry>(m_InputValues->GridGeomDataPath);
-  Int32AbstractDataStore& featureIds = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef();
-
-  SizeVec3 udims = grid->getDimensions();
-
-  MeshIndexType xP = udims[0];
-  MeshIndexType yP = udims[1];
-  MeshIndexType zP = udims[2];
-
-  std::vector<std::set<int32_t>> ownerLists;
-
-  MeshIndexType point = 0, neigh1 = 0, neigh2 = 0, neigh3 = 0;
-
-  MeshIndexType nodeId1 = 0, nodeId2 = 0, nodeId3 = 0, nodeId4 = 0;
-
-  // first determining which nodes are actually boundary nodes and
-  // count number of nodes and triangles that will be created
-  for(MeshIndexType k = 0; k < zP; k++)
-  {
-    for(MeshIndexType j = 0; j < yP; j++)
+  const auto& featureIdsArray = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeatureIdsArrayPath);
+  const SurfaceMeshVoxels voxels(featureIdsArray.getDataStoreRef(), grid->getDimensions());
+  const usize zP = voxels.dims()[2];
+
+  // Count the nodes first used and the triangles created by every z slab of voxels so that
+  // each slab can later write its part of the mesh independently
+  std::vector<MeshIndexType> slabNodeCounts(zP, 0);
+  std::vector<MeshIndexType> slabTriangleCounts(zP, 0);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, zP);
+  dataAlg.requireArraysInMemory({&featureIdsArray});
+  dataAlg.execute([&](const Range& range) {
+    for(usize k = range.min(); k < range.max(); k++)
     {
-      for(MeshIndexType i = 0; i < xP; i++)
+      if(m_ShouldCancel)
       {
-        point = (k * xP * yP) + (j * xP) + i;
-        neigh1 = point + 1;
-        neigh2 = point + xP;
-        neigh3 = point + (xP * yP);
-
-        if(i == 0)
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
-          }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
-        }
-        if(j == 0)
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
-          }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
-        }
-        if(k == 0)
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
-          }
-          nodeId4 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
-        }
-        if(i == (xP - 1))
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
-          }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
-        }
-        else if(featureIds[point] != featureIds[neigh1])
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
-          }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
-        }
-        if(j == (yP - 1))
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
-          }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
-        }
-        else if(featureIds[point] != featureIds[neigh2])
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
-          }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
-        }
-        if(k == (zP - 1))
+        return;
+      }
+      MeshIndexType nodeCount = 0;
+      MeshIndexType faceCount = 0;
+      for(usize j = 0; j < voxels.dims()[1]; j++)
+      {
+        for(usize i = 0; i < voxels.dims()[0]; i++)
         {
-          nodeId1 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
-          }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
-        }
-        else if(k < zP - 1 && featureIds[point] != featureIds[neigh3])
-        {
-          nodeId1 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId1] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId1] = nodeCount;
-            nodeCount++;
-          }
-          nodeId2 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          if(nodeIds[nodeId2] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId2] = nodeCount;
-            nodeCount++;
-          }
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          if(nodeIds[nodeId3] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId3] = nodeCount;
-            nodeCount++;
-          }
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          if(nodeIds[nodeId4] == std::numeric_limits<size_t>::max())
-          {
-            nodeIds[nodeId4] = nodeCount;
-            nodeCount++;
-          }
-          triangleCount++;
-          triangleCount++;
+          voxels.forEachFace(i, j, k, [&faceCount](usize, usize, bool) { faceCount++; });
+          voxels.forEachNewNode(i, j, k, [&nodeCount](uint8) { nodeCount++; });
         }
       }
+      slabNodeCounts[k] = nodeCount;
+      slabTriangleCounts[k] = 2 * faceCount;
     }
+  });
+
+  slabNodeOffsets.assign(zP + 1, 0);
+  slabTriangleOffsets.assign(zP + 1, 0);
+  for(usize k = 0; k < zP; k++)
+  {
+    slabNodeOffsets[k + 1] = slabNodeOffsets[k] + slabNodeCounts[k];
+    slabTriangleOffsets[k + 1] = slabTriangleOffsets[k] + slabTriangleCounts[k];
   }
 }
 
 // -----------------------------------------------------------------------------
-void QuickSurfaceMesh::createNodesAndTriangles(std::vector<MeshIndexType>& m_NodeIds, MeshIndexType nodeCount, MeshIndexType triangleCount)
+void QuickSurfaceMesh::createNodesAndTriangles(const std::vector<MeshIndexType>& slabNodeOffsets, const std::vector<MeshIndexType>& slabTriangleOffsets)
 {
   m_MessageHandler(IFilter::Message::Type::Info, "Creating mesh");
 
-  auto& featureIds = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FeatureIdsArrayPath)->getDataStoreRef();
-
-  size_t numFeatures = 0;
-  size_t numTuples = featureIds.getNumberOfTuples();
-  for(size_t i = 0; i < numTuples; i++)
-  // for(const auto& featureId : featureIds)
-  {
-    const size_t featureId = featureIds[i];
-    if(featureId > numFeatures)
-    {
-      numFeatures = static_cast<size_t>(featureId);
-    }
-  }
-
   auto* grid = m_DataStructure.getDataAs<IGridGeometry>(m_InputValues->GridGeomDataPath);
-
-  SizeVec3 udims = grid->getDimensions();
-
-  MeshIndexType xP = udims[0];
-  MeshIndexType yP = udims[1];
-  MeshIndexType zP = udims[2];
-
-  std::vector<std::set<int32_t>> ownerLists;
-
-  MeshIndexType point = 0;
-  MeshIndexType neigh1 = 0;
-  MeshIndexType neigh2 = 0;
-  MeshIndexType neigh3 = 0;
-
-  MeshIndexType nodeId1 = 0;
-  MeshIndexType nodeId2 = 0;
-  MeshIndexType nodeId3 = 0;
-  MeshIndexType nodeId4 = 0;
+  const auto& featureIdsArray = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeatureIdsArrayPath);
+  const Int32AbstractDataStore& featureIds = featureIdsArray.getDataStoreRef();
+  const SurfaceMeshVoxels voxels(featureIds, grid->getDimensions());
+  const usize xP = voxels.dims()[0];
+  const usize yP = voxels.dims()[1];
+  const usize zP = voxels.dims()[2];
 
   auto* triangleGeom = m_DataStructure.getDataAs<TriangleGeom>(m_InputValues->TriangleGeometryPath);
-
-  std::vector<size_t> tDims = {nodeCount};
-  triangleGeom->resizeVertexList(nodeCount);
-  triangleGeom->resizeFaceList(triangleCount);
-  triangleGeom->getFaceAttributeMatrix()->resizeTuples({triangleCount});
-  triangleGeom->getVertexAttributeMatrix()->resizeTuples(tDims);
-
-  auto& faceLabelsStore = m_DataStructure.getDataAs<Int32Array>(m_InputValues->FaceLabelsDataPath)->getDataStoreRef();
-
-  // Resize the NodeTypes array
-  auto& nodeTypes = m_DataStructure.getDataAs<Int8Array>(m_InputValues->NodeTypesDataPath)->getDataStoreRef();
-  nodeTypes.resizeTuples({nodeCount});
-
+  auto& faceLabelsArray = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FaceLabelsDataPath);
+  auto& nodeTypesArray = m_DataStructure.getDataRefAs<Int8Array>(m_InputValues->NodeTypesDataPath);
+  auto& faceLabelsStore = faceLabelsArray.getDataStoreRef();
+  auto& nodeTypes = nodeTypesArray.getDataStoreRef();
   QuickSurfaceMesh::VertexStore& vertex = triangleGeom->getVertices()->getDataStoreRef();
   QuickSurfaceMesh::TriStore& triangle = triangleGeom->getFaces()->getDataStoreRef();
 
-  ownerLists.resize(nodeCount);
-
   // Create a vector of TupleTransferFunctions for each of the Triangle Face to VertexType Data Arrays
   std::vector<std::shared_ptr<AbstractTupleTransfer>> tupleTransferFunctions;
+  IParallelAlgorithm::AlgorithmArrays algArrays = {&featureIdsArray, triangleGeom->getVertices(), triangleGeom->getFaces(), &faceLabelsArray, &nodeTypesArray};
   for(size_t i = 0; i < m_InputValues->SelectedDataArrayPaths.size(); i++)
   {
     // Associate these arrays with the Triangle Face Data.
     ::AddTupleTransferInstance(m_DataStructure, m_InputValues->SelectedDataArrayPaths[i], m_InputValues->CreatedDataArrayPaths[i], tupleTransferFunctions);
+    algArrays.push_back(m_DataStructure.getDataAs<IDataArray>(m_InputValues->SelectedDataArrayPaths[i]));
+    algArrays.push_back(m_DataStructure.getDataAs<IDataArray>(m_InputValues->CreatedDataArrayPaths[i]));
   }
 
-  // Cycle through again assigning coordinates to each node and assigning node numbers and feature labels to each triangle
-  MeshIndexType triangleIndex = 0;
-  for(MeshIndexType k = 0; k < zP; k++)
-  {
-    for(MeshIndexType j = 0; j < yP; j++)
+  // Every node is numbered by the voxel that uses it first, so a node is written exactly once
+  // by the slab that owns that voxel and its id does not depend on the thread count
+  std::vector<MeshIndexType> nodeIds((xP + 1) * (yP + 1) * (zP + 1), std::numeric_limits<MeshIndexType>::max());
+
+  ParallelDataAlgorithm nodesAlg;
+  nodesAlg.setRange(0, zP);
+  nodesAlg.requireArraysInMemory(algArrays);
+  nodesAlg.execute([&](const Range& range) {
+    for(usize k = range.min(); k < range.max(); k++)
     {
-      for(MeshIndexType i = 0; i < xP; i++)
+      if(m_ShouldCancel)
       {
-
-        point = (k * xP * yP) + (j * xP) + i;
-        neigh1 = point + 1; // <== What happens if we are at the end of a row?
-        neigh2 = point + xP;
-        neigh3 = point + (xP * yP);
-
-        if(i == 0)
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j, k, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i + 1, j + 1, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId2];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId4];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(-1);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(-1);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(-1);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(-1);
-        }
-        if(j == 0)
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j, k, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId4];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(-1);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(-1);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(-1);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(-1);
-        }
-        if(k == 0)
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j, k, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId2];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId4];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(-1);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(-1);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(-1);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(-1);
-        }
-        if(i == (xP - 1)) // Takes care of the end of a Row...
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId4];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(-1);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(-1);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(-1);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(-1);
-        }
-        else if(featureIds[point] != featureIds[neigh1])
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = featureIds[neigh1];
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          if(featureIds[point] < featureIds[neigh1])
-          {
-            triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-            triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId2];
-            faceLabelsStore[triangleIndex * 2] = featureIds[point];
-            faceLabelsStore[triangleIndex * 2 + 1] = featureIds[neigh1];
-          }
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, neigh1, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId4];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = featureIds[neigh1];
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-          if(featureIds[point] < featureIds[neigh1])
-          {
-            triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-            triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId4];
-            faceLabelsStore[triangleIndex * 2] = featureIds[point];
-            faceLabelsStore[triangleIndex * 2 + 1] = featureIds[neigh1];
-          }
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, neigh1, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[neigh1]);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[neigh1]);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[neigh1]);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[neigh1]);
-        }
-        if(j == (yP - 1)) // Takes care of the end of a column
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId4];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(-1);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(-1);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(-1);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(-1);
-        }
-        else if(featureIds[point] != featureIds[neigh2])
-        {
-          nodeId1 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = (k * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId2];
-          faceLabelsStore[triangleIndex * 2] = featureIds[neigh2];
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-          if(featureIds[point] < featureIds[neigh2])
-          {
-            triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId2];
-            triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-            faceLabelsStore[triangleIndex * 2] = featureIds[point];
-            faceLabelsStore[triangleIndex * 2 + 1] = featureIds[neigh2];
-          }
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, neigh2, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId4];
-          faceLabelsStore[triangleIndex * 2] = featureIds[neigh2];
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-          if(featureIds[point] < featureIds[neigh2])
-          {
-            triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId4];
-            triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-            faceLabelsStore[triangleIndex * 2] = featureIds[point];
-            faceLabelsStore[triangleIndex * 2 + 1] = featureIds[neigh2];
-          }
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, neigh2, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[neigh2]);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[neigh2]);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[neigh2]);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[neigh2]);
-        }
-        if(k == (zP - 1)) // Takes care of the end of a Pillar
-        {
-          nodeId1 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k + 1, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j, k + 1, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId2];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId4];
-          faceLabelsStore[triangleIndex * 2] = -1;
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, point, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(-1);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(-1);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(-1);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(-1);
-        }
-        else if(featureIds[point] != featureIds[neigh3])
+        return;
+      }
+      MeshIndexType nodeId = slabNodeOffsets[k];
+      for(usize j = 0; j < yP; j++)
+      {
+        for(usize i = 0; i < xP; i++)
         {
-          nodeId1 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j, k + 1, vertex, (m_NodeIds[nodeId1] * 3));
-
-          nodeId2 = ((k + 1) * (xP + 1) * (yP + 1)) + (j * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j, k + 1, vertex, (m_NodeIds[nodeId2] * 3));
-
-          nodeId3 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + (i + 1);
-          ::GetGridCoordinates(grid, i + 1, j + 1, k + 1, vertex, (m_NodeIds[nodeId3] * 3));
-
-          nodeId4 = ((k + 1) * (xP + 1) * (yP + 1)) + ((j + 1) * (xP + 1)) + i;
-          ::GetGridCoordinates(grid, i, j + 1, k + 1, vertex, (m_NodeIds[nodeId4] * 3));
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId1];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = featureIds[neigh3];
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-          if(featureIds[point] < featureIds[neigh3])
-          {
-            triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-            triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId2];
-            faceLabelsStore[triangleIndex * 2] = featureIds[point];
-            faceLabelsStore[triangleIndex * 2 + 1] = featureIds[neigh3];
-          }
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, neigh3, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          triangle[triangleIndex * 3 + 0] = m_NodeIds[nodeId2];
-          triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId4];
-          triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId3];
-          faceLabelsStore[triangleIndex * 2] = featureIds[neigh3];
-          faceLabelsStore[triangleIndex * 2 + 1] = featureIds[point];
-          if(featureIds[point] < featureIds[neigh3])
-          {
-            triangle[triangleIndex * 3 + 1] = m_NodeIds[nodeId3];
-            triangle[triangleIndex * 3 + 2] = m_NodeIds[nodeId4];
-            faceLabelsStore[triangleIndex * 2] = featureIds[point];
-            faceLabelsStore[triangleIndex * 2 + 1] = featureIds[neigh3];
-          }
-
-          for(size_t dataVectorIndex = 0; dataVectorIndex < m_InputValues->SelectedDataArrayPaths.size(); dataVectorIndex++)
-          {
-            tupleTransferFunctions[dataVectorIndex]->transfer(triangleIndex, neigh3, point, faceLabelsStore);
-          }
-
-          triangleIndex++;
-
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId1]].insert(featureIds[neigh3]);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId2]].insert(featureIds[neigh3]);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId3]].insert(featureIds[neigh3]);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[point]);
-          ownerLists[m_NodeIds[nodeId4]].insert(featureIds[neigh3]);
+          voxels.forEachNewNode(i, j, k, [&](uint8 corner) {
+            const SizeVec3 cornerPos = SurfaceMeshVoxels::CornerPosition(i, j, k, corner);
+            nodeIds[voxels.cornerIndex(i, j, k, corner)] = nodeId;
+            ::GetGridCoordinates(grid, cornerPos[0], cornerPos[1], cornerPos[2], vertex, nodeId * 3);
+            nodeTypes[nodeId] = voxels.nodeType(cornerPos);
+            nodeId++;
+          });
         }
       }
     }
-  }
-
-  Int8AbstractDataStore& m_NodeTypes = m_DataStructure.getDataAs<Int8Array>(m_InputValues->NodeTypesDataPath)->getDataStoreRef();
-
-  for(size_t i = 0; i < nodeCount; i++)
+  });
+  if(m_ShouldCancel)
   {
-    auto& ownerList = ownerLists[i];
+    return;
+  }
 
-    m_NodeTypes[i] = static_cast<int8_t>(ownerList.size());
-    if(m_NodeTypes[i] > 4)
-    {
-      m_NodeTypes[i] = 4;
-    }
-    if(ownerList.find(-1) != ownerList.end())
+  // Cycle through again assigning node numbers and feature labels to each triangle
+  ParallelDataAlgorithm trianglesAlg;
+  trianglesAlg.setRange(0, zP);
+  trianglesAlg.requireArraysInMemory(algArrays);
+  trianglesAlg.execute([&](const Range& range) {
+    for(usize k = range.min(); k < range.max(); k++)
     {
-      m_NodeTypes[i] += 10;
+      if(m_ShouldCancel)
+      {
+        return;
+      }
+      MeshIndexType triangleIndex = slabTriangleOffsets[k];
+      for(usize j = 0; j < yP; j++)
+      {
+        for(usize i = 0; i < xP; i++)
+        {
+          const usize point = voxels.voxelIndex(i, j, k);
+          voxels.forEachFace(i, j, k, [&](usize face, usize neighbor, bool boundary) {
+            const FaceTemplate& faceTemplate = k_FaceTemplates[face];
+            const int32 pointFeature = featureIds.getValue(point);
+            const int32 neighborFeature = boundary ? -1 : featureIds.getValue(neighbor);
+
+            bool useWindingA = boundary ? faceTemplate.boundaryWindingA : faceTemplate.interiorWindingA;
+            std::array<int32, 2> labels = {neighborFeature, pointFeature};
+            if(!boundary && pointFeature < neighborFeature)
+            {
+              useWindingA = !useWindingA;
+              labels = {pointFeature, neighborFeature};
+            }
+
+            const FaceWinding& winding = useWindingA ? k_WindingA : k_WindingB;
+            for(const auto& faceTriangle : winding)
+            {
+              for(usize vertexIndex = 0; vertexIndex < 3; vertexIndex++)
+              {
+                triangle[triangleIndex * 3 + vertexIndex] = nodeIds[voxels.cornerIndex(i, j, k, faceTemplate.corners[faceTriangle[vertexIndex]])];
+              }
+              faceLabelsStore[triangleIndex * 2] = labels[0];
+              faceLabelsStore[triangleIndex * 2 + 1] = labels[1];
+
+              for(const auto& tupleTransferFunction : tupleTransferFunctions)
+              {
+                tupleTransferFunction->transfer(triangleIndex, boundary ? point : neighbor, point, faceLabelsStore);
+              }
+              triangleIndex++;
+            }
+          });
+        }
+      }
     }
-  }
+  });
 }
 
 // -----------------------------------------------------------------------------
@@ -53,20 +53,21 @@ public:
   void correctProblemVoxels();
 
   /**
-   * @brief
-   * @param m_NodeIds
-   * @param nodeCount
-   * @param triangleCount
+   * @brief Counts, in parallel over z slabs of voxels, the nodes first used and the triangles
+   * created by every slab. The offsets hold the exclusive prefix sums of those counts with the
+   * totals as their last entry.
+   * @param slabNodeOffsets
+   * @param slabTriangleOffsets
    */
-  void determineActiveNodes(std::vector<MeshIndexType>& m_NodeIds, MeshIndexType& nodeCount, MeshIndexType& triangleCount);
+  void determineActiveNodes(std::vector<MeshIndexType>& slabNodeOffsets, std::vector<MeshIndexType>& slabTriangleOffsets);
 
   /**
-   * @brief
-   * @param m_NodeIds
-   * @param nodeCount
-   * @param triangleCount
+   * @brief Writes the nodes, node types, triangles, face labels and transferred face data of
+   * every z slab in parallel, starting at the slab's offsets.
+   * @param slabNodeOffsets
+   * @param slabTriangleOffsets
    */
-  void createNodesAndTriangles(std::vector<MeshIndexType>& m_NodeIds, MeshIndexType nodeCount, MeshIndexType triangleCount);
+  void createNodesAndTriangles(const std::vector<MeshIndexType>& slabNodeOffsets, const std::vector<MeshIndexType>& slabTriangleOffsets);
 
   /**
    * @brief generateTripleLines
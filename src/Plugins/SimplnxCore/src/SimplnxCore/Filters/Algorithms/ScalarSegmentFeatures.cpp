@@ -40,13 +40,7 @@ public:
 
   bool operator()(int64 referencePoint, int64 neighborPoint, int32 gnum) override
   {
-    // Sanity check the indices that are being passed in.
-    if(referencePoint >= m_Length || neighborPoint >= m_Length)
-    {
-      return false;
-    }
-
-    if((*m_Data)[neighborPoint] == (*m_Data)[referencePoint])
+    if(compare(referencePoint, neighborPoint))
     {
       m_FeatureIdsArray->setValue(neighborPoint, gnum);
       return true;
@@ -54,6 +48,17 @@ public:
     return false;
   }
 
+  bool compare(int64 referencePoint, int64 neighborPoint) const override
+  {
+    // Sanity check the indices that are being passed in.
+    if(referencePoint >= m_Length || neighborPoint >= m_Length)
+    {
+      return false;
+    }
+    const DataArrayType& data = *m_Data;
+    return data[neighborPoint] == data[referencePoint];
+  }
+
 private:
   int64 m_Length = 0;                                    // Length of the Data Array
   AbstractDataStore<int32>* m_FeatureIdsArray = nullptr; // The Feature Ids
@@ -83,6 +88,16 @@ public:
   ~TSpecificCompareFunctor() override = default;
 
   bool operator()(int64 referencePoint, int64 neighborPoint, int32 gnum) override
+  {
+    if(compare(referencePoint, neighborPoint))
+    {
+      m_FeatureIdsArray->setValue(neighborPoint, gnum);
+      return true;
+    }
+    return false;
+  }
+
+  bool compare(int64 referencePoint, int64 neighborPoint) const override
   {
     // Sanity check the indices that are being passed in.
     if(referencePoint >= m_Length || neighborPoint >= m_Length)
@@ -90,23 +105,13 @@ public:
       return false;
     }
 
-    if(m_Data[referencePoint] >= m_Data[neighborPoint])
-    {
-      if((m_Data[referencePoint] - m_Data[neighborPoint]) <= m_Tolerance)
-      {
-        m_FeatureIdsArray->setValue(neighborPoint, gnum);
-        return true;
-      }
-    }
-    else
+    const T referenceValue = m_Data.getValue(referencePoint);
+    const T neighborValue = m_Data.getValue(neighborPoint);
+    if(referenceValue >= neighborValue)
     {
-      if((m_Data[neighborPoint] - m_Data[referencePoint]) <= m_Tolerance)
-      {
-        m_FeatureIdsArray->setValue(neighborPoint, gnum);
-        return true;
-      }
+      return (referenceValue - neighborValue) <= m_Tolerance;
     }
-    return false;
+    return (neighborValue - referenceValue) <= m_Tolerance;
   }
 
 private:
@@ -133,8 +138,8 @@ Result<> ScalarSegmentFeatures::operator()()
   {
     try
     {
-      m_GoodVoxels = InstantiateMaskCompare(m_DataStructure, m_InputValues->MaskArrayPath);
-    } catch(const std::out_of_range& exception)
+      m_GoodVoxels = std::make_unique<PackedMaskView>(m_DataStructure.getDataRefAs<IDataArray>(m_InputValues->MaskArrayPath));
+    } catch(const std::exception& exception)
     {
       // This really should NOT be happening as the path was verified during preflight BUT we may be calling this from
       // somewhere else that is NOT going through the normal nx::core::IFilter API of Preflight and Execute
@@ -209,7 +214,16 @@ Result<> ScalarSegmentFeatures::operator()()
   }
 
   // Run the segmentation algorithm
-  execute(gridGeom);
+  IParallelAlgorithm::AlgorithmArrays inputArrays = {inputDataArray};
+  if(m_InputValues->UseMask)
+  {
+    inputArrays.push_back(m_DataStructure.getDataAs<IDataArray>(m_InputValues->MaskArrayPath));
+  }
+  Result<> segmentResult = executeParallel(gridGeom, *m_FeatureIdsArray, inputArrays);
+  if(segmentResult.invalid())
+  {
+    return segmentResult;
+  }
   // Sanity check the result.
   if(this->m_FoundFeatures < 1)
   {
@@ -231,55 +245,20 @@ Result<> ScalarSegmentFeatures::operator()()
   // would look like a smooth gradient. This is a user input parameter
   if(m_InputValues->RandomizeFeatureIds)
   {
-    randomizeFeatureIds(m_FeatureIdsArray, this->m_FoundFeatures + 1);
+    return randomizeFeatureIds(m_FeatureIdsArray, this->m_FoundFeatures + 1);
   }
 
   return {};
 }
 
 // -----------------------------------------------------------------------------
-int64_t ScalarSegmentFeatures::getSeed(int32 gnum, int64 nextSeed) const
+bool ScalarSegmentFeatures::isValidVoxel(int64 point) const
 {
-  nx::core::DataArray<int32>::store_type* featureIds = m_FeatureIdsArray->getDataStore();
-  usize totalPoints = featureIds->getNumberOfTuples();
-
-  int64 seed = -1;
-  // start with the next voxel after the last seed
-  auto randPoint = static_cast<usize>(nextSeed);
-  while(seed == -1 && randPoint < totalPoints)
-  {
-    if(featureIds->getValue(randPoint) == 0) // If the GrainId of the voxel is ZERO then we can use this as a seed point
-    {
-      if(!m_InputValues->UseMask || m_GoodVoxels->isTrue(randPoint))
-      {
-        seed = randPoint;
-      }
-      else
-      {
-        randPoint += 1;
-      }
-    }
-    else
-    {
-      randPoint += 1;
-    }
-  }
-  if(seed >= 0)
-  {
-    featureIds->setValue(static_cast<usize>(seed), gnum);
-  }
-  return seed;
+  return !m_InputValues->UseMask || m_GoodVoxels->isTrue(point);
 }
 
 // -----------------------------------------------------------------------------
-bool ScalarSegmentFeatures::determineGrouping(int64 referencepoint, int64 neighborpoint, int32 gnum) const
+bool ScalarSegmentFeatures::areNeighborsSimilar(int64 referencePoint, int64 neighborPoint) const
 {
-  auto* featureIds = m_FeatureIdsArray->getDataStore();
-  if(featureIds->getValue(neighborpoint) == 0 && (!m_InputValues->UseMask || m_GoodVoxels->isTrue(neighborpoint)))
-  {
-    CompareFunctor* func = m_CompareFunctor.get();
-    return (*func)((usize)(referencepoint), (usize)(neighborpoint), gnum);
-  }
-
-  return false;
+  return m_CompareFunctor->compare(referencePoint, neighborPoint);
 }
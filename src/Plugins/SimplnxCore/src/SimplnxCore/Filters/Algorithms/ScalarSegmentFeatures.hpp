@@ -50,31 +50,25 @@ public:
 
 protected:
   /**
-   * @brief
-   * @param data
-   * @param args
-   * @param gnum
-   * @param nextSeed
-   * @return int64
+   * @brief Returns true if the voxel is not excluded by the mask.
+   * @param point
+   * @return bool
    */
-  int64_t getSeed(int32 gnum, int64 nextSeed) const override;
+  bool isValidVoxel(int64 point) const override;
 
   /**
-   * @brief
-   * @param data
-   * @param args
+   * @brief Returns true if the scalar values of both voxels are within the tolerance.
    * @param referencePoint
    * @param neighborPoint
-   * @param gnum
    * @return bool
    */
-  bool determineGrouping(int64 referencePoint, int64 neighborPoint, int32 gnum) const override;
+  bool areNeighborsSimilar(int64 referencePoint, int64 neighborPoint) const override;
 
 private:
   const ScalarSegmentFeaturesInputValues* m_InputValues = nullptr;
   FeatureIdsArrayType* m_FeatureIdsArray = nullptr;
   GoodVoxelsArrayType* m_GoodVoxelsArray = nullptr;
   std::shared_ptr<SegmentFeatures::CompareFunctor> m_CompareFunctor;
-  std::unique_ptr<MaskCompare> m_GoodVoxels = nullptr;
+  std::unique_ptr<PackedMaskView> m_GoodVoxels = nullptr;
 };
 } // namespace nx::core
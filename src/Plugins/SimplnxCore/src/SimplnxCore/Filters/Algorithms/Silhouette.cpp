@@ -27,13 +27,15 @@ public:
   }
 
   SilhouetteTemplate(const IDataArray& inputIDataArray, Float64AbstractDataStore& outputDataArray, const std::unique_ptr<MaskCompare>& maskDataArray, usize numClusters,
-                     const Int32AbstractDataStore& featureIds, ClusterUtilities::DistanceMetric distMetric)
+                     const Int32AbstractDataStore& featureIds, ClusterUtilities::DistanceMetric distMetric, const SilhouetteInputValues* inputValues, const std::atomic_bool& shouldCancel)
   : m_InputData(inputIDataArray.template getIDataStoreRefAs<AbstractDataStoreT>())
   , m_OutputData(outputDataArray)
   , m_Mask(maskDataArray)
   , m_NumClusters(numClusters)
   , m_FeatureIds(featureIds)
   , m_DistMetric(distMetric)
+  , m_InputValues(inputValues)
+  , m_ShouldCancel(shouldCancel)
   {
   }
   ~SilhouetteTemplate() = default;
@@ -45,79 +47,31 @@ public:
   SilhouetteTemplate& operator=(SilhouetteTemplate&&) = delete;      // Move Assignment Not Implemented
 
   // -----------------------------------------------------------------------------
-  void operator()()
+  Result<> operator()()
   {
     usize numTuples = m_InputData.getNumberOfTuples();
-    usize numCompDims = m_InputData.getNumberOfComponents();
     usize totalClusters = m_NumClusters + 1;
-    std::vector<float64> inClusterDist(numTuples, 0.0);
-    std::vector<float64> outClusterMinDist(numTuples, 0.0);
-    std::vector<float64> numTuplesPerFeature(totalClusters, 0.0);
-    std::vector<std::vector<float64>> clusterDist(numTuples, std::vector<float64>(totalClusters, 0.0));
 
-    for(usize i = 0; i < numTuples; i++)
+    std::vector<int32> featureIds(numTuples, 0);
+    Result<> readResult = m_FeatureIds.copyIntoBuffer(0, nonstd::span<int32>(featureIds.data(), featureIds.size()));
+    if(readResult.invalid())
     {
-      if(m_Mask->isTrue(i))
-      {
-        numTuplesPerFeature[m_FeatureIds[i]]++;
-      }
+      return readResult;
     }
+    const std::vector<uint8> mask = ClusterUtilities::ReadMask(*m_Mask, numTuples);
 
-    for(usize i = 0; i < numTuples; i++)
-    {
-      if(m_Mask->isTrue(i))
+    ClusterUtilities::VisitDistanceMetric(m_DistMetric, [&](auto metric) {
+      if(m_InputValues->UseSampling)
       {
-        for(usize j = 0; j < numTuples; j++)
-        {
-          if(m_Mask->isTrue(j))
-          {
-            clusterDist[i][m_FeatureIds[j]] += ClusterUtilities::GetDistance(m_InputData, (numCompDims * i), m_InputData, (numCompDims * j), numCompDims, m_DistMetric);
-          }
-        }
+        ClusterUtilities::ComputeSampledSilhouette<decltype(metric)::value>(m_InputData, mask, totalClusters, featureIds, m_InputValues->SamplesPerCluster, m_InputValues->Seed, m_OutputData,
+                                                                            m_ShouldCancel);
       }
-    }
-
-    for(usize i = 0; i < numTuples; i++)
-    {
-      if(m_Mask->isTrue(i))
+      else
       {
-        for(usize j = 1; j < totalClusters; j++)
-        {
-          clusterDist[i][j] /= numTuplesPerFeature[j];
-        }
+        ClusterUtilities::ComputeSilhouette<decltype(metric)::value>(m_InputData, mask, totalClusters, featureIds, m_OutputData, m_ShouldCancel);
       }
-    }
-
-    for(usize i = 0; i < numTuples; i++)
-    {
-      if(m_Mask->isTrue(i))
-      {
-        int32 cluster = m_FeatureIds[i];
-        inClusterDist[i] = clusterDist[i][cluster];
-
-        float64 minDist = std::numeric_limits<float64>::max();
-        for(usize j = 1; j < totalClusters; j++)
-        {
-          if(cluster != j)
-          {
-            float64 dist = clusterDist[i][j];
-            if(dist < minDist)
-            {
-              minDist = dist;
-              outClusterMinDist[i] = dist;
-            }
-          }
-        }
-      }
-    }
-
-    for(usize i = 0; i < numTuples; i++)
-    {
-      if(m_Mask->isTrue(i))
-      {
-        m_OutputData[i] = (outClusterMinDist[i] - inClusterDist[i]) / (std::max(outClusterMinDist[i], inClusterDist[i]));
-      }
-    }
+    });
+    return {};
   }
 
 private:
@@ -128,6 +82,8 @@ private:
   const std::unique_ptr<MaskCompare>& m_Mask;
   usize m_NumClusters;
   ClusterUtilities::DistanceMetric m_DistMetric;
+  const SilhouetteInputValues* m_InputValues;
+  const std::atomic_bool& m_ShouldCancel;
 };
 } // namespace
 
@@ -179,8 +135,7 @@ Result<> Silhouette::operator()()
     std::string message = fmt::format("Mask Array DataPath does not exist or is not of the correct type (Bool | UInt8) {}", m_InputValues->MaskArrayPath.toString());
     return MakeErrorResult(-54080, message);
   }
-  RunTemplateClass<SilhouetteTemplate, types::NoBooleanType>(clusteringArray.getDataType(), clusteringArray,
-                                                             m_DataStructure.getDataAs<Float64Array>(m_InputValues->SilhouetteArrayPath)->getDataStoreRef(), maskCompare, uniqueIds.size(), featureIds,
-                                                             m_InputValues->DistanceMetric);
-  return {};
+  return RunTemplateClass<SilhouetteTemplate, types::NoBooleanType>(clusteringArray.getDataType(), clusteringArray,
+                                                                    m_DataStructure.getDataAs<Float64Array>(m_InputValues->SilhouetteArrayPath)->getDataStoreRef(), maskCompare, uniqueIds.size(),
+                                                                    featureIds, m_InputValues->DistanceMetric, m_InputValues, m_ShouldCancel);
 }
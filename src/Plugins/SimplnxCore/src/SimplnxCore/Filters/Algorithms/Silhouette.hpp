@@ -19,6 +19,9 @@ struct SIMPLNXCORE_EXPORT SilhouetteInputValues
   DataPath MaskArrayPath;
   DataPath FeatureIdsArrayPath;
   DataPath SilhouetteArrayPath;
+  bool UseSampling = false;
+  usize SamplesPerCluster = 0;
+  uint64 Seed = 0;
 };
 
 /**
@@ -16,10 +16,17 @@
 
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
+#include <optional>
 #include <sstream>
 
 namespace nx::core
 {
+namespace
+{
+// Number of FeatureIds read per bulk copy while validating the FeatureIds
+constexpr usize k_ChunkSize = 65536;
+} // namespace
+
 //------------------------------------------------------------------------------
 std::string ComputeFeatureNeighborsFilter::name() const
 {
@@ -193,7 +200,7 @@ Result<> ComputeFeatureNeighborsFilter::executeImpl(DataStructure& dataStructure
   DataPath sharedSurfaceAreaPath = featureAttrMatrixPath.createChildPath(sharedSurfaceAreaName);
   DataPath surfaceFeaturesPath = featureAttrMatrixPath.createChildPath(surfaceFeaturesName);
 
-  auto& featureIds = dataStructure.getDataAs<Int32Array>(featureIdsPath)->getDataStoreRef();
+  const auto& featureIds = dataStructure.getDataAs<Int32Array>(featureIdsPath)->getDataStoreRef();
   auto& numNeighbors = dataStructure.getDataAs<Int32Array>(numNeighborsPath)->getDataStoreRef();
 
   auto& neighborList = dataStructure.getDataRefAs<Int32NeighborList>(neighborListPath);
@@ -206,11 +213,16 @@ Result<> ComputeFeatureNeighborsFilter::executeImpl(DataStructure& dataStructure
   usize totalFeatures = numNeighbors.getNumberOfTuples();
 
   /* Ensure that we will be able to work with the user selected featureId Array */
-  const auto [minFeatureId, maxFeatureId] = std::minmax_element(featureIds.begin(), featureIds.end());
-  if(static_cast<usize>(*maxFeatureId) >= totalFeatures)
+  int32 maxFeatureId = 0;
+  for(usize chunkStart = 0; chunkStart < totalPoints; chunkStart += k_ChunkSize)
+  {
+    const auto featureIdsChunk = featureIds.createChunkView(chunkStart, std::min(k_ChunkSize, totalPoints - chunkStart));
+    maxFeatureId = std::max(maxFeatureId, *std::max_element(featureIdsChunk.begin(), featureIdsChunk.end()));
+  }
+  if(static_cast<usize>(maxFeatureId) >= totalFeatures)
   {
     std::stringstream out;
-    out << "Data Array " << featureIdsPath.getTargetName() << " has a maximum value of " << *maxFeatureId << " which is greater than the "
+    out << "Data Array " << featureIdsPath.getTargetName() << " has a maximum value of " << maxFeatureId << " which is greater than the "
         << " number of features from array " << numNeighborsPath.getTargetName() << " which has " << totalFeatures << ". Did you select the "
         << " incorrect array for the 'FeatureIds' array?";
     return MakeErrorResult(-24500, out.str());
@@ -234,7 +246,6 @@ Result<> ComputeFeatureNeighborsFilter::executeImpl(DataStructure& dataStructure
   int64 row = 0;
   int64 plane = 0;
   int32 feature = 0;
-  int32 nnum = 0;
   uint8 onsurf = 0;
   bool good = false;
   int64 neighbor = 0;
@@ -275,85 +286,110 @@ Result<> ComputeFeatureNeighborsFilter::executeImpl(DataStructure& dataStructure
 
   progInt = 0.0F;
   start = std::chrono::steady_clock::now();
-  // Loop over all points to generate the neighbor lists
-  for(usize j = 0; j < totalPoints; j++)
+  // Loop over all points one plane at a time to generate the neighbor lists. The FeatureIds of the current plane and
+  // the planes directly above and below it are viewed in bulk so that no virtual call is made per voxel.
+  const usize planeSize = imageGeomNumX * imageGeomNumY;
+  for(usize currentPlane = 0; currentPlane < imageGeomNumZ; currentPlane++)
   {
-    auto now = std::chrono::steady_clock::now();
-    // Only send updates every 1 second
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+    const usize viewStart = (currentPlane > 0 ? currentPlane - 1 : 0) * planeSize;
+    const usize viewEnd = std::min(currentPlane + 2, imageGeomNumZ) * planeSize;
+    const auto featureIdsView = featureIds.createChunkView(viewStart, viewEnd - viewStart);
+    std::optional<AbstractDataStore<int8>::ChunkView> boundaryCellsView;
+    if(storeBoundaryCells && boundaryCells != nullptr)
     {
-      progInt = static_cast<float>(j) / static_cast<float>(totalPoints) * 100.0f;
-      std::string message = fmt::format("Determining Neighbor Lists || {:2.0f}% Complete", progInt);
-      messageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, static_cast<int32_t>(progInt)});
-      start = std::chrono::steady_clock::now();
+      boundaryCellsView.emplace(*boundaryCells, currentPlane * planeSize, planeSize);
     }
 
-    if(shouldCancel)
+    for(usize j = currentPlane * planeSize; j < (currentPlane + 1) * planeSize; j++)
     {
-      return {};
-    }
+      auto now = std::chrono::steady_clock::now();
+      // Only send updates every 1 second
+      if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+      {
+        progInt = static_cast<float>(j) / static_cast<float>(totalPoints) * 100.0f;
+        std::string message = fmt::format("Determining Neighbor Lists || {:2.0f}% Complete", progInt);
+        messageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, static_cast<int32_t>(progInt)});
+        start = std::chrono::steady_clock::now();
+      }
 
-    onsurf = 0;
-    feature = featureIds[j];
-    if(feature > 0 && feature < neighborlist.size())
-    {
-      column = static_cast<int64>(j % imageGeomNumX);
-      row = static_cast<int64>((j / imageGeomNumX) % imageGeomNumY);
-      plane = static_cast<int64>(j / (imageGeomNumX * imageGeomNumY));
-      if(storeSurfaceFeatures && surfaceFeatures != nullptr)
+      if(shouldCancel)
       {
-        if((column == 0 || column == static_cast<int64>((imageGeomNumX - 1)) || row == 0 || row == static_cast<int64>((imageGeomNumY)-1) || plane == 0 ||
-            plane == static_cast<int64>((imageGeomNumZ - 1))) &&
-           imageGeomNumZ != 1)
-        {
-          surfaceFeatures->setValue(feature, true);
-        }
-        if((column == 0 || column == static_cast<int64>((imageGeomNumX - 1)) || row == 0 || row == static_cast<int64>((imageGeomNumY - 1))) && imageGeomNumZ == 1)
-        {
-          surfaceFeatures->setValue(feature, true);
-        }
+        return {};
       }
-      for(size_t k = 0; k < 6; k++)
+
+      onsurf = 0;
+      feature = featureIdsView[j - viewStart];
+      if(feature > 0 && feature < neighborlist.size())
       {
-        good = true;
-        neighbor = static_cast<int64>(j + neighPoints[k]);
-        if(k == 0 && plane == 0)
+        column = static_cast<int64>(j % imageGeomNumX);
+        row = static_cast<int64>((j / imageGeomNumX) % imageGeomNumY);
+        plane = static_cast<int64>(currentPlane);
+        if(storeSurfaceFeatures && surfaceFeatures != nullptr)
         {
-          good = false;
+          if((column == 0 || column == static_cast<int64>((imageGeomNumX - 1)) || row == 0 || row == static_cast<int64>((imageGeomNumY)-1) || plane == 0 ||
+              plane == static_cast<int64>((imageGeomNumZ - 1))) &&
+             imageGeomNumZ != 1)
+          {
+            surfaceFeatures->setValue(feature, true);
+          }
+          if((column == 0 || column == static_cast<int64>((imageGeomNumX - 1)) || row == 0 || row == static_cast<int64>((imageGeomNumY - 1))) && imageGeomNumZ == 1)
+          {
+            surfaceFeatures->setValue(feature, true);
+          }
         }
-        if(k == 5 && plane == (imageGeomNumZ - 1))
+        for(size_t k = 0; k < 6; k++)
         {
-          good = false;
-        }
-        if(k == 1 && row == 0)
-        {
-          good = false;
-        }
-        if(k == 4 && row == (imageGeomNumY - 1))
-        {
-          good = false;
-        }
-        if(k == 2 && column == 0)
-        {
-          good = false;
-        }
-        if(k == 3 && column == (imageGeomNumX - 1))
-        {
-          good = false;
-        }
-        if(good && featureIds[neighbor] != feature && featureIds[neighbor] > 0)
-        {
-          onsurf++;
-          nnum = numNeighbors[feature];
-          neighborlist[feature].push_back(featureIds[neighbor]);
-          nnum++;
-          numNeighbors[feature] = nnum;
+          good = true;
+          neighbor = static_cast<int64>(j + neighPoints[k]);
+          if(k == 0 && plane == 0)
+          {
+            good = false;
+          }
+          if(k == 5 && plane == (imageGeomNumZ - 1))
+          {
+            good = false;
+          }
+          if(k == 1 && row == 0)
+          {
+            good = false;
+          }
+          if(k == 4 && row == (imageGeomNumY - 1))
+          {
+            good = false;
+          }
+          if(k == 2 && column == 0)
+          {
+            good = false;
+          }
+          if(k == 3 && column == (imageGeomNumX - 1))
+          {
+            good = false;
+          }
+          if(!good)
+          {
+            continue;
+          }
+          const int32 neighborFeature = featureIdsView[neighbor - viewStart];
+          if(neighborFeature != feature && neighborFeature > 0)
+          {
+            onsurf++;
+            // NumNeighbors is set from the final size of each list below
+            neighborlist[feature].push_back(neighborFeature);
+          }
         }
       }
+      if(boundaryCellsView.has_value())
+      {
+        (*boundaryCellsView)[j - currentPlane * planeSize] = static_cast<int8>(onsurf);
+      }
     }
-    if(storeBoundaryCells && boundaryCells != nullptr)
+    if(boundaryCellsView.has_value())
     {
-      boundaryCells->setValue(j, static_cast<int32>(onsurf));
+      Result<> commitResult = boundaryCellsView->commit();
+      if(commitResult.invalid())
+      {
+        return commitResult;
+      }
     }
   }
 
@@ -407,16 +443,25 @@ Result<> ComputeFeatureNeighborsFilter::executeImpl(DataStructure& dataStructure
       neighborsurfacearealist[i].push_back(area);
     }
     numNeighbors[i] = static_cast<int32>(neighborlist[i].size());
+  }
 
-    // Set the vector for each list into the NeighborList Object
-    NeighborList<int32>::SharedVectorType sharedNeiLst(new std::vector<int32>);
-    sharedNeiLst->assign(neighborlist[i].begin(), neighborlist[i].end());
-    neighborList.setList(static_cast<int32>(i), sharedNeiLst);
-
-    NeighborList<float32>::SharedVectorType sharedSAL(new std::vector<float32>);
-    sharedSAL->assign(neighborsurfacearealist[i].begin(), neighborsurfacearealist[i].end());
-    sharedSurfaceAreaList.setList(static_cast<int32>(i), sharedSAL);
+  // Move the lists into the compact storage of the NeighborList objects
+  NeighborList<int32>::Builder neighborListBuilder(totalFeatures);
+  NeighborList<float32>::Builder surfaceAreaListBuilder(totalFeatures);
+  for(usize i = 1; i < totalFeatures; i++)
+  {
+    neighborListBuilder.setListSize(i, neighborlist[i].size());
+    surfaceAreaListBuilder.setListSize(i, neighborsurfacearealist[i].size());
+  }
+  neighborListBuilder.allocate();
+  surfaceAreaListBuilder.allocate();
+  for(usize i = 1; i < totalFeatures; i++)
+  {
+    std::copy(neighborlist[i].begin(), neighborlist[i].end(), neighborListBuilder.getListSpan(i).begin());
+    std::copy(neighborsurfacearealist[i].begin(), neighborsurfacearealist[i].end(), surfaceAreaListBuilder.getListSpan(i).begin());
   }
+  neighborListBuilder.commit(neighborList);
+  surfaceAreaListBuilder.commit(sharedSurfaceAreaList);
 
   return {};
 }
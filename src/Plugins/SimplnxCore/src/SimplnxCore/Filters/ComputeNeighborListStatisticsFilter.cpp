@@ -93,11 +93,11 @@ public:
       throw std::invalid_argument("ComputeNeighborListStatisticsFilter::compute() could not dynamic_cast 'Summation' array to needed type. Check input array selection.");
     }
 
-    auto& sourceList = dynamic_cast<NeighborListType&>(m_Source);
+    const auto& sourceList = dynamic_cast<const NeighborListType&>(m_Source);
 
     for(usize i = start; i < end; i++)
     {
-      const std::vector<T>& tmpList = sourceList[i];
+      nonstd::span<const T> tmpList = sourceList.getListSpan(i);
 
       if(m_Length)
       {
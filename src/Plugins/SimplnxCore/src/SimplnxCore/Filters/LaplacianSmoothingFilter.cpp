@@ -64,6 +64,10 @@ Parameters LaplacianSmoothingFilter::parameters() const
   params.insert(std::make_unique<Float32Parameter>(k_SurfaceTripleLineLambda_Key, "Outer Triple Line Lambda", "Value of λ for triple lines that lie on the outer surface of the volume", 0.0f));
   params.insert(
       std::make_unique<Float32Parameter>(k_SurfaceQuadPointLambda_Key, "Outer Quadruple Points Lambda", "Value of λ for the quadruple Points that lie on the outer surface of the volume.", 0.0f));
+  params.insert(std::make_unique<Float32Parameter>(k_ConvergenceTolerance_Key, "Convergence Tolerance",
+                                                   "Stop iterating once no vertex moves farther than this distance during an iteration. A value of 0 always runs every iteration step.", 0.0f));
+  params.insert(std::make_unique<BoolParameter>(k_UseSinglePrecision_Key, "Use Single Precision Accumulation",
+                                                "Sum the neighbor offsets of each vertex in 32 bit instead of 64 bit floating point. This is faster but slightly less accurate.", false));
 
   params.insertSeparator(Parameters::Separator{"Input Triangle Geometry"});
   // Create the parameter descriptors that are needed for this filter
@@ -96,6 +100,12 @@ IFilter::UniquePointer LaplacianSmoothingFilter::clone() const
 IFilter::PreflightResult LaplacianSmoothingFilter::preflightImpl(const DataStructure& dataStructure, const Arguments& filterArgs, const MessageHandler& messageHandler,
                                                                  const std::atomic_bool& shouldCancel) const
 {
+  auto pConvergenceToleranceValue = filterArgs.value<float32>(k_ConvergenceTolerance_Key);
+  if(pConvergenceToleranceValue < 0.0f)
+  {
+    return MakePreflightErrorResult(-561, fmt::format("The convergence tolerance must not be negative: {}", pConvergenceToleranceValue));
+  }
+
   return {};
 }
 
@@ -116,6 +126,8 @@ Result<> LaplacianSmoothingFilter::executeImpl(DataStructure& dataStructure, con
   inputValues.pSurfaceTripleLineLambda = filterArgs.value<float32>(k_SurfaceTripleLineLambda_Key);
   inputValues.pSurfaceQuadPointLambda = filterArgs.value<float32>(k_SurfaceQuadPointLambda_Key);
   inputValues.pSurfaceMeshNodeTypeArrayPath = filterArgs.value<DataPath>(k_SurfaceMeshNodeTypeArrayPath_Key);
+  inputValues.pUseSinglePrecision = filterArgs.value<bool>(k_UseSinglePrecision_Key);
+  inputValues.pConvergenceTolerance = filterArgs.value<float32>(k_ConvergenceTolerance_Key);
 
   // Let the Algorithm instance do the work
   return LaplacianSmoothing(dataStructure, &inputValues, shouldCancel, messageHandler)();
@@ -36,6 +36,8 @@ public:
   static inline constexpr StringLiteral k_SurfaceQuadPointLambda_Key = "surface_quad_point_lambda";
   static inline constexpr StringLiteral k_SurfaceMeshNodeTypeArrayPath_Key = "surface_mesh_node_type_array_path";
   static inline constexpr StringLiteral k_SurfaceMeshFaceLabelsArrayPath_Key = "surface_mesh_face_labels_array_path";
+  static inline constexpr StringLiteral k_UseSinglePrecision_Key = "use_single_precision";
+  static inline constexpr StringLiteral k_ConvergenceTolerance_Key = "convergence_tolerance";
 
   /**
    * @brief Reads SIMPL json and converts it simplnx Arguments.
@@ -11,284 +11,387 @@
 #include "simplnx/Parameters/NumericTypeParameter.hpp"
 #include "simplnx/Utilities/ArrayThreshold.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
 #include <algorithm>
+#include <functional>
+#include <mutex>
 
 namespace nx::core
 {
 namespace
 {
-template <typename U>
-class ThresholdFilterHelper
-{
-public:
-  ThresholdFilterHelper(nx::core::ArrayThreshold::ComparisonType compType, nx::core::ArrayThreshold::ComparisonValue compValue, std::vector<U>& output)
-  : m_ComparisonOperator(compType)
-  , m_ComparisonValue(compValue)
-  , m_Output(output)
-  {
-  }
+// Tuples are thresholded in blocks. Every intermediate result of a block is a bit mask with one
+// bit per tuple, so a block of 64K tuples needs 8KB per level of the threshold tree.
+constexpr usize k_BitsPerWord = 64;
+constexpr usize k_BlockSize = 1024 * k_BitsPerWord;
+constexpr usize k_WordsPerBlock = k_BlockSize / k_BitsPerWord;
 
-  ~ThresholdFilterHelper() = default;
+using MaskWord = uint64;
 
-  /**
-   * @brief
-   */
-  template <typename T>
-  void filterDataLessThan(const AbstractDataStore<T>& m_Input, T trueValue, T falseValue)
+/**
+ * @brief Packs compare(value, compareValue) for every value into one bit per value. Each word
+ * is built without branches so that the comparisons can be vectorized by the compiler.
+ * @param values
+ * @param compareValue
+ * @param compare
+ * @param words Receives ceil(values.size() / 64) words
+ */
+template <typename T, typename CompareT>
+void PackComparison(nonstd::span<const T> values, T compareValue, CompareT compare, MaskWord* words)
+{
+  const T* valuesPtr = values.data();
+  const usize numFullWords = values.size() / k_BitsPerWord;
+  for(usize wordIndex = 0; wordIndex < numFullWords; wordIndex++)
   {
-    size_t m_NumValues = m_Input.getNumberOfTuples();
-    T value = static_cast<T>(m_ComparisonValue);
-    for(size_t i = 0; i < m_NumValues; ++i)
+    const T* wordValues = valuesPtr + wordIndex * k_BitsPerWord;
+    MaskWord word = 0;
+    for(usize bit = 0; bit < k_BitsPerWord; bit++)
     {
-      m_Output[i] = (m_Input[i] < value) ? trueValue : falseValue;
+      word |= static_cast<MaskWord>(compare(wordValues[bit], compareValue)) << bit;
     }
+    words[wordIndex] = word;
   }
 
-  /**
-   * @brief
-   */
-  template <typename T>
-  void filterDataGreaterThan(const AbstractDataStore<T>& m_Input, T trueValue, T falseValue)
+  const usize numRemaining = values.size() - numFullWords * k_BitsPerWord;
+  if(numRemaining > 0)
   {
-    size_t m_NumValues = m_Input.getNumberOfTuples();
-    T value = static_cast<T>(m_ComparisonValue);
-    for(size_t i = 0; i < m_NumValues; ++i)
+    const T* wordValues = valuesPtr + numFullWords * k_BitsPerWord;
+    MaskWord word = 0;
+    for(usize bit = 0; bit < numRemaining; bit++)
     {
-      m_Output[i] = (m_Input[i] > value) ? trueValue : falseValue;
+      word |= static_cast<MaskWord>(compare(wordValues[bit], compareValue)) << bit;
     }
+    words[numFullWords] = word;
   }
+}
 
-  /**
-   * @brief
-   */
-  template <typename T>
-  void filterDataEqualTo(const AbstractDataStore<T>& m_Input, T trueValue, T falseValue)
-  {
-    size_t m_NumValues = m_Input.getNumberOfTuples();
-    T value = static_cast<T>(m_ComparisonValue);
-    for(size_t i = 0; i < m_NumValues; ++i)
-    {
-      m_Output[i] = (m_Input[i] == value) ? trueValue : falseValue;
-    }
-  }
+/**
+ * @brief Evaluates a single ArrayThreshold over a range of tuples.
+ */
+class IThresholdComparison
+{
+public:
+  IThresholdComparison() = default;
+  virtual ~IThresholdComparison() noexcept = default;
+
+  IThresholdComparison(const IThresholdComparison&) = delete;
+  IThresholdComparison(IThresholdComparison&&) noexcept = delete;
+  IThresholdComparison& operator=(const IThresholdComparison&) = delete;
+  IThresholdComparison& operator=(IThresholdComparison&&) noexcept = delete;
 
   /**
-   * @brief
+   * @brief Writes the comparison result of count tuples starting at start as a bit mask.
+   * @param start
+   * @param count
+   * @param words
    */
-  template <typename T>
-  void filterDataNotEqualTo(const AbstractDataStore<T>& m_Input, T trueValue, T falseValue)
+  virtual void evaluate(usize start, usize count, MaskWord* words) const = 0;
+};
+
+template <typename T>
+class ThresholdComparison : public IThresholdComparison
+{
+public:
+  ThresholdComparison(const AbstractDataStore<T>& store, ArrayThreshold::ComparisonType comparisonType, ArrayThreshold::ComparisonValue comparisonValue)
+  : m_Store(store)
+  , m_ComparisonType(comparisonType)
+  , m_ComparisonValue(static_cast<T>(comparisonValue))
   {
-    size_t m_NumValues = m_Input.getNumberOfTuples();
-    T value = static_cast<T>(m_ComparisonValue);
-    for(size_t i = 0; i < m_NumValues; ++i)
-    {
-      m_Output[i] = (m_Input[i] != value) ? trueValue : falseValue;
-    }
   }
 
-  template <typename Type>
-  void filterData(const AbstractDataStore<Type>& input, Type trueValue, Type falseValue)
+  ~ThresholdComparison() noexcept override = default;
+
+  void evaluate(usize start, usize count, MaskWord* words) const override
   {
-    if(m_ComparisonOperator == ArrayThreshold::ComparisonType::LessThan)
-    {
-      filterDataLessThan<Type>(input, trueValue, falseValue);
-    }
-    else if(m_ComparisonOperator == ArrayThreshold::ComparisonType::GreaterThan)
-    {
-      filterDataGreaterThan<Type>(input, trueValue, falseValue);
-    }
-    else if(m_ComparisonOperator == ArrayThreshold::ComparisonType::Operator_Equal)
-    {
-      filterDataEqualTo<Type>(input, trueValue, falseValue);
-    }
-    else if(m_ComparisonOperator == ArrayThreshold::ComparisonType::Operator_NotEqual)
-    {
-      filterDataNotEqualTo<Type>(input, trueValue, falseValue);
-    }
-    else
+    const auto valuesChunk = m_Store.createChunkView(start, count);
+    const nonstd::span<const T> values = valuesChunk.span();
+    switch(m_ComparisonType)
     {
-      std::string errorMessage = fmt::format("MultiThresholdObjects Comparison Operator not understood: '{}'", static_cast<int>(m_ComparisonOperator));
-      throw std::runtime_error(errorMessage);
+    case ArrayThreshold::ComparisonType::GreaterThan:
+      PackComparison(values, m_ComparisonValue, std::greater<T>{}, words);
+      break;
+    case ArrayThreshold::ComparisonType::LessThan:
+      PackComparison(values, m_ComparisonValue, std::less<T>{}, words);
+      break;
+    case ArrayThreshold::ComparisonType::Operator_Equal:
+      PackComparison(values, m_ComparisonValue, std::equal_to<T>{}, words);
+      break;
+    case ArrayThreshold::ComparisonType::Operator_NotEqual:
+      PackComparison(values, m_ComparisonValue, std::not_equal_to<T>{}, words);
+      break;
     }
   }
 
 private:
-  nx::core::ArrayThreshold::ComparisonType m_ComparisonOperator;
-  nx::core::ArrayThreshold::ComparisonValue m_ComparisonValue;
-  std::vector<U>& m_Output;
-
-public:
-  ThresholdFilterHelper(const ThresholdFilterHelper&) = delete;            // Copy Constructor Not Implemented
-  ThresholdFilterHelper(ThresholdFilterHelper&&) = delete;                 // Move Constructor Not Implemented
-  ThresholdFilterHelper& operator=(const ThresholdFilterHelper&) = delete; // Copy Assignment Not Implemented
-  ThresholdFilterHelper& operator=(ThresholdFilterHelper&&) = delete;      // Move Assignment Not Implemented
+  const AbstractDataStore<T>& m_Store;
+  ArrayThreshold::ComparisonType m_ComparisonType;
+  T m_ComparisonValue;
 };
 
-struct ExecuteThresholdHelper
+struct CreateThresholdComparisonFunctor
 {
-  template <typename Type, typename MaskType>
-  void operator()(ThresholdFilterHelper<MaskType>& helper, const IDataArray* iDataArray, Type trueValue, Type falseValue)
+  template <typename T>
+  std::unique_ptr<IThresholdComparison> operator()(const IDataArray& dataArray, ArrayThreshold::ComparisonType comparisonType, ArrayThreshold::ComparisonValue comparisonValue)
   {
-    const auto& dataStore = iDataArray->template getIDataStoreRefAs<AbstractDataStore<Type>>();
-    helper.template filterData<Type>(dataStore, trueValue, falseValue);
+    return std::make_unique<ThresholdComparison<T>>(dataArray.template getIDataStoreRefAs<AbstractDataStore<T>>(), comparisonType, comparisonValue);
   }
 };
 
 /**
- * @brief InsertThreshold
- * @param numItems
- * @param currentArrayPtr
- * @param unionOperator
- * @param newArrayPtr
- * @param inverse
+ * @brief An ArrayThresholdSet compiled into a postfix program that evaluates the whole
+ * threshold tree for one block of tuples at a time.
+ *
+ * Every ArrayThreshold pushes its bit mask onto a stack. The threshold that follows the first
+ * one in a set pops the top two masks and pushes their intersection or union, depending on its
+ * union operator, and inverted thresholds or sets flip the mask on top of the stack. Only the
+ * bit masks of a single block are held at any time.
  */
-template <typename T>
-void InsertThreshold(usize numItems, AbstractDataStore<T>& currentStore, nx::core::IArrayThreshold::UnionOperator unionOperator, std::vector<T>& newArrayPtr, bool inverse, T trueValue, T falseValue)
+class ThresholdProgram
 {
-  for(usize i = 0; i < numItems; i++)
+public:
+  /**
+   * @brief Compiles the threshold tree. Sets without any thresholds are ignored.
+   * @param thresholdSet
+   * @param dataStructure
+   * @return Result<>
+   */
+  Result<> compile(const ArrayThresholdSet& thresholdSet, const DataStructure& dataStructure)
   {
-    // invert the current comparison if necessary
-    if(inverse)
-    {
-      newArrayPtr[i] = (newArrayPtr[i] == trueValue) ? falseValue : trueValue;
-    }
-
-    if(nx::core::IArrayThreshold::UnionOperator::Or == unionOperator)
+    Result<> result = append(thresholdSet, dataStructure);
+    if(result.invalid())
     {
-      currentStore[i] = (currentStore[i] == trueValue || newArrayPtr[i] == trueValue) ? trueValue : falseValue;
+      return result;
     }
-    else if(currentStore[i] == falseValue || newArrayPtr[i] == falseValue)
+    if(m_Instructions.empty())
     {
-      currentStore[i] = falseValue;
+      return MakeErrorResult(-4000, "No data arrays were found for calculating threshold");
     }
+    return {};
   }
-}
 
-template <typename T>
-void ThresholdValue(std::shared_ptr<ArrayThreshold>& comparisonValue, const DataStructure& dataStructure, AbstractDataStore<T>& outputResultStore, int32_t& err, bool replaceInput, bool inverse,
-                    T trueValue, T falseValue)
-{
-  if(nullptr == comparisonValue)
+  /**
+   * @brief Returns the data stores read by the program.
+   * @return IParallelAlgorithm::AlgorithmStores
+   */
+  const IParallelAlgorithm::AlgorithmStores& stores() const
   {
-    err = -1;
-    return;
+    return m_Stores;
   }
 
-  // Get the total number of tuples, create and initialize an array with FALSE to use for these results
-  size_t totalTuples = outputResultStore.getNumberOfTuples();
-  std::vector<T> tempResultVector(totalTuples, falseValue);
-
-  nx::core::ArrayThreshold::ComparisonType compOperator = comparisonValue->getComparisonType();
-  nx::core::ArrayThreshold::ComparisonValue compValue = comparisonValue->getComparisonValue();
-  nx::core::IArrayThreshold::UnionOperator unionOperator = comparisonValue->getUnionOperator();
-
-  DataPath inputDataArrayPath = comparisonValue->getArrayPath();
-
-  ThresholdFilterHelper<T> helper(compOperator, compValue, tempResultVector);
-
-  const auto* iDataArray = dataStructure.getDataAs<IDataArray>(inputDataArrayPath);
-
-  ExecuteDataFunction(ExecuteThresholdHelper{}, iDataArray->getDataType(), helper, iDataArray, trueValue, falseValue);
+  /**
+   * @brief Returns the number of words of scratch space evaluate() needs.
+   * @return usize
+   */
+  usize scratchSize() const
+  {
+    return m_MaxDepth * k_WordsPerBlock;
+  }
 
-  if(replaceInput)
+  /**
+   * @brief Evaluates count tuples starting at start.
+   * @param start
+   * @param count At most k_BlockSize
+   * @param scratch At least scratchSize() words
+   * @return The bit mask of the result, stored at the beginning of the scratch space
+   */
+  const MaskWord* evaluate(usize start, usize count, MaskWord* scratch) const
   {
-    if(inverse)
-    {
-      std::reverse(tempResultVector.begin(), tempResultVector.end());
-    }
-    // copy the temp uint8 vector to the final uint8 result array
-    for(size_t i = 0; i < totalTuples; i++)
+    const usize numWords = (count + k_BitsPerWord - 1) / k_BitsPerWord;
+    usize depth = 0;
+    for(const Instruction& instruction : m_Instructions)
     {
-      outputResultStore[i] = tempResultVector[i];
+      if(instruction.operation == Operation::Compare)
+      {
+        m_Comparisons[instruction.comparisonIndex]->evaluate(start, count, scratch + depth * k_WordsPerBlock);
+        depth++;
+        continue;
+      }
+
+      MaskWord* top = scratch + (depth - 1) * k_WordsPerBlock;
+      switch(instruction.operation)
+      {
+      case Operation::Compare: {
+        break;
+      }
+      case Operation::And: {
+        MaskWord* lhs = top - k_WordsPerBlock;
+        for(usize wordIndex = 0; wordIndex < numWords; wordIndex++)
+        {
+          lhs[wordIndex] &= top[wordIndex];
+        }
+        depth--;
+        break;
+      }
+      case Operation::Or: {
+        MaskWord* lhs = top - k_WordsPerBlock;
+        for(usize wordIndex = 0; wordIndex < numWords; wordIndex++)
+        {
+          lhs[wordIndex] |= top[wordIndex];
+        }
+        depth--;
+        break;
+      }
+      case Operation::Invert: {
+        for(usize wordIndex = 0; wordIndex < numWords; wordIndex++)
+        {
+          top[wordIndex] = ~top[wordIndex];
+        }
+        break;
+      }
+      }
     }
+    return scratch;
   }
-  else
-  {
-    // insert into current threshold
-    InsertThreshold<T>(totalTuples, outputResultStore, unionOperator, tempResultVector, inverse, trueValue, falseValue);
-  }
-}
 
-struct ThresholdValueFunctor
-{
-  template <typename T>
-  void operator()(std::shared_ptr<ArrayThreshold>& comparisonValue, const DataStructure& dataStructure, IDataArray* outputResultArray, int32_t& err, bool replaceInput, bool inverse, T trueValue,
-                  T falseValue)
+private:
+  enum class Operation : uint8
   {
-    // Traditionally we would do a check to ensure we get a valid pointer, I'm forgoing that check because it
-    // was essentially done in the preflight part.
-    ThresholdValue(comparisonValue, dataStructure, outputResultArray->template getIDataStoreRefAs<AbstractDataStore<T>>(), err, replaceInput, inverse, trueValue, falseValue);
-  }
-};
+    Compare,
+    And,
+    Or,
+    Invert
+  };
 
-template <typename T>
-void ThresholdSet(std::shared_ptr<ArrayThresholdSet>& inputComparisonSet, const DataStructure& dataStructure, AbstractDataStore<T>& outputResultStore, int32_t& err, bool replaceInput, bool inverse,
-                  T trueValue, T falseValue)
-{
-  if(nullptr == inputComparisonSet)
+  struct Instruction
   {
-    return;
-  }
-
-  // Get the total number of tuples, create and initialize an array with FALSE to use for these results
-  size_t totalTuples = outputResultStore.getNumberOfTuples();
-  std::vector<T> tempResultVector(totalTuples, falseValue);
+    Operation operation = Operation::Compare;
+    usize comparisonIndex = 0;
+  };
 
-  T firstValueFound = 0;
-
-  ArrayThresholdSet::CollectionType thresholds = inputComparisonSet->getArrayThresholds();
-  for(const std::shared_ptr<IArrayThreshold>& threshold : thresholds)
+  Result<> append(const IArrayThreshold& threshold, const DataStructure& dataStructure)
   {
-    if(std::dynamic_pointer_cast<ArrayThresholdSet>(threshold))
+    if(const auto* thresholdSet = dynamic_cast<const ArrayThresholdSet*>(&threshold); thresholdSet != nullptr)
     {
-      std::shared_ptr<ArrayThresholdSet> comparisonSet = std::dynamic_pointer_cast<ArrayThresholdSet>(threshold);
-      ThresholdSet<T>(comparisonSet, dataStructure, outputResultStore, err, !firstValueFound, false, trueValue, falseValue);
-      firstValueFound = true;
+      bool firstValueFound = false;
+      for(const std::shared_ptr<IArrayThreshold>& child : thresholdSet->getArrayThresholds())
+      {
+        if(child == nullptr)
+        {
+          continue;
+        }
+        const usize numInstructions = m_Instructions.size();
+        Result<> result = append(*child, dataStructure);
+        if(result.invalid())
+        {
+          return result;
+        }
+        if(m_Instructions.size() == numInstructions)
+        {
+          continue;
+        }
+        if(firstValueFound)
+        {
+          m_Instructions.push_back({child->getUnionOperator() == IArrayThreshold::UnionOperator::Or ? Operation::Or : Operation::And, 0});
+          m_Depth--;
+        }
+        firstValueFound = true;
+      }
+      if(firstValueFound && thresholdSet->isInverted())
+      {
+        m_Instructions.push_back({Operation::Invert, 0});
+      }
+      return {};
     }
-    else if(std::dynamic_pointer_cast<ArrayThreshold>(threshold))
-    {
-      std::shared_ptr<ArrayThreshold> comparisonValue = std::dynamic_pointer_cast<ArrayThreshold>(threshold);
 
-      ThresholdValue<T>(comparisonValue, dataStructure, outputResultStore, err, !firstValueFound, false, trueValue, falseValue);
-      firstValueFound = true;
+    const auto* arrayThreshold = dynamic_cast<const ArrayThreshold*>(&threshold);
+    if(arrayThreshold == nullptr)
+    {
+      return {};
     }
-  }
-
-  if(replaceInput)
-  {
-    if(inverse)
+    const DataPath arrayPath = arrayThreshold->getArrayPath();
+    const auto* dataArray = dataStructure.getDataAs<IDataArray>(arrayPath);
+    if(dataArray == nullptr)
     {
-      std::reverse(tempResultVector.begin(), tempResultVector.end());
+      return MakeErrorResult(to_underlying(MultiThresholdObjectsFilter::ErrorCodes::PathNotFoundError), fmt::format("Could not find DataArray at path {}.", arrayPath.toString()));
     }
-    // copy the temp uint8 vector to the final uint8 result array
-    for(size_t i = 0; i < totalTuples; i++)
+    const ArrayThreshold::ComparisonType comparisonType = arrayThreshold->getComparisonType();
+    if(comparisonType != ArrayThreshold::ComparisonType::GreaterThan && comparisonType != ArrayThreshold::ComparisonType::LessThan &&
+       comparisonType != ArrayThreshold::ComparisonType::Operator_Equal && comparisonType != ArrayThreshold::ComparisonType::Operator_NotEqual)
     {
-      outputResultStore[i] = tempResultVector[i];
+      return MakeErrorResult(to_underlying(MultiThresholdObjectsFilter::ErrorCodes::UnknownComparisonType),
+                             fmt::format("MultiThresholdObjects Comparison Operator not understood: '{}'", static_cast<int>(comparisonType)));
     }
+
+    m_Comparisons.push_back(ExecuteDataFunction(CreateThresholdComparisonFunctor{}, dataArray->getDataType(), *dataArray, comparisonType, arrayThreshold->getComparisonValue()));
+    m_Stores.push_back(dataArray->getIDataStore());
+    m_Instructions.push_back({Operation::Compare, m_Comparisons.size() - 1});
+    m_Depth++;
+    m_MaxDepth = std::max(m_MaxDepth, m_Depth);
+    if(arrayThreshold->isInverted())
+    {
+      m_Instructions.push_back({Operation::Invert, 0});
+    }
+    return {};
   }
-  else
-  {
-    // insert into current threshold
-    InsertThreshold<T>(totalTuples, outputResultStore, inputComparisonSet->getUnionOperator(), tempResultVector, inverse, trueValue, falseValue);
-  }
-}
 
-struct ThresholdSetFunctor
+  std::vector<Instruction> m_Instructions;
+  std::vector<std::unique_ptr<IThresholdComparison>> m_Comparisons;
+  IParallelAlgorithm::AlgorithmStores m_Stores;
+  usize m_Depth = 0;
+  usize m_MaxDepth = 0;
+};
+
+/**
+ * @brief Evaluates the compiled thresholds in parallel over blocks of tuples and writes the
+ * TRUE/FALSE values straight into the mask. A failed write-back is reported for the lowest
+ * failing block so the error does not depend on thread scheduling.
+ */
+struct WriteThresholdMaskFunctor
 {
   template <typename T>
-  void operator()(std::shared_ptr<ArrayThresholdSet>& inputComparisonSet, const DataStructure& dataStructure, IDataArray* outputResultArray, int32_t& err, bool replaceInput, bool inverse, T trueValue,
-                  T falseValue)
+  Result<> operator()(const ThresholdProgram& program, IDataArray& maskArray, float64 trueValue, float64 falseValue, const std::atomic_bool& shouldCancel)
   {
-    if(outputResultArray == nullptr)
-    {
-      return;
-    }
-
-    // Traditionally we would do a check to ensure we get a valid pointer, I'm forgoing that check because it
-    // was essentially done in the preflight part.
-    ThresholdSet<T>(inputComparisonSet, dataStructure, outputResultArray->template getIDataStoreRefAs<AbstractDataStore<T>>(), err, replaceInput, inverse, trueValue, falseValue);
+    auto& maskStore = maskArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+    const T maskTrueValue = static_cast<T>(trueValue);
+    const T maskFalseValue = static_cast<T>(falseValue);
+    const usize numTuples = maskStore.getNumberOfTuples();
+    const usize numBlocks = (numTuples + k_BlockSize - 1) / k_BlockSize;
+
+    IParallelAlgorithm::AlgorithmStores stores = program.stores();
+    stores.push_back(&maskStore);
+
+    std::mutex resultMutex;
+    usize firstFailedBlock = numBlocks;
+    Result<> writeResult = {};
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numBlocks);
+    dataAlg.requireStoresInMemory(stores);
+    dataAlg.execute([&](const Range& range) {
+      std::vector<MaskWord> scratch(program.scratchSize());
+      for(usize blockIndex = range.min(); blockIndex < range.max(); blockIndex++)
+      {
+        if(shouldCancel)
+        {
+          return;
+        }
+        const usize blockStart = blockIndex * k_BlockSize;
+        const usize blockSize = std::min(k_BlockSize, numTuples - blockStart);
+        const MaskWord* words = program.evaluate(blockStart, blockSize, scratch.data());
+
+        auto maskChunk = maskStore.createChunkView(blockStart, blockSize);
+        T* maskValues = maskChunk.span().data();
+        for(usize index = 0; index < blockSize; index++)
+        {
+          const bool isTrue = ((words[index / k_BitsPerWord] >> (index % k_BitsPerWord)) & 1) != 0;
+          maskValues[index] = isTrue ? maskTrueValue : maskFalseValue;
+        }
+        Result<> commitResult = maskChunk.commit();
+        if(commitResult.invalid())
+        {
+          std::lock_guard<std::mutex> lock(resultMutex);
+          if(blockIndex < firstFailedBlock)
+          {
+            firstFailedBlock = blockIndex;
+            writeResult = std::move(commitResult);
+          }
+          return;
+        }
+      }
+    });
+    return writeResult;
   }
 };
 
@@ -498,29 +601,16 @@ Result<> MultiThresholdObjectsFilter::executeImpl(DataStructure& dataStructure,
   float64 trueValue = useCustomTrueValue ? customTrueValue : 1.0;
   float64 falseValue = useCustomFalseValue ? customFalseValue : 0.0;
 
-  bool firstValueFound = false;
   DataPath maskArrayPath = (*thresholdsObject.getRequiredPaths().begin()).replaceName(maskArrayName);
-  int32_t err = 0;
-  ArrayThresholdSet::CollectionType thresholdSet = thresholdsObject.getArrayThresholds();
-  for(const std::shared_ptr<IArrayThreshold>& threshold : thresholdSet)
+
+  ThresholdProgram thresholdProgram;
+  Result<> compileResult = thresholdProgram.compile(thresholdsObject, dataStructure);
+  if(compileResult.invalid())
   {
-    if(std::dynamic_pointer_cast<ArrayThresholdSet>(threshold))
-    {
-      std::shared_ptr<ArrayThresholdSet> comparisonSet = std::dynamic_pointer_cast<ArrayThresholdSet>(threshold);
-      ExecuteDataFunction(ThresholdSetFunctor{}, maskArrayType, comparisonSet, dataStructure, dataStructure.getDataAs<IDataArray>(maskArrayPath), err, !firstValueFound, thresholdsObject.isInverted(),
-                          trueValue, falseValue);
-      firstValueFound = true;
-    }
-    else if(std::dynamic_pointer_cast<ArrayThreshold>(threshold))
-    {
-      std::shared_ptr<ArrayThreshold> comparisonValue = std::dynamic_pointer_cast<ArrayThreshold>(threshold);
-      ExecuteDataFunction(ThresholdValueFunctor{}, maskArrayType, comparisonValue, dataStructure, dataStructure.getDataAs<IDataArray>(maskArrayPath), err, !firstValueFound,
-                          thresholdsObject.isInverted(), trueValue, falseValue);
-      firstValueFound = true;
-    }
+    return compileResult;
   }
 
-  return {};
+  return ExecuteDataFunction(WriteThresholdMaskFunctor{}, maskArrayType, thresholdProgram, dataStructure.getDataRefAs<IDataArray>(maskArrayPath), trueValue, falseValue, shouldCancel);
 }
 
 namespace
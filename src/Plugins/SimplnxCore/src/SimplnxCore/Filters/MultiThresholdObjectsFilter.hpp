@@ -43,7 +43,8 @@ public:
     CustomTrueWithBoolean = -4003,
     CustomFalseWithBoolean = -4004,
     CustomTrueOutOfBounds = -4005,
-    CustomFalseOutOfBounds = -4006
+    CustomFalseOutOfBounds = -4006,
+    UnknownComparisonType = -4007
   };
 
   /**
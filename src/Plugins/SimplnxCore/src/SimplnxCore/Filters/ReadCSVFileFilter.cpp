@@ -16,10 +16,14 @@
 #include "simplnx/Parameters/DynamicTableParameter.hpp"
 #include "simplnx/Parameters/ReadCSVFileParameter.hpp"
 #include "simplnx/Utilities/FileUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/Parsing/Text/MappedTextFile.hpp"
+#include "simplnx/Utilities/Parsing/Text/TextChunks.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
 #include <fstream>
+#include <mutex>
 
 using namespace nx::core;
 
@@ -211,12 +215,10 @@ Result<ParsersVector> createParsers(const DataTypeVector& dataTypes, const std::
 }
 
 // -----------------------------------------------------------------------------
-Result<> parseLine(std::fstream& inStream, const ParsersVector& dataParsers, const StringVector& headers, const CharVector& delimiters, bool consecutiveDelimiters, usize lineNumber, usize beginIndex)
+Result<> parseLine(std::string_view line, std::vector<std::string_view>& tokens, const ParsersVector& dataParsers, const StringVector& headers, const CharVector& delimiters,
+                   bool consecutiveDelimiters, usize lineNumber, usize tupleIndex)
 {
-  std::string line;
-  std::getline(inStream, line);
-  line = StringUtilities::replace(line, "\r", "");
-  StringVector tokens = StringUtilities::split(line, delimiters, consecutiveDelimiters);
+  TextChunks::SplitDelimited(line, delimiters, consecutiveDelimiters, tokens);
   if(tokens.empty())
   {
     // This is an empty line in the middle of the CSV file, which just shouldn't happen
@@ -242,7 +244,7 @@ Result<> parseLine(std::fstream& inStream, const ParsersVector& dataParsers, con
 
     usize index = dataParser->columnIndex();
 
-    Result<> result = dataParser->parse(tokens[index], lineNumber - beginIndex);
+    Result<> result = dataParser->parse(tokens[index], tupleIndex);
     if(result.invalid())
     {
       for(Error& error : result.errors())
@@ -320,6 +322,10 @@ IFilter::PreflightResult readHeaders(const std::string& inputFilePath, usize hea
 
   // Read the headers line
   std::getline(in, headerCache.Headers);
+  if(!headerCache.Headers.empty() && headerCache.Headers.back() == '\r')
+  {
+    headerCache.Headers.pop_back();
+  }
   headerCache.HeadersLine = headersLineNum;
   return {};
 }
@@ -341,6 +347,11 @@ Result<> cacheHeaders(const ReadCSVData& readCsvData)
 
     if(currentLine == readCsvData.headersLine)
     {
+      // Files with CRLF line endings are read the same way as the data lines
+      if(!line.empty() && line.back() == '\r')
+      {
+        line.pop_back();
+      }
       s_HeaderCache[s_InstanceId].Headers = line;
       s_HeaderCache[s_InstanceId].HeadersLine = readCsvData.headersLine;
       break;
@@ -700,41 +711,95 @@ Result<> ReadCSVFileFilter::executeImpl(DataStructure& dataStructure, const Argu
     return ConvertResult(std::move(parsersResult));
   }
 
-  std::fstream in(inputFilePath.c_str(), std::ios_base::in);
-  if(!in.is_open())
+  std::unique_ptr<MappedTextFile> mappedFile;
+  try
   {
-    return MakeErrorResult(to_underlying(IssueCodes::FILE_NOT_OPEN), fmt::format("Could not open file for reading: {}", inputFilePath));
+    mappedFile = std::make_unique<MappedTextFile>(inputFilePath);
+  } catch(const std::exception& exception)
+  {
+    return MakeErrorResult(to_underlying(IssueCodes::FILE_NOT_OPEN), fmt::format("Could not open file for reading: {}\n{}", inputFilePath, exception.what()));
   }
 
   // Skip to the first data line
-  if(!skipNumberOfLines(in, startImportRow))
+  const std::string_view text = mappedFile->text();
+  const usize dataStart = TextChunks::FindLineStart(text, startImportRow - 1);
+  if(startImportRow > 1 && dataStart == text.size())
   {
     return MakeErrorResult(to_underlying(IssueCodes::CANNOT_SKIP_TO_LINE), fmt::format("Could not skip to the first line in the file to import ({}).", startImportRow));
   }
+  const std::string_view dataText = text.substr(dataStart);
 
-  float32 threshold = 0.0f;
   usize numTuples = std::accumulate(readCSVData.tupleDims.cbegin(), readCSVData.tupleDims.cend(), static_cast<usize>(1), std::multiplies<>());
   if(useExistingGroup)
   {
     const AttributeMatrix& am = dataStructure.getDataRefAs<AttributeMatrix>(groupPath);
     numTuples = std::accumulate(am.getShape().cbegin(), am.getShape().cend(), static_cast<usize>(1), std::multiplies<>());
   }
-  usize lineNum = startImportRow;
-  for(usize i = 0; i < numTuples && !in.eof(); i++)
+
+  // Every line is a tuple, so the chunks are indexed by line rather than by non-blank line
+  const std::vector<TextChunks::LineChunk> chunks = TextChunks::SplitIntoLineChunks(dataText, TextChunks::CountLines);
+  const usize numDataLines = chunks.empty() ? 0 : chunks.back().firstRow + chunks.back().numRows;
+  if(numDataLines < numTuples)
+  {
+    return MakeErrorResult(to_underlying(IssueCodes::EMPTY_LINE),
+                           fmt::format("Line #{} is empty!  You should not have any empty lines in the file.", std::to_string(startImportRow + numDataLines)));
+  }
+
+  IParallelAlgorithm::AlgorithmArrays arrays;
+  for(const auto& dataParser : parsersResult.value())
   {
-    if(shouldCancel)
+    if(dataParser != nullptr)
     {
-      return {};
+      arrays.push_back(&dataParser->dataArray());
     }
+  }
+
+  std::vector<Result<>> chunkResults(chunks.size());
+  std::mutex progressMutex;
+  usize numParsedLines = 0;
+  float32 threshold = 0.0f;
 
-    Result<> parsingResult = parseLine(in, parsersResult.value(), headers, readCSVData.delimiters, consecutiveDelimiters, lineNum, startImportRow);
-    if(parsingResult.invalid())
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, chunks.size());
+  dataAlg.requireArraysInMemory(arrays);
+  dataAlg.execute([&](const Range& range) {
+    std::vector<std::string_view> tokens;
+    for(usize chunkIndex = range.min(); chunkIndex < range.max(); chunkIndex++)
     {
-      return std::move(parsingResult);
+      const TextChunks::LineChunk& chunk = chunks[chunkIndex];
+      if(shouldCancel || chunk.firstRow >= numTuples)
+      {
+        continue;
+      }
+
+      const std::string_view chunkText = dataText.substr(chunk.begin, chunk.end - chunk.begin);
+      const usize numChunkLines = std::min(chunk.numRows, numTuples - chunk.firstRow);
+      usize offset = 0;
+      for(usize line = 0; line < numChunkLines; line++)
+      {
+        const usize tupleIndex = chunk.firstRow + line;
+        Result<> parsingResult =
+            parseLine(TextChunks::NextLine(chunkText, offset), tokens, parsersResult.value(), headers, readCSVData.delimiters, consecutiveDelimiters, startImportRow + tupleIndex, tupleIndex);
+        if(parsingResult.invalid())
+        {
+          chunkResults[chunkIndex] = std::move(parsingResult);
+          break;
+        }
+      }
+
+      std::lock_guard<std::mutex> lock(progressMutex);
+      numParsedLines += numChunkLines;
+      notifyProgress(messageHandler, numParsedLines, numTuples, threshold);
     }
+  });
 
-    notifyProgress(messageHandler, lineNum, numTuples, threshold);
-    lineNum++;
+  // Report the error closest to the start of the file
+  for(Result<>& chunkResult : chunkResults)
+  {
+    if(chunkResult.invalid())
+    {
+      return std::move(chunkResult);
+    }
   }
 
   return {};
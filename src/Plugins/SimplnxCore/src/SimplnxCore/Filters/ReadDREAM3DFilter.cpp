@@ -2,6 +2,7 @@
 
 #include "simplnx/Common/StringLiteral.hpp"
 #include "simplnx/Filter/Actions/ImportH5ObjectPathsAction.hpp"
+#include "simplnx/Parameters/BoolParameter.hpp"
 #include "simplnx/Parameters/Dream3dImportParameter.hpp"
 #include "simplnx/Parameters/StringParameter.hpp"
 #include "simplnx/Utilities/Parsing/HDF5/Readers/FileReader.hpp"
@@ -54,6 +55,10 @@ Parameters ReadDREAM3DFilter::parameters() const
   Parameters params;
   params.insertSeparator(Parameters::Separator{"Input Parameter(s)"});
   params.insert(std::make_unique<Dream3dImportParameter>(k_ImportFileData, "Import File Path", "The HDF5 file path the DataStructure should be imported from.", Dream3dImportParameter::ImportData()));
+  params.insert(std::make_unique<BoolParameter>(k_DeferLoading_Key, "Load Array Data On First Access",
+                                                "Read the values of each imported array from the file the first time they are accessed instead of while importing. The file stays open until every "
+                                                "imported array has been fully read.",
+                                                false));
   return params;
 }
 
@@ -82,8 +87,10 @@ IFilter::PreflightResult ReadDREAM3DFilter::preflightImpl(const DataStructure& d
     return {nonstd::make_unexpected(std::vector<Error>{Error{k_FailedOpenFileReaderError, "Failed to open the HDF5 file at the specified path."}})};
   }
 
+  auto deferLoading = args.value<bool>(k_DeferLoading_Key);
+
   OutputActions actions;
-  auto action = std::make_unique<ImportH5ObjectPathsAction>(importData.FilePath, importData.DataPaths);
+  auto action = std::make_unique<ImportH5ObjectPathsAction>(importData.FilePath, importData.DataPaths, deferLoading);
   actions.appendAction(std::move(action));
   return {std::move(actions)};
 }
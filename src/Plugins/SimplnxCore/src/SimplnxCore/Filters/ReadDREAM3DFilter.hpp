@@ -28,6 +28,7 @@ public:
 
   // Parameter Keys
   static inline constexpr StringLiteral k_ImportFileData = "import_data_object";
+  static inline constexpr StringLiteral k_DeferLoading_Key = "defer_loading";
 
   /**
    * @brief Reads SIMPL json and converts it simplnx Arguments.
@@ -12,9 +12,14 @@
 #include "simplnx/Parameters/ArraySelectionParameter.hpp"
 #include "simplnx/Parameters/BoolParameter.hpp"
 #include "simplnx/Parameters/ChoicesParameter.hpp"
+#include "simplnx/Parameters/DataObjectNameParameter.hpp"
+#include "simplnx/Parameters/NumberParameter.hpp"
 #include "simplnx/Utilities/ClusteringUtilities.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
+#include <chrono>
+#include <random>
+
 using namespace nx::core;
 
 namespace
@@ -64,6 +69,16 @@ Parameters SilhouetteFilter::parameters() const
       std::make_unique<ChoicesParameter>(k_DistanceMetric_Key, "Distance Metric", "Distance Metric type to be used for calculations", to_underlying(ClusterUtilities::DistanceMetric::Euclidean),
                                          ChoicesParameter::Choices{"Euclidean", "Squared Euclidean", "Manhattan", "Cosine", "Pearson", "Squared Pearson"})); // sequence dependent DO NOT REORDER
 
+  params.insertSeparator(Parameters::Separator{"Sampling Parameters"});
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseSampling_Key, "Use Sampled Silhouette",
+                                                                 "When true each point is only compared against a random sample of the points in every cluster", false));
+  params.insert(std::make_unique<NumberParameter<uint64>>(k_SamplesPerCluster_Key, "Samples Per Cluster", "The maximum number of points of each cluster that every point is compared against", 1000));
+
+  params.insertSeparator(Parameters::Separator{"Random Number Seed Parameters"});
+  params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseSeed_Key, "Use Seed for Random Generation", "When true the user will be able to put in a seed for random generation", false));
+  params.insert(std::make_unique<NumberParameter<uint64>>(k_SeedValue_Key, "Seed Value", "The seed fed into the random generator that selects the samples", std::mt19937::default_seed));
+  params.insert(std::make_unique<DataObjectNameParameter>(k_SeedArrayName_Key, "Stored Seed Value Array Name", "Name of array holding the seed value", "Silhouette SeedValue"));
+
   // Create the parameter descriptors that are needed for this filter
   params.insertSeparator(Parameters::Separator{"Optional Data Mask"});
   params.insertLinkableParameter(std::make_unique<BoolParameter>(k_UseMask_Key, "Use Mask Array", "Specifies whether or not to use a mask array", false));
@@ -80,6 +95,9 @@ Parameters SilhouetteFilter::parameters() const
 
   // Associate the Linkable Parameter(s) to the children parameters that they control
   params.linkParameters(k_UseMask_Key, k_MaskArrayPath_Key, true);
+  params.linkParameters(k_UseSampling_Key, k_SamplesPerCluster_Key, true);
+  params.linkParameters(k_UseSampling_Key, k_SeedArrayName_Key, true);
+  params.linkParameters(k_UseSeed_Key, k_SeedValue_Key, true);
 
   return params;
 }
@@ -105,9 +123,17 @@ IFilter::PreflightResult SilhouetteFilter::preflightImpl(const DataStructure& da
   auto pMaskArrayPathValue = filterArgs.value<DataPath>(k_MaskArrayPath_Key);
   auto pFeatureIdsArrayPathValue = filterArgs.value<DataPath>(k_FeatureIdsArrayPath_Key);
   auto pSilhouetteArrayPathValue = filterArgs.value<DataPath>(k_SilhouetteArrayPath_Key);
+  auto pUseSamplingValue = filterArgs.value<bool>(k_UseSampling_Key);
+  auto pSamplesPerClusterValue = filterArgs.value<uint64>(k_SamplesPerCluster_Key);
+  auto pSeedArrayNameValue = filterArgs.value<std::string>(k_SeedArrayName_Key);
 
   nx::core::Result<OutputActions> resultOutputActions;
 
+  if(pUseSamplingValue && pSamplesPerClusterValue == 0)
+  {
+    return MakePreflightErrorResult(-8977, "The number of samples per cluster must be greater than 0");
+  }
+
   auto clusterArray = dataStructure.getDataAs<IDataArray>(pSelectedArrayPathValue);
   auto clusterIds = dataStructure.getDataAs<IDataArray>(pFeatureIdsArrayPathValue);
   if(clusterArray->getNumberOfTuples() != clusterIds->getNumberOfTuples())
@@ -132,6 +158,12 @@ IFilter::PreflightResult SilhouetteFilter::preflightImpl(const DataStructure& da
     resultOutputActions.value().appendAction(std::move(createAction));
   }
 
+  if(pUseSamplingValue)
+  {
+    auto createAction = std::make_unique<CreateArrayAction>(DataType::uint64, std::vector<usize>{1}, std::vector<usize>{1}, DataPath({pSeedArrayNameValue}));
+    resultOutputActions.value().appendAction(std::move(createAction));
+  }
+
   // Return both the resultOutputActions and the preflightUpdatedValues via std::move()
   return {std::move(resultOutputActions)};
 }
@@ -154,6 +186,21 @@ Result<> SilhouetteFilter::executeImpl(DataStructure& dataStructure, const Argum
   inputValues.MaskArrayPath = maskPath;
   inputValues.FeatureIdsArrayPath = filterArgs.value<DataPath>(k_FeatureIdsArrayPath_Key);
   inputValues.SilhouetteArrayPath = filterArgs.value<DataPath>(k_SilhouetteArrayPath_Key);
+  inputValues.UseSampling = filterArgs.value<bool>(k_UseSampling_Key);
+  inputValues.SamplesPerCluster = filterArgs.value<uint64>(k_SamplesPerCluster_Key);
+
+  if(inputValues.UseSampling)
+  {
+    auto seed = filterArgs.value<std::mt19937_64::result_type>(k_SeedValue_Key);
+    if(!filterArgs.value<bool>(k_UseSeed_Key))
+    {
+      seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
+    }
+
+    // Store Seed Value in Top Level Array
+    dataStructure.getDataRefAs<UInt64Array>(DataPath({filterArgs.value<std::string>(k_SeedArrayName_Key)}))[0] = seed;
+    inputValues.Seed = seed;
+  }
 
   return Silhouette(dataStructure, messageHandler, shouldCancel, &inputValues)();
 }
@@ -30,6 +30,11 @@ public:
   static inline constexpr StringLiteral k_MaskArrayPath_Key = "mask_array_path";
   static inline constexpr StringLiteral k_FeatureIdsArrayPath_Key = "feature_ids_array_path";
   static inline constexpr StringLiteral k_SilhouetteArrayPath_Key = "silhouette_array_path";
+  static inline constexpr StringLiteral k_UseSampling_Key = "use_sampling";
+  static inline constexpr StringLiteral k_SamplesPerCluster_Key = "samples_per_cluster";
+  static inline constexpr StringLiteral k_UseSeed_Key = "use_seed";
+  static inline constexpr StringLiteral k_SeedValue_Key = "seed_value";
+  static inline constexpr StringLiteral k_SeedArrayName_Key = "seed_array_name";
 
   /**
    * @brief Reads SIMPL json and converts it simplnx Arguments.
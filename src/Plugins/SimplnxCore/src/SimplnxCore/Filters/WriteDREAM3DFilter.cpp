@@ -3,7 +3,9 @@
 #include "simplnx/Common/AtomicFile.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/Parameters/BoolParameter.hpp"
+#include "simplnx/Parameters/ChoicesParameter.hpp"
 #include "simplnx/Parameters/FileSystemPathParameter.hpp"
+#include "simplnx/Parameters/NumberParameter.hpp"
 #include "simplnx/Pipeline/Pipeline.hpp"
 #include "simplnx/Pipeline/PipelineFilter.hpp"
 #include "simplnx/Utilities/Parsing/DREAM3D/Dream3dIO.hpp"
@@ -16,6 +18,11 @@ namespace
 {
 constexpr nx::core::int32 k_NoExportPathError = -1;
 constexpr nx::core::int32 k_FailedFindPipelineError = -15;
+constexpr nx::core::int32 k_BloscUnavailableError = -16;
+constexpr nx::core::int32 k_InvalidCompressionLevelError = -17;
+
+// Indices match nx::core::HDF5::CompressionSettings::Type
+const nx::core::ChoicesParameter::Choices k_CompressionChoices = {"None", "Deflate", "Shuffle + Deflate", "Blosc"};
 } // namespace
 
 namespace nx::core
@@ -59,6 +66,13 @@ Parameters WriteDREAM3DFilter::parameters() const
   params.insert(std::make_unique<FileSystemPathParameter>(k_ExportFilePath, "Output File Path", "The file path the DataStructure should be written to as an HDF5 file.", "Untitled.dream3d",
                                                           FileSystemPathParameter::ExtensionsType{".dream3d"}, FileSystemPathParameter::PathType::OutputFile, false));
   params.insert(std::make_unique<BoolParameter>(k_WriteXdmf, "Write Xdmf File", "Whether or not to write the data out an XDMF file", true));
+
+  params.insertSeparator(Parameters::Separator{"Compression"});
+  params.insert(std::make_unique<ChoicesParameter>(k_CompressionType_Key, "Compression",
+                                                   "The compression applied to the arrays. Shuffle + Deflate usually works best for integer arrays. Blosc requires simplnx to be built with compressors enabled.",
+                                                   0, k_CompressionChoices));
+  params.insert(std::make_unique<Int32Parameter>(k_CompressionLevel_Key, "Compression Level", "The compression level from 1 (fastest) to 9 (smallest file)",
+                                                 HDF5::CompressionSettings::k_DefaultLevel));
   return params;
 }
 
@@ -82,6 +96,19 @@ IFilter::PreflightResult WriteDREAM3DFilter::preflightImpl(const DataStructure&
   {
     return MakePreflightErrorResult(k_NoExportPathError, "Export file path not provided.");
   }
+
+  auto compressionType = static_cast<HDF5::CompressionSettings::Type>(args.value<ChoicesParameter::ValueType>(k_CompressionType_Key));
+  if(compressionType == HDF5::CompressionSettings::Type::Blosc && !HDF5::Compression::IsBloscAvailable())
+  {
+    return MakePreflightErrorResult(k_BloscUnavailableError, "Blosc compression is not available in this build. Select Deflate or Shuffle + Deflate instead.");
+  }
+  auto compressionLevel = args.value<int32>(k_CompressionLevel_Key);
+  if(compressionType != HDF5::CompressionSettings::Type::None &&
+     (compressionLevel < HDF5::CompressionSettings::k_MinLevel || compressionLevel > HDF5::CompressionSettings::k_MaxLevel))
+  {
+    return MakePreflightErrorResult(k_InvalidCompressionLevelError,
+                                    fmt::format("Compression level must be between {} and {}", HDF5::CompressionSettings::k_MinLevel, HDF5::CompressionSettings::k_MaxLevel));
+  }
   return {};
 }
 
@@ -98,6 +125,9 @@ Result<> WriteDREAM3DFilter::executeImpl(DataStructure& dataStructure, const Arg
 
   auto exportFilePath = atomicFile.tempFilePath();
   auto writeXdmf = args.value<bool>(k_WriteXdmf);
+  HDF5::CompressionSettings compression;
+  compression.type = static_cast<HDF5::CompressionSettings::Type>(args.value<ChoicesParameter::ValueType>(k_CompressionType_Key));
+  compression.level = args.value<int32>(k_CompressionLevel_Key);
 
   Pipeline pipeline;
 
@@ -112,9 +142,15 @@ Result<> WriteDREAM3DFilter::executeImpl(DataStructure& dataStructure, const Arg
     pipeline = *pipelinePtr;
   }
 
-  auto results = DREAM3D::WriteFile(exportFilePath, dataStructure, pipeline, writeXdmf);
+  HDF5::WriteStatistics statistics;
+  auto results = DREAM3D::WriteFile(exportFilePath, dataStructure, pipeline, writeXdmf, compression, &statistics);
   if(results.valid())
   {
+    constexpr float64 k_MiB = 1024.0 * 1024.0;
+    messageHandler({IFilter::Message::Type::Info,
+                    fmt::format("Wrote {:.2f} MiB of array data as {:.2f} MiB (ratio {:.2f}) in {:.3f} s ({:.1f} MiB/s)", static_cast<float64>(statistics.uncompressedBytes) / k_MiB,
+                                static_cast<float64>(statistics.storedBytes) / k_MiB, statistics.compressionRatio(), statistics.seconds, statistics.throughput())});
+
     Result<> commitResult = atomicFile.commit();
     if(commitResult.invalid())
     {
@@ -29,6 +29,8 @@ public:
   // Parameter Keys
   static inline constexpr StringLiteral k_ExportFilePath = "export_file_path";
   static inline constexpr StringLiteral k_WriteXdmf = "write_xdmf_file";
+  static inline constexpr StringLiteral k_CompressionType_Key = "compression_type_index";
+  static inline constexpr StringLiteral k_CompressionLevel_Key = "compression_level";
 
   /**
    * @brief Reads SIMPL json and converts it simplnx Arguments.
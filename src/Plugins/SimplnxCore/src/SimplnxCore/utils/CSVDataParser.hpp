@@ -32,6 +32,9 @@
 #include "simplnx/Common/Types.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/Parsing/Text/TextChunks.hpp"
+
+#include <string_view>
 
 using namespace nx::core;
 
@@ -60,7 +63,14 @@ public:
     return m_DataArray;
   }
 
-  virtual Result<> parse(const std::string& token, size_t index) = 0;
+  /**
+   * @brief Converts the token and writes it into tuple index of the array. Different
+   * indices may be parsed concurrently when the array is held in memory.
+   * @param token
+   * @param index
+   * @return Result<>
+   */
+  virtual Result<> parse(std::string_view token, usize index) const = 0;
 
 protected:
   AbstractDataParser(IDataArray& array, const std::string& columnName, usize columnIndex)
@@ -85,7 +95,7 @@ class CSVDataParser : public AbstractDataParser
 public:
   CSVDataParser(ArrayType& array, const std::string& name, usize index)
   : AbstractDataParser(array, name, index)
-  , m_Array(array)
+  , m_DataStore(array.getDataStoreRef())
   {
   }
   ~CSVDataParser() override = default;
@@ -95,19 +105,20 @@ public:
   CSVDataParser& operator=(const CSVDataParser&) = delete; // Copy Assignment Not Implemented
   CSVDataParser& operator=(CSVDataParser&&) = delete;      // Move Assignment
 
-  Result<> parse(const std::string& token, size_t index) override
+  Result<> parse(std::string_view token, usize index) const override
   {
-    Result<T> parseResult = ConvertTo<T>::convert(token);
-    if(parseResult.valid())
+    T value = {};
+    Result<> result = TextChunks::ConvertToken(token, value);
+    if(result.invalid())
     {
-      m_Array[index] = parseResult.value();
+      return result;
     }
-
-    return ConvertResult(std::move(parseResult));
+    m_DataStore.setValue(index, value);
+    return {};
   }
 
 private:
-  ArrayType& m_Array;
+  AbstractDataStore<T>& m_DataStore;
 };
 
 using Int8Parser = CSVDataParser<Int8Array, int8>;
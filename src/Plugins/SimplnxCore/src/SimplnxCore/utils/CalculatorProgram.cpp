@@ -0,0 +1,608 @@
+#include "SimplnxCore/utils/CalculatorProgram.hpp"
+
+#include "SimplnxCore/utils/ABSOperator.hpp"
+#include "SimplnxCore/utils/ACosOperator.hpp"
+#include "SimplnxCore/utils/ASinOperator.hpp"
+#include "SimplnxCore/utils/ATanOperator.hpp"
+#include "SimplnxCore/utils/AdditionOperator.hpp"
+#include "SimplnxCore/utils/CeilOperator.hpp"
+#include "SimplnxCore/utils/CosOperator.hpp"
+#include "SimplnxCore/utils/DivisionOperator.hpp"
+#include "SimplnxCore/utils/ExpOperator.hpp"
+#include "SimplnxCore/utils/FloorOperator.hpp"
+#include "SimplnxCore/utils/ICalculatorArray.hpp"
+#include "SimplnxCore/utils/LnOperator.hpp"
+#include "SimplnxCore/utils/Log10Operator.hpp"
+#include "SimplnxCore/utils/LogOperator.hpp"
+#include "SimplnxCore/utils/MultiplicationOperator.hpp"
+#include "SimplnxCore/utils/NegativeOperator.hpp"
+#include "SimplnxCore/utils/PowOperator.hpp"
+#include "SimplnxCore/utils/RootOperator.hpp"
+#include "SimplnxCore/utils/SinOperator.hpp"
+#include "SimplnxCore/utils/SqrtOperator.hpp"
+#include "SimplnxCore/utils/SubtractionOperator.hpp"
+#include "SimplnxCore/utils/TanOperator.hpp"
+
+#include "simplnx/Common/Numbers.hpp"
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <mutex>
+#include <type_traits>
+
+using namespace nx::core;
+
+namespace
+{
+using OpCode = CalculatorProgram::OpCode;
+using Operand = CalculatorProgram::Operand;
+
+constexpr float64 k_DegreesToRadians = numbers::pi / 180.0;
+constexpr float64 k_RadiansToDegrees = 180.0 / numbers::pi;
+
+template <class T>
+bool IsOperator(const CalculatorItem::Pointer& item)
+{
+  return std::dynamic_pointer_cast<T>(item) != nullptr;
+}
+
+// -----------------------------------------------------------------------------
+std::optional<OpCode> GetOpCode(const CalculatorItem::Pointer& item)
+{
+  if(IsOperator<NegativeOperator>(item))
+  {
+    return OpCode::Negate;
+  }
+  if(IsOperator<AdditionOperator>(item))
+  {
+    return OpCode::Add;
+  }
+  if(IsOperator<SubtractionOperator>(item))
+  {
+    return OpCode::Subtract;
+  }
+  if(IsOperator<MultiplicationOperator>(item))
+  {
+    return OpCode::Multiply;
+  }
+  if(IsOperator<DivisionOperator>(item))
+  {
+    return OpCode::Divide;
+  }
+  if(IsOperator<PowOperator>(item))
+  {
+    return OpCode::Pow;
+  }
+  if(IsOperator<RootOperator>(item))
+  {
+    return OpCode::Root;
+  }
+  if(IsOperator<LogOperator>(item))
+  {
+    return OpCode::Log;
+  }
+  if(IsOperator<ABSOperator>(item))
+  {
+    return OpCode::Abs;
+  }
+  if(IsOperator<SinOperator>(item))
+  {
+    return OpCode::Sin;
+  }
+  if(IsOperator<CosOperator>(item))
+  {
+    return OpCode::Cos;
+  }
+  if(IsOperator<TanOperator>(item))
+  {
+    return OpCode::Tan;
+  }
+  if(IsOperator<ASinOperator>(item))
+  {
+    return OpCode::ASin;
+  }
+  if(IsOperator<ACosOperator>(item))
+  {
+    return OpCode::ACos;
+  }
+  if(IsOperator<ATanOperator>(item))
+  {
+    return OpCode::ATan;
+  }
+  if(IsOperator<SqrtOperator>(item))
+  {
+    return OpCode::Sqrt;
+  }
+  if(IsOperator<Log10Operator>(item))
+  {
+    return OpCode::Log10;
+  }
+  if(IsOperator<ExpOperator>(item))
+  {
+    return OpCode::Exp;
+  }
+  if(IsOperator<LnOperator>(item))
+  {
+    return OpCode::Ln;
+  }
+  if(IsOperator<FloorOperator>(item))
+  {
+    return OpCode::Floor;
+  }
+  if(IsOperator<CeilOperator>(item))
+  {
+    return OpCode::Ceil;
+  }
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+bool IsBinary(OpCode opCode)
+{
+  switch(opCode)
+  {
+  case OpCode::Add:
+  case OpCode::Subtract:
+  case OpCode::Multiply:
+  case OpCode::Divide:
+  case OpCode::Pow:
+  case OpCode::Root:
+  case OpCode::Log:
+    return true;
+  default:
+    return false;
+  }
+}
+
+/**
+ * @brief Calls visitor with a function object implementing the operator. Binary
+ * functions take (left, right) in the order the operands appear in the expression.
+ * These mirror the lambdas passed to CalculatorOperator::CreateNewArrayTwoArguments
+ * and the UnaryOperator helpers.
+ */
+template <class VisitorT>
+void VisitOperation(OpCode opCode, CalculatorParameter::AngleUnits units, VisitorT&& visitor)
+{
+  const bool degrees = units == CalculatorParameter::AngleUnits::Degrees;
+  switch(opCode)
+  {
+  case OpCode::Load:
+    break;
+  case OpCode::Add:
+    visitor([](float64 lhs, float64 rhs) -> float64 { return lhs + rhs; });
+    break;
+  case OpCode::Subtract:
+    visitor([](float64 lhs, float64 rhs) -> float64 { return lhs - rhs; });
+    break;
+  case OpCode::Multiply:
+    visitor([](float64 lhs, float64 rhs) -> float64 { return lhs * rhs; });
+    break;
+  case OpCode::Divide:
+    visitor([](float64 lhs, float64 rhs) -> float64 { return lhs / rhs; });
+    break;
+  case OpCode::Pow:
+    visitor([](float64 lhs, float64 rhs) -> float64 { return std::pow(lhs, rhs); });
+    break;
+  case OpCode::Root:
+    visitor([](float64 lhs, float64 rhs) -> float64 { return rhs == 0 ? std::numeric_limits<float64>::infinity() : std::pow(lhs, 1 / rhs); });
+    break;
+  case OpCode::Log:
+    visitor([](float64 lhs, float64 rhs) -> float64 { return std::log(rhs) / std::log(lhs); });
+    break;
+  case OpCode::Negate:
+    visitor([](float64 value) -> float64 { return -1 * value; });
+    break;
+  case OpCode::Abs:
+    visitor([](float64 value) -> float64 { return std::fabs(value); });
+    break;
+  case OpCode::Sin:
+    if(degrees)
+    {
+      visitor([](float64 value) -> float64 { return std::sin(value * k_DegreesToRadians); });
+    }
+    else
+    {
+      visitor([](float64 value) -> float64 { return std::sin(value); });
+    }
+    break;
+  case OpCode::Cos:
+    if(degrees)
+    {
+      visitor([](float64 value) -> float64 { return std::cos(value * k_DegreesToRadians); });
+    }
+    else
+    {
+      visitor([](float64 value) -> float64 { return std::cos(value); });
+    }
+    break;
+  case OpCode::Tan:
+    if(degrees)
+    {
+      visitor([](float64 value) -> float64 { return std::tan(value * k_DegreesToRadians); });
+    }
+    else
+    {
+      visitor([](float64 value) -> float64 { return std::tan(value); });
+    }
+    break;
+  case OpCode::ASin:
+    degrees ? visitor([](float64 value) -> float64 { return std::asin(value) * k_RadiansToDegrees; }) : visitor([](float64 value) -> float64 { return std::asin(value); });
+    break;
+  case OpCode::ACos:
+    degrees ? visitor([](float64 value) -> float64 { return std::acos(value) * k_RadiansToDegrees; }) : visitor([](float64 value) -> float64 { return std::acos(value); });
+    break;
+  case OpCode::ATan:
+    degrees ? visitor([](float64 value) -> float64 { return std::atan(value) * k_RadiansToDegrees; }) : visitor([](float64 value) -> float64 { return std::atan(value); });
+    break;
+  case OpCode::Sqrt:
+    visitor([](float64 value) -> float64 { return std::sqrt(value); });
+    break;
+  case OpCode::Log10:
+    visitor([](float64 value) -> float64 { return std::log10(value); });
+    break;
+  case OpCode::Exp:
+    visitor([](float64 value) -> float64 { return std::exp(value); });
+    break;
+  case OpCode::Ln:
+    visitor([](float64 value) -> float64 { return std::log(value); });
+    break;
+  case OpCode::Floor:
+    visitor([](float64 value) -> float64 { return std::floor(value); });
+    break;
+  case OpCode::Ceil:
+    visitor([](float64 value) -> float64 { return std::ceil(value); });
+    break;
+  }
+}
+
+// -----------------------------------------------------------------------------
+float64 FoldConstant(OpCode opCode, CalculatorParameter::AngleUnits units, float64 lhs, float64 rhs)
+{
+  float64 value = 0.0;
+  VisitOperation(opCode, units, [&](auto&& func) {
+    if constexpr(std::is_invocable_v<decltype(func), float64, float64>)
+    {
+      value = func(lhs, rhs);
+    }
+    else
+    {
+      value = func(lhs);
+    }
+  });
+  return value;
+}
+
+/**
+ * @brief Applies func over count values. Each branch is a plain loop over
+ * contiguous memory so that the compiler can vectorize it.
+ */
+template <class FuncT>
+void ApplyBinary(FuncT func, const Operand& lhs, const Operand& rhs, const float64* lhsValues, const float64* rhsValues, usize count, float64* output)
+{
+  if(lhs.isConstant)
+  {
+    const float64 lhsValue = lhs.value;
+    for(usize i = 0; i < count; i++)
+    {
+      output[i] = func(lhsValue, rhsValues[i]);
+    }
+  }
+  else if(rhs.isConstant)
+  {
+    const float64 rhsValue = rhs.value;
+    for(usize i = 0; i < count; i++)
+    {
+      output[i] = func(lhsValues[i], rhsValue);
+    }
+  }
+  else
+  {
+    for(usize i = 0; i < count; i++)
+    {
+      output[i] = func(lhsValues[i], rhsValues[i]);
+    }
+  }
+}
+
+template <class FuncT>
+void ApplyUnary(FuncT func, const float64* values, usize count, float64* output)
+{
+  for(usize i = 0; i < count; i++)
+  {
+    output[i] = func(values[i]);
+  }
+}
+
+struct LoadBlockFunctor
+{
+  template <typename T>
+  void operator()(const IDataArray& inputArray, int32 component, usize tupleStart, usize tupleCount, float64* output)
+  {
+    const auto& store = dynamic_cast<const DataArray<T>&>(inputArray).getDataStoreRef();
+    const usize numComponents = store.getNumberOfComponents();
+    typename AbstractDataStore<T>::ConstChunkView view(store, tupleStart * numComponents, tupleCount * numComponents);
+    if(component < 0)
+    {
+      const usize count = view.size();
+      for(usize i = 0; i < count; i++)
+      {
+        output[i] = static_cast<float64>(view[i]);
+      }
+    }
+    else
+    {
+      for(usize i = 0; i < tupleCount; i++)
+      {
+        output[i] = static_cast<float64>(view[i * numComponents + component]);
+      }
+    }
+  }
+};
+
+struct StoreBlockFunctor
+{
+  template <typename T>
+  Result<> operator()(IDataArray& outputArray, usize startIndex, usize count, const float64* values)
+  {
+    auto& store = dynamic_cast<DataArray<T>&>(outputArray).getDataStoreRef();
+    typename AbstractDataStore<T>::ChunkView view(store, startIndex, count);
+    for(usize i = 0; i < count; i++)
+    {
+      view[i] = static_cast<T>(values[i]);
+    }
+    return view.commit();
+  }
+};
+
+struct FillFunctor
+{
+  template <typename T>
+  void operator()(IDataArray& outputArray, float64 value)
+  {
+    dynamic_cast<DataArray<T>&>(outputArray).getDataStoreRef().fill(static_cast<T>(value));
+  }
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+Result<CalculatorProgram> CalculatorProgram::Compile(const std::vector<CalculatorItem::Pointer>& rpn, CalculatorParameter::AngleUnits units)
+{
+  CalculatorProgram program;
+  program.m_Units = units;
+  bool hasArray = false;
+
+  // Each stack slot is either a constant or the register with the same index as the slot
+  std::vector<Operand> stack;
+  for(const auto& item : rpn)
+  {
+    if(auto arrayItem = std::dynamic_pointer_cast<ICalculatorArray>(item); arrayItem != nullptr)
+    {
+      if(arrayItem->isNumber())
+      {
+        stack.push_back({true, 0, arrayItem->getValue(0)});
+        continue;
+      }
+
+      const IDataArray* sourceArray = arrayItem->getSourceArray();
+      if(sourceArray == nullptr)
+      {
+        return MakeErrorResult<CalculatorProgram>(static_cast<int>(CalculatorItem::ErrorCode::UnexpectedOutput), "An array in the infix expression is not associated with an input array.");
+      }
+      const int32 component = arrayItem->getSourceComponent();
+      const usize numComponents = component < 0 ? sourceArray->getNumberOfComponents() : 1;
+      if(!hasArray)
+      {
+        program.m_NumTuples = sourceArray->getNumberOfTuples();
+        program.m_NumComponents = numComponents;
+        hasArray = true;
+      }
+      else if(program.m_NumTuples != sourceArray->getNumberOfTuples())
+      {
+        return MakeErrorResult<CalculatorProgram>(static_cast<int>(CalculatorItem::ErrorCode::InconsistentTuples), "Attribute Array symbols in the infix expression have mismatching number of tuples");
+      }
+      else if(program.m_NumComponents != numComponents)
+      {
+        return MakeErrorResult<CalculatorProgram>(static_cast<int>(CalculatorItem::ErrorCode::InconsistentCompDims),
+                                                  "Attribute Array symbols in the infix expression have mismatching component dimensions");
+      }
+
+      usize inputIndex = 0;
+      while(inputIndex < program.m_Inputs.size() && (program.m_Inputs[inputIndex].array != sourceArray || program.m_Inputs[inputIndex].component != component))
+      {
+        inputIndex++;
+      }
+      if(inputIndex == program.m_Inputs.size())
+      {
+        program.m_Inputs.push_back({sourceArray, component});
+      }
+
+      Instruction instruction;
+      instruction.opCode = OpCode::Load;
+      instruction.target = stack.size();
+      instruction.inputIndex = inputIndex;
+      program.m_Instructions.push_back(instruction);
+      stack.push_back({false, instruction.target, 0.0});
+      program.m_NumRegisters = std::max(program.m_NumRegisters, stack.size());
+      continue;
+    }
+
+    std::optional<OpCode> opCode = GetOpCode(item);
+    if(!opCode.has_value())
+    {
+      return MakeErrorResult<CalculatorProgram>(static_cast<int>(CalculatorItem::ErrorCode::InvalidSymbol), fmt::format("The operator '{}' cannot be evaluated.", item->getInfixToken()));
+    }
+
+    const usize numOperands = IsBinary(*opCode) ? 2 : 1;
+    if(stack.size() < numOperands)
+    {
+      return MakeErrorResult<CalculatorProgram>(static_cast<int>(CalculatorItem::ErrorCode::InvalidEquation), "The chosen infix equation is not a valid equation.");
+    }
+
+    Instruction instruction;
+    instruction.opCode = *opCode;
+    instruction.target = stack.size() - numOperands;
+    instruction.lhs = stack[instruction.target];
+    instruction.rhs = numOperands == 2 ? stack.back() : Operand{true, 0, 0.0};
+    stack.resize(instruction.target);
+
+    if(instruction.lhs.isConstant && instruction.rhs.isConstant)
+    {
+      stack.push_back({true, 0, FoldConstant(instruction.opCode, units, instruction.lhs.value, instruction.rhs.value)});
+      continue;
+    }
+    program.m_Instructions.push_back(instruction);
+    stack.push_back({false, instruction.target, 0.0});
+  }
+
+  if(stack.size() != 1)
+  {
+    return MakeErrorResult<CalculatorProgram>(static_cast<int>(CalculatorItem::ErrorCode::InvalidEquation), "The chosen infix equation is not a valid equation.");
+  }
+  program.m_Result = stack.front();
+
+  return {std::move(program)};
+}
+
+// -----------------------------------------------------------------------------
+bool CalculatorProgram::isConstant() const
+{
+  return m_Result.isConstant;
+}
+
+// -----------------------------------------------------------------------------
+float64 CalculatorProgram::getConstantValue() const
+{
+  return m_Result.value;
+}
+
+// -----------------------------------------------------------------------------
+usize CalculatorProgram::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+usize CalculatorProgram::getNumberOfComponents() const
+{
+  return m_NumComponents;
+}
+
+// -----------------------------------------------------------------------------
+usize CalculatorProgram::getNumberOfRegisters() const
+{
+  return m_NumRegisters;
+}
+
+// -----------------------------------------------------------------------------
+const std::vector<CalculatorProgram::Instruction>& CalculatorProgram::getInstructions() const
+{
+  return m_Instructions;
+}
+
+// -----------------------------------------------------------------------------
+usize CalculatorProgram::getBlockTuples() const
+{
+  return std::max<usize>(k_BlockSize / std::max<usize>(m_NumComponents, 1), 1);
+}
+
+// -----------------------------------------------------------------------------
+usize CalculatorProgram::getRegisterSize() const
+{
+  return getBlockTuples() * m_NumComponents;
+}
+
+// -----------------------------------------------------------------------------
+Result<> CalculatorProgram::evaluateBlock(IDataArray& outputArray, usize tupleStart, usize tupleCount, std::vector<float64>& registers) const
+{
+  const usize count = tupleCount * m_NumComponents;
+  const usize registerSize = getRegisterSize();
+  for(const auto& instruction : m_Instructions)
+  {
+    float64* target = registers.data() + instruction.target * registerSize;
+    if(instruction.opCode == OpCode::Load)
+    {
+      const Input& input = m_Inputs[instruction.inputIndex];
+      ExecuteDataFunction(LoadBlockFunctor{}, input.array->getDataType(), *input.array, input.component, tupleStart, tupleCount, target);
+      continue;
+    }
+
+    const float64* lhsValues = registers.data() + instruction.lhs.registerIndex * registerSize;
+    const float64* rhsValues = registers.data() + instruction.rhs.registerIndex * registerSize;
+    VisitOperation(instruction.opCode, m_Units, [&](auto&& func) {
+      if constexpr(std::is_invocable_v<decltype(func), float64, float64>)
+      {
+        ApplyBinary(func, instruction.lhs, instruction.rhs, lhsValues, rhsValues, count, target);
+      }
+      else
+      {
+        ApplyUnary(func, lhsValues, count, target);
+      }
+    });
+  }
+
+  return ExecuteDataFunction(StoreBlockFunctor{}, outputArray.getDataType(), outputArray, tupleStart * m_NumComponents, count, registers.data() + m_Result.registerIndex * registerSize);
+}
+
+// -----------------------------------------------------------------------------
+Result<> CalculatorProgram::execute(IDataArray& outputArray, const std::atomic_bool& shouldCancel) const
+{
+  if(m_Result.isConstant)
+  {
+    ExecuteDataFunction(FillFunctor{}, outputArray.getDataType(), outputArray, m_Result.value);
+    return {};
+  }
+
+  if(outputArray.getSize() != m_NumTuples * m_NumComponents)
+  {
+    return MakeErrorResult(static_cast<int>(CalculatorItem::ErrorCode::IncorrectTupleCount),
+                           fmt::format("The output array '{}' holds {} values but the expression produces {} values.", outputArray.getName(), outputArray.getSize(), m_NumTuples * m_NumComponents));
+  }
+
+  const usize blockTuples = getBlockTuples();
+  const usize numBlocks = (m_NumTuples + blockTuples - 1) / blockTuples;
+
+  ParallelDataAlgorithm::AlgorithmArrays algorithmArrays;
+  algorithmArrays.reserve(m_Inputs.size() + 1);
+  for(const auto& input : m_Inputs)
+  {
+    algorithmArrays.push_back(input.array);
+  }
+  algorithmArrays.push_back(&outputArray);
+
+  // A failed write-back is reported for the lowest failing block so the error does not depend on thread scheduling
+  std::mutex resultMutex;
+  usize firstFailedBlock = numBlocks;
+  Result<> writeResult = {};
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.requireArraysInMemory(algorithmArrays);
+  dataAlg.execute([&](const Range& range) {
+    std::vector<float64> registers(m_NumRegisters * getRegisterSize());
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      if(shouldCancel)
+      {
+        return;
+      }
+      const usize tupleStart = block * blockTuples;
+      Result<> blockResult = evaluateBlock(outputArray, tupleStart, std::min(blockTuples, m_NumTuples - tupleStart), registers);
+      if(blockResult.invalid())
+      {
+        std::lock_guard<std::mutex> lock(resultMutex);
+        if(block < firstFailedBlock)
+        {
+          firstFailedBlock = block;
+          writeResult = std::move(blockResult);
+        }
+        return;
+      }
+    }
+  });
+
+  return writeResult;
+}
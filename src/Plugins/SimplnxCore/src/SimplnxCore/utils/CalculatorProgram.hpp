@@ -0,0 +1,179 @@
+#pragma once
+
+#include "SimplnxCore/SimplnxCore_export.hpp"
+#include "SimplnxCore/utils/CalculatorItem.hpp"
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/IDataArray.hpp"
+#include "simplnx/Parameters/CalculatorParameter.hpp"
+
+#include <atomic>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @class CalculatorProgram
+ * @brief Compiles an RPN expression produced by the ArrayCalculatorParser into a flat
+ * list of instructions that is evaluated in one pass over blocks of tuples.
+ *
+ * Every value on the RPN stack is either a constant or a block sized register, so
+ * intermediate results never exceed a few kilobytes per thread no matter how large
+ * the input arrays are. Sub-expressions that only involve numbers are folded while
+ * compiling. The results are converted straight into the type of the output array.
+ * The operators keep the semantics of their CalculatorOperator counterparts,
+ * including component indexing and the selected angle units.
+ */
+class SIMPLNXCORE_EXPORT CalculatorProgram
+{
+public:
+  /**
+   * @brief The target number of values evaluated per block.
+   */
+  static inline constexpr usize k_BlockSize = 4096;
+
+  enum class OpCode : uint8
+  {
+    Load,
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+    Pow,
+    Root,
+    Log,
+    Negate,
+    Abs,
+    Sin,
+    Cos,
+    Tan,
+    ASin,
+    ACos,
+    ATan,
+    Sqrt,
+    Log10,
+    Exp,
+    Ln,
+    Floor,
+    Ceil
+  };
+
+  struct Operand
+  {
+    bool isConstant = false;
+    usize registerIndex = 0;
+    float64 value = 0.0;
+  };
+
+  struct Instruction
+  {
+    OpCode opCode = OpCode::Load;
+    usize target = 0;
+    Operand lhs;
+    Operand rhs;
+    usize inputIndex = 0;
+  };
+
+  struct Input
+  {
+    const IDataArray* array = nullptr;
+    int32 component = -1;
+  };
+
+  /**
+   * @brief Compiles the RPN expression. Array items must have been created by the
+   * ArrayCalculatorParser so that their source arrays are known.
+   * @param rpn
+   * @param units
+   * @return Result<CalculatorProgram>
+   */
+  static Result<CalculatorProgram> Compile(const std::vector<CalculatorItem::Pointer>& rpn, CalculatorParameter::AngleUnits units);
+
+  CalculatorProgram() = default;
+  ~CalculatorProgram() noexcept = default;
+
+  CalculatorProgram(const CalculatorProgram&) = default;
+  CalculatorProgram(CalculatorProgram&&) noexcept = default;
+  CalculatorProgram& operator=(const CalculatorProgram&) = default;
+  CalculatorProgram& operator=(CalculatorProgram&&) noexcept = default;
+
+  /**
+   * @brief Returns true if the expression folded down to a single number.
+   * @return bool
+   */
+  bool isConstant() const;
+
+  /**
+   * @brief Returns the folded value of a constant expression.
+   * @return float64
+   */
+  float64 getConstantValue() const;
+
+  /**
+   * @brief Returns the number of tuples of the arrays in the expression.
+   * @return usize
+   */
+  usize getNumberOfTuples() const;
+
+  /**
+   * @brief Returns the number of components of the arrays in the expression.
+   * @return usize
+   */
+  usize getNumberOfComponents() const;
+
+  /**
+   * @brief Returns the number of block sized registers needed to evaluate the program.
+   * @return usize
+   */
+  usize getNumberOfRegisters() const;
+
+  /**
+   * @brief Returns the compiled instructions.
+   * @return const std::vector<Instruction>&
+   */
+  const std::vector<Instruction>& getInstructions() const;
+
+  /**
+   * @brief Evaluates the expression into the output array. Constant expressions fill
+   * the whole output array. Blocks are evaluated in parallel when every array is
+   * held in memory.
+   * @param outputArray
+   * @param shouldCancel
+   * @return Result<>
+   */
+  Result<> execute(IDataArray& outputArray, const std::atomic_bool& shouldCancel) const;
+
+  /**
+   * @brief Evaluates the tuples [tupleStart, tupleStart + tupleCount) into the output array.
+   * tupleCount may not exceed getBlockTuples().
+   * @param outputArray
+   * @param tupleStart
+   * @param tupleCount
+   * @param registers Scratch memory of getNumberOfRegisters() * getRegisterSize() values
+   * @return Result<>
+   */
+  Result<> evaluateBlock(IDataArray& outputArray, usize tupleStart, usize tupleCount, std::vector<float64>& registers) const;
+
+  /**
+   * @brief Returns the number of tuples evaluated per block.
+   * @return usize
+   */
+  usize getBlockTuples() const;
+
+  /**
+   * @brief Returns the number of values held by one register.
+   * @return usize
+   */
+  usize getRegisterSize() const;
+
+private:
+  std::vector<Instruction> m_Instructions;
+  std::vector<Input> m_Inputs;
+  Operand m_Result;
+  CalculatorParameter::AngleUnits m_Units = CalculatorParameter::AngleUnits::Radians;
+  usize m_NumRegisters = 0;
+  usize m_NumTuples = 0;
+  usize m_NumComponents = 1;
+};
+} // namespace nx::core
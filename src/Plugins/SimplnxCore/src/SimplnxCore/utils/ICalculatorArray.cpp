@@ -17,3 +17,22 @@ ICalculatorArray::Pointer ICalculatorArray::NullPointer()
 {
   return Pointer(static_cast<Self*>(nullptr));
 }
+
+// -----------------------------------------------------------------------------
+const IDataArray* ICalculatorArray::getSourceArray() const
+{
+  return m_SourceArray;
+}
+
+// -----------------------------------------------------------------------------
+int ICalculatorArray::getSourceComponent() const
+{
+  return m_SourceComponent;
+}
+
+// -----------------------------------------------------------------------------
+void ICalculatorArray::setSourceArray(const IDataArray* sourceArray, int component)
+{
+  m_SourceArray = sourceArray;
+  m_SourceComponent = component;
+}
@@ -35,6 +35,27 @@ public:
 
   virtual Float64Array* reduceToOneComponent(int c, bool allocate = true) = 0;
 
+  /**
+   * @brief Returns the DataArray this item was parsed from. Numbers and the results
+   * of operators do not have a source array and return nullptr.
+   * @return const IDataArray*
+   */
+  const IDataArray* getSourceArray() const;
+
+  /**
+   * @brief Returns the component of the source array selected with the index
+   * operator or -1 if every component of the source array is used.
+   * @return int
+   */
+  int getSourceComponent() const;
+
+  /**
+   * @brief Sets the DataArray (and optionally the single component) this item was parsed from.
+   * @param sourceArray
+   * @param component
+   */
+  void setSourceArray(const IDataArray* sourceArray, int component = -1);
+
 protected:
   ICalculatorArray();
 
@@ -45,5 +66,7 @@ public:
   ICalculatorArray& operator=(ICalculatorArray&&) = delete;      // Move Assignment Not Implemented
 
 private:
+  const IDataArray* m_SourceArray = nullptr;
+  int m_SourceComponent = -1;
 };
 } // namespace nx::core
@@ -816,3 +816,31 @@ TEST_CASE("SimplnxCore::ArrayCalculatorFilter: Filter Execution")
   SingleComponentArrayCalculatorTest2();
   MultiComponentArrayCalculatorTest();
 }
+
+TEST_CASE("SimplnxCore::ArrayCalculatorFilter: Fused Evaluation")
+{
+  ArrayCalculatorFilter filter;
+  DataStructure dataStructure = createDataStructure();
+
+  // Component indexing, angle units and the output type are all applied in a single pass
+  Arguments args;
+  args.insertOrAssign(ArrayCalculatorFilter::k_CalculatorParameter_Key,
+                      std::make_any<CalculatorParameter::ValueType>(
+                          CalculatorParameter::ValueType{k_AttributeMatrixPath, "MultiComponent Array1[2] * cos(60) + InputArray1 - 2^3", CalculatorParameter::AngleUnits::Degrees}));
+  args.insertOrAssign(ArrayCalculatorFilter::k_ScalarType_Key, std::make_any<NumericTypeParameter::ValueType>(NumericType::int32));
+  args.insertOrAssign(ArrayCalculatorFilter::k_CalculatedArray_Key, std::make_any<DataPath>(k_AttributeArrayPath));
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+
+  const auto& mcArray1 = dataStructure.getDataRefAs<UInt32Array>(k_MultiComponentArray1Path);
+  const auto& inputArray1 = dataStructure.getDataRefAs<Float32Array>(k_InputArray1Path);
+  const auto& calculatedArray = dataStructure.getDataRefAs<Int32Array>(k_AttributeArrayPath);
+  REQUIRE(calculatedArray.getNumberOfTuples() == mcArray1.getNumberOfTuples());
+  REQUIRE(calculatedArray.getNumberOfComponents() == 1);
+  for(usize i = 0; i < calculatedArray.getNumberOfTuples(); i++)
+  {
+    const float64 expected = static_cast<float64>(mcArray1[i * 3 + 2]) * std::cos(60.0 * numbers::pi / 180.0) + static_cast<float64>(inputArray1[i]) - 8.0;
+    REQUIRE(calculatedArray[i] == static_cast<int32>(expected));
+  }
+}
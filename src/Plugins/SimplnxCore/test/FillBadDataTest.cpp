@@ -59,3 +59,163 @@ TEST_CASE("SimplnxCore::FillBadData", "[Core][FillBadData]")
   WriteTestDataStructure(dataStructure, fs::path(fmt::format("{}/7_0_fill_bad_data.dream3d", unit_test::k_BinaryTestOutputDir)));
 #endif
 }
+
+TEST_CASE("SimplnxCore::FillBadData: Synthetic Volume", "[Core][FillBadData]")
+{
+  const std::vector<usize> dims = {4, 3, 2};
+  const std::vector<usize> tupleShape = {dims[2], dims[1], dims[0]};
+  const DataPath geomPath({"Image Geometry"});
+  const DataPath cellDataPath = geomPath.createChildPath("Cell Data");
+  const DataPath featureIdsPath = cellDataPath.createChildPath("FeatureIds");
+  const DataPath phasesPath = cellDataPath.createChildPath("Phases");
+  const DataPath valuesPath = cellDataPath.createChildPath("Values");
+
+  DataStructure dataStructure;
+  auto* imageGeom = ImageGeom::Create(dataStructure, geomPath.getTargetName());
+  imageGeom->setDimensions(dims);
+  auto* cellData = AttributeMatrix::Create(dataStructure, cellDataPath.getTargetName(), tupleShape, imageGeom->getId());
+  imageGeom->setCellData(*cellData);
+  auto& featureIds = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, featureIdsPath.getTargetName(), tupleShape, {1}, cellData->getId())->getDataStoreRef();
+  auto& phases = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, phasesPath.getTargetName(), tupleShape, {1}, cellData->getId())->getDataStoreRef();
+  auto& values = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, valuesPath.getTargetName(), tupleShape, {1}, cellData->getId())->getDataStoreRef();
+
+  const usize numVoxels = featureIds.getNumberOfTuples();
+  for(usize i = 0; i < numVoxels; i++)
+  {
+    // Feature 1 (phase 1) fills x < 2 and feature 2 (phase 2) fills the rest
+    featureIds[i] = (i % dims[0]) < 2 ? 1 : 2;
+    phases[i] = featureIds[i];
+    values[i] = static_cast<float32>(i) * 10.0f;
+  }
+
+  Arguments args;
+  args.insertOrAssign(FillBadDataFilter::k_MinAllowedDefectSize_Key, std::make_any<int32>(4));
+  args.insertOrAssign(FillBadDataFilter::k_StoreAsNewPhase_Key, std::make_any<bool>(true));
+  args.insertOrAssign(FillBadDataFilter::k_CellFeatureIdsArrayPath_Key, std::make_any<DataPath>(featureIdsPath));
+  args.insertOrAssign(FillBadDataFilter::k_CellPhasesArrayPath_Key, std::make_any<DataPath>(phasesPath));
+  args.insertOrAssign(FillBadDataFilter::k_IgnoredDataArrayPaths_Key, std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{}));
+  args.insertOrAssign(FillBadDataFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(geomPath));
+
+  FillBadDataFilter filter;
+
+  SECTION("Fill Small Regions")
+  {
+    // A two voxel defect at z = 0 that is filled, and a row of four voxels at z = 1 that is kept
+    featureIds[5] = 0;
+    featureIds[6] = 0;
+    for(usize i = 20; i < 24; i++)
+    {
+      featureIds[i] = 0;
+    }
+
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+    // Each voxel takes the feature held by most of its face neighbors and copies its values from the neighbor at which
+    // that feature reached its count, visiting the neighbors in -z, -y, -x, +x, +y, +z order
+    REQUIRE(featureIds[5] == 1);
+    REQUIRE(featureIds[6] == 2);
+    REQUIRE(phases[5] == 1);
+    REQUIRE(phases[6] == 2);
+    REQUIRE(values[5] == Approx(170.0f));
+    REQUIRE(values[6] == Approx(180.0f));
+    for(usize i = 20; i < 24; i++)
+    {
+      REQUIRE(featureIds[i] == 0);
+      REQUIRE(phases[i] == 3);
+      REQUIRE(values[i] == Approx(static_cast<float32>(i) * 10.0f));
+    }
+  }
+
+  SECTION("No Good Voxels")
+  {
+    // Nothing can be filled from, so the small region is left marked as bad
+    featureIds.fill(0);
+    args.insertOrAssign(FillBadDataFilter::k_MinAllowedDefectSize_Key, std::make_any<int32>(100));
+
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+    for(usize i = 0; i < numVoxels; i++)
+    {
+      REQUIRE(featureIds[i] == -1);
+      REQUIRE(phases[i] == ((i % dims[0]) < 2 ? 1 : 2));
+    }
+  }
+}
+
+TEST_CASE("SimplnxCore::FillBadData: Region Across Z Slabs", "[Core][FillBadData]")
+{
+  // The voxels are split into z slabs internally, so a defect running through every z plane has to be sized and
+  // filled as one region
+  const std::vector<usize> dims = {3, 1, 16};
+  const std::vector<usize> tupleShape = {dims[2], dims[1], dims[0]};
+  const DataPath geomPath({"Image Geometry"});
+  const DataPath cellDataPath = geomPath.createChildPath("Cell Data");
+  const DataPath featureIdsPath = cellDataPath.createChildPath("FeatureIds");
+  const DataPath phasesPath = cellDataPath.createChildPath("Phases");
+  const DataPath valuesPath = cellDataPath.createChildPath("Values");
+
+  DataStructure dataStructure;
+  auto* imageGeom = ImageGeom::Create(dataStructure, geomPath.getTargetName());
+  imageGeom->setDimensions(dims);
+  auto* cellData = AttributeMatrix::Create(dataStructure, cellDataPath.getTargetName(), tupleShape, imageGeom->getId());
+  imageGeom->setCellData(*cellData);
+  auto& featureIds = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, featureIdsPath.getTargetName(), tupleShape, {1}, cellData->getId())->getDataStoreRef();
+  auto& phases = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, phasesPath.getTargetName(), tupleShape, {1}, cellData->getId())->getDataStoreRef();
+  auto& values = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, valuesPath.getTargetName(), tupleShape, {1}, cellData->getId())->getDataStoreRef();
+
+  const usize numVoxels = featureIds.getNumberOfTuples();
+  for(usize i = 0; i < numVoxels; i++)
+  {
+    // Feature 2 fills x = 0, feature 1 fills x = 2 and the column at x = 1 is bad in every z plane
+    const usize column = i % dims[0];
+    featureIds[i] = column == 0 ? 2 : (column == 2 ? 1 : 0);
+    phases[i] = featureIds[i];
+    values[i] = static_cast<float32>(i) * 10.0f;
+  }
+
+  Arguments args;
+  args.insertOrAssign(FillBadDataFilter::k_StoreAsNewPhase_Key, std::make_any<bool>(true));
+  args.insertOrAssign(FillBadDataFilter::k_CellFeatureIdsArrayPath_Key, std::make_any<DataPath>(featureIdsPath));
+  args.insertOrAssign(FillBadDataFilter::k_CellPhasesArrayPath_Key, std::make_any<DataPath>(phasesPath));
+  args.insertOrAssign(FillBadDataFilter::k_IgnoredDataArrayPaths_Key, std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{}));
+  args.insertOrAssign(FillBadDataFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(geomPath));
+
+  FillBadDataFilter filter;
+
+  SECTION("Tied Vote")
+  {
+    // The 16 voxel region is sized as 17 (the count of the original flood fill), so it is filled
+    args.insertOrAssign(FillBadDataFilter::k_MinAllowedDefectSize_Key, std::make_any<int32>(18));
+
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+    // Every bad voxel has one neighbor in each feature. The tie goes to the feature that reached the count first, and
+    // feature 2 at -x is visited before feature 1 at +x.
+    for(usize z = 0; z < dims[2]; z++)
+    {
+      const usize index = z * dims[0] + 1;
+      REQUIRE(featureIds[index] == 2);
+      REQUIRE(phases[index] == 2);
+      REQUIRE(values[index] == Approx(static_cast<float32>(index - 1) * 10.0f));
+    }
+  }
+
+  SECTION("Region Kept")
+  {
+    args.insertOrAssign(FillBadDataFilter::k_MinAllowedDefectSize_Key, std::make_any<int32>(17));
+
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+    for(usize z = 0; z < dims[2]; z++)
+    {
+      const usize index = z * dims[0] + 1;
+      REQUIRE(featureIds[index] == 0);
+      REQUIRE(phases[index] == 3);
+      REQUIRE(values[index] == Approx(static_cast<float32>(index) * 10.0f));
+    }
+  }
+}
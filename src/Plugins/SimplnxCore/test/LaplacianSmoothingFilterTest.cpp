@@ -2,6 +2,7 @@
 #include "SimplnxCore/Filters/ReadStlFileFilter.hpp"
 #include "SimplnxCore/SimplnxCore_test_dirs.hpp"
 
+#include "simplnx/Common/Numbers.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
 #include "simplnx/Parameters/ArrayCreationParameter.hpp"
 #include "simplnx/Parameters/FileSystemPathParameter.hpp"
@@ -11,6 +12,7 @@
 
 #include <catch2/catch.hpp>
 
+#include <cmath>
 #include <filesystem>
 #include <string>
 
@@ -117,3 +119,76 @@ TEST_CASE("SimplnxCore::LaplacianSmoothingFilter", "[SurfaceMeshing][LaplacianSm
   SIMPLNX_RESULT_REQUIRE_VALID(resultH5);
 #endif
 }
+
+TEST_CASE("SimplnxCore::LaplacianSmoothingFilter: Convergence", "[SurfaceMeshing][LaplacianSmoothingFilter]")
+{
+  // A fan of 6 triangles around a raised center vertex. The rim vertices are pinned, so every
+  // iteration halves the height of the center vertex when lambda is 0.5.
+  constexpr usize k_NumRimVertices = 6;
+  const DataPath triangleGeometryPath({"Fan"});
+  const DataPath nodeTypeArrayPath = triangleGeometryPath.createChildPath("Node Type");
+
+  auto createFan = [&](DataStructure& dataStructure) {
+    auto* triangleGeom = TriangleGeom::Create(dataStructure, triangleGeometryPath.getTargetName());
+    auto* vertices = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, "Vertices", {k_NumRimVertices + 1}, {3}, triangleGeom->getId());
+    auto* faces = UInt64Array::CreateWithStore<UInt64DataStore>(dataStructure, "Faces", {k_NumRimVertices}, {3}, triangleGeom->getId());
+    auto* nodeTypes = Int8Array::CreateWithStore<Int8DataStore>(dataStructure, nodeTypeArrayPath.getTargetName(), {k_NumRimVertices + 1}, {1}, triangleGeom->getId());
+
+    (*vertices)[2] = 1.0f;
+    (*nodeTypes)[0] = NodeType::Default;
+    for(usize i = 0; i < k_NumRimVertices; i++)
+    {
+      const float32 angle = static_cast<float32>(i) * numbers::pi_v<float32> / 3.0f;
+      (*vertices)[3 * (i + 1)] = std::cos(angle);
+      (*vertices)[3 * (i + 1) + 1] = std::sin(angle);
+      (*faces)[3 * i] = 0;
+      (*faces)[3 * i + 1] = i + 1;
+      (*faces)[3 * i + 2] = (i + 1) % k_NumRimVertices + 1;
+      (*nodeTypes)[i + 1] = NodeType::SurfaceDefault;
+    }
+    triangleGeom->setVertices(*vertices);
+    triangleGeom->setFaceList(*faces);
+  };
+
+  auto runFilter = [&](DataStructure& dataStructure, float32 tolerance, bool useSinglePrecision) -> const Float32AbstractDataStore& {
+    LaplacianSmoothingFilter filter;
+    Arguments args;
+    args.insertOrAssign(LaplacianSmoothingFilter::k_IterationSteps_Key, std::make_any<int32>(20));
+    args.insertOrAssign(LaplacianSmoothingFilter::k_Lambda_Key, std::make_any<float32>(0.5F));
+    args.insertOrAssign(LaplacianSmoothingFilter::k_UseTaubinSmoothing_Key, std::make_any<bool>(false));
+    args.insertOrAssign(LaplacianSmoothingFilter::k_SurfacePointLambda_Key, std::make_any<float32>(0.0F));
+    args.insertOrAssign(LaplacianSmoothingFilter::k_ConvergenceTolerance_Key, std::make_any<float32>(tolerance));
+    args.insertOrAssign(LaplacianSmoothingFilter::k_UseSinglePrecision_Key, std::make_any<bool>(useSinglePrecision));
+    args.insertOrAssign(LaplacianSmoothingFilter::k_SurfaceMeshNodeTypeArrayPath_Key, std::make_any<DataPath>(nodeTypeArrayPath));
+    args.insertOrAssign(LaplacianSmoothingFilter::k_TriangleGeometryDataPath_Key, std::make_any<DataPath>(triangleGeometryPath));
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+
+    return dataStructure.getDataRefAs<TriangleGeom>(triangleGeometryPath).getVertices()->getDataStoreRef();
+  };
+
+  bool useSinglePrecision = GENERATE(false, true);
+
+  {
+    DataStructure dataStructure;
+    createFan(dataStructure);
+    const auto& vertices = runFilter(dataStructure, 0.0f, useSinglePrecision);
+    REQUIRE(vertices[2] == Approx(std::pow(0.5f, 20.0f)).margin(1.0e-6));
+    for(usize i = 1; i <= k_NumRimVertices; i++)
+    {
+      REQUIRE(vertices[3 * i + 2] == 0.0f);
+    }
+  }
+
+  {
+    // The center moves 0.5, 0.25, 0.125 and then 0.0625 which is below the tolerance
+    DataStructure dataStructure;
+    createFan(dataStructure);
+    const auto& vertices = runFilter(dataStructure, 0.1f, useSinglePrecision);
+    REQUIRE(vertices[2] == Approx(0.0625f).margin(1.0e-6));
+  }
+}
@@ -166,6 +166,59 @@ TEST_CASE("SimplnxCore::MultiThresholdObjects: Valid Execution", "[SimplnxCore][
   }
 }
 
+TEST_CASE("SimplnxCore::MultiThresholdObjects: Valid Execution - Nested Sets", "[SimplnxCore][MultiThresholdObjects]")
+{
+  DataStructure dataStructure = CreateTestDataStructure();
+
+  // (Int > 15) OR ((Int < 5) AND NOT (Int == 2))
+  auto greaterThreshold = std::make_shared<ArrayThreshold>();
+  greaterThreshold->setArrayPath(k_TestArrayIntPath);
+  greaterThreshold->setComparisonType(ArrayThreshold::ComparisonType::GreaterThan);
+  greaterThreshold->setComparisonValue(15);
+
+  auto lessThreshold = std::make_shared<ArrayThreshold>();
+  lessThreshold->setArrayPath(k_TestArrayIntPath);
+  lessThreshold->setComparisonType(ArrayThreshold::ComparisonType::LessThan);
+  lessThreshold->setComparisonValue(5);
+
+  auto equalThreshold = std::make_shared<ArrayThreshold>();
+  equalThreshold->setArrayPath(k_TestArrayIntPath);
+  equalThreshold->setComparisonType(ArrayThreshold::ComparisonType::Operator_Equal);
+  equalThreshold->setComparisonValue(2);
+  equalThreshold->setUnionOperator(IArrayThreshold::UnionOperator::And);
+  equalThreshold->setInverted(true);
+
+  auto nestedSet = std::make_shared<ArrayThresholdSet>();
+  nestedSet->setArrayThresholds({lessThreshold, equalThreshold});
+  nestedSet->setUnionOperator(IArrayThreshold::UnionOperator::Or);
+
+  const bool invertSet = GENERATE(false, true);
+  ArrayThresholdSet thresholdSet;
+  thresholdSet.setArrayThresholds({greaterThreshold, nestedSet});
+  thresholdSet.setInverted(invertSet);
+
+  MultiThresholdObjectsFilter filter;
+  Arguments args;
+  args.insertOrAssign(MultiThresholdObjectsFilter::k_ArrayThresholdsObject_Key, std::make_any<ArrayThresholdSet>(thresholdSet));
+  args.insertOrAssign(MultiThresholdObjectsFilter::k_CreatedDataName_Key, std::make_any<std::string>(k_ThresholdArrayName));
+  args.insertOrAssign(MultiThresholdObjectsFilter::k_CreatedMaskType_Key, std::make_any<DataType>(DataType::uint8));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  auto* thresholdArray = dataStructure.getDataAs<UInt8Array>(k_ThresholdArrayPath);
+  REQUIRE(thresholdArray != nullptr);
+
+  for(usize i = 0; i < 20; i++)
+  {
+    const bool expected = (i > 15) || (i < 5 && i != 2);
+    REQUIRE((*thresholdArray)[i] == static_cast<uint8>(expected != invertSet));
+  }
+}
+
 TEMPLATE_TEST_CASE("SimplnxCore::MultiThresholdObjects: Valid Execution - Custom Values", "[SimplnxCore][MultiThresholdObjects]", int8, uint8, int16, uint16, int32, uint32, int64, uint64, float32,
                    float64)
 {
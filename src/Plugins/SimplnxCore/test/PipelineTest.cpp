@@ -1,6 +1,10 @@
 #include "SimplnxCore/SimplnxCore_test_dirs.hpp"
 
 #include "simplnx/Core/Application.hpp"
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/DataStructure/NeighborList.hpp"
+#include "simplnx/DataStructure/StringArray.hpp"
 #include "simplnx/Filter/Actions/CreateArrayAction.hpp"
 #include "simplnx/Filter/Actions/DeleteDataAction.hpp"
 #include "simplnx/Filter/Arguments.hpp"
@@ -17,6 +21,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <limits>
 #include <typeinfo>
 
 namespace fs = std::filesystem;
@@ -110,6 +115,222 @@ protected:
     return {};
   }
 };
+const DataPath k_SnapshotValuesPath({"Values"});
+const DataPath k_SnapshotListsPath({"Lists"});
+const DataPath k_SnapshotStringsPath({"Strings"});
+constexpr usize k_SnapshotNumValues = 8;
+
+/**
+ * @brief Creates a DataArray, a NeighborList and a StringArray that hold the
+ * execution count 0.
+ */
+class SnapshotCreateTestFilter : public IFilter
+{
+public:
+  SnapshotCreateTestFilter() = default;
+
+  ~SnapshotCreateTestFilter() noexcept override = default;
+
+  SnapshotCreateTestFilter(const SnapshotCreateTestFilter&) = delete;
+  SnapshotCreateTestFilter(SnapshotCreateTestFilter&&) noexcept = delete;
+
+  SnapshotCreateTestFilter& operator=(const SnapshotCreateTestFilter&) = delete;
+  SnapshotCreateTestFilter& operator=(SnapshotCreateTestFilter&&) noexcept = delete;
+
+  std::string name() const override
+  {
+    return "SnapshotCreateTestFilter";
+  }
+
+  std::string className() const override
+  {
+    return "SnapshotCreateTestFilter";
+  }
+
+  Uuid uuid() const override
+  {
+    static constexpr Uuid uuid = *Uuid::FromString("79f1960b-67e1-45ca-be6c-f5f84df033fe");
+    return uuid;
+  }
+
+  std::string humanName() const override
+  {
+    return "Snapshot Create Test Filter";
+  }
+
+  Parameters parameters() const override
+  {
+    return {};
+  }
+
+  VersionType parametersVersion() const override
+  {
+    return 1;
+  }
+
+  UniquePointer clone() const override
+  {
+    return std::make_unique<SnapshotCreateTestFilter>();
+  }
+
+protected:
+  PreflightResult preflightImpl(const DataStructure& dataStructure, const Arguments& args, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const override
+  {
+    OutputActions outputActions;
+    outputActions.appendAction(std::make_unique<CreateArrayAction>(DataType::int32, std::vector<usize>{k_SnapshotNumValues}, std::vector<usize>{1}, k_SnapshotValuesPath));
+    return {std::move(outputActions)};
+  }
+
+  Result<> executeImpl(DataStructure& dataStructure, const Arguments& args, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
+                       const std::atomic_bool& shouldCancel) const override
+  {
+    auto& values = dataStructure.getDataRefAs<Int32Array>(k_SnapshotValuesPath);
+    for(usize i = 0; i < k_SnapshotNumValues; i++)
+    {
+      values[i] = static_cast<int32>(i);
+    }
+    auto* lists = NeighborList<int32>::Create(dataStructure, k_SnapshotListsPath.getTargetName(), 1);
+    lists->addEntry(0, 0);
+    StringArray::CreateWithValues(dataStructure, k_SnapshotStringsPath.getTargetName(), {"0"});
+    return {};
+  }
+};
+
+/**
+ * @brief Increments the execution count held by the data of
+ * SnapshotCreateTestFilter. The data is found by fixed paths instead of
+ * arguments and written through references.
+ */
+class SnapshotIncrementTestFilter : public IFilter
+{
+public:
+  SnapshotIncrementTestFilter() = default;
+
+  ~SnapshotIncrementTestFilter() noexcept override = default;
+
+  SnapshotIncrementTestFilter(const SnapshotIncrementTestFilter&) = delete;
+  SnapshotIncrementTestFilter(SnapshotIncrementTestFilter&&) noexcept = delete;
+
+  SnapshotIncrementTestFilter& operator=(const SnapshotIncrementTestFilter&) = delete;
+  SnapshotIncrementTestFilter& operator=(SnapshotIncrementTestFilter&&) noexcept = delete;
+
+  std::string name() const override
+  {
+    return "SnapshotIncrementTestFilter";
+  }
+
+  std::string className() const override
+  {
+    return "SnapshotIncrementTestFilter";
+  }
+
+  Uuid uuid() const override
+  {
+    static constexpr Uuid uuid = *Uuid::FromString("12817adf-490c-4fde-bd92-82fcf8b116db");
+    return uuid;
+  }
+
+  std::string humanName() const override
+  {
+    return "Snapshot Increment Test Filter";
+  }
+
+  Parameters parameters() const override
+  {
+    return {};
+  }
+
+  VersionType parametersVersion() const override
+  {
+    return 1;
+  }
+
+  UniquePointer clone() const override
+  {
+    return std::make_unique<SnapshotIncrementTestFilter>();
+  }
+
+protected:
+  PreflightResult preflightImpl(const DataStructure& dataStructure, const Arguments& args, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const override
+  {
+    return {OutputActions{}};
+  }
+
+  Result<> executeImpl(DataStructure& dataStructure, const Arguments& args, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
+                       const std::atomic_bool& shouldCancel) const override
+  {
+    auto& valuesStore = dataStructure.getDataRefAs<Int32Array>(k_SnapshotValuesPath).getDataStoreRef();
+    for(usize i = 0; i < k_SnapshotNumValues; i++)
+    {
+      valuesStore[i] += 1;
+    }
+    auto& lists = dataStructure.getDataRefAs<NeighborList<int32>>(k_SnapshotListsPath);
+    lists.addEntry(0, lists.getListSize(0));
+    auto& strings = dataStructure.getDataRefAs<StringArray>(k_SnapshotStringsPath);
+    strings[0] = std::to_string(std::stoi(strings[0]) + 1);
+    return {};
+  }
+};
+
+/**
+ * @brief Checks that the data of SnapshotCreateTestFilter holds the execution count.
+ */
+void RequireSnapshotCount(const DataStructure& dataStructure, int32 count)
+{
+  const auto& values = dataStructure.getDataRefAs<Int32Array>(k_SnapshotValuesPath);
+  for(usize i = 0; i < k_SnapshotNumValues; i++)
+  {
+    REQUIRE(values[i] == static_cast<int32>(i) + count);
+  }
+  const auto& lists = dataStructure.getDataRefAs<NeighborList<int32>>(k_SnapshotListsPath);
+  const auto list = lists.copyOfList(0);
+  REQUIRE(list.size() == static_cast<usize>(count) + 1);
+  for(usize i = 0; i < list.size(); i++)
+  {
+    REQUIRE(list[i] == static_cast<int32>(i));
+  }
+  const auto& strings = dataStructure.getDataRefAs<StringArray>(k_SnapshotStringsPath);
+  REQUIRE(strings.at(0) == std::to_string(count));
+}
+
+/**
+ * @brief Creates a pipeline of SnapshotCreateTestFilter followed by numIncrements SnapshotIncrementTestFilters.
+ */
+void CreateSnapshotTestPipeline(Pipeline& pipeline, usize numIncrements)
+{
+  REQUIRE(pipeline.push_back(std::make_unique<SnapshotCreateTestFilter>()));
+  for(usize i = 0; i < numIncrements; i++)
+  {
+    REQUIRE(pipeline.push_back(std::make_unique<SnapshotIncrementTestFilter>()));
+  }
+}
+
+/**
+ * @brief Restores the snapshot memory limit when the test ends.
+ */
+class SnapshotMemoryLimitSentinel
+{
+public:
+  explicit SnapshotMemoryLimitSentinel(uint64 memoryLimit)
+  : m_PreviousLimit(Application::GetOrCreateInstance()->getPreferences()->snapshotMemoryLimit())
+  {
+    Application::GetOrCreateInstance()->getPreferences()->setSnapshotMemoryLimit(memoryLimit);
+  }
+
+  ~SnapshotMemoryLimitSentinel()
+  {
+    Application::GetOrCreateInstance()->getPreferences()->setSnapshotMemoryLimit(m_PreviousLimit);
+  }
+
+  SnapshotMemoryLimitSentinel(const SnapshotMemoryLimitSentinel&) = delete;
+  SnapshotMemoryLimitSentinel(SnapshotMemoryLimitSentinel&&) noexcept = delete;
+
+  SnapshotMemoryLimitSentinel& operator=(const SnapshotMemoryLimitSentinel&) = delete;
+  SnapshotMemoryLimitSentinel& operator=(SnapshotMemoryLimitSentinel&&) noexcept = delete;
+
+private:
+  uint64 m_PreviousLimit;
+};
 } // namespace
 
 TEST_CASE("PipelineTest:Execute Pipeline")
@@ -385,3 +606,79 @@ TEST_CASE("PipelineTest:PipelineDeferredActionTest")
   DataObject* executeObject = dataStructure.getData(k_DeferredActionPath);
   REQUIRE(executeObject == nullptr);
 }
+
+TEST_CASE("PipelineTest:Snapshot Execute From")
+{
+  const SnapshotMemoryLimitSentinel limitSentinel(std::numeric_limits<uint64>::max());
+
+  Pipeline pipeline;
+  CreateSnapshotTestPipeline(pipeline, 3);
+  pipeline.setSnapshotsEnabled(true);
+
+  REQUIRE(pipeline.execute());
+  RequireSnapshotCount(pipeline.getDataStructure(), 3);
+  // Later filters wrote through references to data they did not select, which must not reach the earlier snapshots
+  for(usize i = 0; i < pipeline.size(); i++)
+  {
+    REQUIRE(pipeline.at(i)->isExecuted());
+    RequireSnapshotCount(pipeline.at(i)->getDataStructure(), static_cast<int32>(i));
+  }
+
+  REQUIRE(pipeline.canExecuteFrom(2));
+  REQUIRE(pipeline.executeFrom(2));
+  RequireSnapshotCount(pipeline.getDataStructure(), 3);
+  for(usize i = 0; i < pipeline.size(); i++)
+  {
+    RequireSnapshotCount(pipeline.at(i)->getDataStructure(), static_cast<int32>(i));
+  }
+}
+
+TEST_CASE("PipelineTest:Snapshot Memory Limit")
+{
+  // Allow the bytes of a single copy of the values
+  uint64 valuesMemory = 0;
+  {
+    DataStructure dataStructure;
+    valuesMemory = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "Values", {k_SnapshotNumValues}, {1})->memoryUsage();
+  }
+  const SnapshotMemoryLimitSentinel limitSentinel(valuesMemory);
+
+  Pipeline pipeline;
+  CreateSnapshotTestPipeline(pipeline, 3);
+  pipeline.setSnapshotsEnabled(true);
+
+  REQUIRE(pipeline.execute());
+  RequireSnapshotCount(pipeline.getDataStructure(), 3);
+  REQUIRE(pipeline.snapshotMemoryUsage() <= valuesMemory);
+
+  // The oldest snapshots are cleared first and the remaining ones keep their values
+  REQUIRE(!pipeline.at(0)->isExecuted());
+  REQUIRE(!pipeline.at(1)->isExecuted());
+  REQUIRE(pipeline.at(2)->isExecuted());
+  REQUIRE(pipeline.at(3)->isExecuted());
+  RequireSnapshotCount(pipeline.at(2)->getDataStructure(), 2);
+  RequireSnapshotCount(pipeline.at(3)->getDataStructure(), 3);
+
+  REQUIRE(!pipeline.canExecuteFrom(2));
+  REQUIRE(pipeline.canExecuteFrom(3));
+  REQUIRE(pipeline.executeFrom(3));
+  RequireSnapshotCount(pipeline.getDataStructure(), 3);
+  RequireSnapshotCount(pipeline.at(3)->getDataStructure(), 3);
+  REQUIRE(pipeline.snapshotMemoryUsage() <= valuesMemory);
+}
+
+TEST_CASE("PipelineTest:Execute From Without Snapshots")
+{
+  Pipeline pipeline;
+  CreateSnapshotTestPipeline(pipeline, 2);
+
+  REQUIRE(pipeline.execute());
+  RequireSnapshotCount(pipeline.getDataStructure(), 2);
+
+  // The stored DataStructures were modified by later filters, so execution can only start from the beginning
+  REQUIRE(!pipeline.canExecuteFrom(1));
+  REQUIRE(!pipeline.executeFrom(1));
+  REQUIRE(pipeline.canExecuteFrom(0));
+  REQUIRE(pipeline.executeFrom(0));
+  RequireSnapshotCount(pipeline.getDataStructure(), 2);
+}
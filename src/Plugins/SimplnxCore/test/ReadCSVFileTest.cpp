@@ -566,3 +566,138 @@ TEST_CASE("SimplnxCore::ReadCSVFileFilter (Case 6): Invalid filter execution - B
 
   // Blank lines at the end of the file are not counted in the line count
 }
+
+namespace
+{
+// -----------------------------------------------------------------------------
+fs::path WriteRawTestFile(const std::string& fileName, const std::string& contents)
+{
+  const fs::path inputFilePath = k_TestInput.parent_path() / fileName;
+  fs::create_directories(inputFilePath.parent_path());
+  std::ofstream file(inputFilePath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  REQUIRE(file.is_open());
+  file << contents;
+  return inputFilePath;
+}
+
+// -----------------------------------------------------------------------------
+Result<> ExecuteRawTestFile(DataStructure& dataStructure, const fs::path& inputFilePath, usize startImportRow, usize headersLine, const std::vector<char>& delimiters, bool consecutiveDelimiters,
+                            const std::vector<DataType>& dataTypes, usize numTuples)
+{
+  ReadCSVData data;
+  data.inputFilePath = inputFilePath.string();
+  data.dataTypes = dataTypes;
+  data.startImportRow = startImportRow;
+  data.delimiters = delimiters;
+  data.consecutiveDelimiters = consecutiveDelimiters;
+  data.headersLine = headersLine;
+  data.headerMode = ReadCSVData::HeaderMode::LINE;
+  data.tupleDims = {numTuples};
+  data.skippedArrayMask = std::vector<bool>(dataTypes.size(), false);
+
+  Arguments args;
+  args.insertOrAssign(ReadCSVFileFilter::k_ReadCSVData_Key, std::make_any<ReadCSVData>(data));
+  args.insertOrAssign(ReadCSVFileFilter::k_UseExistingGroup_Key, std::make_any<bool>(false));
+  args.insertOrAssign(ReadCSVFileFilter::k_CreatedDataGroup_Key, std::make_any<DataPath>(DataPath({"New Group"})));
+
+  ReadCSVFileFilter filter;
+  auto executeResult = filter.execute(dataStructure, args);
+  return executeResult.result;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+std::vector<T> GetValues(const DataStructure& dataStructure, const std::string& arrayName)
+{
+  const auto* array = dataStructure.getDataAs<DataArray<T>>(DataPath({"New Group", arrayName}));
+  REQUIRE(array != nullptr);
+  std::vector<T> values(array->getSize());
+  for(usize i = 0; i < values.size(); i++)
+  {
+    values[i] = array->at(i);
+  }
+  return values;
+}
+} // namespace
+
+TEST_CASE("SimplnxCore::ReadCSVFileFilter (Case 7): Parsing details")
+{
+  DataStructure dataStructure;
+
+  SECTION("Lenient values with CRLF line endings")
+  {
+    // Values are converted with the leniency of std::stoll/std::stod: leading whitespace is skipped and trailing characters are ignored
+    const fs::path inputFilePath = WriteRawTestFile("Lenient.csv", "Int,Float,Bool\r\n 7,2.5e1x,True\r\n+3abc,-0.5,0\r\n-12,4,FALSE\r\n");
+    Result<> result = ExecuteRawTestFile(dataStructure, inputFilePath, 2, 1, {','}, false, {DataType::int32, DataType::float64, DataType::boolean}, 3);
+    SIMPLNX_RESULT_REQUIRE_VALID(result);
+    REQUIRE(GetValues<int32>(dataStructure, "Int") == std::vector<int32>{7, 3, -12});
+    REQUIRE(GetValues<float64>(dataStructure, "Float") == std::vector<float64>{25.0, -0.5, 4.0});
+    REQUIRE(GetValues<bool>(dataStructure, "Bool") == std::vector<bool>{true, false, false});
+  }
+
+  SECTION("Missing final newline")
+  {
+    const fs::path inputFilePath = WriteRawTestFile("NoFinalNewline.csv", "Value\n1\n2\n3");
+    Result<> result = ExecuteRawTestFile(dataStructure, inputFilePath, 2, 1, {','}, false, {DataType::uint16}, 3);
+    SIMPLNX_RESULT_REQUIRE_VALID(result);
+    REQUIRE(GetValues<uint16>(dataStructure, "Value") == std::vector<uint16>{1, 2, 3});
+  }
+
+  SECTION("Skipped lines in front of the header")
+  {
+    const fs::path inputFilePath = WriteRawTestFile("SkippedHeaderLines.csv", "# Exported data\n# Units: mm\nX;Y\n1;10\n2;20\n");
+    Result<> result = ExecuteRawTestFile(dataStructure, inputFilePath, 4, 3, {';'}, false, {DataType::int8, DataType::float32}, 2);
+    SIMPLNX_RESULT_REQUIRE_VALID(result);
+    REQUIRE(GetValues<int8>(dataStructure, "X") == std::vector<int8>{1, 2});
+    REQUIRE(GetValues<float32>(dataStructure, "Y") == std::vector<float32>{10.0f, 20.0f});
+  }
+
+  SECTION("Consecutive delimiters merged")
+  {
+    const fs::path inputFilePath = WriteRawTestFile("MergedDelimiters.csv", "A  B\n1    2\n3 4\n");
+    Result<> result = ExecuteRawTestFile(dataStructure, inputFilePath, 2, 1, {' '}, false, {DataType::int32, DataType::int32}, 2);
+    SIMPLNX_RESULT_REQUIRE_VALID(result);
+    REQUIRE(GetValues<int32>(dataStructure, "A") == std::vector<int32>{1, 3});
+    REQUIRE(GetValues<int32>(dataStructure, "B") == std::vector<int32>{2, 4});
+  }
+
+  SECTION("Consecutive delimiters kept as empty values")
+  {
+    const fs::path inputFilePath = WriteRawTestFile("EmptyValues.csv", "A,B,C\n1,2,3\n4,,6\n");
+    Result<> result = ExecuteRawTestFile(dataStructure, inputFilePath, 2, 1, {','}, true, {DataType::int32, DataType::int32, DataType::int32}, 2);
+    SIMPLNX_RESULT_REQUIRE_INVALID(result);
+    REQUIRE(result.errors().size() == 1);
+    REQUIRE(result.errors()[0].code == k_InvalidArgumentErrorCode);
+    REQUIRE(result.errors()[0].message.find("Array \"B\", Line 3:") == 0);
+  }
+
+  SECTION("Error line numbers")
+  {
+    const fs::path inputFilePath = WriteRawTestFile("ErrorLine.csv", "# Comment\nValue\n1\n2\n300\n4\n");
+    Result<> result = ExecuteRawTestFile(dataStructure, inputFilePath, 3, 2, {','}, false, {DataType::uint8}, 4);
+    SIMPLNX_RESULT_REQUIRE_INVALID(result);
+    REQUIRE(result.errors().size() == 1);
+    REQUIRE(result.errors()[0].code == k_OverflowErrorCode);
+    REQUIRE(result.errors()[0].message.find("Array \"Value\", Line 5:") == 0);
+  }
+
+  SECTION("Inconsistent columns report the line")
+  {
+    const fs::path inputFilePath = WriteRawTestFile("InconsistentLine.csv", "A,B\n1,2\n3,4,5\n");
+    Result<> result = ExecuteRawTestFile(dataStructure, inputFilePath, 2, 1, {','}, false, {DataType::int32, DataType::int32}, 2);
+    SIMPLNX_RESULT_REQUIRE_INVALID(result);
+    REQUIRE(result.errors().size() == 1);
+    REQUIRE(result.errors()[0].code == k_InconsistentCols);
+    REQUIRE(result.errors()[0].message.find("at line #3.") != std::string::npos);
+  }
+
+  SECTION("Blank line reports the line")
+  {
+    const fs::path inputFilePath = WriteRawTestFile("BlankLine.csv", "A\n1\n\n3\n");
+    Result<> result = ExecuteRawTestFile(dataStructure, inputFilePath, 2, 1, {','}, false, {DataType::int32}, 3);
+    SIMPLNX_RESULT_REQUIRE_INVALID(result);
+    REQUIRE(result.errors().size() == 1);
+    REQUIRE(result.errors()[0].code == k_BlankLineErrorCode);
+    REQUIRE(result.errors()[0].message.find("Line #3 is empty") == 0);
+  }
+}
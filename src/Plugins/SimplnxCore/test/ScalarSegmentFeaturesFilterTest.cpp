@@ -1,16 +1,68 @@
 #include "SimplnxCore/Filters/ScalarSegmentFeaturesFilter.hpp"
 #include "SimplnxCore/SimplnxCore_test_dirs.hpp"
 
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Parameters/ArrayCreationParameter.hpp"
 #include "simplnx/Parameters/BoolParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
 
 #include <catch2/catch.hpp>
 
+#include <random>
+
 using namespace nx::core;
 using namespace nx::core::UnitTest;
 using namespace nx::core::Constants;
 
+namespace
+{
+/**
+ * @brief Serial seed and flood fill labeling with a tolerance of 1 used as the
+ * reference for the parallel labeling engine.
+ */
+std::vector<int32> FloodFillReference(const std::array<int64, 3>& dims, const std::vector<int32>& values, const std::vector<bool>& mask)
+{
+  const int64 totalPoints = dims[0] * dims[1] * dims[2];
+  std::vector<int32> featureIds(totalPoints, 0);
+  int32 gnum = 0;
+  std::vector<int64> voxelsList;
+  for(int64 seed = 0; seed < totalPoints; seed++)
+  {
+    if(featureIds[seed] != 0 || !mask[seed])
+    {
+      continue;
+    }
+    featureIds[seed] = ++gnum;
+    voxelsList.push_back(seed);
+    while(!voxelsList.empty())
+    {
+      const int64 point = voxelsList.back();
+      voxelsList.pop_back();
+      const int64 x = point % dims[0];
+      const int64 y = (point / dims[0]) % dims[1];
+      const int64 z = point / (dims[0] * dims[1]);
+      const std::array<std::pair<bool, int64>, 6> neighbors = {{{z > 0, -dims[0] * dims[1]},
+                                                               {y > 0, -dims[0]},
+                                                               {x > 0, -1},
+                                                               {x < dims[0] - 1, 1},
+                                                               {y < dims[1] - 1, dims[0]},
+                                                               {z < dims[2] - 1, dims[0] * dims[1]}}};
+      for(const auto& [inBounds, offset] : neighbors)
+      {
+        const int64 neighbor = point + offset;
+        if(inBounds && featureIds[neighbor] == 0 && mask[neighbor] && std::abs(values[point] - values[neighbor]) <= 1)
+        {
+          featureIds[neighbor] = gnum;
+          voxelsList.push_back(neighbor);
+        }
+      }
+    }
+  }
+  return featureIds;
+}
+} // namespace
+
 TEST_CASE("SimplnxCore::ScalarSegmentFeatures", "[Reconstruction][ScalarSegmentFeatures]")
 {
   const nx::core::UnitTest::TestFileSentinel testDataSentinel(nx::core::unit_test::k_CMakeExecutable, nx::core::unit_test::k_TestFilesDir, "6_5_test_data_1_v2.tar.gz", "6_5_test_data_1_v2");
@@ -67,3 +119,63 @@ TEST_CASE("SimplnxCore::ScalarSegmentFeatures", "[Reconstruction][ScalarSegmentF
   WriteTestDataStructure(dataStructure, fs::path(fmt::format("{}/ScalarSegmentFeatures.dream3d", unit_test::k_BinaryTestOutputDir)));
 #endif
 }
+
+TEST_CASE("SimplnxCore::ScalarSegmentFeatures: Parallel Labeling", "[Reconstruction][ScalarSegmentFeatures]")
+{
+  // Odd dimensions so the slabs do not divide the volume evenly
+  const std::array<int64, 3> dims = {37, 23, 41};
+  const std::vector<usize> tupleShape = {static_cast<usize>(dims[2]), static_cast<usize>(dims[1]), static_cast<usize>(dims[0])};
+  const usize totalPoints = dims[0] * dims[1] * dims[2];
+
+  DataStructure dataStructure;
+  auto* imageGeom = ImageGeom::Create(dataStructure, k_ImageGeometry);
+  imageGeom->setDimensions({static_cast<usize>(dims[0]), static_cast<usize>(dims[1]), static_cast<usize>(dims[2])});
+  auto* cellData = AttributeMatrix::Create(dataStructure, k_CellData, tupleShape, imageGeom->getId());
+  imageGeom->setCellData(*cellData);
+
+  auto* scalars = CreateTestDataArray<int32>(dataStructure, "Scalars", tupleShape, {1}, cellData->getId());
+  auto* mask = CreateTestDataArray<bool>(dataStructure, k_Mask, tupleShape, {1}, cellData->getId());
+
+  // Smooth random field so that features span many slabs
+  std::mt19937 generator(std::mt19937::default_seed);
+  std::uniform_int_distribution<int32> stepDistribution(-1, 1);
+  std::uniform_int_distribution<int32> maskDistribution(0, 9);
+  std::vector<int32> values(totalPoints);
+  std::vector<bool> maskValues(totalPoints);
+  for(usize i = 0; i < totalPoints; i++)
+  {
+    values[i] = (i == 0 ? 0 : values[i - 1]) + stepDistribution(generator) * 2;
+    maskValues[i] = maskDistribution(generator) != 0;
+    (*scalars)[i] = values[i];
+    (*mask)[i] = maskValues[i];
+  }
+
+  ScalarSegmentFeaturesFilter filter;
+  Arguments args;
+  const DataPath geomPath({k_ImageGeometry});
+  const DataPath cellDataPath = geomPath.createChildPath(k_CellData);
+  args.insertOrAssign(ScalarSegmentFeaturesFilter::k_GridGeomPath_Key, std::make_any<DataPath>(geomPath));
+  args.insertOrAssign(ScalarSegmentFeaturesFilter::k_UseMask_Key, std::make_any<bool>(true));
+  args.insertOrAssign(ScalarSegmentFeaturesFilter::k_MaskArrayPath_Key, std::make_any<DataPath>(cellDataPath.createChildPath(k_Mask)));
+  args.insertOrAssign(ScalarSegmentFeaturesFilter::k_InputArrayPathKey, std::make_any<DataPath>(cellDataPath.createChildPath("Scalars")));
+  args.insertOrAssign(ScalarSegmentFeaturesFilter::k_ScalarToleranceKey, std::make_any<int>(1));
+  args.insertOrAssign(ScalarSegmentFeaturesFilter::k_FeatureIdsName_Key, std::make_any<std::string>(k_FeatureIds));
+  args.insertOrAssign(ScalarSegmentFeaturesFilter::k_CellFeatureName_Key, std::make_any<std::string>(k_CellFeatureData));
+  args.insertOrAssign(ScalarSegmentFeaturesFilter::k_ActiveArrayName_Key, std::make_any<std::string>(k_ActiveName));
+  args.insertOrAssign(ScalarSegmentFeaturesFilter::k_RandomizeFeatures_Key, std::make_any<bool>(false));
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  // The features and their numbering must match the serial flood fill exactly
+  const std::vector<int32> expectedFeatureIds = FloodFillReference(dims, values, maskValues);
+  const auto& featureIds = dataStructure.getDataRefAs<Int32Array>(cellDataPath.createChildPath(k_FeatureIds));
+  for(usize i = 0; i < totalPoints; i++)
+  {
+    if(featureIds[i] != expectedFeatureIds[i])
+    {
+      UNSCOPED_INFO(fmt::format("Voxel {}: expected Feature Id {} but found {}", i, expectedFeatureIds[i], featureIds[i]));
+      REQUIRE(featureIds[i] == expectedFeatureIds[i]);
+    }
+  }
+}
@@ -80,3 +80,88 @@ TEST_CASE("SimplnxCore::SilhouetteFilter: Means Test", "[SimplnxCore][Silhouette
 
   UnitTest::CompareArrays<float64>(dataStructure, k_MeansSilhouettePath, k_MeansSilhouettePathNX);
 }
+
+TEST_CASE("SimplnxCore::SilhouetteFilter: Sampled Means Test", "[SimplnxCore][SilhouetteFilter]")
+{
+  const nx::core::UnitTest::TestFileSentinel testDataSentinel(nx::core::unit_test::k_CMakeExecutable, nx::core::unit_test::k_TestFilesDir, "k_files.tar.gz", "k_files");
+  DataStructure dataStructure = UnitTest::LoadDataStructure(fs::path(fmt::format("{}/k_files/7_0_silhouette_exemplar.dream3d", unit_test::k_TestFilesDir)));
+
+  {
+    // Instantiate the filter, a DataStructure object and an Arguments Object
+    SilhouetteFilter filter;
+    Arguments args;
+
+    // Sampling more points than any cluster holds compares every point and must match the exact silhouette
+    args.insertOrAssign(SilhouetteFilter::k_UseMask_Key, std::make_any<bool>(false));
+    args.insertOrAssign(SilhouetteFilter::k_UseSampling_Key, std::make_any<bool>(true));
+    args.insertOrAssign(SilhouetteFilter::k_SamplesPerCluster_Key, std::make_any<uint64>(std::numeric_limits<uint32>::max()));
+    args.insertOrAssign(SilhouetteFilter::k_SelectedArrayPath_Key, std::make_any<DataPath>(k_CellPath.createChildPath("DAMAGE")));
+    args.insertOrAssign(SilhouetteFilter::k_FeatureIdsArrayPath_Key, std::make_any<DataPath>(k_MeansClusterIdsPath));
+    args.insertOrAssign(SilhouetteFilter::k_SilhouetteArrayPath_Key, std::make_any<DataPath>(k_MeansSilhouettePathNX));
+
+    // Preflight the filter and check result
+    auto preflightResult = filter.preflight(dataStructure, args);
+    REQUIRE(preflightResult.outputActions.valid());
+
+    // Execute the filter and check the result
+    auto executeResult = filter.execute(dataStructure, args);
+    REQUIRE(executeResult.result.valid());
+  }
+
+  UnitTest::CompareArrays<float64>(dataStructure, k_MeansSilhouettePath, k_MeansSilhouettePathNX);
+}
+
+TEST_CASE("SimplnxCore::SilhouetteFilter: Sampled Matches Exact With Cluster 0", "[SimplnxCore][SilhouetteFilter]")
+{
+  DataStructure dataStructure;
+  DataGroup* group = DataGroup::Create(dataStructure, Constants::k_DataContainer);
+
+  // Cluster 0 holds 0-2, cluster 1 holds 10-13 and cluster 2 holds 20-24
+  const std::vector<float32> values = {0.0f, 10.0f, 1.0f, 20.0f, 11.0f, 21.0f, 2.0f, 12.0f, 22.0f, 13.0f, 23.0f, 24.0f};
+  const std::vector<int32> clusterIds = {0, 1, 0, 2, 1, 2, 0, 1, 2, 1, 2, 2};
+  Float32Array* valuesArray = UnitTest::CreateTestDataArray<float32>(dataStructure, "Values", {values.size()}, {1}, group->getId());
+  Int32Array* clusterIdsArray = UnitTest::CreateTestDataArray<int32>(dataStructure, "ClusterIds", {clusterIds.size()}, {1}, group->getId());
+  for(usize i = 0; i < values.size(); i++)
+  {
+    (*valuesArray)[i] = values[i];
+    (*clusterIdsArray)[i] = clusterIds[i];
+  }
+
+  const DataPath groupPath({Constants::k_DataContainer});
+  const DataPath exactPath = groupPath.createChildPath("Exact");
+  const DataPath sampledPath = groupPath.createChildPath("Sampled");
+  for(const auto& [useSampling, outputPath] : {std::make_pair(false, exactPath), std::make_pair(true, sampledPath)})
+  {
+    SilhouetteFilter filter;
+    Arguments args;
+
+    args.insertOrAssign(SilhouetteFilter::k_UseMask_Key, std::make_any<bool>(false));
+    args.insertOrAssign(SilhouetteFilter::k_UseSampling_Key, std::make_any<bool>(useSampling));
+    args.insertOrAssign(SilhouetteFilter::k_SamplesPerCluster_Key, std::make_any<uint64>(values.size()));
+    args.insertOrAssign(SilhouetteFilter::k_UseSeed_Key, std::make_any<bool>(true));
+    args.insertOrAssign(SilhouetteFilter::k_SeedValue_Key, std::make_any<uint64>(5489));
+    args.insertOrAssign(SilhouetteFilter::k_SeedArrayName_Key, std::make_any<std::string>("SeedValue"));
+    args.insertOrAssign(SilhouetteFilter::k_SelectedArrayPath_Key, std::make_any<DataPath>(groupPath.createChildPath("Values")));
+    args.insertOrAssign(SilhouetteFilter::k_FeatureIdsArrayPath_Key, std::make_any<DataPath>(groupPath.createChildPath("ClusterIds")));
+    args.insertOrAssign(SilhouetteFilter::k_SilhouetteArrayPath_Key, std::make_any<DataPath>(outputPath));
+
+    auto preflightResult = filter.preflight(dataStructure, args);
+    REQUIRE(preflightResult.outputActions.valid());
+
+    auto executeResult = filter.execute(dataStructure, args);
+    REQUIRE(executeResult.result.valid());
+  }
+
+  const auto& exact = dataStructure.getDataRefAs<Float64Array>(exactPath);
+  const auto& sampled = dataStructure.getDataRefAs<Float64Array>(sampledPath);
+  for(usize i = 0; i < values.size(); i++)
+  {
+    REQUIRE(sampled[i] == Approx(exact[i]));
+  }
+
+  // Only the sampled run stores the seed it used
+  REQUIRE(dataStructure.getDataRefAs<UInt64Array>(DataPath({"SeedValue"}))[0] == 5489);
+
+  // Cluster 0 compares the total distance of 0 to its members (3) against the average distance to cluster 1 (11.5)
+  REQUIRE(exact[0] == Approx((11.5 - 3.0) / 11.5));
+}
@@ -3,6 +3,7 @@
 #include "simplnx/Common/Result.hpp"
 #include "simplnx/Core/Application.hpp"
 #include "simplnx/Pipeline/Pipeline.hpp"
+#include "simplnx/Pipeline/PipelineProfiler.hpp"
 #include "simplnx/SIMPLNXVersion.hpp"
 #include "simplnx/SimplnxPython.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
@@ -12,6 +13,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <optional>
 #include <ostream>
 #include <string>
 
@@ -40,6 +42,8 @@ constexpr int32 k_PreflightPipelineError = -110;
 constexpr int32 k_InvalidArgumentError = -120;
 constexpr int32 k_LogFileError = -121;
 constexpr int32 k_NullLogFileError = -122;
+constexpr int32 k_NullProfileFileError = -123;
+constexpr int32 k_ProfileWithoutExecuteError = -124;
 
 constexpr StringLiteral k_HelpParamLong = "--help";
 constexpr StringLiteral k_ExecuteParamLong = "--execute";
@@ -47,6 +51,7 @@ constexpr StringLiteral k_PreflightParamLong = "--preflight";
 constexpr StringLiteral k_LogFileParamLong = "--logfile";
 constexpr StringLiteral k_ConvertParamLong = "--convert";
 constexpr StringLiteral k_ConvertOutputParamLong = "--convert-output";
+constexpr StringLiteral k_ProfileParamLong = "--profile";
 
 constexpr StringLiteral k_HelpParamShort = "-h";
 constexpr StringLiteral k_ExecuteParamShort = "-e";
@@ -54,6 +59,7 @@ constexpr StringLiteral k_PreflightParamShort = "-p";
 constexpr StringLiteral k_LogFileParamShort = "-l";
 constexpr StringLiteral k_ConvertParamShort = "-c";
 constexpr StringLiteral k_ConvertOutputParamShort = "-co";
+constexpr StringLiteral k_ProfileParamShort = "-pr";
 
 void LoadApp()
 {
@@ -137,7 +143,8 @@ enum class ArgumentType
   Help,
   Logfile,
   Convert,
-  ConvertOutput
+  ConvertOutput,
+  Profile
 };
 
 struct Argument
@@ -236,6 +243,11 @@ Result<CliArguments> ParseParameters(int argc, char* argv[])
       std::string argStr = ParseArgument(argc, argv, index);
       args.emplace_back(ArgumentType::ConvertOutput, argStr);
     }
+    else if(arg == k_ProfileParamLong || arg == k_ProfileParamShort)
+    {
+      std::string argStr = ParseArgument(argc, argv, index);
+      args.emplace_back(ArgumentType::Profile, argStr);
+    }
     else
     {
       args.emplace_back(ArgumentType::Invalid, arg);
@@ -285,23 +297,48 @@ Result<> PreflightPipeline(Pipeline& pipeline)
   return {};
 }
 
-Result<> ExecutePipeline(Pipeline& pipeline)
+Result<> WriteProfile(const PipelineProfiler& profiler, const std::filesystem::path& profileFilePath)
+{
+  cliOut << "\n-------------------------\n";
+  cliOut << profiler.toSummaryString();
+  Result<> writeResult = profiler.writeChromeTrace(profileFilePath);
+  if(writeResult.valid())
+  {
+    cliOut << fmt::format("Wrote profiling trace to '{}'", profileFilePath.string());
+    cliOut.endline();
+  }
+  return writeResult;
+}
+
+Result<> ExecutePipeline(Pipeline& pipeline, const std::filesystem::path& profileFilePath)
 {
   const CLI::PipelineObserver obs(&pipeline);
+  std::optional<PipelineProfiler> profiler;
+  if(!profileFilePath.empty())
+  {
+    profiler.emplace(&pipeline);
+  }
   cliOut << "\n-------------------------";
   cliOut.endline();
 
-  if(!pipeline.execute())
+  const bool executeSucceeded = pipeline.execute();
+  // The profile of a failed pipeline is still useful for finding the failing filter
+  Result<> profileResult = profiler.has_value() ? WriteProfile(*profiler, profileFilePath) : Result<>{};
+  if(!executeSucceeded)
   {
     std::string ss = "Error executing pipeline";
-    return nx::core::MakeErrorResult(k_ExecutePipelineError, ss);
+    return MergeResults(nx::core::MakeErrorResult(k_ExecutePipelineError, ss), std::move(profileResult));
+  }
+  if(profileResult.invalid())
+  {
+    return profileResult;
   }
   cliOut << timestamp() << " Finished executing pipeline";
   cliOut.endline();
   return {};
 }
 
-Result<> ExecutePipeline(const Argument& arg)
+Result<> ExecutePipeline(const Argument& arg, const std::filesystem::path& profileFilePath)
 {
   std::string pipelinePath = arg.value;
   cliOut << "Executing Pipeline: " << pipelinePath << "\n";
@@ -336,7 +373,7 @@ Result<> ExecutePipeline(const Argument& arg)
   Pipeline pipeline = loadPipelineResult.value();
   cliOut << fmt::format("Executing pipeline at path: '{}'\n", pipelinePath);
   cliOut.endline();
-  return ExecutePipeline(pipeline);
+  return ExecutePipeline(pipeline, profileFilePath);
 }
 
 Result<> PreflightPipeline(const Argument& arg)
@@ -445,6 +482,8 @@ void DisplayDefaultHelp()
   cliOut << fmt::format("\t {}|{} <pipeline filepath>  [{}|{} <log filepath>]\t", k_ConvertParamLong, k_ConvertParamShort, k_LogFileParamLong, k_LogFileParamShort)
          << "\t Convert the SIMPL pipeline at the target filepath. Optionally, create a log file at the specified path.";
   cliOut << fmt::format("\t <operand [argument]>  [{}|{} <log filepath>]\t", k_LogFileParamLong, k_LogFileParamShort) << "\t Creates a log file at the specified path.";
+  cliOut << fmt::format("\t {}|{} <pipeline filepath>  {}|{} <json filepath>\t", k_ExecuteParamLong, k_ExecuteParamShort, k_ProfileParamLong, k_ProfileParamShort)
+         << "\t Execute the pipeline and write a per filter profile in the Chrome trace format to the specified path.";
   cliOut.endline();
 }
 
@@ -480,6 +519,15 @@ void DisplayConvertOutputHelp()
   cliOut.endline();
 }
 
+void DisplayProfileHelp()
+{
+  cliOut << "To profile the execution of a target pipeline file:\n\t";
+  cliOut << fmt::format("\t {}|{} <pipeline filepath>  {}|{} <json filepath>\t", k_ExecuteParamLong, k_ExecuteParamShort, k_ProfileParamLong, k_ProfileParamShort)
+         << "\t Execute the pipeline and write the preflight time, execute time, memory delta, peak RSS, thread utilization and created array sizes of each filter to the"
+            " specified path. The file can be opened with chrome://tracing or https://ui.perfetto.dev.";
+  cliOut.endline();
+}
+
 void DisplayLogfileHelp()
 {
   cliOut << "To export output a log file:\n\t";
@@ -516,6 +564,10 @@ Result<> DisplayHelpMenu(const std::vector<Argument>& arguments)
     DisplayLogfileHelp();
     return {};
   }
+  case ArgumentType::Profile: {
+    DisplayProfileHelp();
+    return {};
+  }
   case ArgumentType::Invalid: {
     [[fallthrough]];
   }
@@ -539,6 +591,17 @@ Result<> SetLogFile(const Argument& argument)
   std::filesystem::path filepath(argument.value);
   return cliOut.setLogFile(filepath);
 }
+
+Result<> SetProfileFile(const Argument& argument, std::filesystem::path& profileFilePath)
+{
+  if(argument.value.empty())
+  {
+    std::string errorMessage = "Profile file cannot be created with an empty filepath.";
+    return nx::core::MakeErrorResult(k_NullProfileFileError, errorMessage);
+  }
+  profileFilePath = argument.value;
+  return {};
+}
 } // namespace
 
 int main(int argc, char* argv[])
@@ -560,6 +623,7 @@ int main(int argc, char* argv[])
 
   CliArguments arguments = parsingResult.value();
   std::vector<Result<>> results;
+  std::filesystem::path profileFilePath;
 
   // Set log file and check for parsing errors
   for(const Argument& argument : arguments)
@@ -574,6 +638,10 @@ int main(int argc, char* argv[])
       results.push_back(SetLogFile(argument));
       break;
     }
+    case ArgumentType::Profile: {
+      results.push_back(SetProfileFile(argument, profileFilePath));
+      break;
+    }
     case ArgumentType::Convert: {
       [[fallthrough]];
     }
@@ -631,6 +699,11 @@ int main(int argc, char* argv[])
   }
 #endif
 
+  if(!profileFilePath.empty() && arguments[0].type != ArgumentType::Execute)
+  {
+    results.push_back(nx::core::MakeErrorResult(k_ProfileWithoutExecuteError, fmt::format("{} can only be used with {}", k_ProfileParamLong, k_ExecuteParamLong)));
+  }
+
   int errorCode = 0;
   // Run target operation
   switch(arguments[0].type)
@@ -643,7 +716,7 @@ int main(int argc, char* argv[])
     try
     {
       cliOut << "###### EXECUTE MODE ########\n";
-      auto result = ExecutePipeline(arguments[0]);
+      auto result = ExecutePipeline(arguments[0], profileFilePath);
       results.push_back(result);
     }
 #if SIMPLNX_EMBED_PYTHON
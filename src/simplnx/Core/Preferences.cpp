@@ -25,6 +25,7 @@ constexpr StringLiteral k_LargeDataFormat = "";
 constexpr StringLiteral k_Plugin_Key = "plugins";
 constexpr StringLiteral k_DefaultFileName = "preferences.json";
 constexpr int64 k_ReducedDataStructureSize = 3221225472; // 3 GB
+constexpr int64 k_SnapshotMemoryLimit = 2147483648;       // 2 GB
 
 constexpr int32 k_FailedToCreateDirectory_Code = -585;
 constexpr int32 k_FileDoesNotExist_Code = -586;
@@ -75,6 +76,8 @@ void Preferences::setDefaultValues()
 
   m_DefaultValues[k_LargeDataSize_Key] = k_LargeDataSize;
   m_DefaultValues[k_PreferredLargeDataFormat_Key] = k_LargeDataFormat;
+  m_DefaultValues[k_MmapScratchDirectory_Key] = std::filesystem::temp_directory_path().string();
+  m_DefaultValues[k_SnapshotMemoryLimit_Key] = k_SnapshotMemoryLimit;
 
   updateMemoryDefaults();
 
@@ -264,6 +267,26 @@ void Preferences::setForceOocData(bool forceOoc)
   setValue(k_ForceOocData_Key, forceOoc);
 }
 
+std::filesystem::path Preferences::mmapScratchDirectory() const
+{
+  return valueAs<std::string>(k_MmapScratchDirectory_Key);
+}
+
+void Preferences::setMmapScratchDirectory(const std::filesystem::path& directory)
+{
+  setValue(k_MmapScratchDirectory_Key, directory.string());
+}
+
+uint64 Preferences::snapshotMemoryLimit() const
+{
+  return value(k_SnapshotMemoryLimit_Key).get<uint64>();
+}
+
+void Preferences::setSnapshotMemoryLimit(uint64 numBytes)
+{
+  setValue(k_SnapshotMemoryLimit_Key, numBytes);
+}
+
 void Preferences::updateMemoryDefaults()
 {
   const uint64 minimumRemaining = 2 * defaultValueAs<uint64>(k_LargeDataSize_Key);
@@ -23,6 +23,8 @@ public:
   static inline constexpr StringLiteral k_PreferredLargeDataFormat_Key = "large_data_format";      // string
   static inline constexpr StringLiteral k_LargeDataStructureSize_Key = "large_datastructure_size"; // bytes
   static inline constexpr StringLiteral k_ForceOocData_Key = "force_ooc_data";                     // boolean
+  static inline constexpr StringLiteral k_MmapScratchDirectory_Key = "mmap_scratch_directory";     // string
+  static inline constexpr StringLiteral k_SnapshotMemoryLimit_Key = "snapshot_memory_limit";       // bytes
 
   static std::filesystem::path DefaultFilePath(const std::string& applicationName);
 
@@ -85,6 +87,12 @@ public:
 
   void setForceOocData(bool forceOoc);
 
+  std::filesystem::path mmapScratchDirectory() const;
+  void setMmapScratchDirectory(const std::filesystem::path& directory);
+
+  uint64 snapshotMemoryLimit() const;
+  void setSnapshotMemoryLimit(uint64 numBytes);
+
   void updateMemoryDefaults();
   uint64 largeDataStructureSize() const;
 
@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <vector>
 
 namespace nx::core
@@ -632,6 +633,201 @@ public:
   // End std::iterator support //
   ///////////////////////////////
 
+  /**
+   * @class ConstChunkView
+   * @brief Read-only view of a contiguous range of values in an AbstractDataStore.
+   * The view references the DataStore's memory directly if the values are kept
+   * contiguously in memory. Otherwise, the values are staged into a buffer
+   * owned by the view. Either way, element access through the view does not
+   * go through a virtual call.
+   */
+  class ConstChunkView
+  {
+  public:
+    /**
+     * @brief Creates a view of count values starting at startIndex. Throws a
+     * std::runtime_error if the range is out of bounds.
+     * @param store
+     * @param startIndex
+     * @param count
+     */
+    ConstChunkView(const AbstractDataStore& store, usize startIndex, usize count)
+    {
+      nonstd::span<const T> storeSpan = store.getContiguousSpan();
+      if(storeSpan.data() != nullptr && startIndex + count <= storeSpan.size())
+      {
+        m_Span = storeSpan.subspan(startIndex, count);
+        return;
+      }
+
+      m_Buffer = std::make_unique<T[]>(count);
+      Result<> result = store.copyIntoBuffer(startIndex, nonstd::span<T>(m_Buffer.get(), count));
+      if(result.invalid())
+      {
+        throw std::runtime_error(result.errors()[0].message);
+      }
+      m_Span = nonstd::span<const T>(m_Buffer.get(), count);
+    }
+
+    ConstChunkView(const ConstChunkView&) = delete;
+    ConstChunkView(ConstChunkView&&) noexcept = delete;
+    ConstChunkView& operator=(const ConstChunkView&) = delete;
+    ConstChunkView& operator=(ConstChunkView&&) noexcept = delete;
+
+    ~ConstChunkView() noexcept = default;
+
+    /**
+     * @brief Returns true if the values were copied into a staging buffer
+     * instead of referencing the DataStore's memory.
+     * @return bool
+     */
+    bool isStaged() const
+    {
+      return m_Buffer != nullptr;
+    }
+
+    nonstd::span<const T> span() const
+    {
+      return m_Span;
+    }
+
+    usize size() const
+    {
+      return m_Span.size();
+    }
+
+    const T& operator[](usize index) const
+    {
+      return m_Span[index];
+    }
+
+    const T* begin() const
+    {
+      return m_Span.data();
+    }
+
+    const T* end() const
+    {
+      return m_Span.data() + m_Span.size();
+    }
+
+  private:
+    nonstd::span<const T> m_Span;
+    std::unique_ptr<T[]> m_Buffer = nullptr;
+  };
+
+  /**
+   * @class ChunkView
+   * @brief Writable view of a contiguous range of values in an AbstractDataStore.
+   * The view references the DataStore's memory directly if the values are kept
+   * contiguously in memory. Otherwise, the values are staged into a buffer owned
+   * by the view and written back to the DataStore when commit() is called. Callers
+   * that write through the view should call commit() after their last write and
+   * check its Result. A view that was never committed writes its values back when
+   * it goes out of scope, but any failure is lost there.
+   */
+  class ChunkView
+  {
+  public:
+    /**
+     * @brief Creates a view of count values starting at startIndex. Throws a
+     * std::runtime_error if the range is out of bounds.
+     * @param store
+     * @param startIndex
+     * @param count
+     */
+    ChunkView(AbstractDataStore& store, usize startIndex, usize count)
+    : m_DataStore(store)
+    , m_StartIndex(startIndex)
+    {
+      nonstd::span<T> storeSpan = store.getContiguousSpan();
+      if(storeSpan.data() != nullptr && startIndex + count <= storeSpan.size())
+      {
+        m_Span = storeSpan.subspan(startIndex, count);
+        return;
+      }
+
+      m_Buffer = std::make_unique<T[]>(count);
+      m_Span = nonstd::span<T>(m_Buffer.get(), count);
+      Result<> result = store.copyIntoBuffer(startIndex, m_Span);
+      if(result.invalid())
+      {
+        throw std::runtime_error(result.errors()[0].message);
+      }
+    }
+
+    ChunkView(const ChunkView&) = delete;
+    ChunkView(ChunkView&&) noexcept = delete;
+    ChunkView& operator=(const ChunkView&) = delete;
+    ChunkView& operator=(ChunkView&&) noexcept = delete;
+
+    ~ChunkView() noexcept
+    {
+      if(!m_Committed)
+      {
+        commit();
+      }
+    }
+
+    /**
+     * @brief Writes staged values back to the DataStore. Does nothing if the
+     * view references the DataStore's memory directly. Values written after a
+     * commit() are only written back by another call to commit().
+     * @return Result<>
+     */
+    Result<> commit()
+    {
+      m_Committed = true;
+      if(m_Buffer == nullptr)
+      {
+        return {};
+      }
+      return m_DataStore.copyFromBuffer(m_StartIndex, nonstd::span<const T>(m_Span.data(), m_Span.size()));
+    }
+
+    /**
+     * @brief Returns true if the values were copied into a staging buffer
+     * instead of referencing the DataStore's memory.
+     * @return bool
+     */
+    bool isStaged() const
+    {
+      return m_Buffer != nullptr;
+    }
+
+    nonstd::span<T> span() const
+    {
+      return m_Span;
+    }
+
+    usize size() const
+    {
+      return m_Span.size();
+    }
+
+    T& operator[](usize index) const
+    {
+      return m_Span[index];
+    }
+
+    T* begin() const
+    {
+      return m_Span.data();
+    }
+
+    T* end() const
+    {
+      return m_Span.data() + m_Span.size();
+    }
+
+  private:
+    AbstractDataStore& m_DataStore;
+    usize m_StartIndex = 0;
+    nonstd::span<T> m_Span;
+    std::unique_ptr<T[]> m_Buffer = nullptr;
+    bool m_Committed = false;
+  };
+
   ~AbstractDataStore() override = default;
 
   /**
@@ -828,6 +1024,110 @@ public:
     return {};
   }
 
+  /**
+   * @brief Returns a span over the DataStore's values if they are kept
+   * contiguously in memory. Returns an empty span otherwise.
+   * @return nonstd::span<T>
+   */
+  virtual nonstd::span<T> getContiguousSpan()
+  {
+    return {};
+  }
+
+  /**
+   * @brief Returns a span over the DataStore's values if they are kept
+   * contiguously in memory. Returns an empty span otherwise.
+   * @return nonstd::span<const T>
+   */
+  virtual nonstd::span<const T> getContiguousSpan() const
+  {
+    return {};
+  }
+
+  /**
+   * @brief Copies buffer.size() values starting at startIndex into the provided
+   * buffer. Contiguous in-memory DataStores perform a single memory copy.
+   * Subclasses that are not kept in memory should override this to read the
+   * range in bulk.
+   * @param startIndex
+   * @param buffer
+   * @return Result<>
+   */
+  virtual Result<> copyIntoBuffer(usize startIndex, nonstd::span<T> buffer) const
+  {
+    if(startIndex + buffer.size() > getSize())
+    {
+      return MakeErrorResult(-14603, fmt::format("Unable to copy {} values starting at index {} from a data store of size {}.", buffer.size(), startIndex, getSize()));
+    }
+
+    nonstd::span<const T> storeSpan = getContiguousSpan();
+    if(storeSpan.data() != nullptr)
+    {
+      std::copy_n(storeSpan.begin() + startIndex, buffer.size(), buffer.begin());
+      return {};
+    }
+
+    for(usize i = 0; i < buffer.size(); i++)
+    {
+      buffer[i] = getValue(startIndex + i);
+    }
+    return {};
+  }
+
+  /**
+   * @brief Copies the values from the provided buffer into the DataStore
+   * starting at startIndex. Contiguous in-memory DataStores perform a single
+   * memory copy. Subclasses that are not kept in memory should override this to
+   * write the range in bulk.
+   * @param startIndex
+   * @param buffer
+   * @return Result<>
+   */
+  virtual Result<> copyFromBuffer(usize startIndex, nonstd::span<const T> buffer)
+  {
+    if(startIndex + buffer.size() > getSize())
+    {
+      return MakeErrorResult(-14604, fmt::format("Unable to copy {} values starting at index {} into a data store of size {}.", buffer.size(), startIndex, getSize()));
+    }
+
+    nonstd::span<T> storeSpan = getContiguousSpan();
+    if(storeSpan.data() != nullptr)
+    {
+      std::copy(buffer.begin(), buffer.end(), storeSpan.begin() + startIndex);
+      return {};
+    }
+
+    for(usize i = 0; i < buffer.size(); i++)
+    {
+      setValue(startIndex + i, buffer[i]);
+    }
+    return {};
+  }
+
+  /**
+   * @brief Creates a writable view of count values starting at startIndex.
+   * Throws a std::runtime_error if the range is out of bounds.
+   * @param startIndex
+   * @param count
+   * @return ChunkView
+   */
+  ChunkView createChunkView(usize startIndex, usize count)
+  {
+    return ChunkView(*this, startIndex, count);
+  }
+
+  /**
+   * @brief Creates a read-only view of count values starting at startIndex.
+   * Throws a std::runtime_error if the range is out of bounds.
+   * @param startIndex
+   * @param count
+   * @return ConstChunkView
+   */
+  ConstChunkView createChunkView(usize startIndex, usize count) const
+  {
+    return ConstChunkView(*this, startIndex, count);
+  }
+
   /**
    * @brief Sets all the components of tuple i to value.
    * @param i
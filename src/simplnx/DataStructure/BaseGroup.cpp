@@ -165,16 +165,14 @@ bool BaseGroup::remove(DataObject* obj)
 
 bool BaseGroup::remove(const std::string& name)
 {
-  for(auto iter = m_DataMap.begin(); iter != m_DataMap.end(); iter++)
+  auto iter = m_DataMap.find(name);
+  if(iter == m_DataMap.end())
   {
-    if((*iter).second->getName() == name)
-    {
-      (*iter).second->removeParent(this);
-      m_DataMap.erase(iter);
-      return true;
-    }
+    return false;
   }
-  return false;
+  (*iter).second->removeParent(this);
+  m_DataMap.erase(iter);
+  return true;
 }
 
 void BaseGroup::clear()
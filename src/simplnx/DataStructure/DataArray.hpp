@@ -9,6 +9,8 @@
 #include "simplnx/DataStructure/EmptyDataStore.hpp"
 #include "simplnx/DataStructure/IDataArray.hpp"
 
+#include <atomic>
+#include <mutex>
 #include <vector>
 
 namespace nx::core
@@ -155,6 +157,7 @@ public:
   DataArray(const DataArray<T>& other)
   : IDataArray(other)
   , m_DataStore(other.m_DataStore)
+  , m_CopyOnWrite(other.m_CopyOnWrite.load())
   {
   }
 
@@ -165,6 +168,7 @@ public:
   DataArray(DataArray<T>&& other)
   : IDataArray(std::move(other))
   , m_DataStore(std::move(other.m_DataStore))
+  , m_CopyOnWrite(other.m_CopyOnWrite.load())
   {
   }
 
@@ -213,7 +217,7 @@ public:
     {
       return nullptr;
     }
-    const std::shared_ptr<IDataStore> sharedStore = getDataStore()->deepCopy();
+    const std::shared_ptr<IDataStore> sharedStore = m_DataStore->deepCopy();
     std::shared_ptr<store_type> dataStore = std::dynamic_pointer_cast<store_type>(sharedStore);
     // Don't construct with identifier since it will get created when inserting into data structure
     std::shared_ptr<DataArray<T>> copy = std::shared_ptr<DataArray<T>>(new DataArray<T>(dataStruct, copyPath.getTargetName(), dataStore));
@@ -295,6 +299,7 @@ public:
    */
   void initializeTuple(usize tupleIndex, T value)
   {
+    makeUnique();
     m_DataStore->fillTuple(tupleIndex, value);
   }
 
@@ -304,6 +309,7 @@ public:
    */
   void fill(T value)
   {
+    makeUnique();
     m_DataStore->fill(value);
   }
 
@@ -320,6 +326,7 @@ public:
     {
       return;
     }
+    makeUnique();
     const auto numComponents = getNumberOfComponents();
     for(usize i = 0; i < numComponents; i++)
     {
@@ -335,6 +342,7 @@ public:
    */
   void byteSwapElements()
   {
+    makeUnique();
     for(auto& value : *this)
     {
       value = nx::core::byteswap(value);
@@ -387,12 +395,14 @@ public:
 
   void setComponent(usize tupleIndex, usize componentIndex, value_type value)
   {
+    makeUnique();
     const usize index = tupleIndex * getNumberOfComponents() + componentIndex;
     m_DataStore->setValue(index, value);
   }
 
   void setValue(usize index, value_type value)
   {
+    makeUnique();
     m_DataStore->setValue(index, value);
   }
 
@@ -460,7 +470,9 @@ public:
   }
 
   /**
-   * @brief Returns a std::weak_ptr for the stored DataStore.
+   * @brief Returns a std::weak_ptr for the stored DataStore. The returned
+   * DataStore may still be shared with a DataStructure snapshot and should be
+   * treated as read-only.
    * @return std::weak_ptr<DataStore<T>>
    */
   weak_store getDataStorePtr() const
@@ -485,6 +497,7 @@ public:
    */
   void setDataStore(std::shared_ptr<store_type> store)
   {
+    m_CopyOnWrite = false;
     m_DataStore = std::move(store);
     if(m_DataStore == nullptr)
     {
@@ -600,6 +613,7 @@ public:
   DataArray& operator=(const DataArray& rhs)
   {
     m_DataStore = rhs.m_DataStore;
+    m_CopyOnWrite = rhs.m_CopyOnWrite.load();
     return *this;
   }
 
@@ -611,6 +625,7 @@ public:
   DataArray& operator=(DataArray&& rhs) noexcept
   {
     m_DataStore = std::move(rhs.m_DataStore);
+    m_CopyOnWrite = rhs.m_CopyOnWrite.load();
     return *this;
   }
 
@@ -693,6 +708,68 @@ public:
     return m_DataStore->memoryUsage();
   }
 
+  /**
+   * @brief Marks the DataStore as shared with a DataStructure snapshot. The
+   * DataStore is cloned by the first write through setValue, setComponent,
+   * fill, initializeTuple, copyTuple or byteSwapElements, or by an explicit
+   * call to makeUnique(). Writes through the references returned by
+   * operator[], getDataStore() or getDataStoreRef() are not tracked, so code
+   * writing through them must call makeUnique() first.
+   */
+  void enableCopyOnWrite() const override
+  {
+    m_CopyOnWrite = true;
+  }
+
+  /**
+   * @brief Returns true if the DataStore is marked as shared with a
+   * DataStructure snapshot and has not been cloned yet.
+   * @return bool
+   */
+  bool isCopyOnWrite() const
+  {
+    return m_CopyOnWrite;
+  }
+
+  /**
+   * @brief Returns the number of bytes makeUnique() would copy. This is 0
+   * unless the DataStore is still shared with a DataStructure snapshot.
+   * @return uint64
+   */
+  uint64 copyOnWriteMemoryUsage() const override
+  {
+    if(!m_CopyOnWrite.load(std::memory_order_acquire) || m_DataStore == nullptr || m_DataStore.use_count() <= 1)
+    {
+      return 0;
+    }
+    return m_DataStore->memoryUsage();
+  }
+
+  /**
+   * @brief Clones the DataStore if it is still shared with a DataStructure
+   * snapshot so that it can be written without changing the snapshot. The
+   * check is a single atomic load once the DataStore has been detached.
+   */
+  void makeUnique() override
+  {
+    if(!m_CopyOnWrite.load(std::memory_order_acquire))
+    {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_DetachMutex);
+    if(!m_CopyOnWrite.load(std::memory_order_relaxed))
+    {
+      return;
+    }
+    // The other owners may have already detached, in which case the DataStore is no longer shared.
+    if(m_DataStore.use_count() > 1)
+    {
+      m_DataStore = std::dynamic_pointer_cast<store_type>(std::shared_ptr<IDataStore>(m_DataStore->deepCopy()));
+    }
+    m_CopyOnWrite.store(false, std::memory_order_release);
+  }
+
 protected:
   /**
    * @brief Constructs a DataArray with the specified name and DataStore.
@@ -727,6 +804,8 @@ protected:
 
 private:
   std::shared_ptr<store_type> m_DataStore = nullptr;
+  mutable std::atomic_bool m_CopyOnWrite = false;
+  std::mutex m_DetachMutex;
 };
 
 // Declare aliases
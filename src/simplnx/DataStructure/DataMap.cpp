@@ -11,11 +11,15 @@ using namespace nx::core;
 DataMap::DataMap() = default;
 DataMap::DataMap(const DataMap& other)
 : m_Map(other.m_Map)
+, m_NameIndex(other.m_NameIndex)
+, m_NumDuplicateNames(other.m_NumDuplicateNames)
 {
 }
 
 DataMap::DataMap(DataMap&& other) noexcept
 : m_Map(std::move(other.m_Map))
+, m_NameIndex(std::move(other.m_NameIndex))
+, m_NumDuplicateNames(other.m_NumDuplicateNames)
 {
 }
 
@@ -52,7 +56,18 @@ bool DataMap::insert(const std::shared_ptr<DataObject>& obj)
     return false;
   }
 
-  m_Map[obj->getId()] = obj;
+  auto iter = m_Map.find(obj->getId());
+  if(iter != m_Map.end() && iter->second->getName() != obj->getName())
+  {
+    // Replacing a child with a differently named object
+    iter->second = obj;
+    rebuildNameIndex();
+  }
+  else
+  {
+    m_Map[obj->getId()] = obj;
+    indexName(obj->getId(), obj->getName());
+  }
   return true;
 }
 
@@ -79,13 +94,32 @@ bool DataMap::erase(const Iterator& iter)
   {
     return false;
   }
+  const IdType identifier = iter->first;
+  const std::string name = iter->second->getName();
   m_Map.erase(iter);
+
+  auto indexIter = m_NameIndex.find(name);
+  if(indexIter == m_NameIndex.end() || indexIter->second != identifier)
+  {
+    m_NumDuplicateNames -= std::min<usize>(m_NumDuplicateNames, 1);
+  }
+  else
+  {
+    m_NameIndex.erase(indexIter);
+    if(m_NumDuplicateNames > 0)
+    {
+      // Another child may share the name when the map was filled without name checks
+      rebuildNameIndex();
+    }
+  }
   return true;
 }
 
 void DataMap::clear()
 {
   m_Map.clear();
+  m_NameIndex.clear();
+  m_NumDuplicateNames = 0;
 }
 
 std::vector<DataMap::IdType> DataMap::getKeys() const
@@ -141,14 +175,7 @@ std::vector<std::string> DataMap::getNames() const
 
 bool DataMap::contains(const std::string& name) const
 {
-  for(auto& iter : m_Map)
-  {
-    if(iter.second->getName() == name)
-    {
-      return true;
-    }
-  }
-  return false;
+  return findId(name).has_value();
 }
 
 bool DataMap::contains(const DataObject* obj) const
@@ -185,26 +212,22 @@ const DataObject* DataMap::operator[](IdType key) const
 
 DataObject* DataMap::operator[](const std::string& name)
 {
-  for(auto& iter : m_Map)
+  auto iter = find(name);
+  if(iter == end())
   {
-    if(iter.second->getName() == name)
-    {
-      return iter.second.get();
-    }
+    return nullptr;
   }
-  return nullptr;
+  return iter->second.get();
 }
 
 const DataObject* DataMap::operator[](const std::string& name) const
 {
-  for(auto& iter : m_Map)
+  auto iter = find(name);
+  if(iter == end())
   {
-    if(iter.second->getName() == name)
-    {
-      return iter.second.get();
-    }
+    return nullptr;
   }
-  return nullptr;
+  return iter->second.get();
 }
 
 DataObject& DataMap::at(const std::string& name)
@@ -239,26 +262,46 @@ DataMap::ConstIterator DataMap::find(IdType identifier) const
 
 DataMap::Iterator DataMap::find(const std::string& name)
 {
-  for(auto iter = begin(); iter != end(); iter++)
+  std::optional<IdType> identifier = findId(name);
+  if(!identifier.has_value())
   {
-    if((*iter).second->getName() == name)
-    {
-      return iter;
-    }
+    return end();
   }
-  return end();
+  return m_Map.find(*identifier);
 }
 
 DataMap::ConstIterator DataMap::find(const std::string& name) const
 {
-  for(auto iter = begin(); iter != end(); iter++)
+  std::optional<IdType> identifier = findId(name);
+  if(!identifier.has_value())
+  {
+    return end();
+  }
+  return m_Map.find(*identifier);
+}
+
+std::optional<DataMap::IdType> DataMap::findId(const std::string& name) const
+{
+  auto indexIter = m_NameIndex.find(name);
+  if(indexIter == m_NameIndex.end())
   {
-    if((*iter).second->getName() == name)
+    return std::nullopt;
+  }
+  auto iter = m_Map.find(indexIter->second);
+  if(iter != m_Map.end() && iter->second->getName() == name)
+  {
+    return iter->first;
+  }
+
+  // The indexed child was renamed without going through updateName()
+  for(const auto& [identifier, object] : m_Map)
+  {
+    if(object->getName() == name)
     {
-      return iter;
+      return identifier;
     }
   }
-  return end();
+  return std::nullopt;
 }
 
 void DataMap::setDataStructure(DataStructure* dataStr)
@@ -280,6 +323,7 @@ void DataMap::setDataStructure(DataStructure* dataStr)
     m_Map[key] = shareData;
     dataStr->setData(key, shareData);
   }
+  rebuildNameIndex();
 }
 
 DataMap::Iterator DataMap::begin()
@@ -308,6 +352,8 @@ DataMap& DataMap::operator=(const DataMap& rhs)
     DataObject* copy = rhs.m_Map.at(key)->shallowCopy();
     m_Map[key] = std::shared_ptr<DataObject>(copy);
   }
+  m_NameIndex = rhs.m_NameIndex;
+  m_NumDuplicateNames = rhs.m_NumDuplicateNames;
 
   return *this;
 }
@@ -315,6 +361,8 @@ DataMap& DataMap::operator=(const DataMap& rhs)
 DataMap& DataMap::operator=(DataMap&& rhs) noexcept
 {
   m_Map = std::move(rhs.m_Map);
+  m_NameIndex = std::move(rhs.m_NameIndex);
+  m_NumDuplicateNames = rhs.m_NumDuplicateNames;
   return *this;
 }
 
@@ -341,4 +389,49 @@ void DataMap::updateIds(const std::unordered_map<DataObject::IdType, DataObject:
   {
     m_Map[updatedValue.first] = updatedValue.second;
   }
+  rebuildNameIndex();
+}
+
+void DataMap::updateName(IdType identifier, const std::string& previousName)
+{
+  auto iter = m_Map.find(identifier);
+  if(iter == m_Map.end())
+  {
+    return;
+  }
+
+  if(m_NumDuplicateNames > 0)
+  {
+    rebuildNameIndex();
+  }
+  else
+  {
+    auto indexIter = m_NameIndex.find(previousName);
+    if(indexIter != m_NameIndex.end() && indexIter->second == identifier)
+    {
+      m_NameIndex.erase(indexIter);
+    }
+    indexName(identifier, iter->second->getName());
+  }
+}
+
+void DataMap::indexName(IdType identifier, const std::string& name)
+{
+  auto [indexIter, inserted] = m_NameIndex.emplace(name, identifier);
+  if(inserted || indexIter->second == identifier)
+  {
+    return;
+  }
+  m_NumDuplicateNames++;
+  indexIter->second = std::min(indexIter->second, identifier);
+}
+
+void DataMap::rebuildNameIndex()
+{
+  m_NameIndex.clear();
+  m_NumDuplicateNames = 0;
+  for(const auto& [identifier, object] : m_Map)
+  {
+    indexName(identifier, object->getName());
+  }
 }
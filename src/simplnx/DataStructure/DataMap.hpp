@@ -21,6 +21,10 @@ class DataPath;
  * @brief The DataMap class is used to handle lookup and storage of DataObjects
  * using the objects' ID values or names. The DataMap class is primarily used
  * within the BaseGroup and DataStructure classes as a consistent.
+ *
+ * Names are looked up through a name to ID index that is kept up to date by
+ * every method that adds, removes or renames a child, so that lookups by name
+ * do not scan the whole map.
  */
 class SIMPLNX_EXPORT DataMap
 {
@@ -291,7 +295,38 @@ public:
    */
   void updateIds(const std::unordered_map<IdType, IdType>& updatedIdsMap);
 
+  /**
+   * @brief Updates the name index after the DataObject with the specified ID
+   * was renamed. Does nothing if the DataObject is not in the map.
+   * @param identifier
+   * @param previousName
+   */
+  void updateName(IdType identifier, const std::string& previousName);
+
 private:
+  /**
+   * @brief Returns the ID of the child with the specified name or std::nullopt
+   * if there is none.
+   * @param name
+   * @return std::optional<IdType>
+   */
+  std::optional<IdType> findId(const std::string& name) const;
+
+  /**
+   * @brief Adds the child to the name index. If several children share a name,
+   * the one with the smallest ID is indexed and the others are counted.
+   * @param identifier
+   * @param name
+   */
+  void indexName(IdType identifier, const std::string& name);
+
+  /**
+   * @brief Rebuilds the name index from the map.
+   */
+  void rebuildNameIndex();
+
   MapType m_Map;
+  std::unordered_map<std::string, IdType> m_NameIndex;
+  usize m_NumDuplicateNames = 0;
 };
 } // namespace nx::core
@@ -2,6 +2,7 @@
 
 #include "simplnx/DataStructure/BaseGroup.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/DataStructure/Messaging/DataRenamedMessage.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
 #include <algorithm>
@@ -206,7 +207,27 @@ bool DataObject::rename(const std::string& name)
     return false;
   }
 
+  if(name == m_Name)
+  {
+    return true;
+  }
+
+  const std::string previousName = m_Name;
   m_Name = name;
+  if(m_DataStructure != nullptr)
+  {
+    // Keep the name indices of the parent groups, or of the top level, in sync
+    for(IdType parentId : m_ParentList)
+    {
+      auto* parentGroup = m_DataStructure->getDataAs<BaseGroup>(parentId);
+      if(parentGroup != nullptr)
+      {
+        parentGroup->getDataMap().updateName(getId(), previousName);
+      }
+    }
+    m_DataStructure->m_RootGroup.updateName(getId(), previousName);
+    m_DataStructure->notify(std::make_shared<DataRenamedMessage>(m_DataStructure, getId(), previousName, name));
+  }
   return true;
 }
 
@@ -345,4 +366,17 @@ uint64 DataObject::memoryUsage() const
 {
   return 0;
 }
+
+void DataObject::enableCopyOnWrite() const
+{
+}
+
+uint64 DataObject::copyOnWriteMemoryUsage() const
+{
+  return 0;
+}
+
+void DataObject::makeUnique()
+{
+}
 } // namespace nx::core
@@ -262,6 +262,27 @@ public:
 
   virtual uint64 memoryUsage() const;
 
+  /**
+   * @brief Marks any data shared with a DataStructure snapshot so that it is
+   * cloned the first time it is modified. DataObjects without shareable data
+   * ignore the call.
+   */
+  virtual void enableCopyOnWrite() const;
+
+  /**
+   * @brief Returns the number of bytes makeUnique() would copy. DataObjects
+   * without shareable data return 0.
+   * @return uint64
+   */
+  virtual uint64 copyOnWriteMemoryUsage() const;
+
+  /**
+   * @brief Clones any data still shared with a DataStructure snapshot so that
+   * the DataObject can be modified without changing the snapshot. DataObjects
+   * without shareable data ignore the call.
+   */
+  virtual void makeUnique();
+
 protected:
   /**
    * @brief DataObject constructor takes a reference to the DataStructure and
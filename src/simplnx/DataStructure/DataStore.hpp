@@ -347,6 +347,16 @@ public:
     return {data(), this->getSize()};
   }
 
+  nonstd::span<T> getContiguousSpan() override
+  {
+    return createSpan();
+  }
+
+  nonstd::span<const T> getContiguousSpan() const override
+  {
+    return createSpan();
+  }
+
   std::pair<int32, std::string> writeBinaryFile(const std::string& absoluteFilePath) const override
   {
     std::ofstream outStrm(absoluteFilePath, std::ios_base::out | std::ios_base::binary);
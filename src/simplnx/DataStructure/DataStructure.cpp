@@ -268,31 +268,7 @@ DataObject* DataStructure::getData(const std::optional<DataObject::IdType>& iden
 
 DataObject* DataStructure::getData(const DataPath& path)
 {
-  if(path.empty())
-  {
-    return nullptr;
-  }
-  DataObject* targetObject = m_RootGroup[path[0]];
-  for(usize index = 1; index < path.getLength(); index++)
-  {
-    if(targetObject == nullptr)
-    {
-      return nullptr;
-    }
-    if(!targetObject->isGroup())
-    {
-      return nullptr;
-    }
-    auto* groupObject = static_cast<BaseGroup*>(targetObject);
-    DataObject* childObject = (*groupObject)[path[index]];
-    if(childObject == nullptr)
-    {
-      return nullptr;
-    }
-    targetObject = childObject;
-  }
-
-  return targetObject;
+  return findData(path);
 }
 
 DataObject& DataStructure::getDataRef(const DataPath& path)
@@ -346,29 +322,35 @@ const DataObject* DataStructure::getData(const std::optional<DataObject::IdType>
 }
 
 const DataObject* DataStructure::getData(const DataPath& path) const
+{
+  return findData(path);
+}
+
+DataObject* DataStructure::findData(const DataPath& path) const
 {
   if(path.empty())
   {
     return nullptr;
   }
-  const DataObject* targetObject = m_RootGroup[path[0]];
-  for(usize index = 1; index < path.getLength(); index++)
+
+  const DataMap* dataMap = &m_RootGroup;
+  DataObject* targetObject = nullptr;
+  for(usize index = 0; index < path.getLength(); index++)
   {
-    if(targetObject == nullptr)
+    if(targetObject != nullptr)
     {
-      return nullptr;
-    }
-    if(!targetObject->isGroup())
-    {
-      return nullptr;
+      if(!targetObject->isGroup())
+      {
+        return nullptr;
+      }
+      dataMap = &static_cast<const BaseGroup*>(targetObject)->getDataMap();
     }
-    const auto* groupObject = static_cast<const BaseGroup*>(targetObject);
-    const DataObject* childObject = (*groupObject)[path[index]];
-    if(childObject == nullptr)
+    auto childIter = dataMap->find(path[index]);
+    if(childIter == dataMap->end())
     {
       return nullptr;
     }
-    targetObject = childObject;
+    targetObject = childIter->second.get();
   }
 
   return targetObject;
@@ -982,6 +964,31 @@ uint64 DataStructure::memoryUsage() const
   return memory;
 }
 
+DataStructure DataStructure::createSnapshot() const
+{
+  for(const auto& dataIter : m_DataObjects)
+  {
+    auto dataPtr = dataIter.second.lock();
+    if(dataPtr == nullptr)
+    {
+      continue;
+    }
+    dataPtr->enableCopyOnWrite();
+  }
+  // Shallow copies inherit the copy-on-write flag from the source objects.
+  DataStructure snapshot(*this);
+  // Only DataArrays share their stores copy-on-write, so other DataObjects holding shared data are copied up front
+  for(const auto& dataIter : snapshot.m_DataObjects)
+  {
+    auto dataPtr = dataIter.second.lock();
+    if(dataPtr != nullptr && std::dynamic_pointer_cast<IDataArray>(dataPtr) == nullptr)
+    {
+      dataPtr->makeUnique();
+    }
+  }
+  return snapshot;
+}
+
 Result<> DataStructure::transferDataArraysOoc()
 {
   auto* preferences = Application::GetOrCreateInstance()->getPreferences();
@@ -891,6 +891,16 @@ public:
 
   uint64 memoryUsage() const;
 
+  /**
+   * @brief Creates a copy-on-write snapshot of the DataStructure. The snapshot
+   * shares all DataArray stores with this DataStructure until either side calls
+   * makeUnique() or one of the DataArray write methods, at which point that side
+   * receives its own copy of the store. Both this DataStructure and the snapshot
+   * are marked. NeighborLists and StringArrays are copied into the snapshot.
+   * @return DataStructure
+   */
+  DataStructure createSnapshot() const;
+
   /**
    * @brief Transfers array data to OOC if available.
    * @return Result with Warnings and errors
@@ -1021,6 +1031,14 @@ private:
    */
   void notify(const std::shared_ptr<AbstractDataStructureMessage>& msg);
 
+  /**
+   * @brief Resolves the DataPath one name at a time through each DataMap's name
+   * index, so a lookup costs O(path length).
+   * @param path
+   * @return DataObject*
+   */
+  DataObject* findData(const DataPath& path) const;
+
   ////////////
   // Variables
   SignalType m_Signal;
@@ -29,7 +29,8 @@ public:
     InMemory = 0,
     OutOfCore,
     Empty,
-    EmptyOutOfCore
+    EmptyOutOfCore,
+    Lazy
   };
 
   virtual ~IDataStore() = default;
@@ -3,6 +3,7 @@
 #include "simplnx/Core/Application.hpp"
 #include "simplnx/DataStructure/IO/Generic/CoreDataIOManager.hpp"
 #include "simplnx/DataStructure/IO/Generic/IDataIOManager.hpp"
+#include "simplnx/DataStructure/IO/Generic/MmapDataIOManager.hpp"
 #include "simplnx/DataStructure/IO/HDF5/DataIOManager.hpp"
 
 namespace nx::core
@@ -11,6 +12,7 @@ DataIOCollection::DataIOCollection()
 {
   addIOManager(std::make_shared<nx::core::Generic::CoreDataIOManager>());
   addIOManager(std::make_shared<nx::core::HDF5::DataIOManager>());
+  addIOManager(std::make_shared<nx::core::Generic::MmapDataIOManager>());
 }
 DataIOCollection::~DataIOCollection() noexcept = default;
 
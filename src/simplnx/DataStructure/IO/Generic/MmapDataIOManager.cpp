@@ -0,0 +1,69 @@
+#include "MmapDataIOManager.hpp"
+
+#include "simplnx/Core/Application.hpp"
+#include "simplnx/DataStructure/MmapDataStore.hpp"
+
+namespace nx::core::Generic
+{
+MmapDataIOManager::MmapDataIOManager()
+: IDataIOManager()
+{
+  addDataStoreFnc();
+}
+
+MmapDataIOManager::~MmapDataIOManager() noexcept = default;
+
+std::string MmapDataIOManager::formatName() const
+{
+  return MmapDataStore<uint8>::k_DataFormat.str();
+}
+
+void MmapDataIOManager::addDataStoreFnc()
+{
+  DataStoreCreateFnc dataStoreFnc = [](nx::core::DataType numericType, const typename IDataStore::ShapeType& tupleShape, const typename IDataStore::ShapeType& componentShape,
+                                       const std::optional<IDataStore::ShapeType>& /*chunkShape*/) {
+    // The mapping is one contiguous region, so chunks are always whole rows (see MmapDataStore::getChunkShape())
+    const std::filesystem::path scratchDirectory = Application::GetOrCreateInstance()->getPreferences()->mmapScratchDirectory();
+
+    std::unique_ptr<IDataStore> dataStore = nullptr;
+    switch(numericType)
+    {
+    case DataType::int8:
+      dataStore = std::make_unique<Int8MmapDataStore>(tupleShape, componentShape, static_cast<int8>(0), scratchDirectory);
+      break;
+    case DataType::int16:
+      dataStore = std::make_unique<Int16MmapDataStore>(tupleShape, componentShape, static_cast<int16>(0), scratchDirectory);
+      break;
+    case DataType::int32:
+      dataStore = std::make_unique<Int32MmapDataStore>(tupleShape, componentShape, static_cast<int32>(0), scratchDirectory);
+      break;
+    case DataType::int64:
+      dataStore = std::make_unique<Int64MmapDataStore>(tupleShape, componentShape, static_cast<int64>(0), scratchDirectory);
+      break;
+    case DataType::uint8:
+      dataStore = std::make_unique<UInt8MmapDataStore>(tupleShape, componentShape, static_cast<uint8>(0), scratchDirectory);
+      break;
+    case DataType::uint16:
+      dataStore = std::make_unique<UInt16MmapDataStore>(tupleShape, componentShape, static_cast<uint16>(0), scratchDirectory);
+      break;
+    case DataType::uint32:
+      dataStore = std::make_unique<UInt32MmapDataStore>(tupleShape, componentShape, static_cast<uint32>(0), scratchDirectory);
+      break;
+    case DataType::uint64:
+      dataStore = std::make_unique<UInt64MmapDataStore>(tupleShape, componentShape, static_cast<uint64>(0), scratchDirectory);
+      break;
+    case DataType::float32:
+      dataStore = std::make_unique<Float32MmapDataStore>(tupleShape, componentShape, 0.0f, scratchDirectory);
+      break;
+    case DataType::float64:
+      dataStore = std::make_unique<Float64MmapDataStore>(tupleShape, componentShape, 0.0, scratchDirectory);
+      break;
+    case DataType::boolean:
+      dataStore = std::make_unique<BoolMmapDataStore>(tupleShape, componentShape, false, scratchDirectory);
+      break;
+    }
+    return dataStore;
+  };
+  addDataStoreCreationFnc(formatName(), dataStoreFnc);
+}
+} // namespace nx::core::Generic
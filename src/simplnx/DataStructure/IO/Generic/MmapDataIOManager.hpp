@@ -0,0 +1,33 @@
+#pragma once
+
+#include "simplnx/DataStructure/IO/Generic/IDataIOManager.hpp"
+
+namespace nx::core
+{
+namespace Generic
+{
+/**
+ * @brief The MmapDataIOManager class registers the MmapDataStore creation
+ * functions so that the memory mapped format can be selected as the large data
+ * format in the Preferences.
+ */
+class SIMPLNX_EXPORT MmapDataIOManager : public IDataIOManager
+{
+public:
+  /**
+   * @brief Constructs a MmapDataIOManager and adds the MmapDataStore creation function.
+   */
+  MmapDataIOManager();
+  ~MmapDataIOManager() noexcept override;
+
+  /**
+   * @brief Returns the format name for the IDataIOManager as a string.
+   * @return std::string
+   */
+  std::string formatName() const override;
+
+private:
+  void addDataStoreFnc();
+};
+} // namespace Generic
+} // namespace nx::core
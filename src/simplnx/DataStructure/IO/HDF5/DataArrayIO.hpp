@@ -9,6 +9,7 @@
 #include "simplnx/DataStructure/IO/HDF5/DataStructureWriter.hpp"
 #include "simplnx/DataStructure/IO/HDF5/EmptyDataStoreIO.hpp"
 #include "simplnx/DataStructure/IO/HDF5/IDataIO.hpp"
+#include "simplnx/DataStructure/IO/HDF5/LazyDataStore.hpp"
 
 #include <vector>
 
@@ -36,13 +37,27 @@ public:
    * @param err
    * @param parentId
    * @param preflight
+   * @param lazyDataSource Creates a LazyDataStore reading from this source instead of reading the values when not null
    */
   template <typename K>
   static void importDataArray(DataStructure& dataStructure, const nx::core::HDF5::DatasetReader& datasetReader, const std::string dataArrayName, DataObject::IdType importId,
-                              nx::core::HDF5::ErrorType& err, const std::optional<DataObject::IdType>& parentId, bool preflight)
+                              nx::core::HDF5::ErrorType& err, const std::optional<DataObject::IdType>& parentId, bool preflight,
+                              const std::shared_ptr<const LazyDataSource>& lazyDataSource = nullptr)
   {
-    std::unique_ptr<AbstractDataStore<K>> dataStore =
-        preflight ? std::unique_ptr<AbstractDataStore<K>>(EmptyDataStoreIO::ReadDataStore<K>(datasetReader)) : std::unique_ptr<AbstractDataStore<K>>(DataStoreIO::ReadDataStore<K>(datasetReader));
+    std::unique_ptr<AbstractDataStore<K>> dataStore;
+    if(preflight)
+    {
+      dataStore = EmptyDataStoreIO::ReadDataStore<K>(datasetReader);
+    }
+    else if(lazyDataSource != nullptr)
+    {
+      dataStore = std::make_unique<LazyDataStore<K>>(lazyDataSource, nx::core::HDF5::Support::GetObjectPath(datasetReader.getId()), IDataStoreIO::ReadTupleShape(datasetReader),
+                                                     IDataStoreIO::ReadComponentShape(datasetReader));
+    }
+    else
+    {
+      dataStore = DataStoreIO::ReadDataStore<K>(datasetReader);
+    }
     DataArray<K>* data = DataArray<K>::Import(dataStructure, dataArrayName, importId, std::move(dataStore), parentId);
     err = (data == nullptr) ? -400 : 0;
   }
@@ -90,41 +105,41 @@ public:
     switch(type)
     {
     case nx::core::HDF5::Type::float32:
-      importDataArray<float32>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<float32>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, dataStructureReader.getLazyDataSource());
       break;
     case nx::core::HDF5::Type::float64:
-      importDataArray<float64>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<float64>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, dataStructureReader.getLazyDataSource());
       break;
     case nx::core::HDF5::Type::int8:
-      importDataArray<int8>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<int8>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, dataStructureReader.getLazyDataSource());
       break;
     case nx::core::HDF5::Type::int16:
-      importDataArray<int16>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<int16>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, dataStructureReader.getLazyDataSource());
       break;
     case nx::core::HDF5::Type::int32:
-      importDataArray<int32>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<int32>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, dataStructureReader.getLazyDataSource());
       break;
     case nx::core::HDF5::Type::int64:
-      importDataArray<int64>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<int64>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, dataStructureReader.getLazyDataSource());
       break;
     case nx::core::HDF5::Type::uint8:
       if(isBoolArray)
       {
-        importDataArray<bool>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+        importDataArray<bool>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, dataStructureReader.getLazyDataSource());
       }
       else
       {
-        importDataArray<uint8>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+        importDataArray<uint8>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, dataStructureReader.getLazyDataSource());
       }
       break;
     case nx::core::HDF5::Type::uint16:
-      importDataArray<uint16>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<uint16>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, dataStructureReader.getLazyDataSource());
       break;
     case nx::core::HDF5::Type::uint32:
-      importDataArray<uint32>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<uint32>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, dataStructureReader.getLazyDataSource());
       break;
     case nx::core::HDF5::Type::uint64:
-      importDataArray<uint64>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore);
+      importDataArray<uint64>(dataStructureReader.getDataStructure(), datasetReader, dataArrayName, importId, err, parentId, useEmptyDataStore, dataStructureReader.getLazyDataSource());
       break;
     default:
       err = -777;
@@ -151,7 +166,7 @@ public:
   Result<> writeData(DataStructureWriter& dataStructureWriter, const nx::core::DataArray<T>& dataArray, group_writer_type& parentGroup, bool importable) const
   {
     auto datasetWriter = parentGroup.createDatasetWriter(dataArray.getName());
-    Result<> result = DataStoreIO::WriteDataStore<T>(datasetWriter, dataArray.getDataStoreRef());
+    Result<> result = DataStoreIO::WriteDataStore<T>(datasetWriter, dataArray.getDataStoreRef(), dataStructureWriter.getCompressionSettings(), &dataStructureWriter.getWriteStatistics());
     if(result.invalid())
     {
       return result;
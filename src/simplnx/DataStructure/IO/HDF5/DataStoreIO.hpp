@@ -3,10 +3,16 @@
 #include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/DataStructure/IO/HDF5/IDataStoreIO.hpp"
 
+#include "simplnx/Utilities/Parsing/HDF5/H5ChunkWritePipeline.hpp"
+#include "simplnx/Utilities/Parsing/HDF5/H5Compression.hpp"
 #include "simplnx/Utilities/Parsing/HDF5/Writers/DatasetWriter.hpp"
 
 #include "fmt/format.h"
 
+#include <chrono>
+#include <cstring>
+#include <type_traits>
+
 namespace nx::core
 {
 namespace HDF5
@@ -17,143 +23,214 @@ namespace Chunks
 {
 constexpr int32 k_DimensionMismatchError = -2654;
 
+/**
+ * @brief Returns true if chunks of the store may be prepared off the HDF5
+ * thread. Only in memory DataStores are read without touching a file; any
+ * other store (lazily loaded or out-of-core) may call into the HDF5 library,
+ * which is not thread safe, so those are staged on the writing thread.
+ * @param store
+ * @return bool
+ */
 template <typename T>
-inline Result<> WriteDataStoreChunk(nx::core::HDF5::DatasetWriter& datasetWriter, const AbstractDataStore<T>& store, const nx::core::HDF5::DatasetWriter::DimsType& h5dims,
-                                    const nx::core::HDF5::DatasetWriter::DimsType& chunkDims, const IDataStore::ShapeType& index)
+inline bool CanPrepareOffThread(const AbstractDataStore<T>& store)
 {
-  auto rank = chunkDims.size();
+  return dynamic_cast<const DataStore<T>*>(&store) != nullptr;
+}
 
-  // Find and write chunk values to HDF5
-  std::vector<hsize_t> offset(rank);
-  for(uint64 i = 0; i < rank && i < index.size(); i++)
-  {
-    offset[i] = index[i] * chunkDims[i];
-  }
-  const std::vector<T> chunkVector = store.getChunkValues(index);
-  const usize cCount = chunkVector.size();
-  T* chunkPtr = new T[cCount];
-  for(usize i = 0; i < cCount; i++)
-  {
-    chunkPtr[i] = chunkVector[i];
-  }
+/**
+ * @brief Writes a DataStore that provides its own chunk shape (see AbstractDataStore::getChunkShape)
+ * chunk by chunk. Chunks are fetched from the store on the writing thread unless the store is an
+ * in memory DataStore (see CanPrepareOffThread).
+ * @param datasetWriter
+ * @param store
+ * @param h5dims
+ * @return Result<>
+ */
+template <typename T>
+inline Result<> WriteDataStoreChunks(nx::core::HDF5::DatasetWriter& datasetWriter, const AbstractDataStore<T>& store, const nx::core::HDF5::DatasetWriter::DimsType& h5dims)
+{
+  using StorageType = std::conditional_t<std::is_same_v<T, bool>, uint8, T>;
+
+  const auto storeChunkShape = store.getChunkShape().value();
+  nx::core::HDF5::DatasetWriter::DimsType chunkDims(storeChunkShape.begin(), storeChunkShape.end());
   if(chunkDims.size() != h5dims.size())
   {
     std::string ss = fmt::format("Dimension mismatch when writing DataStore chunk. Num Shape Dimensions: {} Num Chunk Dimensions: {}", h5dims.size(), chunkDims.size());
     return MakeErrorResult(k_DimensionMismatchError, ss);
   }
-  auto result = datasetWriter.writeChunk(h5dims, nonstd::span<const T>(chunkPtr, cCount), chunkDims, nonstd::span<const hsize_t>{offset.data(), offset.size()});
-  delete[] chunkPtr;
-  if(result.invalid())
-  {
-    std::string ss = "Failed to write DataStore chunk to Dataset";
-    return MakeErrorResult(result.errors()[0].code, ss);
-  }
 
-  return {};
-}
-
-template <>
-inline Result<> WriteDataStoreChunk<bool>(nx::core::HDF5::DatasetWriter& datasetWriter, const AbstractDataStore<bool>& store, const nx::core::HDF5::DatasetWriter::DimsType& h5dims,
-                                          const nx::core::HDF5::DatasetWriter::DimsType& chunkDims, const IDataStore::ShapeType& index)
-{
-  auto rank = chunkDims.size();
-
-  // Find and write chunk values to HDF5
-  std::vector<hsize_t> offset(rank);
-  for(uint64 i = 0; i < rank; i++)
-  {
-    offset[i] = index[i] * chunkDims[i];
-  }
-  const std::vector<bool> chunkVector = store.getChunkValues(index);
-  const usize cCount = chunkVector.size();
-  uint8* chunkPtr = new uint8[cCount];
-  for(usize i = 0; i < cCount; i++)
-  {
-    chunkPtr[i] = chunkVector[i];
-  }
-  auto result = datasetWriter.writeChunk(h5dims, nonstd::span<const uint8>(chunkPtr, cCount), chunkDims, nonstd::span<const hsize_t>{offset.data(), offset.size()});
-  delete[] chunkPtr;
-  if(result.invalid())
+  const usize rank = h5dims.size();
+  nx::core::HDF5::DatasetWriter::DimsType chunkLayout(rank);
+  usize numChunks = 1;
+  usize chunkElements = 1;
+  for(usize i = 0; i < rank; i++)
   {
-    std::string ss = "Failed to write DataStore chunk to Dataset";
-    return MakeErrorResult(result.errors()[0].code, ss);
+    chunkLayout[i] = (h5dims[i] + chunkDims[i] - 1) / chunkDims[i];
+    numChunks *= chunkLayout[i];
+    chunkElements *= chunkDims[i];
   }
 
-  return {};
-}
+  // Chunk positions are enumerated in row major order of the chunk layout
+  auto chunkPosition = [&](usize chunkIndex) {
+    IDataStore::ShapeType position(rank);
+    for(usize dim = rank; dim-- > 0;)
+    {
+      position[dim] = chunkIndex % chunkLayout[dim];
+      chunkIndex /= chunkLayout[dim];
+    }
+    return position;
+  };
 
-template <typename T>
-inline Result<> RecursivelyWriteChunks(nx::core::HDF5::DatasetWriter& datasetWriter, const AbstractDataStore<T>& store, const nx::core::HDF5::DatasetWriter::DimsType& h5dims,
-                                       const nx::core::HDF5::DatasetWriter::DimsType& chunkDims, IDataStore::ShapeType index, const nx::core::HDF5::DatasetWriter::DimsType& chunkLayout, uint64 i = 0)
-{
-  // uint64 rank = chunkLayout.size();
-  const uint64 rank = chunkDims.size();
-  if(i >= rank)
+  ChunkWritePipeline pipeline;
+  if(!CanPrepareOffThread(store))
   {
-    return {};
+    pipeline.setParallelizationEnabled(false);
   }
 
-  const auto maxValue = chunkLayout[i];
-  // const auto maxValue = rank;
-  const uint64 nextIndexPos = i + 1;
-  for(hsize_t value = 0; value < maxValue; value++)
-  {
-    index[i] = value;
-    Result<> result = WriteDataStoreChunk<T>(datasetWriter, store, h5dims, chunkDims, index);
-    if(result.invalid())
+  auto prepareChunk = [&](usize chunkIndex, std::vector<StorageType>& buffer) -> Result<> {
+    const std::vector<T> chunkValues = store.getChunkValues(chunkPosition(chunkIndex));
+    buffer.assign(chunkValues.begin(), chunkValues.end());
+    return {};
+  };
+  auto writeChunk = [&](usize chunkIndex, std::vector<StorageType>& buffer) -> Result<> {
+    const IDataStore::ShapeType position = chunkPosition(chunkIndex);
+    std::vector<hsize_t> offset(rank);
+    for(usize i = 0; i < rank; i++)
     {
-      return result;
+      offset[i] = position[i] * chunkDims[i];
     }
-
-    result = RecursivelyWriteChunks<T>(datasetWriter, store, h5dims, chunkDims, index, chunkLayout, nextIndexPos);
+    auto result = datasetWriter.writeChunk(h5dims, nonstd::span<const StorageType>(buffer.data(), buffer.size()), chunkDims, nonstd::span<const hsize_t>{offset.data(), offset.size()});
     if(result.invalid())
     {
-      return result;
+      std::string ss = "Failed to write DataStore chunk to Dataset";
+      return MakeErrorResult(result.errors()[0].code, ss);
     }
-  }
+    return {};
+  };
 
-  // Successfully wrote all chunks
-  return {};
+  return pipeline.execute<std::vector<StorageType>>(numChunks, chunkElements * sizeof(StorageType), prepareChunk, writeChunk);
 }
 
+/**
+ * @brief Writes the DataStore as a compressed, chunked dataset. Chunks are
+ * picked by Compression::ComputeChunkShape so each one is a contiguous range of
+ * the store. For in memory DataStores worker tasks stage and compress the chunks
+ * while the calling thread hands them to HDF5 with H5Dwrite_chunk, since the
+ * HDF5 library itself is not thread safe (see ChunkWritePipeline). Other stores
+ * are staged and compressed on the calling thread.
+ * @param datasetWriter
+ * @param store
+ * @param h5dims
+ * @param compression
+ * @param statistics
+ * @return Result<>
+ */
 template <typename T>
-inline Result<> WriteDataStoreChunks(nx::core::HDF5::DatasetWriter& datasetWriter, const AbstractDataStore<T>& store, const nx::core::HDF5::DatasetWriter::DimsType& h5dims)
+inline Result<> WriteCompressedDataStore(nx::core::HDF5::DatasetWriter& datasetWriter, const AbstractDataStore<T>& store, const nx::core::HDF5::DatasetWriter::DimsType& h5dims,
+                                         const CompressionSettings& compression, WriteStatistics& statistics)
 {
-  auto shapeDims = store.getTupleShape();
-  const auto componentDims = store.getComponentShape();
-  shapeDims.insert(shapeDims.end(), componentDims.begin(), componentDims.end());
-
-  const auto storeChunkShape = store.getChunkShape().value();
-  nx::core::HDF5::DatasetWriter::DimsType chunkDims(storeChunkShape.begin(), storeChunkShape.end());
+  using StorageType = std::conditional_t<std::is_same_v<T, bool>, uint8, T>;
+  constexpr usize k_TypeSize = sizeof(StorageType);
+  static_assert(sizeof(T) == k_TypeSize, "Compressed chunks require the stored type to match the in memory type");
 
-  usize rank = shapeDims.size();
+  const auto chunkShape = Compression::ComputeChunkShape(store.getTupleShape(), store.getComponentShape(), k_TypeSize, compression.targetChunkBytes);
+  Result<> result = datasetWriter.createCompressedDataset(Support::HdfTypeForPrimitive<StorageType>(), h5dims, chunkShape, compression);
+  if(result.invalid())
+  {
+    return result;
+  }
 
-  nx::core::HDF5::DatasetWriter::DimsType chunkLayout(rank);
+  // Only one dimension (splitIndex) is partially covered by a chunk, every faster dimension is whole
+  // and every slower dimension has a chunk extent of 1
+  const usize rank = h5dims.size();
+  usize splitIndex = 0;
   for(usize i = 0; i < rank; i++)
   {
-    const bool hasRemainder = (shapeDims[i] % chunkDims[i] != 0);
-    chunkLayout[i] = shapeDims[i] / chunkDims[i];
-    if(hasRemainder)
+    if(chunkShape[i] != h5dims[i])
     {
-      chunkLayout[i]++;
+      splitIndex = i;
     }
   }
+  usize innerSize = 1;
+  for(usize i = splitIndex + 1; i < rank; i++)
+  {
+    innerSize *= h5dims[i];
+  }
+  usize outerCount = 1;
+  for(usize i = 0; i < splitIndex; i++)
+  {
+    outerCount *= h5dims[i];
+  }
+  const usize splitDim = std::max<usize>(h5dims[splitIndex], 1);
+  const usize splitChunk = chunkShape[splitIndex];
+  const usize chunksPerOuter = (splitDim + splitChunk - 1) / splitChunk;
+  const usize chunkElements = splitChunk * innerSize;
+  const usize numChunks = outerCount * chunksPerOuter;
+
+  struct ChunkBuffer
+  {
+    std::vector<StorageType> staged;
+    std::vector<uint8> compressed;
+  };
 
-  IDataStore::ShapeType index(chunkDims.size());
-  std::fill(index.begin(), index.end(), 0);
+  ChunkWritePipeline pipeline;
+  if(!CanPrepareOffThread(store))
+  {
+    pipeline.setParallelizationEnabled(false);
+  }
 
-  return RecursivelyWriteChunks<T>(datasetWriter, store, h5dims, chunkDims, index, chunkLayout);
+  // HDF5 expects whole chunks, edge chunks are zero padded
+  auto prepareChunk = [&](usize chunkIndex, ChunkBuffer& buffer) -> Result<> {
+    const usize outerIndex = chunkIndex / chunksPerOuter;
+    const usize splitStart = (chunkIndex % chunksPerOuter) * splitChunk;
+    const usize count = std::min(splitChunk, splitDim - splitStart) * innerSize;
+    buffer.staged.assign(chunkElements, StorageType{});
+    Result<> stageResult = store.copyIntoBuffer((outerIndex * splitDim + splitStart) * innerSize, nonstd::span<T>(reinterpret_cast<T*>(buffer.staged.data()), count));
+    if(stageResult.invalid())
+    {
+      return stageResult;
+    }
+    return Compression::CompressChunk(compression, k_TypeSize, nonstd::span<const uint8>(reinterpret_cast<const uint8*>(buffer.staged.data()), buffer.staged.size() * k_TypeSize),
+                                      buffer.compressed);
+  };
+
+  std::vector<hsize_t> offset(rank, 0);
+  auto writeChunk = [&](usize chunkIndex, ChunkBuffer& buffer) -> Result<> {
+    usize outerIndex = chunkIndex / chunksPerOuter;
+    for(usize dim = splitIndex; dim-- > 0;)
+    {
+      offset[dim] = outerIndex % h5dims[dim];
+      outerIndex /= h5dims[dim];
+    }
+    offset[splitIndex] = (chunkIndex % chunksPerOuter) * splitChunk;
+    Result<> writeResult = datasetWriter.writeRawChunk(offset, buffer.compressed);
+    if(writeResult.invalid())
+    {
+      return writeResult;
+    }
+    statistics.storedBytes += buffer.compressed.size();
+    return {};
+  };
+
+  // Each buffer holds the staged chunk and at most about the same amount of compressed bytes
+  return pipeline.execute<ChunkBuffer>(numChunks, 2 * chunkElements * k_TypeSize, prepareChunk, writeChunk);
 }
 } // namespace Chunks
 
 /**
  * @brief Writes the data store to HDF5. Returns the HDF5 error code should
- * one be encountered. Otherwise, returns 0.
+ * one be encountered. Otherwise, returns 0. Empty stores and stores without
+ * a compression request keep their existing (contiguous or store chunked)
+ * layout, all others are written as compressed chunks.
  * @param datasetWriter
+ * @param dataStore
+ * @param compression
+ * @param statistics Optional accumulator for the written sizes and timing
  * @return H5::ErrorType
  */
 template <typename T>
-inline Result<> WriteDataStore(nx::core::HDF5::DatasetWriter& datasetWriter, const AbstractDataStore<T>& dataStore)
+inline Result<> WriteDataStore(nx::core::HDF5::DatasetWriter& datasetWriter, const AbstractDataStore<T>& dataStore, const CompressionSettings& compression = {},
+                               WriteStatistics* statistics = nullptr)
 {
   if(!datasetWriter.isValid())
   {
@@ -173,16 +250,36 @@ inline Result<> WriteDataStore(nx::core::HDF5::DatasetWriter& datasetWriter, con
     h5dims.push_back(static_cast<hsize_t>(value));
   }
 
-  if(dataStore.getChunkShape().has_value() == false)
+  const auto startTime = std::chrono::steady_clock::now();
+  WriteStatistics writeStatistics;
+  writeStatistics.uncompressedBytes = dataStore.getSize() * sizeof(T);
+
+  if(compression.isEnabled() && dataStore.getSize() > 0)
+  {
+    Result<> writeResult = Chunks::WriteCompressedDataStore<T>(datasetWriter, dataStore, h5dims, compression, writeStatistics);
+    if(writeResult.invalid())
+    {
+      return writeResult;
+    }
+  }
+  else if(dataStore.getChunkShape().has_value() == false)
   {
     usize count = dataStore.getSize();
-    auto dataPtr = std::make_unique<T[]>(count);
-    for(usize i = 0; i < count; ++i)
+    // Contiguous in memory stores are written without a staging copy
+    nonstd::span<const T> values = dataStore.getContiguousSpan();
+    std::unique_ptr<T[]> dataPtr;
+    if(values.data() == nullptr || values.size() != count)
     {
-      dataPtr[i] = dataStore[i];
+      dataPtr = std::make_unique<T[]>(count);
+      Result<> copyResult = dataStore.copyIntoBuffer(0, nonstd::span<T>{dataPtr.get(), count});
+      if(copyResult.invalid())
+      {
+        return copyResult;
+      }
+      values = nonstd::span<const T>{dataPtr.get(), count};
     }
 
-    Result<> result = datasetWriter.writeSpan(h5dims, nonstd::span<const T>{dataPtr.get(), count});
+    Result<> result = datasetWriter.writeSpan(h5dims, values);
     if(result.invalid())
     {
       std::string ss = "Failed to write DataStore span to Dataset";
@@ -197,6 +294,15 @@ inline Result<> WriteDataStore(nx::core::HDF5::DatasetWriter& datasetWriter, con
       return writeResult;
     }
   }
+  if(!compression.isEnabled() || dataStore.getSize() == 0)
+  {
+    writeStatistics.storedBytes = writeStatistics.uncompressedBytes;
+  }
+  writeStatistics.seconds = std::chrono::duration<float64>(std::chrono::steady_clock::now() - startTime).count();
+  if(statistics != nullptr)
+  {
+    *statistics += writeStatistics;
+  }
 
   // Write shape attributes to the dataset
   auto tupleAttribute = datasetWriter.createAttribute(IOConstants::k_TupleShapeTag);
@@ -6,6 +6,7 @@
 #include "simplnx/DataStructure/IO/HDF5/DataIOManager.hpp"
 #include "simplnx/DataStructure/IO/HDF5/IDataIO.hpp"
 #include "simplnx/DataStructure/IO/HDF5/IOUtilities.hpp"
+#include "simplnx/DataStructure/IO/HDF5/LazyDataStore.hpp"
 
 #include "fmt/format.h"
 
@@ -20,7 +21,7 @@ DataStructureReader::~DataStructureReader() noexcept = default;
 Result<DataStructure> DataStructureReader::ReadFile(const std::filesystem::path& path, bool useEmptyDataStores)
 {
   const nx::core::HDF5::FileReader fileReader(path);
-  return ReadFile(fileReader);
+  return ReadFile(fileReader, useEmptyDataStores);
 }
 Result<DataStructure> DataStructureReader::ReadFile(const nx::core::HDF5::FileReader& fileReader, bool useEmptyDataStores)
 {
@@ -29,6 +30,20 @@ Result<DataStructure> DataStructureReader::ReadFile(const nx::core::HDF5::FileRe
   return dataStructureReader.readGroup(groupReader, useEmptyDataStores);
 }
 
+Result<DataStructure> DataStructureReader::ReadFileLazily(const nx::core::HDF5::FileReader& fileReader)
+{
+  auto lazyDataSource = std::make_shared<const LazyDataSource>(fileReader.getName());
+  if(!lazyDataSource->isValid())
+  {
+    return MakeErrorResult<DataStructure>(-3, fmt::format("Failed to reopen '{}' for lazy reading", fileReader.getName()));
+  }
+
+  DataStructureReader dataStructureReader;
+  dataStructureReader.setLazyDataSource(std::move(lazyDataSource));
+  auto groupReader = fileReader.openGroup(Constants::k_DataStructureTag);
+  return dataStructureReader.readGroup(groupReader);
+}
+
 Result<DataStructure> DataStructureReader::readGroup(const nx::core::HDF5::GroupReader& groupReader, bool useEmptyDataStores)
 {
   clearDataStructure();
@@ -133,6 +148,16 @@ void DataStructureReader::clearDataStructure()
   m_CurrentStructure = DataStructure();
 }
 
+void DataStructureReader::setLazyDataSource(std::shared_ptr<const LazyDataSource> lazyDataSource)
+{
+  m_LazyDataSource = std::move(lazyDataSource);
+}
+
+std::shared_ptr<const LazyDataSource> DataStructureReader::getLazyDataSource() const
+{
+  return m_LazyDataSource;
+}
+
 std::shared_ptr<DataIOManager> DataStructureReader::getDataReader() const
 {
   if(m_IOManager != nullptr)
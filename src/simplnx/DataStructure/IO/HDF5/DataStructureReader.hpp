@@ -11,6 +11,7 @@ namespace nx::core::HDF5
 {
 class IDataIO;
 class DataIOManager;
+class LazyDataSource;
 
 /**
  * @brief The DataStructureReader class exists to read DataStructures from an HDF5 file or group.
@@ -37,6 +38,16 @@ public:
    */
   static Result<DataStructure> ReadFile(const nx::core::HDF5::FileReader& fileReader, bool useEmptyDataStores = false);
 
+  /**
+   * @brief Reads the DataStructure from the corresponding HDF5 file without reading
+   * any array values. DataArrays are created with LazyDataStores that read their
+   * values from the file the first time they are accessed. The file is kept open
+   * until every LazyDataStore is fully loaded or destroyed.
+   * @param fileReader
+   * @return Result<DataStructure>
+   */
+  static Result<DataStructure> ReadFileLazily(const nx::core::HDF5::FileReader& fileReader);
+
   /**
    * @brief Imports and returns a DataStructure from a target nx::core::HDF5::GroupReader.
    * Returns any HDF5 error code that occur by reference. Otherwise, this value
@@ -70,6 +81,20 @@ public:
    */
   void clearDataStructure();
 
+  /**
+   * @brief Sets the HDF5 source used to create LazyDataStores. DataArrays are read
+   * in full when no source is set.
+   * @param lazyDataSource
+   */
+  void setLazyDataSource(std::shared_ptr<const LazyDataSource> lazyDataSource);
+
+  /**
+   * @brief Returns the HDF5 source used to create LazyDataStores or nullptr if
+   * DataArrays are read in full.
+   * @return std::shared_ptr<const LazyDataSource>
+   */
+  std::shared_ptr<const LazyDataSource> getLazyDataSource() const;
+
 protected:
   /**
    * @brief Returns a pointer to the nx::core::HDF5::DataFactoryManager used for finding the
@@ -89,5 +114,6 @@ protected:
 private:
   std::shared_ptr<DataIOManager> m_IOManager = nullptr;
   DataStructure m_CurrentStructure;
+  std::shared_ptr<const LazyDataSource> m_LazyDataSource = nullptr;
 };
 } // namespace nx::core::HDF5
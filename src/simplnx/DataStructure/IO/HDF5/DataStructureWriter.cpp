@@ -20,7 +20,7 @@ DataStructureWriter::DataStructureWriter()
 
 DataStructureWriter::~DataStructureWriter() noexcept = default;
 
-Result<> DataStructureWriter::WriteFile(const DataStructure& dataStructure, const std::filesystem::path& filepath)
+Result<> DataStructureWriter::WriteFile(const DataStructure& dataStructure, const std::filesystem::path& filepath, const CompressionSettings& compression, WriteStatistics* statistics)
 {
   auto fileWriterResult = nx::core::HDF5::FileWriter::CreateFile(filepath);
   if(fileWriterResult.invalid())
@@ -29,14 +29,40 @@ Result<> DataStructureWriter::WriteFile(const DataStructure& dataStructure, cons
     return MakeErrorResult(error.code, error.message);
   }
   nx::core::HDF5::FileWriter fileWriter = std::move(fileWriterResult.value());
-  return WriteFile(dataStructure, fileWriter);
+  return WriteFile(dataStructure, fileWriter, compression, statistics);
 }
 
-Result<> DataStructureWriter::WriteFile(const DataStructure& dataStructure, nx::core::HDF5::FileWriter& fileWriter)
+Result<> DataStructureWriter::WriteFile(const DataStructure& dataStructure, nx::core::HDF5::FileWriter& fileWriter, const CompressionSettings& compression, WriteStatistics* statistics)
 {
   HDF5::DataStructureWriter dataStructureWriter;
+  dataStructureWriter.setCompressionSettings(compression);
   auto groupWriter = fileWriter.createGroupWriter(Constants::k_DataStructureTag);
-  return dataStructureWriter.writeDataStructure(dataStructure, groupWriter);
+  auto result = dataStructureWriter.writeDataStructure(dataStructure, groupWriter);
+  if(statistics != nullptr)
+  {
+    *statistics = dataStructureWriter.getWriteStatistics();
+  }
+  return result;
+}
+
+const CompressionSettings& DataStructureWriter::getCompressionSettings() const
+{
+  return m_CompressionSettings;
+}
+
+void DataStructureWriter::setCompressionSettings(const CompressionSettings& compression)
+{
+  m_CompressionSettings = compression;
+}
+
+WriteStatistics& DataStructureWriter::getWriteStatistics()
+{
+  return m_WriteStatistics;
+}
+
+const WriteStatistics& DataStructureWriter::getWriteStatistics() const
+{
+  return m_WriteStatistics;
 }
 
 Result<> DataStructureWriter::writeDataObject(const DataObject* dataObject, nx::core::HDF5::GroupWriter& parentGroup)
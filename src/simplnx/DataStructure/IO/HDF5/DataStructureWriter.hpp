@@ -3,6 +3,7 @@
 #include "simplnx/Common/Result.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
 #include "simplnx/DataStructure/IO/HDF5/IOUtilities.hpp"
+#include "simplnx/Utilities/Parsing/HDF5/H5Compression.hpp"
 #include "simplnx/Utilities/Parsing/HDF5/Writers/FileWriter.hpp"
 
 #include <filesystem>
@@ -35,8 +36,29 @@ public:
   DataStructureWriter();
   ~DataStructureWriter() noexcept;
 
-  static Result<> WriteFile(const DataStructure& dataStructure, const std::filesystem::path& filepath);
-  static Result<> WriteFile(const DataStructure& dataStructure, FileWriter& fileWriter);
+  static Result<> WriteFile(const DataStructure& dataStructure, const std::filesystem::path& filepath, const CompressionSettings& compression = {}, WriteStatistics* statistics = nullptr);
+  static Result<> WriteFile(const DataStructure& dataStructure, FileWriter& fileWriter, const CompressionSettings& compression = {}, WriteStatistics* statistics = nullptr);
+
+  /**
+   * @brief Returns the compression applied to DataStore datasets.
+   * @return const CompressionSettings&
+   */
+  const CompressionSettings& getCompressionSettings() const;
+
+  /**
+   * @brief Sets the compression applied to DataStore datasets written from
+   * this point on.
+   * @param compression
+   */
+  void setCompressionSettings(const CompressionSettings& compression);
+
+  /**
+   * @brief Returns the sizes and timing accumulated over every DataStore
+   * written so far.
+   * @return WriteStatistics&
+   */
+  WriteStatistics& getWriteStatistics();
+  const WriteStatistics& getWriteStatistics() const;
 
   /**
    * @brief Writes the DataObject under the given GroupWriter. If the
@@ -133,6 +155,8 @@ private:
   DataStructure m_DataStructure;
   DataMapType m_IdMap;
   std::shared_ptr<DataIOManager> m_IOManager;
+  CompressionSettings m_CompressionSettings;
+  WriteStatistics m_WriteStatistics;
 };
 } // namespace HDF5
 } // namespace nx::core
@@ -0,0 +1,79 @@
+#include "LazyDataStore.hpp"
+
+#include "simplnx/DataStructure/DataArray.hpp"
+
+namespace nx::core::HDF5
+{
+namespace
+{
+template <typename T>
+bool LoadLazyDataArrayImpl(IDataArray& dataArray)
+{
+  auto* typedArray = dynamic_cast<DataArray<T>*>(&dataArray);
+  if(typedArray == nullptr)
+  {
+    return false;
+  }
+  auto* lazyStore = dynamic_cast<LazyDataStore<T>*>(typedArray->getDataStore());
+  if(lazyStore == nullptr)
+  {
+    return false;
+  }
+  typedArray->setDataStore(std::shared_ptr<AbstractDataStore<T>>(lazyStore->releaseIntoDataStore()));
+  return true;
+}
+} // namespace
+
+LazyDataSource::LazyDataSource(const std::filesystem::path& filePath)
+: m_FilePath(filePath)
+{
+  std::lock_guard<std::recursive_mutex> lock(GetLibraryMutex());
+  m_FileReader = std::make_unique<FileReader>(m_FilePath);
+}
+
+LazyDataSource::~LazyDataSource() noexcept
+{
+  std::lock_guard<std::recursive_mutex> lock(GetLibraryMutex());
+  m_FileReader.reset();
+}
+
+bool LazyDataSource::isValid() const
+{
+  return m_FileReader != nullptr && m_FileReader->isValid();
+}
+
+const std::filesystem::path& LazyDataSource::getFilePath() const
+{
+  return m_FilePath;
+}
+
+bool LoadLazyDataArray(IDataArray& dataArray)
+{
+  switch(dataArray.getDataType())
+  {
+  case DataType::int8:
+    return LoadLazyDataArrayImpl<int8>(dataArray);
+  case DataType::int16:
+    return LoadLazyDataArrayImpl<int16>(dataArray);
+  case DataType::int32:
+    return LoadLazyDataArrayImpl<int32>(dataArray);
+  case DataType::int64:
+    return LoadLazyDataArrayImpl<int64>(dataArray);
+  case DataType::uint8:
+    return LoadLazyDataArrayImpl<uint8>(dataArray);
+  case DataType::uint16:
+    return LoadLazyDataArrayImpl<uint16>(dataArray);
+  case DataType::uint32:
+    return LoadLazyDataArrayImpl<uint32>(dataArray);
+  case DataType::uint64:
+    return LoadLazyDataArrayImpl<uint64>(dataArray);
+  case DataType::float32:
+    return LoadLazyDataArrayImpl<float32>(dataArray);
+  case DataType::float64:
+    return LoadLazyDataArrayImpl<float64>(dataArray);
+  case DataType::boolean:
+    return LoadLazyDataArrayImpl<bool>(dataArray);
+  }
+  return false;
+}
+} // namespace nx::core::HDF5
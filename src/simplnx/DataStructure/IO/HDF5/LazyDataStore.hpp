@@ -0,0 +1,632 @@
+#pragma once
+
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/Utilities/Parsing/HDF5/H5.hpp"
+#include "simplnx/Utilities/Parsing/HDF5/Readers/FileReader.hpp"
+
+#include "simplnx/simplnx_export.hpp"
+
+#include <fmt/core.h>
+#include <nonstd/span.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace nx::core
+{
+class IDataArray;
+
+namespace HDF5
+{
+/**
+ * @class LazyDataSource
+ * @brief The LazyDataSource class keeps an HDF5 file open for the LazyDataStores
+ * that were imported from it and reads hyperslabs of their datasets on request.
+ * Every read holds HDF5::GetLibraryMutex() because the HDF5 library is not
+ * guaranteed to be thread safe and reads may come from parallel algorithms.
+ */
+class SIMPLNX_EXPORT LazyDataSource
+{
+public:
+  /**
+   * @brief Opens the HDF5 file at the target path for reading.
+   * @param filePath
+   */
+  explicit LazyDataSource(const std::filesystem::path& filePath);
+
+  LazyDataSource(const LazyDataSource&) = delete;
+  LazyDataSource(LazyDataSource&&) noexcept = delete;
+  LazyDataSource& operator=(const LazyDataSource&) = delete;
+  LazyDataSource& operator=(LazyDataSource&&) noexcept = delete;
+
+  /**
+   * @brief Closes the HDF5 file.
+   */
+  ~LazyDataSource() noexcept;
+
+  /**
+   * @brief Returns true if the HDF5 file was opened successfully.
+   * @return bool
+   */
+  bool isValid() const;
+
+  /**
+   * @brief Returns the path of the HDF5 file.
+   * @return const std::filesystem::path&
+   */
+  const std::filesystem::path& getFilePath() const;
+
+  /**
+   * @brief Reads the hyperslab described by start and count from the dataset at
+   * datasetPath into values. The dataset path is relative to the file root.
+   * @param datasetPath
+   * @param values
+   * @param start
+   * @param count
+   * @return Result<>
+   */
+  template <typename T>
+  Result<> readHyperslab(const std::string& datasetPath, nonstd::span<T> values, const std::vector<hsize_t>& start, const std::vector<hsize_t>& count) const
+  {
+    std::lock_guard<std::recursive_mutex> lock(GetLibraryMutex());
+    if(m_FileReader == nullptr || !m_FileReader->isValid())
+    {
+      return MakeErrorResult(-1060, fmt::format("LazyDataSource: The HDF5 file '{}' is not open", m_FilePath.string()));
+    }
+    DatasetReader datasetReader = m_FileReader->openDataset(datasetPath);
+    if(!datasetReader.isValid())
+    {
+      return MakeErrorResult(-1061, fmt::format("LazyDataSource: Could not open dataset '{}' in '{}'", datasetPath, m_FilePath.string()));
+    }
+    return datasetReader.readIntoSpan(values, start, count);
+  }
+
+private:
+  std::filesystem::path m_FilePath;
+  std::unique_ptr<FileReader> m_FileReader;
+};
+
+/**
+ * @class LazyDataStore
+ * @brief The LazyDataStore class is an in-memory store whose values are
+ * read from an HDF5 dataset the first time they are accessed. The store is
+ * divided into blocks of whole rows of the slowest tuple dimension and each
+ * block is read with a single hyperslab selection, so only the parts of an
+ * array that a pipeline touches are ever read from disk or committed to memory.
+ *
+ * Values can be modified; the modifications are kept in memory and are never
+ * written back to the source file. Blocks are loaded under a lock, so the
+ * store can be accessed from parallel algorithms.
+ *
+ * The store reports StoreType::Lazy since it is not a DataStore<T>. Code that
+ * needs a DataStore<T> (e.g. to wrap its buffer) must replace it with
+ * LoadLazyDataArray() first.
+ * @tparam T
+ */
+template <typename T>
+class LazyDataStore : public AbstractDataStore<T>
+{
+public:
+  using parent_type = AbstractDataStore<T>;
+  using value_type = typename AbstractDataStore<T>::value_type;
+  using reference = typename AbstractDataStore<T>::reference;
+  using const_reference = typename AbstractDataStore<T>::const_reference;
+  using ShapeType = typename IDataStore::ShapeType;
+
+  /**
+   * @brief The approximate size of each block read from the HDF5 dataset.
+   */
+  static inline constexpr usize k_TargetBlockBytes = 4 * 1024 * 1024;
+
+  /**
+   * @brief Constructs a LazyDataStore for the dataset at datasetPath. No values are
+   * read until they are accessed.
+   * @param source The open HDF5 file the dataset is read from
+   * @param datasetPath The dataset path relative to the file root
+   * @param tupleShape The dimensions of the tuples
+   * @param componentShape The dimensions of the component at each tuple
+   */
+  LazyDataStore(std::shared_ptr<const LazyDataSource> source, std::string datasetPath, const ShapeType& tupleShape, const ShapeType& componentShape)
+  : parent_type()
+  , m_ComponentShape(componentShape)
+  , m_TupleShape(tupleShape)
+  , m_NumComponents(std::accumulate(m_ComponentShape.cbegin(), m_ComponentShape.cend(), static_cast<usize>(1), std::multiplies<>()))
+  , m_NumTuples(std::accumulate(m_TupleShape.cbegin(), m_TupleShape.cend(), static_cast<usize>(1), std::multiplies<>()))
+  , m_Source(std::move(source))
+  , m_DatasetPath(std::move(datasetPath))
+  {
+    const usize size = this->getSize();
+    // Default initialized so that pages of blocks that are never loaded are never committed
+    m_Data = std::unique_ptr<T[]>(new T[size]);
+
+    if(size == 0 || m_TupleShape.empty())
+    {
+      markFullyLoaded();
+      return;
+    }
+
+    const usize rowValues = size / m_TupleShape[0];
+    const usize rowBytes = std::max(rowValues * sizeof(T), static_cast<usize>(1));
+    m_RowsPerBlock = std::clamp(k_TargetBlockBytes / rowBytes, static_cast<usize>(1), m_TupleShape[0]);
+    m_ValuesPerBlock = m_RowsPerBlock * rowValues;
+    m_NumBlocks = (m_TupleShape[0] + m_RowsPerBlock - 1) / m_RowsPerBlock;
+    m_BlockLoaded = std::make_unique<std::atomic_bool[]>(m_NumBlocks);
+    for(usize i = 0; i < m_NumBlocks; i++)
+    {
+      m_BlockLoaded[i] = false;
+    }
+  }
+
+  /**
+   * @brief Copy constructor. Copies the blocks that are already loaded and shares
+   * the HDF5 source for the rest.
+   * @param other
+   */
+  LazyDataStore(const LazyDataStore& other)
+  : parent_type()
+  , m_ComponentShape(other.m_ComponentShape)
+  , m_TupleShape(other.m_TupleShape)
+  , m_NumComponents(other.m_NumComponents)
+  , m_NumTuples(other.m_NumTuples)
+  , m_DatasetPath(other.m_DatasetPath)
+  {
+    std::lock_guard<std::mutex> lock(other.m_LoadMutex);
+    const usize size = this->getSize();
+    m_Data = std::unique_ptr<T[]>(new T[size]);
+    m_Source = other.m_Source;
+    m_RowsPerBlock = other.m_RowsPerBlock;
+    m_ValuesPerBlock = other.m_ValuesPerBlock;
+    m_NumBlocks = other.m_NumBlocks;
+    if(other.m_FullyLoaded)
+    {
+      std::copy_n(other.m_Data.get(), size, m_Data.get());
+      markFullyLoaded();
+      return;
+    }
+
+    m_NumLoadedBlocks = other.m_NumLoadedBlocks.load();
+    m_BlockLoaded = std::make_unique<std::atomic_bool[]>(m_NumBlocks);
+    for(usize i = 0; i < m_NumBlocks; i++)
+    {
+      const bool loaded = other.m_BlockLoaded[i].load();
+      m_BlockLoaded[i] = loaded;
+      if(loaded)
+      {
+        const usize start = i * m_ValuesPerBlock;
+        std::copy_n(other.m_Data.get() + start, std::min(m_ValuesPerBlock, size - start), m_Data.get() + start);
+      }
+    }
+  }
+
+  LazyDataStore(LazyDataStore&& other) noexcept = delete;
+  LazyDataStore& operator=(const LazyDataStore& rhs) = delete;
+  LazyDataStore& operator=(LazyDataStore&& rhs) noexcept = delete;
+
+  ~LazyDataStore() override = default;
+
+  /**
+   * @brief Returns the number of tuples in the DataStore.
+   * @return usize
+   */
+  usize getNumberOfTuples() const override
+  {
+    return m_NumTuples;
+  }
+
+  /**
+   * @brief Returns the number of elements in each Tuple.
+   * @return usize
+   */
+  usize getNumberOfComponents() const override
+  {
+    return m_NumComponents;
+  }
+
+  /**
+   * @brief Returns the dimensions of the Tuples
+   * @return
+   */
+  const ShapeType& getTupleShape() const override
+  {
+    return m_TupleShape;
+  }
+
+  /**
+   * @brief Returns the dimensions of the Components
+   * @return
+   */
+  const ShapeType& getComponentShape() const override
+  {
+    return m_ComponentShape;
+  }
+
+  /**
+   * @brief The values are held in memory once loaded, but the store is not a DataStore<T>.
+   * @return StoreType
+   */
+  IDataStore::StoreType getStoreType() const override
+  {
+    return IDataStore::StoreType::Lazy;
+  }
+
+  /**
+   * @brief Returns the path of the source dataset relative to the HDF5 file root.
+   * @return const std::string&
+   */
+  const std::string& getDatasetPath() const
+  {
+    return m_DatasetPath;
+  }
+
+  /**
+   * @brief Returns true once every value has been read from the HDF5 dataset.
+   * @return bool
+   */
+  bool isFullyLoaded() const
+  {
+    return m_FullyLoaded.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Returns the number of blocks read from the HDF5 dataset so far.
+   * @return usize
+   */
+  usize getNumberOfLoadedBlocks() const
+  {
+    return isFullyLoaded() ? m_NumBlocks : m_NumLoadedBlocks.load();
+  }
+
+  /**
+   * @brief Returns the number of blocks the store is divided into.
+   * @return usize
+   */
+  usize getNumberOfBlocks() const
+  {
+    return m_NumBlocks;
+  }
+
+  /**
+   * @brief Reads every block that has not been loaded yet.
+   */
+  void loadAll() const
+  {
+    loadRange(0, this->getSize());
+  }
+
+  /**
+   * @brief Reads all remaining values and moves them into a DataStore. This store is
+   * left empty and must not be used afterwards.
+   * @return std::unique_ptr<DataStore<T>>
+   */
+  std::unique_ptr<DataStore<T>> releaseIntoDataStore()
+  {
+    loadAll();
+    auto dataStore = std::make_unique<DataStore<T>>(std::move(m_Data), m_TupleShape, m_ComponentShape);
+    m_TupleShape = {0};
+    m_NumTuples = 0;
+    return dataStore;
+  }
+
+  /**
+   * @brief Returns a span over the values once every block has been loaded.
+   * Returns an empty span otherwise so that callers fall back to copyIntoBuffer
+   * and only read the blocks they need.
+   * @return nonstd::span<T>
+   */
+  nonstd::span<T> getContiguousSpan() override
+  {
+    if(!isFullyLoaded())
+    {
+      return {};
+    }
+    return {m_Data.get(), this->getSize()};
+  }
+
+  nonstd::span<const T> getContiguousSpan() const override
+  {
+    if(!isFullyLoaded())
+    {
+      return {};
+    }
+    return {m_Data.get(), this->getSize()};
+  }
+
+  Result<> copyIntoBuffer(usize startIndex, nonstd::span<T> buffer) const override
+  {
+    if(startIndex + buffer.size() > this->getSize())
+    {
+      return MakeErrorResult(-14603, fmt::format("Unable to copy {} values starting at index {} from a data store of size {}.", buffer.size(), startIndex, this->getSize()));
+    }
+    loadRange(startIndex, buffer.size());
+    std::copy_n(m_Data.get() + startIndex, buffer.size(), buffer.begin());
+    return {};
+  }
+
+  Result<> copyFromBuffer(usize startIndex, nonstd::span<const T> buffer) override
+  {
+    if(startIndex + buffer.size() > this->getSize())
+    {
+      return MakeErrorResult(-14604, fmt::format("Unable to copy {} values starting at index {} into a data store of size {}.", buffer.size(), startIndex, this->getSize()));
+    }
+    loadRange(startIndex, buffer.size());
+    std::copy(buffer.begin(), buffer.end(), m_Data.get() + startIndex);
+    return {};
+  }
+
+  /**
+   * @brief Resizes the store to the new tuple shape. All values are loaded first
+   * and the HDF5 source is released.
+   * @param tupleShape
+   */
+  void resizeTuples(const ShapeType& tupleShape) override
+  {
+    loadAll();
+    const usize oldSize = this->getSize();
+    m_TupleShape = tupleShape;
+    m_NumTuples = std::accumulate(m_TupleShape.cbegin(), m_TupleShape.cend(), static_cast<usize>(1), std::multiplies<>());
+    const usize newSize = this->getSize();
+    if(newSize == oldSize)
+    {
+      return;
+    }
+
+    auto data = std::make_unique<T[]>(newSize);
+    std::copy_n(m_Data.get(), std::min(oldSize, newSize), data.get());
+    m_Data = std::move(data);
+  }
+
+  /**
+   * @brief Returns the value found at the specified index of the DataStore.
+   * @param index
+   * @return value_type
+   */
+  value_type getValue(usize index) const override
+  {
+    ensureLoaded(index);
+    return m_Data[index];
+  }
+
+  /**
+   * @brief Sets the value stored at the specified index.
+   * @param index
+   * @param value
+   */
+  void setValue(usize index, value_type value) override
+  {
+    ensureLoaded(index);
+    m_Data[index] = value;
+  }
+
+  /**
+   * @brief Returns the value found at the specified index of the DataStore.
+   * @param index
+   * @return const_reference
+   */
+  const_reference operator[](usize index) const override
+  {
+    ensureLoaded(index);
+    return m_Data[index];
+  }
+
+  /**
+   * @brief Returns the value found at the specified index of the DataStore.
+   * This can be used to edit the value found at the specified index.
+   * @param index
+   * @return reference
+   */
+  reference operator[](usize index) override
+  {
+    ensureLoaded(index);
+    return m_Data[index];
+  }
+
+  /**
+   * @brief Returns the value found at the specified index of the DataStore.
+   * Throws a std::runtime_error if the index is out of range.
+   * @param index
+   * @return const_reference
+   */
+  const_reference at(usize index) const override
+  {
+    if(index >= this->getSize())
+    {
+      throw std::runtime_error(fmt::format("LazyDataStore: Index {} is out of range for a store of size {}", index, this->getSize()));
+    }
+    ensureLoaded(index);
+    return m_Data[index];
+  }
+
+  /**
+   * @brief Fills the AbstractDataStore with the specified value. Nothing is read
+   * from the HDF5 dataset since every value is overwritten.
+   * @param value
+   */
+  void fill(value_type value) override
+  {
+    std::lock_guard<std::mutex> lock(m_LoadMutex);
+    std::fill_n(m_Data.get(), this->getSize(), value);
+    markFullyLoaded();
+  }
+
+  /**
+   * @brief Returns a deep copy of the data store. Blocks that have not been loaded
+   * yet are read from the same HDF5 file by the copy.
+   * @return std::unique_ptr<IDataStore>
+   */
+  std::unique_ptr<IDataStore> deepCopy() const override
+  {
+    return std::make_unique<LazyDataStore<T>>(*this);
+  }
+
+  /**
+   * @brief Returns an in-memory DataStore with the same shape and default initialized data.
+   * @return std::unique_ptr<IDataStore>
+   */
+  std::unique_ptr<IDataStore> createNewInstance() const override
+  {
+    return std::make_unique<DataStore<T>>(this->getTupleShape(), this->getComponentShape(), static_cast<T>(0));
+  }
+
+  /**
+   * @brief Returns the memory committed for the blocks loaded so far.
+   * @return uint64
+   */
+  uint64 memoryUsage() const override
+  {
+    const usize size = this->getSize();
+    if(isFullyLoaded())
+    {
+      return size * sizeof(T);
+    }
+    return std::min(m_NumLoadedBlocks.load() * m_ValuesPerBlock, size) * sizeof(T);
+  }
+
+  std::pair<int32, std::string> writeBinaryFile(const std::string& absoluteFilePath) const override
+  {
+    std::ofstream outStrm(absoluteFilePath, std::ios_base::out | std::ios_base::binary);
+    if(!outStrm.is_open())
+    {
+      return {-10170, fmt::format("File could not be opened for writing:\n  '{}'", absoluteFilePath)};
+    }
+
+    return writeBinaryFile(outStrm);
+  }
+
+  std::pair<int32, std::string> writeBinaryFile(std::ostream& outputStream) const override
+  {
+    loadAll();
+    const usize totalElements = this->getSize();
+    outputStream.write(reinterpret_cast<const char*>(m_Data.get()), sizeof(T) * totalElements);
+    if(outputStream.bad())
+    {
+      return {-10175, fmt::format("Error writing binary file:\n  Total Elements:'{}'\n", totalElements)};
+    }
+
+    return {0, ""};
+  }
+
+private:
+  /**
+   * @brief Marks every block as loaded and releases the HDF5 source. The caller
+   * must hold m_LoadMutex unless the store is still being constructed.
+   */
+  void markFullyLoaded() const
+  {
+    m_Source.reset();
+    m_FullyLoaded.store(true, std::memory_order_release);
+  }
+
+  /**
+   * @brief Makes sure the block containing index has been read. The fast path is a
+   * single atomic load once the store is fully loaded.
+   * @param index
+   */
+  void ensureLoaded(usize index) const
+  {
+    if(m_FullyLoaded.load(std::memory_order_acquire))
+    {
+      return;
+    }
+    const usize block = index / m_ValuesPerBlock;
+    if(!m_BlockLoaded[block].load(std::memory_order_acquire))
+    {
+      loadBlock(block);
+    }
+  }
+
+  /**
+   * @brief Makes sure every block overlapping [startIndex, startIndex + count) has been read.
+   * @param startIndex
+   * @param count
+   */
+  void loadRange(usize startIndex, usize count) const
+  {
+    if(count == 0 || m_FullyLoaded.load(std::memory_order_acquire))
+    {
+      return;
+    }
+    const usize firstBlock = startIndex / m_ValuesPerBlock;
+    const usize lastBlock = (startIndex + count - 1) / m_ValuesPerBlock;
+    for(usize block = firstBlock; block <= lastBlock; block++)
+    {
+      if(!m_BlockLoaded[block].load(std::memory_order_acquire))
+      {
+        loadBlock(block);
+      }
+    }
+  }
+
+  /**
+   * @brief Reads a single block from the HDF5 dataset. Throws a std::runtime_error
+   * if the read fails.
+   * @param block
+   */
+  void loadBlock(usize block) const
+  {
+    std::lock_guard<std::mutex> lock(m_LoadMutex);
+    if(m_FullyLoaded.load(std::memory_order_relaxed) || m_BlockLoaded[block].load(std::memory_order_relaxed))
+    {
+      return;
+    }
+
+    const usize firstRow = block * m_RowsPerBlock;
+    const usize rowCount = std::min(m_RowsPerBlock, m_TupleShape[0] - firstRow);
+    const usize valuesPerRow = m_ValuesPerBlock / m_RowsPerBlock;
+
+    std::vector<hsize_t> start(m_TupleShape.size() + m_ComponentShape.size(), 0);
+    std::vector<hsize_t> count;
+    count.reserve(start.size());
+    count.push_back(static_cast<hsize_t>(rowCount));
+    count.insert(count.end(), m_TupleShape.cbegin() + 1, m_TupleShape.cend());
+    count.insert(count.end(), m_ComponentShape.cbegin(), m_ComponentShape.cend());
+    start[0] = static_cast<hsize_t>(firstRow);
+
+    nonstd::span<T> values(m_Data.get() + firstRow * valuesPerRow, rowCount * valuesPerRow);
+    Result<> result = m_Source->readHyperslab(m_DatasetPath, values, start, count);
+    if(result.invalid())
+    {
+      throw std::runtime_error(fmt::format("Error reading rows [{}, {}) of '{}' from '{}':\n\n{}", firstRow, firstRow + rowCount, m_DatasetPath, m_Source->getFilePath().string(),
+                                           result.errors()[0].message));
+    }
+
+    m_BlockLoaded[block].store(true, std::memory_order_release);
+    if(++m_NumLoadedBlocks == m_NumBlocks)
+    {
+      markFullyLoaded();
+    }
+  }
+
+  ShapeType m_ComponentShape;
+  ShapeType m_TupleShape;
+  usize m_NumComponents = {0};
+  usize m_NumTuples = {0};
+  mutable std::shared_ptr<const LazyDataSource> m_Source;
+  std::string m_DatasetPath;
+  std::unique_ptr<T[]> m_Data;
+  usize m_RowsPerBlock = {0};
+  usize m_ValuesPerBlock = {1};
+  usize m_NumBlocks = {0};
+  mutable std::unique_ptr<std::atomic_bool[]> m_BlockLoaded;
+  mutable std::atomic<usize> m_NumLoadedBlocks = {0};
+  mutable std::atomic_bool m_FullyLoaded = {false};
+  mutable std::mutex m_LoadMutex;
+};
+
+/**
+ * @brief Replaces a LazyDataStore held by the DataArray with an in-memory DataStore
+ * containing all of its values. Does nothing for any other kind of store.
+ * @param dataArray
+ * @return bool True if the store was replaced
+ */
+SIMPLNX_EXPORT bool LoadLazyDataArray(IDataArray& dataArray);
+} // namespace HDF5
+} // namespace nx::core
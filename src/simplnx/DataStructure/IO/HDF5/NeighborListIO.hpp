@@ -21,17 +21,29 @@ public:
   using data_type = NeighborList<T>;
   using shared_vector_type = typename data_type::SharedVectorType;
 
+  /**
+   * @brief Values and list offsets of a NeighborList in the compact layout.
+   */
+  struct CompactData
+  {
+    std::vector<T> values;
+    std::vector<usize> offsets;
+  };
+
   NeighborListIO() = default;
   ~NeighborListIO() noexcept override = default;
 
   /**
-   * @brief Attempts to read the NeighborList<T> data from HDF5.
-   * Returns a Result<> with any errors or warnings encountered during the process.
+   * @brief Reads the NeighborList<T> values and offsets from HDF5. The linear
+   * dataset is read directly into the compact values buffer and the offsets
+   * are computed from the linked NumNeighbors dataset.
+   * Throws a std::runtime_error if the dataset holds fewer values than the
+   * NumNeighbors dataset requires.
    * @param parentGroup
    * @param dataReader
-   * @return Result<>
+   * @return CompactData
    */
-  static std::vector<shared_vector_type> ReadHdf5Data(const nx::core::HDF5::GroupReader& parentGroup, const nx::core::HDF5::DatasetReader& dataReader)
+  static CompactData ReadHdf5CompactData(const nx::core::HDF5::GroupReader& parentGroup, const nx::core::HDF5::DatasetReader& dataReader)
   {
     auto numNeighborsAttributeName = dataReader.getAttribute("Linked NumNeighbors Dataset");
     auto numNeighborsName = numNeighborsAttributeName.readAsString();
@@ -41,26 +53,40 @@ public:
     auto numNeighborsPtr = DataStoreIO::ReadDataStore<int32>(numNeighborsReader);
     auto& numNeighborsStore = *numNeighborsPtr.get();
 
-    std::vector<T> flatDataStore = dataReader.template readAsVector<T>();
-    if(flatDataStore.empty())
+    CompactData compactData;
+    const auto numTuples = numNeighborsStore.getNumberOfTuples();
+    compactData.offsets.resize(numTuples + 1, 0);
+    for(usize i = 0; i < numTuples; i++)
+    {
+      compactData.offsets[i + 1] = compactData.offsets[i] + static_cast<usize>(numNeighborsStore[i]);
+    }
+
+    compactData.values = dataReader.template readAsVector<T>();
+    if(compactData.values.size() < compactData.offsets.back())
     {
       throw std::runtime_error(fmt::format("Error reading neighbor list from DataStore from HDF5 at {}/{}", nx::core::HDF5::Support::GetObjectPath(dataReader.getParentId()), dataReader.getName()));
     }
+    compactData.values.resize(compactData.offsets.back());
 
-    std::vector<shared_vector_type> dataVector;
-    usize offset = 0;
-    const auto numTuples = numNeighborsStore.getNumberOfTuples();
+    return compactData;
+  }
+
+  /**
+   * @brief Attempts to read the NeighborList<T> data from HDF5.
+   * Returns a Result<> with any errors or warnings encountered during the process.
+   * @param parentGroup
+   * @param dataReader
+   * @return Result<>
+   */
+  static std::vector<shared_vector_type> ReadHdf5Data(const nx::core::HDF5::GroupReader& parentGroup, const nx::core::HDF5::DatasetReader& dataReader)
+  {
+    CompactData compactData = ReadHdf5CompactData(parentGroup, dataReader);
+
+    const usize numTuples = compactData.offsets.size() - 1;
+    std::vector<shared_vector_type> dataVector(numTuples);
     for(usize i = 0; i < numTuples; i++)
     {
-      const auto numNeighbors = numNeighborsStore[i];
-      auto sharedVector = std::make_shared<std::vector<T>>(numNeighbors);
-      std::vector<T>& vector = *sharedVector.get();
-
-      size_t neighborListStart = offset;
-      size_t neighborListEnd = offset + numNeighbors;
-      sharedVector->assign(flatDataStore.begin() + neighborListStart, flatDataStore.begin() + neighborListEnd);
-      offset += numNeighbors;
-      dataVector.push_back(sharedVector);
+      dataVector[i] = std::make_shared<std::vector<T>>(compactData.values.begin() + compactData.offsets[i], compactData.values.begin() + compactData.offsets[i + 1]);
     }
 
     return dataVector;
@@ -81,8 +107,8 @@ public:
                     const std::optional<DataObject::IdType>& parentId, bool useEmptyDataStore = false) const override
   {
     auto datasetReader = parentGroup.openDataset(objectName);
-    auto dataVector = ReadHdf5Data(parentGroup, datasetReader);
-    auto* dataObject = data_type::Import(dataStructureReader.getDataStructure(), objectName, importId, dataVector, parentId);
+    auto compactData = ReadHdf5CompactData(parentGroup, datasetReader);
+    auto* dataObject = data_type::ImportCompact(dataStructureReader.getDataStructure(), objectName, importId, std::move(compactData.values), std::move(compactData.offsets), parentId);
     if(dataObject == nullptr)
     {
       std::string ss = "Failed to import NeighborList from HDF5";
@@ -104,14 +130,13 @@ public:
     DataStructure tmp;
 
     // Create NumNeighbors DataStore
-    const auto& neighborData = neighborList.getValues();
-    const usize arraySize = neighborData.size();
+    const usize arraySize = neighborList.getNumberOfLists();
     auto* numNeighborsArray = Int32Array::CreateWithStore<Int32DataStore>(tmp, neighborList.getNumNeighborsArrayName(), std::vector<usize>{arraySize}, std::vector<usize>{1});
     auto& numNeighborsStore = numNeighborsArray->getDataStoreRef();
     usize totalItems = 0;
     for(usize i = 0; i < arraySize; i++)
     {
-      const auto numNeighbors = neighborData[i]->size();
+      const auto numNeighbors = neighborList.getListSpan(i).size();
       numNeighborsStore[i] = static_cast<int32>(numNeighbors);
       totalItems += numNeighbors;
     }
@@ -124,27 +149,28 @@ public:
       return result;
     }
 
-    // Create flattened neighbor DataStore
+    // Create flattened neighbor DataStore. Compact NeighborLists already use the dataset layout.
     DataStore<T> flattenedData(totalItems, static_cast<T>(0));
-    usize offset = 0;
-    for(const auto& segment : neighborData)
+    nonstd::span<T> flattenedSpan = flattenedData.createSpan();
+    if(neighborList.isCompact())
     {
-      usize numElements = segment->size();
-      if(numElements == 0)
-      {
-        continue;
-      }
-      T* start = segment->data();
-      for(usize i = 0; i < numElements; i++)
+      nonstd::span<const T> compactValues = neighborList.getCompactValues();
+      std::copy(compactValues.begin(), compactValues.end(), flattenedSpan.begin());
+    }
+    else
+    {
+      usize offset = 0;
+      for(usize i = 0; i < arraySize; i++)
       {
-        flattenedData[offset + i] = start[i];
+        nonstd::span<const T> list = neighborList.getListSpan(i);
+        std::copy(list.begin(), list.end(), flattenedSpan.begin() + offset);
+        offset += list.size();
       }
-      offset += numElements;
     }
 
     // Write flattened array to HDF5 as a separate array
     auto datasetWriter = parentGroupWriter.createDatasetWriter(neighborList.getName());
-    Result<> flattenedResult = DataStoreIO::WriteDataStore<T>(datasetWriter, flattenedData);
+    Result<> flattenedResult = DataStoreIO::WriteDataStore<T>(datasetWriter, flattenedData, dataStructureWriter.getCompressionSettings(), &dataStructureWriter.getWriteStatistics());
     if(flattenedResult.invalid())
     {
       return flattenedResult;
@@ -0,0 +1,445 @@
+#pragma once
+
+#include "simplnx/Common/StringLiteral.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/Utilities/MemoryMappedFile.hpp"
+
+#include <fmt/core.h>
+#include <nonstd/span.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @class MmapDataStore
+ * @brief The MmapDataStore class stores its values in a sparse scratch file
+ * that is memory mapped into the address space of the process. The operating
+ * system pages the data in and out as required, which allows arrays that are
+ * larger than the available physical memory to be processed with the same
+ * random access semantics as the in-memory DataStore.
+ *
+ * Unlike other out-of-core formats the mapped memory can be accessed from any
+ * number of threads, so parallel algorithms are not disabled for this format.
+ * @tparam T
+ */
+template <typename T>
+class MmapDataStore : public AbstractDataStore<T>
+{
+public:
+  using parent_type = AbstractDataStore<T>;
+  using value_type = typename AbstractDataStore<T>::value_type;
+  using reference = typename AbstractDataStore<T>::reference;
+  using const_reference = typename AbstractDataStore<T>::const_reference;
+  using ShapeType = typename IDataStore::ShapeType;
+
+  static inline constexpr StringLiteral k_DataFormat = "MemoryMapped";
+
+  /**
+   * @brief The approximate size of each chunk reported by getChunkShape().
+   */
+  static inline constexpr usize k_TargetChunkBytes = 4 * 1024 * 1024;
+
+  /**
+   * @brief Constructs a MmapDataStore backed by a new scratch file created inside scratchDirectory.
+   * Newly mapped pages read as zero, so the values are only explicitly filled when a non-zero initValue is given.
+   * @param tupleShape The dimensions of the tuples
+   * @param componentShape The dimensions of the component at each tuple
+   * @param initValue
+   * @param scratchDirectory
+   */
+  MmapDataStore(const ShapeType& tupleShape, const ShapeType& componentShape, std::optional<T> initValue, const std::filesystem::path& scratchDirectory)
+  : parent_type()
+  , m_ComponentShape(componentShape)
+  , m_TupleShape(tupleShape)
+  , m_NumComponents(std::accumulate(m_ComponentShape.cbegin(), m_ComponentShape.cend(), static_cast<usize>(1), std::multiplies<>()))
+  , m_NumTuples(std::accumulate(m_TupleShape.cbegin(), m_TupleShape.cend(), static_cast<usize>(1), std::multiplies<>()))
+  , m_InitValue(initValue)
+  , m_ScratchDirectory(scratchDirectory)
+  , m_File(std::make_unique<MemoryMappedFile>(scratchDirectory, m_NumTuples * m_NumComponents * sizeof(T)))
+  {
+    if(m_InitValue.has_value() && *m_InitValue != static_cast<T>(0))
+    {
+      std::fill_n(data(), this->getSize(), *m_InitValue);
+    }
+  }
+
+  /**
+   * @brief Copy constructor. Creates a new scratch file in the same directory.
+   * @param other
+   */
+  MmapDataStore(const MmapDataStore& other)
+  : parent_type()
+  , m_ComponentShape(other.m_ComponentShape)
+  , m_TupleShape(other.m_TupleShape)
+  , m_NumComponents(other.m_NumComponents)
+  , m_NumTuples(other.m_NumTuples)
+  , m_InitValue(other.m_InitValue)
+  , m_ScratchDirectory(other.m_ScratchDirectory)
+  , m_File(std::make_unique<MemoryMappedFile>(other.m_ScratchDirectory, other.m_File->size()))
+  {
+    if(m_File->size() > 0)
+    {
+      std::memcpy(m_File->data(), other.m_File->data(), m_File->size());
+    }
+  }
+
+  /**
+   * @brief Move constructor
+   * @param other
+   */
+  MmapDataStore(MmapDataStore&& other) noexcept = default;
+
+  MmapDataStore& operator=(const MmapDataStore& rhs) = delete;
+  MmapDataStore& operator=(MmapDataStore&& rhs) noexcept = default;
+
+  ~MmapDataStore() override = default;
+
+  /**
+   * @brief Returns the number of tuples in the DataStore.
+   * @return usize
+   */
+  usize getNumberOfTuples() const override
+  {
+    return m_NumTuples;
+  }
+
+  /**
+   * @brief Returns the number of elements in each Tuple.
+   * @return usize
+   */
+  usize getNumberOfComponents() const override
+  {
+    return m_NumComponents;
+  }
+
+  /**
+   * @brief Returns the dimensions of the Tuples
+   * @return
+   */
+  const ShapeType& getTupleShape() const override
+  {
+    return m_TupleShape;
+  }
+
+  /**
+   * @brief Returns the dimensions of the Components
+   * @return
+   */
+  const ShapeType& getComponentShape() const override
+  {
+    return m_ComponentShape;
+  }
+
+  /**
+   * @brief Returns the store type e.g. in memory, out of core, etc.
+   * @return StoreType
+   */
+  IDataStore::StoreType getStoreType() const override
+  {
+    return IDataStore::StoreType::OutOfCore;
+  }
+
+  /**
+   * @brief Returns the data format used for storing the array data.
+   * @return data format as string
+   */
+  std::string getDataFormat() const override
+  {
+    return k_DataFormat.str();
+  }
+
+  /**
+   * @brief Returns the pointer to the mapped data. Const version
+   * @return
+   */
+  const T* data() const
+  {
+    return static_cast<const T*>(m_File->data());
+  }
+
+  /**
+   * @brief Returns the pointer to the mapped data. Non-const version
+   * @return
+   */
+  T* data()
+  {
+    return static_cast<T*>(m_File->data());
+  }
+
+  nonstd::span<T> createSpan()
+  {
+    return {data(), this->getSize()};
+  }
+
+  nonstd::span<const T> createSpan() const
+  {
+    return {data(), this->getSize()};
+  }
+
+  nonstd::span<T> getContiguousSpan() override
+  {
+    return createSpan();
+  }
+
+  nonstd::span<const T> getContiguousSpan() const override
+  {
+    return createSpan();
+  }
+
+  /**
+   * @brief Resizes the backing file to hold the new tuple shape. Existing values
+   * are preserved up to the smaller of the two sizes and any new values are set
+   * to the initialization value.
+   * @param tupleShape
+   */
+  void resizeTuples(const ShapeType& tupleShape) override
+  {
+    const usize oldSize = this->getSize();
+    m_TupleShape = tupleShape;
+    m_NumTuples = std::accumulate(m_TupleShape.cbegin(), m_TupleShape.cend(), static_cast<usize>(1), std::multiplies<>());
+    const usize newSize = this->getSize();
+    if(newSize == oldSize)
+    {
+      return;
+    }
+
+    m_File->resize(newSize * sizeof(T));
+    if(newSize > oldSize && m_InitValue.has_value() && *m_InitValue != static_cast<T>(0))
+    {
+      std::fill(data() + oldSize, data() + newSize, *m_InitValue);
+    }
+  }
+
+  /**
+   * @brief Returns the value found at the specified index of the DataStore.
+   * @param index
+   * @return value_type
+   */
+  value_type getValue(usize index) const override
+  {
+    return data()[index];
+  }
+
+  /**
+   * @brief Sets the value stored at the specified index.
+   * @param index
+   * @param value
+   */
+  void setValue(usize index, value_type value) override
+  {
+    data()[index] = value;
+  }
+
+  /**
+   * @brief Returns the value found at the specified index of the DataStore.
+   * @param index
+   * @return const_reference
+   */
+  const_reference operator[](usize index) const override
+  {
+    return data()[index];
+  }
+
+  /**
+   * @brief Returns the value found at the specified index of the DataStore.
+   * This can be used to edit the value found at the specified index.
+   * @param index
+   * @return reference
+   */
+  reference operator[](usize index) override
+  {
+    return data()[index];
+  }
+
+  /**
+   * @brief Returns the value found at the specified index of the DataStore.
+   * Throws a std::runtime_error if the index is out of range.
+   * @param index
+   * @return const_reference
+   */
+  const_reference at(usize index) const override
+  {
+    if(index >= this->getSize())
+    {
+      throw std::runtime_error(fmt::format("MmapDataStore: Index {} is out of range for a store of size {}", index, this->getSize()));
+    }
+    return data()[index];
+  }
+
+  /**
+   * @brief Fills the AbstractDataStore with the specified value.
+   * @param value
+   */
+  void fill(value_type value) override
+  {
+    std::fill_n(data(), this->getSize(), value);
+  }
+
+  /**
+   * @brief Returns a deep copy of the data store and all its data.
+   * @return std::unique_ptr<IDataStore>
+   */
+  std::unique_ptr<IDataStore> deepCopy() const override
+  {
+    return std::make_unique<MmapDataStore<T>>(*this);
+  }
+
+  /**
+   * @brief Returns a data store of the same type as this but with default initialized data.
+   * @return std::unique_ptr<IDataStore>
+   */
+  std::unique_ptr<IDataStore> createNewInstance() const override
+  {
+    return std::make_unique<MmapDataStore<T>>(this->getTupleShape(), this->getComponentShape(), static_cast<T>(0), m_ScratchDirectory);
+  }
+
+  /**
+   * @brief Returns the chunk shape used when writing the store to a chunked format.
+   * Chunks span the full extent of every dimension except the slowest tuple dimension
+   * so that each chunk is a single contiguous region of the mapping.
+   * @return optional ShapeType
+   */
+  std::optional<ShapeType> getChunkShape() const override
+  {
+    if(m_TupleShape.empty() || this->getSize() == 0)
+    {
+      return {};
+    }
+
+    ShapeType chunkShape = m_TupleShape;
+    chunkShape.insert(chunkShape.end(), m_ComponentShape.begin(), m_ComponentShape.end());
+    chunkShape[0] = rowsPerChunk();
+    return chunkShape;
+  }
+
+  /**
+   * @brief Returns the values for the chunk at the given chunk position. The returned
+   * vector always holds a full chunk; values past the end of the store are zero filled.
+   * @param chunkPosition
+   * @return std::vector<T>
+   */
+  std::vector<T> getChunkValues(const ShapeType& chunkPosition) const override
+  {
+    if(chunkPosition.empty() || this->getSize() == 0)
+    {
+      return {};
+    }
+    for(usize i = 1; i < chunkPosition.size(); i++)
+    {
+      if(chunkPosition[i] != 0)
+      {
+        return {};
+      }
+    }
+
+    const usize valuesPerRow = rowSize();
+    const usize chunkRows = rowsPerChunk();
+    const usize startRow = chunkPosition[0] * chunkRows;
+    if(startRow >= m_TupleShape[0])
+    {
+      return {};
+    }
+
+    const usize rowCount = std::min(chunkRows, m_TupleShape[0] - startRow);
+    std::vector<T> values(chunkRows * valuesPerRow, static_cast<T>(0));
+    const T* begin = data() + startRow * valuesPerRow;
+    std::copy(begin, begin + rowCount * valuesPerRow, values.begin());
+    return values;
+  }
+
+  /**
+   * @brief Writes all modified pages back to the scratch file using msync.
+   */
+  void flush() const override
+  {
+    m_File->flush();
+  }
+
+  /**
+   * @brief The mapped pages are owned by the operating system's page cache and
+   * do not count against the in-memory DataStructure budget.
+   * @return uint64
+   */
+  uint64 memoryUsage() const override
+  {
+    return 0;
+  }
+
+  std::pair<int32, std::string> writeBinaryFile(const std::string& absoluteFilePath) const override
+  {
+    std::ofstream outStrm(absoluteFilePath, std::ios_base::out | std::ios_base::binary);
+    if(!outStrm.is_open())
+    {
+      return {-10170, fmt::format("File could not be opened for writing:\n  '{}'", absoluteFilePath)};
+    }
+
+    return writeBinaryFile(outStrm);
+  }
+
+  std::pair<int32, std::string> writeBinaryFile(std::ostream& outputStream) const override
+  {
+    const usize totalElements = this->getSize();
+    outputStream.write(reinterpret_cast<const char*>(data()), sizeof(T) * totalElements);
+    if(outputStream.bad())
+    {
+      return {-10175, fmt::format("Error writing binary file:\n  Total Elements:'{}'\n", totalElements)};
+    }
+
+    return {0, ""};
+  }
+
+private:
+  /**
+   * @brief Returns the number of values in a single index of the slowest tuple dimension.
+   * @return usize
+   */
+  usize rowSize() const
+  {
+    const usize rowTuples = std::accumulate(m_TupleShape.cbegin() + 1, m_TupleShape.cend(), static_cast<usize>(1), std::multiplies<>());
+    return rowTuples * m_NumComponents;
+  }
+
+  /**
+   * @brief Returns the number of slowest-dimension rows that fit in k_TargetChunkBytes.
+   * @return usize
+   */
+  usize rowsPerChunk() const
+  {
+    const usize rowBytes = std::max(rowSize() * sizeof(T), static_cast<usize>(1));
+    return std::clamp(k_TargetChunkBytes / rowBytes, static_cast<usize>(1), std::max(m_TupleShape[0], static_cast<usize>(1)));
+  }
+
+  ShapeType m_ComponentShape;
+  ShapeType m_TupleShape;
+  usize m_NumComponents = {0};
+  usize m_NumTuples = {0};
+  std::optional<T> m_InitValue;
+  std::filesystem::path m_ScratchDirectory;
+  std::unique_ptr<MemoryMappedFile> m_File;
+};
+
+// Declare aliases
+using UInt8MmapDataStore = MmapDataStore<uint8>;
+using UInt16MmapDataStore = MmapDataStore<uint16>;
+using UInt32MmapDataStore = MmapDataStore<uint32>;
+using UInt64MmapDataStore = MmapDataStore<uint64>;
+
+using Int8MmapDataStore = MmapDataStore<int8>;
+using Int16MmapDataStore = MmapDataStore<int16>;
+using Int32MmapDataStore = MmapDataStore<int32>;
+using Int64MmapDataStore = MmapDataStore<int64>;
+
+using BoolMmapDataStore = MmapDataStore<bool>;
+
+using Float32MmapDataStore = MmapDataStore<float32>;
+using Float64MmapDataStore = MmapDataStore<float64>;
+} // namespace nx::core
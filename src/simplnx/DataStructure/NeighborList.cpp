@@ -4,6 +4,10 @@
 #include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
 
+#include <fmt/format.h>
+
+#include <algorithm>
+
 namespace nx::core
 {
 template <typename T>
@@ -23,6 +27,34 @@ NeighborList<T>::NeighborList(DataStructure& dataStructure, const std::string& n
 {
 }
 
+template <typename T>
+NeighborList<T>::NeighborList(DataStructure& dataStructure, const std::string& name, usize numTuples, IdType importId)
+: INeighborList(dataStructure, name, numTuples, importId)
+, m_IsAllocated(false)
+, m_InitValue(static_cast<T>(0.0))
+{
+}
+
+template <typename T>
+NeighborList<T>::NeighborList(const NeighborList& other)
+: INeighborList(other)
+, m_IsAllocated(other.m_IsAllocated)
+, m_InitValue(other.m_InitValue)
+{
+  std::lock_guard<std::mutex> lock(other.m_ListsMutex);
+  m_CompactStorage = other.m_CompactStorage;
+  if(m_CompactStorage != nullptr)
+  {
+    // Lists created from the compact storage are rebuilt so converting this copy cannot edit the other's lists
+    m_ListsValid = false;
+    m_OwnsLists = false;
+  }
+  else
+  {
+    m_Array = other.m_Array;
+  }
+}
+
 template <typename T>
 NeighborList<T>* NeighborList<T>::Create(DataStructure& dataStructure, const std::string& name, usize numTuples, const std::optional<IdType>& parentId)
 {
@@ -45,6 +77,19 @@ NeighborList<T>* NeighborList<T>::Import(DataStructure& dataStructure, const std
   return data.get();
 }
 
+template <typename T>
+NeighborList<T>* NeighborList<T>::ImportCompact(DataStructure& dataStructure, const std::string& name, IdType importId, std::vector<T> values, std::vector<usize> offsets,
+                                                const std::optional<IdType>& parentId)
+{
+  auto data = std::shared_ptr<NeighborList>(new NeighborList(dataStructure, name, offsets.empty() ? 0 : offsets.size() - 1, importId));
+  data->setCompactData(std::move(values), std::move(offsets));
+  if(!AttemptToAddObject(dataStructure, data, parentId))
+  {
+    return nullptr;
+  }
+  return data.get();
+}
+
 template <typename T>
 DataObject* NeighborList<T>::shallowCopy()
 {
@@ -62,13 +107,19 @@ std::shared_ptr<DataObject> NeighborList<T>::deepCopy(const DataPath& copyPath)
   // Don't construct with identifier since it will get created when inserting into data structure
   auto copy = std::shared_ptr<NeighborList<T>>(new NeighborList<T>(dataStruct, copyPath.getTargetName(), getNumberOfTuples()));
   copy->setNumNeighborsArrayName(getNumNeighborsArrayName());
-  copy->m_Array.reserve(m_Array.size());
-  for(usize i = 0; i < m_Array.size(); ++i)
+  if(m_CompactStorage != nullptr)
+  {
+    // Compact storage is never modified in place so the copy can share it
+    copy->m_CompactStorage = m_CompactStorage;
+    copy->m_ListsValid = false;
+    copy->m_OwnsLists = false;
+  }
+  else
   {
-    copy->m_Array.push_back(std::make_shared<VectorType>(m_Array[i]->size()));
-    for(usize j = 0; j < m_Array[i]->size(); ++j)
+    copy->m_Array.reserve(m_Array.size());
+    for(usize i = 0; i < m_Array.size(); ++i)
     {
-      (*copy->m_Array[i])[j] = (*m_Array[i])[j];
+      copy->m_Array.push_back(std::make_shared<VectorType>(*m_Array[i]));
     }
   }
   if(dataStruct.insert(copy, copyPath.getParent()))
@@ -78,6 +129,22 @@ std::shared_ptr<DataObject> NeighborList<T>::deepCopy(const DataPath& copyPath)
   return nullptr;
 }
 
+template <typename T>
+void NeighborList<T>::makeUnique()
+{
+  if(!m_OwnsLists.load(std::memory_order_acquire))
+  {
+    return;
+  }
+  for(auto& list : m_Array)
+  {
+    if(list != nullptr)
+    {
+      list = std::make_shared<VectorType>(*list);
+    }
+  }
+}
+
 template <typename T>
 void NeighborList<T>::setInitValue(value_type initValue)
 {
@@ -101,7 +168,8 @@ int32 NeighborList<T>::eraseTuples(const std::vector<usize>& idxs)
     return 0;
   }
 
-  usize arraySize = m_Array.size();
+  auto& lists = getMutableLists();
+  usize arraySize = lists.size();
   // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
   // off the end of the array and return an error code.
   for(usize idx : idxs)
@@ -120,7 +188,7 @@ int32 NeighborList<T>::eraseTuples(const std::vector<usize>& idxs)
   {
     if(dIdx != idxs[idxsIndex])
     {
-      replacement[rIdx] = m_Array[dIdx];
+      replacement[rIdx] = lists[dIdx];
       ++rIdx;
     }
     else
@@ -132,20 +200,25 @@ int32 NeighborList<T>::eraseTuples(const std::vector<usize>& idxs)
       }
     }
   }
-  m_Array = replacement;
-  setNumberOfTuples(m_Array.size());
+  lists = replacement;
+  setNumberOfTuples(lists.size());
   return err;
 }
 
 template <typename T>
 void NeighborList<T>::copyTuple(usize currentPos, usize newPos)
 {
-  m_Array[newPos] = m_Array[currentPos];
+  auto& lists = getMutableLists();
+  lists[newPos] = lists[currentPos];
 }
 
 template <typename T>
 usize NeighborList<T>::getSize() const
 {
+  if(m_CompactStorage != nullptr)
+  {
+    return m_CompactStorage->values.size();
+  }
   usize total = 0;
   for(usize dIdx = 0; dIdx < m_Array.size(); ++dIdx)
   {
@@ -157,12 +230,7 @@ usize NeighborList<T>::getSize() const
 template <typename T>
 usize NeighborList<T>::size() const
 {
-  usize total = 0;
-  for(usize dIdx = 0; dIdx < m_Array.size(); ++dIdx)
-  {
-    total += m_Array[dIdx]->size();
-  }
-  return total;
+  return getSize();
 }
 
 template <typename T>
@@ -186,13 +254,17 @@ usize NeighborList<T>::getTypeSize() const
 template <typename T>
 void NeighborList<T>::initializeWithZeros()
 {
+  m_CompactStorage.reset();
   m_Array.clear();
+  m_ListsValid = true;
+  m_OwnsLists = true;
   m_IsAllocated = false;
 }
 
 template <typename T>
 int32 NeighborList<T>::resizeTotalElements(usize size)
 {
+  getMutableLists();
   usize old = m_Array.size();
   m_Array.resize(size);
   setNumberOfTuples(size);
@@ -224,6 +296,7 @@ void NeighborList<T>::resizeTuples(usize numTuples)
 template <typename T>
 void NeighborList<T>::addEntry(int32 grainId, value_type value)
 {
+  getMutableLists();
   if(grainId >= static_cast<int32>(m_Array.size()))
   {
     usize old = m_Array.size();
@@ -242,13 +315,17 @@ void NeighborList<T>::addEntry(int32 grainId, value_type value)
 template <typename T>
 void NeighborList<T>::clearAllLists()
 {
+  m_CompactStorage.reset();
   m_Array.clear();
+  m_ListsValid = true;
+  m_OwnsLists = true;
   m_IsAllocated = false;
 }
 
 template <typename T>
 void NeighborList<T>::setList(int32 grainId, const SharedVectorType& neighborList)
 {
+  getMutableLists();
   if(grainId >= static_cast<int32>(m_Array.size()))
   {
     usize old = m_Array.size();
@@ -266,68 +343,85 @@ void NeighborList<T>::setList(int32 grainId, const SharedVectorType& neighborLis
 template <typename T>
 T NeighborList<T>::getValue(int32 grainId, int32 index, bool& ok) const
 {
-  SharedVectorType vec = m_Array[grainId];
-  if(index < 0 || static_cast<usize>(index) >= vec->size())
+  nonstd::span<const T> list = getListSpan(grainId);
+  if(index < 0 || static_cast<usize>(index) >= list.size())
   {
     ok = false;
     return static_cast<T>(-1);
   }
-  return (*vec)[index];
+  return list[index];
 }
 
 template <typename T>
 int32 NeighborList<T>::getNumberOfLists() const
 {
+  if(m_CompactStorage != nullptr)
+  {
+    return static_cast<int32>(m_CompactStorage->offsets.size() - 1);
+  }
   return static_cast<int32>(m_Array.size());
 }
 
 template <typename T>
 int32 NeighborList<T>::getListSize(int32 grainId) const
 {
-  return static_cast<int32>(m_Array[grainId]->size());
+  return static_cast<int32>(getListSpan(grainId).size());
+}
+
+template <typename T>
+typename NeighborList<T>::VectorType& NeighborList<T>::getListReference(int32 grainId)
+{
+  return *(getMutableLists()[grainId]);
+}
+
+template <typename T>
+const typename NeighborList<T>::VectorType& NeighborList<T>::getListReference(int32 grainId) const
+{
+  return *(getLists()[grainId]);
 }
 
 template <typename T>
-typename NeighborList<T>::VectorType& NeighborList<T>::getListReference(int32 grainId) const
+typename NeighborList<T>::SharedVectorType NeighborList<T>::getList(int32 grainId)
 {
-  return *(m_Array[grainId]);
+  return getMutableLists()[grainId];
 }
 
 template <typename T>
-typename NeighborList<T>::SharedVectorType NeighborList<T>::getList(int32 grainId) const
+typename NeighborList<T>::ConstSharedVectorType NeighborList<T>::getList(int32 grainId) const
 {
-  return m_Array[grainId];
+  return getLists()[grainId];
 }
 
 template <typename T>
 typename NeighborList<T>::VectorType NeighborList<T>::copyOfList(int32 grainId) const
 {
-  VectorType copy(*(m_Array[grainId]));
+  nonstd::span<const T> list = getListSpan(grainId);
+  VectorType copy(list.begin(), list.end());
   return copy;
 }
 
 template <typename T>
 typename NeighborList<T>::VectorType& NeighborList<T>::operator[](int32 grainId)
 {
-  return *(m_Array[grainId]);
+  return *(getMutableLists()[grainId]);
 }
 
 template <typename T>
 typename NeighborList<T>::VectorType& NeighborList<T>::operator[](usize grainId)
 {
-  return *(m_Array[grainId]);
+  return *(getMutableLists()[grainId]);
 }
 
 template <typename T>
 const typename NeighborList<T>::VectorType& NeighborList<T>::at(int32 grainId) const
 {
-  return *(m_Array[grainId]);
+  return *(getLists()[grainId]);
 }
 
 template <typename T>
 const typename NeighborList<T>::VectorType& NeighborList<T>::at(usize grainId) const
 {
-  return *(m_Array[grainId]);
+  return *(getLists()[grainId]);
 }
 
 template <typename T>
@@ -344,45 +438,192 @@ void NeighborList<T>::resizeTuples(const std::vector<usize>& tupleShape)
 }
 
 template <typename T>
-const std::vector<typename NeighborList<T>::SharedVectorType>& NeighborList<T>::getValues() const
+std::vector<typename NeighborList<T>::ConstSharedVectorType> NeighborList<T>::getValues() const
+{
+  const auto& lists = getLists();
+  return std::vector<ConstSharedVectorType>(lists.cbegin(), lists.cend());
+}
+
+template <typename T>
+nonstd::span<const T> NeighborList<T>::getListSpan(usize listIndex) const
+{
+  if(m_CompactStorage != nullptr)
+  {
+    const auto& offsets = m_CompactStorage->offsets;
+    return nonstd::span<const T>(m_CompactStorage->values.data() + offsets[listIndex], offsets[listIndex + 1] - offsets[listIndex]);
+  }
+  const VectorType& list = *(m_Array[listIndex]);
+  return nonstd::span<const T>(list.data(), list.size());
+}
+
+template <typename T>
+bool NeighborList<T>::isCompact() const
 {
+  return m_CompactStorage != nullptr;
+}
+
+template <typename T>
+void NeighborList<T>::compact()
+{
+  if(m_CompactStorage == nullptr)
+  {
+    std::vector<usize> offsets(m_Array.size() + 1, 0);
+    for(usize i = 0; i < m_Array.size(); i++)
+    {
+      offsets[i + 1] = offsets[i] + m_Array[i]->size();
+    }
+    std::vector<T> values(offsets.back());
+    for(usize i = 0; i < m_Array.size(); i++)
+    {
+      std::copy(m_Array[i]->begin(), m_Array[i]->end(), values.begin() + offsets[i]);
+    }
+    auto storage = std::make_shared<CompactStorage>();
+    storage->values = std::move(values);
+    storage->offsets = std::move(offsets);
+    m_CompactStorage = std::move(storage);
+  }
+  m_Array.clear();
+  m_Array.shrink_to_fit();
+  m_ListsValid = false;
+  m_OwnsLists = false;
+}
+
+template <typename T>
+void NeighborList<T>::setCompactData(std::vector<T> values, std::vector<usize> offsets)
+{
+  if(offsets.empty() || offsets.front() != 0 || offsets.back() != values.size() || !std::is_sorted(offsets.cbegin(), offsets.cend()))
+  {
+    throw std::runtime_error(fmt::format("{}:({}): NeighborList offsets do not describe the {} compact values", __FILE__, __LINE__, values.size()));
+  }
+  auto storage = std::make_shared<CompactStorage>();
+  storage->values = std::move(values);
+  storage->offsets = std::move(offsets);
+  const usize numLists = storage->offsets.size() - 1;
+  m_CompactStorage = std::move(storage);
+  m_Array.clear();
+  m_ListsValid = false;
+  m_OwnsLists = false;
+  m_IsAllocated = numLists > 0;
+  setNumberOfTuples(numLists);
+}
+
+template <typename T>
+nonstd::span<const T> NeighborList<T>::getCompactValues() const
+{
+  if(m_CompactStorage == nullptr)
+  {
+    return {};
+  }
+  return nonstd::span<const T>(m_CompactStorage->values.data(), m_CompactStorage->values.size());
+}
+
+template <typename T>
+nonstd::span<const usize> NeighborList<T>::getCompactOffsets() const
+{
+  if(m_CompactStorage == nullptr)
+  {
+    return {};
+  }
+  return nonstd::span<const usize>(m_CompactStorage->offsets.data(), m_CompactStorage->offsets.size());
+}
+
+template <typename T>
+uint64 NeighborList<T>::memoryUsage() const
+{
+  if(m_CompactStorage != nullptr)
+  {
+    return m_CompactStorage->values.capacity() * sizeof(T) + m_CompactStorage->offsets.capacity() * sizeof(usize);
+  }
+  // Every list is a separate allocation with its own vector and reference count
+  uint64 total = m_Array.capacity() * sizeof(SharedVectorType);
+  for(const auto& list : m_Array)
+  {
+    total += sizeof(VectorType) + list->capacity() * sizeof(T);
+  }
+  return total;
+}
+
+template <typename T>
+void NeighborList<T>::createListsLocked() const
+{
+  if(m_ListsValid.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+  const usize numLists = m_CompactStorage->offsets.size() - 1;
+  m_Array.resize(numLists);
+  for(usize i = 0; i < numLists; i++)
+  {
+    nonstd::span<const T> list = getListSpan(i);
+    m_Array[i] = std::make_shared<VectorType>(list.begin(), list.end());
+  }
+  m_ListsValid.store(true, std::memory_order_release);
+}
+
+template <typename T>
+const std::vector<typename NeighborList<T>::SharedVectorType>& NeighborList<T>::getLists() const
+{
+  if(m_ListsValid.load(std::memory_order_acquire))
+  {
+    return m_Array;
+  }
+  std::lock_guard<std::mutex> lock(m_ListsMutex);
+  createListsLocked();
+  return m_Array;
+}
+
+template <typename T>
+std::vector<typename NeighborList<T>::SharedVectorType>& NeighborList<T>::getMutableLists()
+{
+  // Concurrent callers editing different lists only take the lock for the one time conversion
+  if(m_OwnsLists.load(std::memory_order_acquire))
+  {
+    return m_Array;
+  }
+  std::lock_guard<std::mutex> lock(m_ListsMutex);
+  if(!m_OwnsLists.load(std::memory_order_relaxed))
+  {
+    createListsLocked();
+    m_CompactStorage.reset();
+    m_OwnsLists.store(true, std::memory_order_release);
+  }
   return m_Array;
 }
 
 template <typename T>
 typename NeighborList<T>::iterator NeighborList<T>::begin()
 {
-  return m_Array.begin();
+  return getMutableLists().begin();
 }
 
 template <typename T>
 typename NeighborList<T>::iterator NeighborList<T>::end()
 {
-  return m_Array.end();
+  return getMutableLists().end();
 }
 
 template <typename T>
 typename NeighborList<T>::const_iterator NeighborList<T>::begin() const
 {
-  return m_Array.begin();
+  return const_iterator(getLists().cbegin());
 }
 
 template <typename T>
 typename NeighborList<T>::const_iterator NeighborList<T>::end() const
 {
-  return m_Array.end();
+  return const_iterator(getLists().cend());
 }
 
 template <typename T>
 typename NeighborList<T>::const_iterator NeighborList<T>::cbegin() const
 {
-  return m_Array.begin();
+  return const_iterator(getLists().cbegin());
 }
 
 template <typename T>
 typename NeighborList<T>::const_iterator NeighborList<T>::cend() const
 {
-  return m_Array.end();
+  return const_iterator(getLists().cend());
 }
 
 template <>
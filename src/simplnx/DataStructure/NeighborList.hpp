@@ -4,6 +4,14 @@
 #include "simplnx/Common/Types.hpp"
 #include "simplnx/DataStructure/INeighborList.hpp"
 
+#include <nonstd/span.hpp>
+
+#include <atomic>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+
 namespace nx::core
 {
 namespace NeighborListConstants
@@ -13,7 +21,17 @@ inline constexpr StringLiteral k_TypeName = "NeighborList<T>";
 
 /**
  * @class NeighborList
- * @brief
+ * @brief Stores a variable length list of values for every tuple.
+ *
+ * The lists are either kept as one vector per tuple or in a compact
+ * (compressed sparse row) layout where all values share one contiguous buffer
+ * and an offsets array marks where each list starts. Compact storage is read
+ * only: getListSpan(), getListSize(), getValue() and copyOfList() read it
+ * directly, while any non-const method handing out a vector converts the
+ * NeighborList back to one vector per tuple first. Const accessors that return
+ * vectors (getList(), getListReference(), at(), getValues(), the const
+ * iterators) only hand out const lists so they cannot be edited behind the
+ * compact storage.
  * @tparam T
  */
 template <class T>
@@ -23,11 +41,152 @@ public:
   using value_type = T;
   using VectorType = std::vector<T>;
   using SharedVectorType = std::shared_ptr<VectorType>;
+  using ConstSharedVectorType = std::shared_ptr<const VectorType>;
   using iterator = typename std::vector<SharedVectorType>::iterator;
-  using const_iterator = typename std::vector<SharedVectorType>::const_iterator;
+
+  /**
+   * @brief Read only iterator over the lists. Dereferencing returns a pointer
+   * to a const list.
+   */
+  class const_iterator
+  {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = ConstSharedVectorType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const ConstSharedVectorType*;
+    using reference = ConstSharedVectorType;
+
+    const_iterator() = default;
+    explicit const_iterator(typename std::vector<SharedVectorType>::const_iterator iter)
+    : m_Iter(iter)
+    {
+    }
+
+    reference operator*() const
+    {
+      return *m_Iter;
+    }
+
+    const_iterator& operator++()
+    {
+      ++m_Iter;
+      return *this;
+    }
+
+    const_iterator operator++(int)
+    {
+      const_iterator copy = *this;
+      ++m_Iter;
+      return copy;
+    }
+
+    bool operator==(const const_iterator& rhs) const
+    {
+      return m_Iter == rhs.m_Iter;
+    }
+
+    bool operator!=(const const_iterator& rhs) const
+    {
+      return m_Iter != rhs.m_Iter;
+    }
+
+  private:
+    typename std::vector<SharedVectorType>::const_iterator m_Iter;
+  };
+
+  /**
+   * @brief Assembles the compact storage of a NeighborList without allocating
+   * a vector for every list. Record the size of every list with setListSize(),
+   * call allocate(), fill each list through getListSpan() and hand the values
+   * to the NeighborList with commit(). setListSize() and getListSpan() may be
+   * called concurrently for different lists.
+   */
+  class Builder
+  {
+  public:
+    /**
+     * @brief Constructs a Builder for numLists lists that are all empty.
+     * @param numLists
+     */
+    explicit Builder(usize numLists)
+    : m_Offsets(numLists + 1, 0)
+    {
+    }
+
+    /**
+     * @brief Returns the number of lists being built.
+     * @return usize
+     */
+    usize getNumberOfLists() const
+    {
+      return m_Offsets.size() - 1;
+    }
+
+    /**
+     * @brief Sets the number of values in the target list. Must be called before allocate().
+     * @param listIndex
+     * @param size
+     */
+    void setListSize(usize listIndex, usize size)
+    {
+      m_Offsets[listIndex + 1] = size;
+    }
+
+    /**
+     * @brief Computes the list offsets and allocates the values buffer.
+     */
+    void allocate()
+    {
+      if(m_IsAllocated)
+      {
+        throw std::runtime_error("NeighborList::Builder::allocate() may only be called once");
+      }
+      std::partial_sum(m_Offsets.begin(), m_Offsets.end(), m_Offsets.begin());
+      m_Values.assign(m_Offsets.back(), static_cast<T>(0));
+      m_IsAllocated = true;
+    }
+
+    /**
+     * @brief Returns the writable values of the target list. Only valid after allocate().
+     * @param listIndex
+     * @return nonstd::span<T>
+     */
+    nonstd::span<T> getListSpan(usize listIndex)
+    {
+      return nonstd::span<T>(m_Values.data() + m_Offsets[listIndex], m_Offsets[listIndex + 1] - m_Offsets[listIndex]);
+    }
+
+    /**
+     * @brief Moves the built lists into the NeighborList. The Builder is empty afterwards.
+     * @param neighborList
+     */
+    void commit(NeighborList& neighborList)
+    {
+      if(!m_IsAllocated)
+      {
+        allocate();
+      }
+      neighborList.setCompactData(std::move(m_Values), std::move(m_Offsets));
+      m_Offsets = {0};
+      m_IsAllocated = false;
+    }
+
+  private:
+    std::vector<T> m_Values;
+    std::vector<usize> m_Offsets;
+    bool m_IsAllocated = false;
+  };
 
   NeighborList() = default;
 
+  /**
+   * @brief Copies the lists of another NeighborList. List vectors and compact
+   * storage are shared with the other NeighborList, matching shallowCopy().
+   * @param other
+   */
+  NeighborList(const NeighborList& other);
+
   /**
    * @brief
    * @param dataStructure
@@ -50,6 +209,21 @@ public:
    */
   static NeighborList* Import(DataStructure& dataStructure, const std::string& name, IdType importId, const std::vector<SharedVectorType>& data, const std::optional<IdType>& parentId = {});
 
+  /**
+   * @brief Imports a NeighborList that uses the compact layout. The offsets
+   * hold the start of every list followed by the total number of values.
+   * Throws a std::runtime_error if the offsets do not describe the values.
+   * @param dataStructure
+   * @param name
+   * @param importId
+   * @param values
+   * @param offsets
+   * @param parentId
+   * @return NeighborList<T>*
+   */
+  static NeighborList* ImportCompact(DataStructure& dataStructure, const std::string& name, IdType importId, std::vector<T> values, std::vector<usize> offsets,
+                                     const std::optional<IdType>& parentId = {});
+
   ~NeighborList() override = default;
 
   /**
@@ -66,6 +240,12 @@ public:
    */
   std::shared_ptr<DataObject> deepCopy(const DataPath& copyPath) override;
 
+  /**
+   * @brief Replaces the list vectors shared with other shallow copies by copies
+   * of their own. Compact storage is never modified in place and stays shared.
+   */
+  void makeUnique() override;
+
   /**
    * @brief Gives this array a human readable name
    * @param name The name of this array
@@ -198,18 +378,85 @@ public:
   int32 getListSize(int32 grainId) const;
 
   /**
-   * @brief Returns a reference to the target grain ID's data.
+   * @brief Returns a modifiable reference to the target grain ID's data.
+   * Compact NeighborLists are converted to one vector per list first.
    * @param grainId
    * @return VectorType&
    */
-  VectorType& getListReference(int32 grainId) const;
+  VectorType& getListReference(int32 grainId);
 
   /**
-   * @brief getList
+   * @brief Returns a read only reference to the target grain ID's data. For
+   * compact NeighborLists the reference is to a copy of the list.
+   * @param grainId
+   * @return const VectorType&
+   */
+  const VectorType& getListReference(int32 grainId) const;
+
+  /**
+   * @brief Returns a read only view of the target list. This does not allocate
+   * or convert the storage and is safe to call from multiple threads.
+   * @param listIndex
+   * @return nonstd::span<const T>
+   */
+  nonstd::span<const T> getListSpan(usize listIndex) const;
+
+  /**
+   * @brief Returns true if the lists are stored in the compact layout.
+   * @return bool
+   */
+  bool isCompact() const;
+
+  /**
+   * @brief Moves all lists into the compact layout, releasing the vector of
+   * every list.
+   */
+  void compact();
+
+  /**
+   * @brief Replaces all lists with the compact values and offsets. The offsets
+   * hold the start of every list followed by the total number of values.
+   * Throws a std::runtime_error if the offsets do not describe the values.
+   * @param values
+   * @param offsets
+   */
+  void setCompactData(std::vector<T> values, std::vector<usize> offsets);
+
+  /**
+   * @brief Returns the values of all lists in the compact layout or an empty
+   * span if the NeighborList is not compact.
+   * @return nonstd::span<const T>
+   */
+  nonstd::span<const T> getCompactValues() const;
+
+  /**
+   * @brief Returns the compact list offsets (number of lists + 1 entries) or an
+   * empty span if the NeighborList is not compact.
+   * @return nonstd::span<const usize>
+   */
+  nonstd::span<const usize> getCompactOffsets() const;
+
+  /**
+   * @brief Returns the number of bytes used by the stored values.
+   * @return uint64
+   */
+  uint64 memoryUsage() const override;
+
+  /**
+   * @brief Returns the modifiable list for the target grain ID. Compact
+   * NeighborLists are converted to one vector per list first.
    * @param grainId
    * @return SharedVectorType
    */
-  SharedVectorType getList(int32 grainId) const;
+  SharedVectorType getList(int32 grainId);
+
+  /**
+   * @brief Returns the read only list for the target grain ID. For compact
+   * NeighborLists this is a copy of the list.
+   * @param grainId
+   * @return ConstSharedVectorType
+   */
+  ConstSharedVectorType getList(int32 grainId) const;
 
   /**
    * @brief Static function to get the typename
@@ -333,7 +580,12 @@ public:
    */
   void resizeTuples(const std::vector<usize>& tupleShape) override;
 
-  const std::vector<SharedVectorType>& getValues() const;
+  /**
+   * @brief Returns the lists as const vectors. For compact storage these are
+   * created from the compact values.
+   * @return std::vector<ConstSharedVectorType>
+   */
+  std::vector<ConstSharedVectorType> getValues() const;
 
   iterator begin();
   iterator end();
@@ -353,8 +605,43 @@ protected:
    */
   NeighborList(DataStructure& dataStructure, const std::string& name, const std::vector<SharedVectorType>& dataVector, IdType importId);
 
+  /**
+   * @brief Constructor for importing a NeighborList whose lists are set afterwards.
+   */
+  NeighborList(DataStructure& dataStructure, const std::string& name, usize numTuples, IdType importId);
+
 private:
-  std::vector<SharedVectorType> m_Array;
+  struct CompactStorage
+  {
+    std::vector<T> values;
+    std::vector<usize> offsets;
+  };
+
+  /**
+   * @brief Returns the per list vectors, creating them from the compact storage
+   * if required. The compact storage is kept.
+   * @return const std::vector<SharedVectorType>&
+   */
+  const std::vector<SharedVectorType>& getLists() const;
+
+  /**
+   * @brief Returns the per list vectors for modification. Compact storage is
+   * released since it would no longer match the lists.
+   * @return std::vector<SharedVectorType>&
+   */
+  std::vector<SharedVectorType>& getMutableLists();
+
+  /**
+   * @brief Creates the per list vectors from the compact storage. m_ListsMutex
+   * must be held.
+   */
+  void createListsLocked() const;
+
+  mutable std::vector<SharedVectorType> m_Array;
+  std::shared_ptr<const CompactStorage> m_CompactStorage;
+  mutable std::atomic<bool> m_ListsValid = true;
+  std::atomic<bool> m_OwnsLists = true;
+  mutable std::mutex m_ListsMutex;
   bool m_IsAllocated;
   value_type m_InitValue;
 };
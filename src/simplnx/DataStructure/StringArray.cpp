@@ -100,6 +100,14 @@ std::shared_ptr<DataObject> StringArray::deepCopy(const DataPath& copyPath)
   return nullptr;
 }
 
+void StringArray::makeUnique()
+{
+  if(m_Strings.use_count() > 1)
+  {
+    m_Strings = std::make_shared<collection_type>(*m_Strings);
+  }
+}
+
 size_t StringArray::size() const
 {
   return m_Strings->size();
@@ -38,6 +38,11 @@ public:
   DataObject* shallowCopy() override;
   std::shared_ptr<DataObject> deepCopy(const DataPath& copyPath) override;
 
+  /**
+   * @brief Copies the strings if they are shared with another shallow copy.
+   */
+  void makeUnique() override;
+
   size_t size() const override;
   const collection_type& values() const;
 
@@ -3,6 +3,7 @@
 #include "simplnx/DataStructure/BaseGroup.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/DataStructure/IO/HDF5/LazyDataStore.hpp"
 #include "simplnx/Utilities/Parsing/DREAM3D/Dream3dIO.hpp"
 #include "simplnx/Utilities/Parsing/HDF5/Readers/FileReader.hpp"
 
@@ -32,10 +33,11 @@ std::vector<DataPath> getImportPaths(const DataStructure& importStructure, const
 
 namespace nx::core
 {
-ImportH5ObjectPathsAction::ImportH5ObjectPathsAction(const std::filesystem::path& importFile, const PathsType& paths)
+ImportH5ObjectPathsAction::ImportH5ObjectPathsAction(const std::filesystem::path& importFile, const PathsType& paths, bool deferLoading)
 : IDataCreationAction(DataPath{})
 , m_H5FilePath(importFile)
 , m_Paths(paths)
+, m_DeferLoading(deferLoading)
 {
   if(m_Paths.has_value())
   {
@@ -51,7 +53,9 @@ Result<> ImportH5ObjectPathsAction::apply(DataStructure& dataStructure, Mode mod
   bool preflighting = (mode == Mode::Preflight);
 
   nx::core::HDF5::FileReader fileReader(m_H5FilePath);
-  Result<DataStructure> dataStructureResult = DREAM3D::ImportDataStructureFromFile(fileReader, preflighting);
+  // Arrays are read lazily so that only the values of the imported arrays are read from the file
+  Result<DataStructure> dataStructureResult =
+      preflighting ? DREAM3D::ImportDataStructureFromFile(fileReader, true) : DREAM3D::ImportDataStructureFromFileLazily(fileReader);
   if(dataStructureResult.invalid())
   {
     return ConvertResult(std::move(dataStructureResult));
@@ -77,6 +81,10 @@ Result<> ImportH5ObjectPathsAction::apply(DataStructure& dataStructure, Mode mod
     {
       importGroup->clear();
     }
+    if(auto importArray = std::dynamic_pointer_cast<IDataArray>(importData); importArray != nullptr && !preflighting && !m_DeferLoading)
+    {
+      HDF5::LoadLazyDataArray(*importArray);
+    }
 
     if(dataStructure.getDataAs<DataObject>(targetPath) != nullptr)
     {
@@ -99,7 +107,7 @@ Result<> ImportH5ObjectPathsAction::apply(DataStructure& dataStructure, Mode mod
 
 IDataAction::UniquePointer ImportH5ObjectPathsAction::clone() const
 {
-  return std::make_unique<ImportH5ObjectPathsAction>(m_H5FilePath, m_Paths);
+  return std::make_unique<ImportH5ObjectPathsAction>(m_H5FilePath, m_Paths, m_DeferLoading);
 }
 
 std::vector<DataPath> ImportH5ObjectPathsAction::getAllCreatedPaths() const
@@ -26,8 +26,12 @@ public:
    * <b>IMPORTANT NOTE</b>. If the std::optional<> paths argument does NOT have a value then
    * then entire file will be imported. If it has a value, but the std::vector<> has a size of
    * zero (0), then NOTHING will be imported.
+   *
+   * Only the values of the imported DataArrays are read from the file. When deferLoading is
+   * true the DataArrays keep reading their values from the file the first time they are accessed.
+   * @param deferLoading
    */
-  ImportH5ObjectPathsAction(const std::filesystem::path& importFile, const PathsType& paths);
+  ImportH5ObjectPathsAction(const std::filesystem::path& importFile, const PathsType& paths, bool deferLoading = false);
 
   ~ImportH5ObjectPathsAction() noexcept override;
 
@@ -60,5 +64,6 @@ public:
 private:
   std::filesystem::path m_H5FilePath;
   PathsType m_Paths;
+  bool m_DeferLoading = false;
 };
 } // namespace nx::core
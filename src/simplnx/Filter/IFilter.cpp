@@ -7,6 +7,7 @@
 #include <fmt/format.h>
 #include <nlohmann/json.hpp>
 
+#include <chrono>
 #include <sstream>
 #include <vector>
 
@@ -197,10 +198,13 @@ IFilter::PreflightResult IFilter::preflight(const DataStructure& data, const Arg
 IFilter::ExecuteResult IFilter::execute(DataStructure& dataStructure, const Arguments& args, const PipelineFilter* pipelineFilter, const MessageHandler& messageHandler,
                                         const std::atomic_bool& shouldCancel) const
 {
+  using Clock = std::chrono::steady_clock;
+  const auto preflightStart = Clock::now();
+
   PreflightResult preflightResult = preflight(dataStructure, args, messageHandler, shouldCancel);
   if(preflightResult.outputActions.invalid())
   {
-    return ExecuteResult{ConvertResult(std::move(preflightResult.outputActions)), std::move(preflightResult.outputValues)};
+    return ExecuteResult{ConvertResult(std::move(preflightResult.outputActions)), std::move(preflightResult.outputValues), Clock::now() - preflightStart};
   }
 
   OutputActions outputActions = std::move(preflightResult.outputActions.value());
@@ -211,11 +215,13 @@ IFilter::ExecuteResult IFilter::execute(DataStructure& dataStructure, const Argu
 
   Result<> preflightActionsResult = MergeResults(std::move(outputActionsResult), std::move(actionsResult));
 
+  const std::chrono::nanoseconds preflightTime = Clock::now() - preflightStart;
   if(preflightActionsResult.invalid())
   {
-    return ExecuteResult{std::move(preflightActionsResult), std::move(preflightResult.outputValues)};
+    return ExecuteResult{std::move(preflightActionsResult), std::move(preflightResult.outputValues), preflightTime};
   }
 
+  const auto executeStart = Clock::now();
   Parameters params = parameters();
   // We can discard the warnings since they're already reported in preflight
   auto [resolvedArgs, warnings] = GetResolvedArgs(args, params, *this);
@@ -223,14 +229,14 @@ IFilter::ExecuteResult IFilter::execute(DataStructure& dataStructure, const Argu
   Result<> executeImplResult = executeImpl(dataStructure, resolvedArgs, pipelineFilter, messageHandler, shouldCancel);
   if(shouldCancel)
   {
-    return {MakeErrorResult(-1, "Filter cancelled")};
+    return {MakeErrorResult(-1, "Filter cancelled"), {}, preflightTime, Clock::now() - executeStart};
   }
 
   Result<> preflightActionsExecuteResult = MergeResults(std::move(preflightActionsResult), std::move(executeImplResult));
 
   if(preflightActionsExecuteResult.invalid())
   {
-    return ExecuteResult{std::move(preflightActionsExecuteResult), std::move(preflightResult.outputValues)};
+    return ExecuteResult{std::move(preflightActionsExecuteResult), std::move(preflightResult.outputValues), preflightTime, Clock::now() - executeStart};
   }
   // Apply any deferred actions
   Result<> deferredActionsResult = outputActions.applyDeferred(dataStructure, IDataAction::Mode::Execute);
@@ -242,7 +248,7 @@ IFilter::ExecuteResult IFilter::execute(DataStructure& dataStructure, const Argu
   // Merge all the results together.
   Result<> finalResult = MergeResults(std::move(preflightActionsExecuteResult), std::move(validGeometryAndAttributeMatrices));
 
-  return ExecuteResult{std::move(finalResult), std::move(preflightResult.outputValues)};
+  return ExecuteResult{std::move(finalResult), std::move(preflightResult.outputValues), preflightTime, Clock::now() - executeStart};
 }
 
 nlohmann::json IFilter::toJson(const Arguments& args) const
@@ -11,6 +11,7 @@
 #include <nonstd/expected.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <optional>
 #include <string>
@@ -98,6 +99,8 @@ public:
   {
     Result<> result;
     std::vector<PreflightValue> outputValues;
+    std::chrono::nanoseconds preflightTime = std::chrono::nanoseconds::zero(); // preflight and applying the regular output actions
+    std::chrono::nanoseconds executeTime = std::chrono::nanoseconds::zero();   // executeImpl, deferred actions and validation
   };
 
   virtual ~IFilter() noexcept;
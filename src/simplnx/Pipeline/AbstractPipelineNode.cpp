@@ -65,7 +65,10 @@ const DataStructure& AbstractPipelineNode::getDataStructure() const
 
 void AbstractPipelineNode::setDataStructure(const DataStructure& dataStructure)
 {
-  m_DataStructure = dataStructure;
+  const auto* pipeline = getType() == NodeType::Pipeline ? dynamic_cast<const Pipeline*>(this) : getParentPipeline();
+  const bool useSnapshot = pipeline != nullptr && pipeline->isSnapshotsEnabled();
+  m_DataStructure = useSnapshot ? dataStructure.createSnapshot() : dataStructure;
+  m_IsExecuted = true;
 }
 
 void AbstractPipelineNode::checkDataStructureSize(DataStructure& dataStructure)
@@ -99,6 +102,7 @@ void AbstractPipelineNode::setPreflightStructure(const DataStructure& dataStruct
 void AbstractPipelineNode::clearDataStructure()
 {
   m_DataStructure = DataStructure();
+  m_IsExecuted = false;
 }
 
 void AbstractPipelineNode::clearPreflightStructure()
@@ -106,6 +110,7 @@ void AbstractPipelineNode::clearPreflightStructure()
   m_DataStructure = DataStructure();
   m_PreflightStructure = DataStructure();
   m_IsPreflighted = false;
+  m_IsExecuted = false;
 }
 
 bool AbstractPipelineNode::isPreflighted() const
@@ -113,6 +118,11 @@ bool AbstractPipelineNode::isPreflighted() const
   return m_IsPreflighted;
 }
 
+bool AbstractPipelineNode::isExecuted() const
+{
+  return m_IsExecuted;
+}
+
 void AbstractPipelineNode::endExecution(DataStructure& dataStructure)
 {
   dataStructure.flush();
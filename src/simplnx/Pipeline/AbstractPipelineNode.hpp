@@ -227,6 +227,13 @@ public:
    */
   bool isPreflighted() const;
 
+  /**
+   * @brief Returns true if the node has been executed and still holds a
+   * snapshot of the resulting DataStructure. Returns false otherwise.
+   * @return bool
+   */
+  bool isExecuted() const;
+
   /**
    * @brief Returns a reference to the signal used for messaging.
    * @return SignalType&
@@ -276,8 +283,10 @@ protected:
   AbstractPipelineNode(Pipeline* parent = nullptr);
 
   /**
-   * @brief Updates the stored DataStructure. This should only be called from
-   * within the execute(DataStructure&) method.
+   * @brief Updates the stored DataStructure. Stores a copy-on-write snapshot of
+   * the provided DataStructure if snapshots are enabled on the pipeline and a
+   * shallow copy otherwise. This should only be called from within the
+   * execute(DataStructure&) method.
    * @param dataStructure
    */
   void setDataStructure(const DataStructure& dataStructure);
@@ -332,6 +341,7 @@ private:
   DataStructure m_DataStructure;
   DataStructure m_PreflightStructure;
   bool m_IsPreflighted = false;
+  bool m_IsExecuted = false;
   SignalType m_Signal;
   FaultState m_FaultState = FaultState::None;
   bool m_IsDisabled = false;
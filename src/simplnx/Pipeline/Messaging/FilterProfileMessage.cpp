@@ -0,0 +1,25 @@
+#include "FilterProfileMessage.hpp"
+
+#include <fmt/format.h>
+
+using namespace nx::core;
+
+FilterProfileMessage::FilterProfileMessage(AbstractPipelineNode* node, FilterProfile profile)
+: AbstractPipelineMessage(node)
+, m_Profile(std::move(profile))
+{
+}
+
+FilterProfileMessage::~FilterProfileMessage() = default;
+
+const FilterProfile& FilterProfileMessage::getProfile() const
+{
+  return m_Profile;
+}
+
+std::string FilterProfileMessage::toString() const
+{
+  using Milliseconds = std::chrono::duration<float64, std::milli>;
+  return fmt::format("[{}] {}: preflight {:.3f} ms, execute {:.3f} ms, memory delta {} bytes, {:.2f} threads", m_Profile.index, m_Profile.name,
+                     Milliseconds(m_Profile.preflightTime).count(), Milliseconds(m_Profile.executeTime).count(), m_Profile.memoryDelta(), m_Profile.threadUtilization());
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/DataPath.hpp"
+#include "simplnx/Pipeline/Messaging/AbstractPipelineMessage.hpp"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @struct FilterProfile
+ * @brief Timing and memory measurements for a single filter execution
+ * collected by a Pipeline with profiling enabled.
+ */
+struct SIMPLNX_EXPORT FilterProfile
+{
+  struct CreatedArray
+  {
+    DataPath path;
+    uint64 bytes = 0;
+  };
+
+  usize index = 0;
+  std::string name;
+  std::string className;
+  std::chrono::nanoseconds startTime = std::chrono::nanoseconds::zero(); // relative to the start of the pipeline execution
+  std::chrono::nanoseconds preflightTime = std::chrono::nanoseconds::zero();
+  std::chrono::nanoseconds executeTime = std::chrono::nanoseconds::zero();
+  std::chrono::nanoseconds wallTime = std::chrono::nanoseconds::zero();
+  std::chrono::nanoseconds cpuTime = std::chrono::nanoseconds::zero();
+  uint64 memoryBefore = 0; // DataStructure::memoryUsage() before the filter
+  uint64 memoryAfter = 0;  // DataStructure::memoryUsage() after the filter
+  uint64 peakResidentMemory = 0;
+  std::vector<CreatedArray> createdArrays;
+  bool succeeded = false;
+
+  /**
+   * @brief Returns the change in DataStructure memory caused by the filter.
+   * @return int64
+   */
+  int64 memoryDelta() const
+  {
+    return static_cast<int64>(memoryAfter) - static_cast<int64>(memoryBefore);
+  }
+
+  /**
+   * @brief Returns the average number of busy threads while the filter was
+   * running (process CPU time / wall time).
+   * @return float64
+   */
+  float64 threadUtilization() const
+  {
+    return wallTime.count() > 0 ? static_cast<float64>(cpuTime.count()) / static_cast<float64>(wallTime.count()) : 0.0;
+  }
+};
+
+/**
+ * @class FilterProfileMessage
+ * @brief The FilterProfileMessage class is emitted by a Pipeline with profiling
+ * enabled after each of its filters finishes executing.
+ */
+class SIMPLNX_EXPORT FilterProfileMessage : public AbstractPipelineMessage
+{
+public:
+  /**
+   * @brief Constructs a new FilterProfileMessage for the specified node.
+   * @param node
+   * @param profile
+   */
+  FilterProfileMessage(AbstractPipelineNode* node, FilterProfile profile);
+
+  ~FilterProfileMessage() override;
+
+  /**
+   * @brief Returns the measurements for the executed filter.
+   * @return const FilterProfile&
+   */
+  const FilterProfile& getProfile() const;
+
+  /**
+   * @brief Returns a string representation of the message.
+   * @return std::string
+   */
+  std::string toString() const override;
+
+private:
+  FilterProfile m_Profile;
+};
+} // namespace nx::core
@@ -1,20 +1,28 @@
 #include "Pipeline.hpp"
 
 #include "simplnx/Core/Application.hpp"
+#include "simplnx/DataStructure/IArray.hpp"
+#include "simplnx/DataStructure/IDataArray.hpp"
 #include "simplnx/Filter/FilterHandle.hpp"
 #include "simplnx/Filter/FilterList.hpp"
+#include "simplnx/Pipeline/Messaging/FilterProfileMessage.hpp"
 #include "simplnx/Pipeline/Messaging/NodeAddedMessage.hpp"
 #include "simplnx/Pipeline/Messaging/NodeMovedMessage.hpp"
 #include "simplnx/Pipeline/Messaging/NodeRemovedMessage.hpp"
 #include "simplnx/Pipeline/Messaging/PipelineNodeMessage.hpp"
 #include "simplnx/Pipeline/PipelineFilter.hpp"
 #include "simplnx/Pipeline/PlaceholderFilter.hpp"
+#include "simplnx/Utilities/MemoryUtilities.hpp"
+#include "simplnx/Utilities/TimeUtilities.hpp"
 
 #include <nlohmann/json.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace nx::core;
 
@@ -28,6 +36,92 @@ constexpr uint64 k_PipelineVersion = 1;
 constexpr StringLiteral k_SIMPLPipelineNameKey = "Name";
 constexpr StringLiteral k_SIMPLNumFilterseKey = "Number_Filters";
 
+/**
+ * @brief Calls the callback for each IDataArray in the DataStructure.
+ */
+template <typename FuncT>
+void ForEachDataArray(const DataStructure& dataStructure, FuncT&& func)
+{
+  for(const auto& identifier : dataStructure.getAllDataObjectIds())
+  {
+    const auto* dataArray = dataStructure.getDataAs<IDataArray>(identifier);
+    if(dataArray != nullptr)
+    {
+      func(*dataArray);
+    }
+  }
+}
+
+/**
+ * @brief The DataStores held by executed snapshots that are not shared with
+ * the current DataStructure.
+ */
+struct SnapshotStores
+{
+  struct StoreUsage
+  {
+    uint64 memory = 0;
+    usize numSnapshots = 0;
+  };
+
+  uint64 memory = 0;
+  std::unordered_map<const IDataStore*, StoreUsage> stores;
+  std::vector<std::vector<const IDataStore*>> snapshotStores;
+};
+
+/**
+ * @brief Collects the DataStores of each snapshot, with nullptr for nodes that
+ * hold no snapshot. Stores shared by several snapshots are only counted once.
+ */
+SnapshotStores CollectSnapshotStores(const DataStructure& dataStructure, const std::vector<const DataStructure*>& snapshots)
+{
+  std::unordered_set<const IDataStore*> currentStores;
+  ForEachDataArray(dataStructure, [&currentStores](const IDataArray& dataArray) { currentStores.insert(dataArray.getIDataStore()); });
+
+  SnapshotStores result;
+  result.snapshotStores.resize(snapshots.size());
+  for(usize i = 0; i < snapshots.size(); i++)
+  {
+    if(snapshots[i] == nullptr)
+    {
+      continue;
+    }
+    std::unordered_set<const IDataStore*> countedStores;
+    ForEachDataArray(*snapshots[i], [&](const IDataArray& dataArray) {
+      const IDataStore* dataStore = dataArray.getIDataStore();
+      if(currentStores.count(dataStore) != 0 || !countedStores.insert(dataStore).second)
+      {
+        return;
+      }
+      result.snapshotStores[i].push_back(dataStore);
+      auto& usage = result.stores[dataStore];
+      if(usage.numSnapshots++ == 0)
+      {
+        usage.memory = dataArray.memoryUsage();
+        result.memory += usage.memory;
+      }
+    });
+  }
+  return result;
+}
+
+/**
+ * @brief Returns the DataObjects that still share data with a snapshot.
+ */
+std::vector<DataObject*> FindSharedDataObjects(DataStructure& dataStructure)
+{
+  std::vector<DataObject*> sharedObjects;
+  for(const auto& identifier : dataStructure.getAllDataObjectIds())
+  {
+    DataObject* dataObject = dataStructure.getData(identifier);
+    if(dataObject != nullptr && dataObject->copyOnWriteMemoryUsage() != 0)
+    {
+      sharedObjects.push_back(dataObject);
+    }
+  }
+  return sharedObjects;
+}
+
 std::string GenerateSIMPLPipelineStringIndex(int32 index, int32 maxIndex)
 {
   std::string numStr = fmt::format("{}", index);
@@ -300,7 +394,17 @@ bool Pipeline::canExecuteFrom(index_type index) const
   {
     return false;
   }
-  return !hasErrorsBeforeIndex(index);
+  // Without snapshots the stored DataStructures share their data with later filters, which may have modified it
+  if(!isSnapshotsEnabled())
+  {
+    return false;
+  }
+  if(hasErrorsBeforeIndex(index))
+  {
+    return false;
+  }
+  const auto* precedingNode = findPrecedingEnabledNode(index);
+  return precedingNode == nullptr || precedingNode->isExecuted();
 }
 
 bool Pipeline::executeFrom(index_type index, DataStructure& dataStructure, const std::atomic_bool& shouldCancel)
@@ -324,6 +428,7 @@ bool Pipeline::executeFrom(index_type index, DataStructure& dataStructure, const
   }
 
   clearFaultState();
+  const auto pipelineStart = std::chrono::steady_clock::now();
   // Loop over each filter and execute the filter.
   for(auto iter = begin() + index; iter != end(); iter++)
   {
@@ -333,7 +438,62 @@ bool Pipeline::executeFrom(index_type index, DataStructure& dataStructure, const
       continue;
     }
 
+    FilterProfile profile;
+    DataObject::IdType firstNewId = 0;
+    if(m_ProfilingEnabled)
+    {
+      profile.index = static_cast<usize>(std::distance(begin(), iter));
+      profile.name = filter->getName();
+      profile.memoryBefore = dataStructure.memoryUsage();
+      profile.cpuTime = GetProcessCpuTime();
+      profile.startTime = std::chrono::steady_clock::now() - pipelineStart;
+      firstNewId = dataStructure.getNextId();
+    }
+
+    if(isSnapshotsEnabled())
+    {
+      detachSharedData(*filter, dataStructure);
+    }
+
     bool success = filter->execute(dataStructure, shouldCancel);
+
+    if(m_ProfilingEnabled)
+    {
+      profile.wallTime = (std::chrono::steady_clock::now() - pipelineStart) - profile.startTime;
+      profile.cpuTime = GetProcessCpuTime() - profile.cpuTime;
+      profile.memoryAfter = dataStructure.memoryUsage();
+      profile.peakResidentMemory = Memory::GetPeakResidentMemory();
+      profile.succeeded = success;
+      if(const auto* pipelineFilter = dynamic_cast<const PipelineFilter*>(filter); pipelineFilter != nullptr)
+      {
+        profile.preflightTime = pipelineFilter->getLastPreflightTime();
+        profile.executeTime = pipelineFilter->getLastExecuteTime();
+        if(const IFilter* filterPtr = pipelineFilter->getFilter(); filterPtr != nullptr)
+        {
+          profile.className = filterPtr->className();
+        }
+      }
+      else
+      {
+        profile.executeTime = profile.wallTime;
+      }
+      // DataObject ids are assigned incrementally so everything at or past firstNewId was created by this filter
+      for(DataObject::IdType id : dataStructure.getAllDataObjectIds())
+      {
+        if(id < firstNewId)
+        {
+          continue;
+        }
+        const auto* array = dynamic_cast<const IArray*>(dataStructure.getData(id));
+        std::vector<DataPath> arrayPaths = dataStructure.getDataPathsForId(id);
+        if(array != nullptr && !arrayPaths.empty())
+        {
+          profile.createdArrays.push_back({arrayPaths.front(), array->memoryUsage()});
+        }
+      }
+      notify(std::make_shared<FilterProfileMessage>(filter, std::move(profile)));
+    }
+
     // Check if the filter was cancelled, and send out signal if it was.
     if(shouldCancel)
     {
@@ -348,6 +508,10 @@ bool Pipeline::executeFrom(index_type index, DataStructure& dataStructure, const
       returnValue = false;
       break;
     }
+    if(isSnapshotsEnabled())
+    {
+      enforceSnapshotMemoryLimit(dataStructure, {});
+    }
   }
 
   // checkDataStructureSize(dataStructure);
@@ -370,11 +534,36 @@ bool Pipeline::executeFrom(index_type index, const std::atomic_bool& shouldCance
     return false;
   }
 
-  auto* node = at(index - 1);
-  DataStructure dataStructure = node->getDataStructure();
+  const auto* node = findPrecedingEnabledNode(index);
+  DataStructure dataStructure;
+  if(node != nullptr)
+  {
+    // Resume from a snapshot of the stored DataStructure so that re-executing does not modify the stored history.
+    dataStructure = node->getDataStructure().createSnapshot();
+  }
   return executeFrom(index, dataStructure, shouldCancel);
 }
 
+void Pipeline::setSnapshotsEnabled(bool enabled)
+{
+  m_SnapshotsEnabled = enabled;
+}
+
+bool Pipeline::isSnapshotsEnabled() const
+{
+  return m_SnapshotsEnabled || (hasParentPipeline() && getParentPipeline()->isSnapshotsEnabled());
+}
+
+void Pipeline::setProfilingEnabled(bool enabled)
+{
+  m_ProfilingEnabled = enabled;
+}
+
+bool Pipeline::isProfilingEnabled() const
+{
+  return m_ProfilingEnabled;
+}
+
 bool Pipeline::hasWarningsBeforeIndex(index_type index) const
 {
   for(usize i = 0; i < index; i++)
@@ -399,6 +588,92 @@ bool Pipeline::hasErrorsBeforeIndex(index_type index) const
   return false;
 }
 
+AbstractPipelineNode* Pipeline::findPrecedingEnabledNode(index_type index) const
+{
+  for(usize i = std::min(index, m_Collection.size()); i > 0; i--)
+  {
+    if(m_Collection[i - 1]->isEnabled())
+    {
+      return m_Collection[i - 1].get();
+    }
+  }
+  return nullptr;
+}
+
+std::vector<const DataStructure*> Pipeline::getExecutedSnapshots() const
+{
+  std::vector<const DataStructure*> snapshots;
+  snapshots.reserve(m_Collection.size());
+  for(const auto& node : m_Collection)
+  {
+    snapshots.push_back(node->isExecuted() ? &node->getDataStructure() : nullptr);
+  }
+  return snapshots;
+}
+
+uint64 Pipeline::snapshotMemoryUsage(const DataStructure& dataStructure) const
+{
+  return CollectSnapshotStores(dataStructure, getExecutedSnapshots()).memory;
+}
+
+uint64 Pipeline::snapshotMemoryUsage() const
+{
+  return snapshotMemoryUsage(getDataStructure());
+}
+
+void Pipeline::enforceSnapshotMemoryLimit(const DataStructure& dataStructure, const std::vector<DataObject*>& pendingCopies)
+{
+  const uint64 memoryLimit = Application::GetOrCreateInstance()->getPreferences()->snapshotMemoryLimit();
+  // The stores are collected once and each cleared snapshot subtracts the stores only it held
+  SnapshotStores snapshotStores = CollectSnapshotStores(dataStructure, getExecutedSnapshots());
+  for(usize i = 0; i < m_Collection.size(); i++)
+  {
+    // Clearing a snapshot can release the last other owner of a pending copy, so the copies are recounted each time
+    uint64 memory = snapshotStores.memory;
+    for(const DataObject* dataObject : pendingCopies)
+    {
+      memory += dataObject->copyOnWriteMemoryUsage();
+    }
+    if(memory <= memoryLimit)
+    {
+      return;
+    }
+    if(!m_Collection[i]->isExecuted())
+    {
+      continue;
+    }
+    for(const IDataStore* dataStore : snapshotStores.snapshotStores[i])
+    {
+      auto& usage = snapshotStores.stores[dataStore];
+      if(--usage.numSnapshots == 0)
+      {
+        snapshotStores.memory -= usage.memory;
+      }
+    }
+    m_Collection[i]->clearDataStructure();
+  }
+}
+
+void Pipeline::detachSharedData(const AbstractPipelineNode& node, DataStructure& dataStructure)
+{
+  // Nested pipelines detach the data for each of their own filters
+  if(dynamic_cast<const PipelineFilter*>(&node) == nullptr)
+  {
+    return;
+  }
+
+  const std::vector<DataObject*> sharedObjects = FindSharedDataObjects(dataStructure);
+  if(sharedObjects.empty())
+  {
+    return;
+  }
+  enforceSnapshotMemoryLimit(dataStructure, sharedObjects);
+  for(DataObject* dataObject : sharedObjects)
+  {
+    dataObject->makeUnique();
+  }
+}
+
 usize Pipeline::size() const
 {
   return m_Collection.size();
@@ -254,8 +254,10 @@ public:
   /**
    * @brief Checks if the pipeline can be executed at the target index.
    *
-   * Returns true if the preceeding node has execution data or the target
-   * index is 0. Returns false otherwise.
+   * Returns true if the target index is 0, or if snapshots are enabled and
+   * the preceeding enabled node has execution data. Returns false otherwise.
+   * Without snapshots the stored DataStructures share their data with the
+   * later filters that modified it, so they cannot be resumed from.
    * @param index
    * @return bool
    */
@@ -274,8 +276,9 @@ public:
   bool executeFrom(index_type index, DataStructure& dataStructure, const std::atomic_bool& shouldCancel = false);
 
   /**
-   * @brief Executes the pipeline segment from the target position using the
-   * previous node's DataStructure. Starts with an empty DataStructure if
+   * @brief Executes the pipeline segment from the target position using a
+   * copy-on-write snapshot of the previous enabled node's DataStructure. The
+   * stored snapshot is not modified. Starts with an empty DataStructure if
    * index is 0.
    *
    * Returns true if the pipeline execution completes without errors. Returns
@@ -606,6 +609,66 @@ public:
    */
   uint64 checkMemoryRequired();
 
+  /**
+   * @brief Returns the number of bytes held by the executed DataStructure
+   * snapshots of the pipeline's nodes that are not shared with the provided
+   * DataStructure. Stores shared by several snapshots are only counted once.
+   * @param dataStructure
+   * @return Memory size in Bytes
+   */
+  uint64 snapshotMemoryUsage(const DataStructure& dataStructure) const;
+
+  /**
+   * @brief Returns the number of bytes held by the executed DataStructure
+   * snapshots of the pipeline's nodes that are not shared with the pipeline's
+   * own executed DataStructure.
+   * @return Memory size in Bytes
+   */
+  uint64 snapshotMemoryUsage() const;
+
+  /**
+   * @brief Enables or disables DataStructure snapshots. While enabled, each
+   * executed node keeps a copy-on-write snapshot of the resulting
+   * DataStructure that later filters cannot modify:
+   * - DataArrays share their DataStores with the snapshot. Every DataStore
+   *   still shared with a snapshot is copied before the next filter executes,
+   *   so writes through operator[], getDataStoreRef() or a ChunkView are
+   *   protected no matter how the filter found the array. The explicit write
+   *   methods, such as setValue() and fill(), also copy a shared DataStore
+   *   outside of a pipeline.
+   * - NeighborLists and StringArrays are copied when the snapshot is taken.
+   * - Other DataObjects hold no shared data and are copied with the
+   *   DataStructure.
+   *
+   * The snapshot memory limit from the application Preferences is enforced
+   * after each filter and before the shared DataStores are copied, clearing
+   * the oldest snapshots first. While disabled, nodes keep a shallow copy that
+   * later filters may modify, and executeFrom() only accepts index 0.
+   * Disabled by default.
+   * @param enabled
+   */
+  void setSnapshotsEnabled(bool enabled);
+
+  /**
+   * @brief Returns true if snapshots are enabled for this pipeline or for any
+   * pipeline containing it.
+   * @return bool
+   */
+  bool isSnapshotsEnabled() const;
+
+  /**
+   * @brief Enables or disables profiling. While enabled, executing the
+   * pipeline emits a FilterProfileMessage for each executed filter.
+   * @param enabled
+   */
+  void setProfilingEnabled(bool enabled);
+
+  /**
+   * @brief Returns true if executing the pipeline emits FilterProfileMessages.
+   * @return bool
+   */
+  bool isProfilingEnabled() const;
+
 protected:
   /**
    * @brief Returns implementation-specific json value for the node.
@@ -651,11 +714,47 @@ private:
    */
   bool hasErrorsBeforeIndex(index_type index) const;
 
+  /**
+   * @brief Returns the closest enabled node before the specified index.
+   * Returns nullptr if there is no enabled node before the index.
+   * @param index
+   * @return AbstractPipelineNode*
+   */
+  AbstractPipelineNode* findPrecedingEnabledNode(index_type index) const;
+
+  /**
+   * @brief Returns the DataStructure snapshot of each node, or nullptr for
+   * nodes that have not been executed.
+   * @return std::vector<const DataStructure*>
+   */
+  std::vector<const DataStructure*> getExecutedSnapshots() const;
+
+  /**
+   * @brief Clears the oldest executed snapshots until the snapshot memory
+   * overhead relative to the provided DataStructure, plus the bytes the pending
+   * copies would add, is within the limit set in the application Preferences.
+   * @param dataStructure
+   * @param pendingCopies DataObjects that are about to be detached from the snapshots
+   */
+  void enforceSnapshotMemoryLimit(const DataStructure& dataStructure, const std::vector<DataObject*>& pendingCopies);
+
+  /**
+   * @brief Detaches all data still shared with the stored snapshots before the
+   * node executes, so that the filter can write to any DataObject without
+   * changing the snapshots. The snapshot memory limit is enforced before any
+   * data is copied, and clearing snapshots can leave nothing to copy.
+   * @param node
+   * @param dataStructure
+   */
+  void detachSharedData(const AbstractPipelineNode& node, DataStructure& dataStructure);
+
   ////////////
   // Variables
   std::string m_Name;
   collection_type m_Collection;
   FilterList* m_FilterList = nullptr;
   uint64 m_MemoryRequired = 0;
+  bool m_ProfilingEnabled = false;
+  bool m_SnapshotsEnabled = false;
 };
 } // namespace nx::core
@@ -242,6 +242,8 @@ bool PipelineFilter::execute(DataStructure& dataStructure, const std::atomic_boo
 
   m_Warnings.clear();
   m_Errors.clear();
+  m_LastPreflightTime = std::chrono::nanoseconds::zero();
+  m_LastExecuteTime = std::chrono::nanoseconds::zero();
   clearFaultState();
 
   IFilter::MessageHandler messageHandler{[this](const IFilter::Message& message) { this->notifyFilterMessage(message); }};
@@ -255,6 +257,8 @@ bool PipelineFilter::execute(DataStructure& dataStructure, const std::atomic_boo
   if(m_Filter != nullptr)
   {
     result = m_Filter->execute(dataStructure, getArguments(), this, messageHandler, shouldCancel);
+    m_LastPreflightTime = result.preflightTime;
+    m_LastExecuteTime = result.executeTime;
     m_Warnings = result.result.warnings();
     m_PreflightValues = std::move(result.outputValues);
     if(result.result.invalid())
@@ -287,6 +291,16 @@ std::vector<DataPath> PipelineFilter::getCreatedPaths() const
   return m_CreatedPaths;
 }
 
+std::chrono::nanoseconds PipelineFilter::getLastPreflightTime() const
+{
+  return m_LastPreflightTime;
+}
+
+std::chrono::nanoseconds PipelineFilter::getLastExecuteTime() const
+{
+  return m_LastExecuteTime;
+}
+
 std::vector<DataObjectModification> PipelineFilter::getDataObjectModificationNotifications() const
 {
   return m_DataModifiedActions;
@@ -150,6 +150,21 @@ public:
    */
   std::vector<DataPath> getCreatedPaths() const;
 
+  /**
+   * @brief Returns the time spent preflighting the filter during the last call
+   * to execute. Returns zero if the filter has not been executed.
+   * @return std::chrono::nanoseconds
+   */
+  std::chrono::nanoseconds getLastPreflightTime() const;
+
+  /**
+   * @brief Returns the time spent executing the filter during the last call to
+   * execute, excluding the preflight time. Returns zero if the filter has not
+   * been executed.
+   * @return std::chrono::nanoseconds
+   */
+  std::chrono::nanoseconds getLastExecuteTime() const;
+
   /**
    * @brief Returns a vector of DataPaths that would be modified when executing the node
    * @return std::vector<DataPath>
@@ -236,5 +251,7 @@ private:
   std::vector<IFilter::PreflightValue> m_PreflightValues;
   std::vector<DataPath> m_CreatedPaths;
   std::vector<DataObjectModification> m_DataModifiedActions;
+  std::chrono::nanoseconds m_LastPreflightTime = std::chrono::nanoseconds::zero();
+  std::chrono::nanoseconds m_LastExecuteTime = std::chrono::nanoseconds::zero();
 };
 } // namespace nx::core
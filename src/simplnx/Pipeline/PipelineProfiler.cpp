@@ -0,0 +1,174 @@
+#include "PipelineProfiler.hpp"
+
+#include "simplnx/Pipeline/Messaging/PipelineNodeMessage.hpp"
+#include "simplnx/Pipeline/Pipeline.hpp"
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <thread>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr int32 k_ProcessId = 1;
+constexpr int32 k_ThreadId = 1;
+
+float64 ToMicroseconds(std::chrono::nanoseconds duration)
+{
+  return std::chrono::duration<float64, std::micro>(duration).count();
+}
+
+float64 ToMilliseconds(std::chrono::nanoseconds duration)
+{
+  return std::chrono::duration<float64, std::milli>(duration).count();
+}
+
+float64 ToMebibytes(uint64 bytes)
+{
+  return static_cast<float64>(bytes) / (1024.0 * 1024.0);
+}
+
+nlohmann::json CreateCompleteEvent(const std::string& name, const std::string& category, std::chrono::nanoseconds start, std::chrono::nanoseconds duration)
+{
+  return {{"name", name}, {"cat", category}, {"ph", "X"}, {"ts", ToMicroseconds(start)}, {"dur", ToMicroseconds(duration)}, {"pid", k_ProcessId}, {"tid", k_ThreadId}};
+}
+
+nlohmann::json CreateCounterEvent(const std::string& name, std::chrono::nanoseconds timestamp, nlohmann::json args)
+{
+  return {{"name", name}, {"ph", "C"}, {"ts", ToMicroseconds(timestamp)}, {"pid", k_ProcessId}, {"args", std::move(args)}};
+}
+} // namespace
+
+PipelineProfiler::PipelineProfiler(Pipeline* pipeline)
+: PipelineNodeObserver()
+, m_Pipeline(pipeline)
+{
+  if(m_Pipeline == nullptr)
+  {
+    return;
+  }
+  m_PipelineName = m_Pipeline->getName();
+  m_Pipeline->setProfilingEnabled(true);
+  startObservingNode(m_Pipeline);
+}
+
+PipelineProfiler::~PipelineProfiler() noexcept
+{
+  if(m_Pipeline != nullptr)
+  {
+    m_Pipeline->setProfilingEnabled(false);
+  }
+}
+
+const std::vector<FilterProfile>& PipelineProfiler::getProfiles() const
+{
+  return m_Profiles;
+}
+
+void PipelineProfiler::clear()
+{
+  m_Profiles.clear();
+}
+
+void PipelineProfiler::onNotify(AbstractPipelineNode* node, const std::shared_ptr<AbstractPipelineMessage>& msg)
+{
+  std::shared_ptr<AbstractPipelineMessage> message = msg;
+  if(const auto nodeMessage = std::dynamic_pointer_cast<PipelineNodeMessage>(message); nodeMessage != nullptr)
+  {
+    message = nodeMessage->getMessage();
+  }
+  if(const auto profileMessage = std::dynamic_pointer_cast<FilterProfileMessage>(message); profileMessage != nullptr)
+  {
+    m_Profiles.push_back(profileMessage->getProfile());
+  }
+}
+
+nlohmann::json PipelineProfiler::toChromeTraceJson() const
+{
+  nlohmann::json events = nlohmann::json::array();
+  events.push_back({{"name", "process_name"}, {"ph", "M"}, {"pid", k_ProcessId}, {"args", {{"name", m_PipelineName}}}});
+  events.push_back({{"name", "thread_name"}, {"ph", "M"}, {"pid", k_ProcessId}, {"tid", k_ThreadId}, {"args", {{"name", "Pipeline"}}}});
+
+  for(const auto& profile : m_Profiles)
+  {
+    nlohmann::json createdArrays = nlohmann::json::object();
+    for(const auto& createdArray : profile.createdArrays)
+    {
+      createdArrays[createdArray.path.toString()] = createdArray.bytes;
+    }
+
+    nlohmann::json filterEvent = CreateCompleteEvent(profile.name, "filter", profile.startTime, profile.wallTime);
+    filterEvent["args"] = {{"index", profile.index},
+                           {"class_name", profile.className},
+                           {"succeeded", profile.succeeded},
+                           {"preflight_ms", ToMilliseconds(profile.preflightTime)},
+                           {"execute_ms", ToMilliseconds(profile.executeTime)},
+                           {"memory_before_bytes", profile.memoryBefore},
+                           {"memory_after_bytes", profile.memoryAfter},
+                           {"memory_delta_bytes", profile.memoryDelta()},
+                           {"peak_rss_bytes", profile.peakResidentMemory},
+                           {"thread_utilization", profile.threadUtilization()},
+                           {"created_arrays", std::move(createdArrays)}};
+    events.push_back(std::move(filterEvent));
+    events.push_back(CreateCompleteEvent("Preflight", "preflight", profile.startTime, profile.preflightTime));
+    events.push_back(CreateCompleteEvent("Execute", "execute", profile.startTime + profile.preflightTime, profile.executeTime));
+
+    const std::chrono::nanoseconds endTime = profile.startTime + profile.wallTime;
+    events.push_back(CreateCounterEvent("DataStructure Memory (MiB)", endTime, {{"memory", ToMebibytes(profile.memoryAfter)}}));
+    events.push_back(CreateCounterEvent("Peak RSS (MiB)", endTime, {{"peak_rss", ToMebibytes(profile.peakResidentMemory)}}));
+    events.push_back(CreateCounterEvent("Thread Utilization", profile.startTime, {{"threads", profile.threadUtilization()}}));
+  }
+
+  nlohmann::json trace;
+  trace["traceEvents"] = std::move(events);
+  trace["displayTimeUnit"] = "ms";
+  trace["otherData"] = {{"pipeline", m_PipelineName}, {"hardware_threads", std::thread::hardware_concurrency()}};
+  return trace;
+}
+
+Result<> PipelineProfiler::writeChromeTrace(const std::filesystem::path& filePath) const
+{
+  const std::filesystem::path parentPath = filePath.parent_path();
+  if(!parentPath.empty() && !std::filesystem::exists(parentPath) && !std::filesystem::create_directories(parentPath))
+  {
+    return MakeErrorResult(k_FailedToCreateDirectory_Code, fmt::format("Failed to create the directory '{}' for the profiling output", parentPath.string()));
+  }
+
+  std::ofstream fileStream(filePath);
+  if(!fileStream.is_open())
+  {
+    return MakeErrorResult(k_FileCouldNotOpen_Code, fmt::format("Could not open '{}' to write the profiling output", filePath.string()));
+  }
+
+  fileStream << toChromeTraceJson().dump(2);
+  return {};
+}
+
+std::string PipelineProfiler::toSummaryString() const
+{
+  std::vector<const FilterProfile*> sortedProfiles;
+  sortedProfiles.reserve(m_Profiles.size());
+  std::chrono::nanoseconds totalTime = std::chrono::nanoseconds::zero();
+  for(const auto& profile : m_Profiles)
+  {
+    sortedProfiles.push_back(&profile);
+    totalTime += profile.wallTime;
+  }
+  std::sort(sortedProfiles.begin(), sortedProfiles.end(), [](const FilterProfile* lhs, const FilterProfile* rhs) { return lhs->wallTime > rhs->wallTime; });
+
+  std::string output = fmt::format("{:>5}  {:<48} {:>12} {:>12} {:>7} {:>16} {:>12} {:>8}\n", "Index", "Filter", "Preflight ms", "Execute ms", "% Time", "Memory Delta MiB",
+                                   "Peak RSS MiB", "Threads");
+  for(const FilterProfile* profile : sortedProfiles)
+  {
+    const float64 percent = totalTime.count() > 0 ? 100.0 * static_cast<float64>(profile->wallTime.count()) / static_cast<float64>(totalTime.count()) : 0.0;
+    output += fmt::format("{:>5}  {:<48.48} {:>12.3f} {:>12.3f} {:>7.2f} {:>16.3f} {:>12.3f} {:>8.2f}\n", profile->index, profile->name, ToMilliseconds(profile->preflightTime),
+                          ToMilliseconds(profile->executeTime), percent, static_cast<float64>(profile->memoryDelta()) / (1024.0 * 1024.0), ToMebibytes(profile->peakResidentMemory),
+                          profile->threadUtilization());
+  }
+  output += fmt::format("Total: {:.3f} ms over {} filters\n", ToMilliseconds(totalTime), m_Profiles.size());
+  return output;
+}
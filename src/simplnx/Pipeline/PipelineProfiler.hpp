@@ -0,0 +1,91 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Pipeline/Messaging/FilterProfileMessage.hpp"
+#include "simplnx/Pipeline/Messaging/PipelineNodeObserver.hpp"
+
+#include <nlohmann/json_fwd.hpp>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace nx::core
+{
+class Pipeline;
+
+/**
+ * @class PipelineProfiler
+ * @brief The PipelineProfiler class enables profiling on a Pipeline and
+ * collects the FilterProfileMessages emitted while it executes. The collected
+ * measurements can be written as a Chrome trace (chrome://tracing, Perfetto)
+ * or summarized as text.
+ */
+class SIMPLNX_EXPORT PipelineProfiler : protected PipelineNodeObserver
+{
+public:
+  static constexpr int32 k_FailedToCreateDirectory_Code = -4600;
+  static constexpr int32 k_FileCouldNotOpen_Code = -4601;
+
+  /**
+   * @brief Constructs a PipelineProfiler that enables profiling on the pipeline
+   * and observes it. Profiling is disabled again when the profiler is destroyed
+   * so the profiler must not outlive the pipeline.
+   * @param pipeline
+   */
+  explicit PipelineProfiler(Pipeline* pipeline);
+
+  PipelineProfiler(const PipelineProfiler&) = delete;
+  PipelineProfiler(PipelineProfiler&&) = delete;
+  PipelineProfiler& operator=(const PipelineProfiler&) = delete;
+  PipelineProfiler& operator=(PipelineProfiler&&) = delete;
+
+  ~PipelineProfiler() noexcept override;
+
+  /**
+   * @brief Returns the profiles of the executed filters in execution order.
+   * @return const std::vector<FilterProfile>&
+   */
+  const std::vector<FilterProfile>& getProfiles() const;
+
+  /**
+   * @brief Removes all collected profiles.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the collected profiles in the Chrome trace event format.
+   * Each filter is a complete event with nested preflight and execute events.
+   * Memory, peak RSS and thread utilization are emitted as counter events.
+   * @return nlohmann::json
+   */
+  nlohmann::json toChromeTraceJson() const;
+
+  /**
+   * @brief Writes the Chrome trace JSON to the specified file.
+   * @param filePath
+   * @return Result<>
+   */
+  Result<> writeChromeTrace(const std::filesystem::path& filePath) const;
+
+  /**
+   * @brief Returns a table of the executed filters sorted by wall time with
+   * the slowest filter first.
+   * @return std::string
+   */
+  std::string toSummaryString() const;
+
+protected:
+  /**
+   * @brief Collects FilterProfileMessages emitted by the observed pipeline.
+   * @param node
+   * @param msg
+   */
+  void onNotify(AbstractPipelineNode* node, const std::shared_ptr<AbstractPipelineMessage>& msg) override;
+
+private:
+  Pipeline* m_Pipeline = nullptr;
+  std::string m_PipelineName;
+  std::vector<FilterProfile> m_Profiles;
+};
+} // namespace nx::core
@@ -1,9 +1,18 @@
 #pragma once
 
+#include "simplnx/Common/Range.hpp"
 #include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/simplnx_export.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
 
 namespace nx::core::ClusterUtilities
 {
@@ -18,66 +27,68 @@ enum SIMPLNX_EXPORT DistanceMetric
 };
 
 /**
- * @brief The DistanceTemplate class contains a templated function getDistance to find the distance, via a variety of
- * metrics, between two vectors of arbitrary dimensions. The developer should ensure that the pointers passed to
- * getDistance do indeed contain vectors of the same component dimensions and start at the desired tuples.
+ * @brief The number of tuples the clustering kernels read through one chunk view.
  */
-template <typename leftDataType, typename rightDataType>
-float64 GetDistance(const leftDataType& leftVector, usize leftOffset, const rightDataType& rightVector, usize rightOffset, usize compDims, DistanceMetric distMetric)
-{
-  float64 dist = 0.0;
-  float64 lVal = 0.0;
-  float64 rVal = 0.0;
+inline constexpr usize k_BlockTuples = 4096;
 
-  float64 epsilon = std::numeric_limits<float64>::min();
+/**
+ * @brief The maximum number of partial sums that are reduced when computing cluster means.
+ * The tuples are split into a fixed number of partitions so that the reduction order, and
+ * therefore the means, do not depend on how the work was scheduled.
+ */
+inline constexpr usize k_MaxPartialSums = 64;
 
-  switch(distMetric)
+/**
+ * @brief Computes the distance between two vectors of compDims values with the metric selected at compile
+ * time. The vectors may be raw pointers or any type with an index operator so the inner loops can be
+ * vectorized by the compiler when the values are contiguous in memory.
+ */
+template <DistanceMetric MetricV, typename LeftT, typename RightT>
+float64 ComputeDistance(const LeftT& leftVector, usize leftOffset, const RightT& rightVector, usize rightOffset, usize compDims)
+{
+  constexpr float64 k_Epsilon = std::numeric_limits<float64>::min();
+
+  if constexpr(MetricV == Euclidean || MetricV == SquaredEuclidean)
   {
-  case Euclidean: {
+    float64 dist = 0.0;
     for(usize i = 0; i < compDims; i++)
     {
-      lVal = static_cast<float64>(leftVector[i + leftOffset]);
-      rVal = static_cast<float64>(rightVector[i + rightOffset]);
-      dist += (lVal - rVal) * (lVal - rVal);
+      const float64 diff = static_cast<float64>(leftVector[i + leftOffset]) - static_cast<float64>(rightVector[i + rightOffset]);
+      dist += diff * diff;
     }
-
-    dist = std::sqrt(dist);
-    break;
-  }
-  case SquaredEuclidean: {
-    for(usize i = 0; i < compDims; i++)
+    if constexpr(MetricV == Euclidean)
     {
-      lVal = static_cast<float64>(leftVector[i + leftOffset]);
-      rVal = static_cast<float64>(rightVector[i + rightOffset]);
-      dist += (lVal - rVal) * (lVal - rVal);
+      return std::sqrt(dist);
     }
-    break;
+    return dist;
   }
-  case Manhattan: {
+  else if constexpr(MetricV == Manhattan)
+  {
+    float64 dist = 0.0;
     for(usize i = 0; i < compDims; i++)
     {
-      lVal = static_cast<float64>(leftVector[i + leftOffset]);
-      rVal = static_cast<float64>(rightVector[i + rightOffset]);
-      dist += std::abs(lVal - rVal);
+      dist += std::abs(static_cast<float64>(leftVector[i + leftOffset]) - static_cast<float64>(rightVector[i + rightOffset]));
     }
-    break;
+    return dist;
   }
-  case Cosine: {
+  else if constexpr(MetricV == Cosine)
+  {
     float64 r = 0;
     float64 x = 0;
     float64 y = 0;
     for(usize i = 0; i < compDims; i++)
     {
-      lVal = static_cast<float64>(leftVector[i + leftOffset]);
-      rVal = static_cast<float64>(rightVector[i + rightOffset]);
+      const float64 lVal = static_cast<float64>(leftVector[i + leftOffset]);
+      const float64 rVal = static_cast<float64>(rightVector[i + rightOffset]);
       r += lVal * rVal;
       x += lVal * lVal;
       y += rVal * rVal;
     }
-    dist = 1 - (r / (sqrt(x * y) + epsilon));
-    break;
+    return 1 - (r / (std::sqrt(x * y) + k_Epsilon));
   }
-  case Pearson: {
+  else
+  {
+    static_assert(MetricV == Pearson || MetricV == SquaredPearson, "Unhandled DistanceMetric");
     float64 r = 0;
     float64 x = 0;
     float64 y = 0;
@@ -85,53 +96,668 @@ float64 GetDistance(const leftDataType& leftVector, usize leftOffset, const righ
     float64 yAvg = 0;
     for(usize i = 0; i < compDims; i++)
     {
-      lVal = static_cast<float64>(leftVector[i + leftOffset]);
-      rVal = static_cast<float64>(rightVector[i + rightOffset]);
-      xAvg += lVal;
-      yAvg += rVal;
+      xAvg += static_cast<float64>(leftVector[i + leftOffset]);
+      yAvg += static_cast<float64>(rightVector[i + rightOffset]);
     }
     xAvg /= static_cast<float64>(compDims);
     yAvg /= static_cast<float64>(compDims);
     for(usize i = 0; i < compDims; i++)
     {
-      lVal = static_cast<float64>(leftVector[i + leftOffset]);
-      rVal = static_cast<float64>(rightVector[i + rightOffset]);
-      r += (lVal - xAvg) * (rVal - yAvg);
-      x += (lVal - xAvg) * (lVal - xAvg);
-      y += (rVal - yAvg) * (rVal - yAvg);
+      const float64 lVal = static_cast<float64>(leftVector[i + leftOffset]) - xAvg;
+      const float64 rVal = static_cast<float64>(rightVector[i + rightOffset]) - yAvg;
+      r += lVal * rVal;
+      x += lVal * lVal;
+      y += rVal * rVal;
+    }
+    if constexpr(MetricV == Pearson)
+    {
+      return 1 - (r / (std::sqrt(x * y) + k_Epsilon));
     }
-    dist = 1 - (r / (sqrt(x * y) + epsilon));
-    break;
+    return 1 - ((r * r) / ((x * y) + k_Epsilon));
   }
-  case SquaredPearson: {
-    float64 r = 0;
-    float64 x = 0;
-    float64 y = 0;
-    float64 xAvg = 0;
-    float64 yAvg = 0;
-    for(usize i = 0; i < compDims; i++)
+}
+
+/**
+ * @brief Calls func with a std::integral_constant holding distMetric so that the caller can instantiate
+ * its kernels for the selected metric at compile time instead of switching on the metric for every distance.
+ * @param distMetric
+ * @param func
+ */
+template <typename FuncT>
+decltype(auto) VisitDistanceMetric(DistanceMetric distMetric, FuncT&& func)
+{
+  switch(distMetric)
+  {
+  case SquaredEuclidean:
+    return func(std::integral_constant<DistanceMetric, SquaredEuclidean>{});
+  case Manhattan:
+    return func(std::integral_constant<DistanceMetric, Manhattan>{});
+  case Cosine:
+    return func(std::integral_constant<DistanceMetric, Cosine>{});
+  case Pearson:
+    return func(std::integral_constant<DistanceMetric, Pearson>{});
+  case SquaredPearson:
+    return func(std::integral_constant<DistanceMetric, SquaredPearson>{});
+  case Euclidean:
+  default:
+    return func(std::integral_constant<DistanceMetric, Euclidean>{});
+  }
+}
+
+/**
+ * @brief The DistanceTemplate class contains a templated function getDistance to find the distance, via a variety of
+ * metrics, between two vectors of arbitrary dimensions. The developer should ensure that the pointers passed to
+ * getDistance do indeed contain vectors of the same component dimensions and start at the desired tuples.
+ */
+template <typename leftDataType, typename rightDataType>
+float64 GetDistance(const leftDataType& leftVector, usize leftOffset, const rightDataType& rightVector, usize rightOffset, usize compDims, DistanceMetric distMetric)
+{
+  return VisitDistanceMetric(distMetric, [&](auto metric) { return ComputeDistance<decltype(metric)::value>(leftVector, leftOffset, rightVector, rightOffset, compDims); });
+}
+
+/**
+ * @brief Reads a mask view (or any type with an isTrue(index) function) into a flat vector
+ * that can be shared by the worker threads.
+ * @param mask
+ * @param numTuples
+ * @return std::vector<uint8>
+ */
+template <typename MaskT>
+std::vector<uint8> ReadMask(const MaskT& mask, usize numTuples)
+{
+  std::vector<uint8> values(numTuples, 0);
+  for(usize i = 0; i < numTuples; i++)
+  {
+    values[i] = mask.isTrue(i) ? 1 : 0;
+  }
+  return values;
+}
+
+/**
+ * @brief Calls func(blockStart, blockEnd, values) for consecutive blocks of at most k_BlockTuples tuples
+ * in [range.min(), range.max()). values points at the first component of blockStart.
+ * Returns false if the operation was canceled.
+ */
+template <typename T, typename FuncT>
+bool ForEachTupleBlock(const AbstractDataStore<T>& data, const Range& range, const std::atomic_bool& shouldCancel, FuncT&& func)
+{
+  const usize numComps = data.getNumberOfComponents();
+  for(usize blockStart = range.min(); blockStart < range.max(); blockStart += k_BlockTuples)
+  {
+    if(shouldCancel)
     {
-      lVal = static_cast<float64>(leftVector[i + leftOffset]);
-      rVal = static_cast<float64>(rightVector[i + rightOffset]);
-      xAvg += lVal;
-      yAvg += rVal;
+      return false;
     }
-    xAvg /= static_cast<float64>(compDims);
-    yAvg /= static_cast<float64>(compDims);
-    for(usize i = 0; i < compDims; i++)
+    const usize blockEnd = std::min(blockStart + k_BlockTuples, range.max());
+    typename AbstractDataStore<T>::ConstChunkView view(data, blockStart * numComps, (blockEnd - blockStart) * numComps);
+    func(blockStart, blockEnd, view.begin());
+  }
+  return true;
+}
+
+/**
+ * @brief Labels each masked tuple with 1 + the index of its nearest center. centers holds numCenters
+ * rows of compDims values. Ties go to the lowest center index. Tuples outside the mask keep their label.
+ * @return The number of tuples whose label changed
+ */
+template <DistanceMetric MetricV, typename T>
+usize AssignToNearestCenter(const AbstractDataStore<T>& data, const std::vector<uint8>& mask, const float64* centers, usize numCenters, std::vector<int32>& labels,
+                            const std::atomic_bool& shouldCancel)
+{
+  const usize numComps = data.getNumberOfComponents();
+  std::atomic<usize> numChanged = 0;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, data.getNumberOfTuples());
+  dataAlg.requireStoresInMemory({&data});
+  dataAlg.execute([&](const Range& range) {
+    usize changed = 0;
+    ForEachTupleBlock(data, range, shouldCancel, [&](usize blockStart, usize blockEnd, const T* values) {
+      for(usize i = blockStart; i < blockEnd; i++)
+      {
+        if(mask[i] == 0)
+        {
+          continue;
+        }
+        const T* tuple = values + (i - blockStart) * numComps;
+        float64 minDist = std::numeric_limits<float64>::max();
+        int32 label = labels[i];
+        for(usize j = 0; j < numCenters; j++)
+        {
+          const float64 dist = ComputeDistance<MetricV>(tuple, 0, centers, j * numComps, numComps);
+          if(dist < minDist)
+          {
+            minDist = dist;
+            label = static_cast<int32>(j + 1);
+          }
+        }
+        if(label != labels[i])
+        {
+          labels[i] = label;
+          changed++;
+        }
+      }
+    });
+    numChanged += changed;
+  });
+
+  return numChanged;
+}
+
+/**
+ * @brief Recomputes the cluster means from the labels. means holds numClusters + 1 rows of compDims values
+ * and row 0 receives the mean of the tuples labeled 0. Clusters without tuples get a mean of 0. The means are
+ * rounded through T so that they match the values stored in an array of the input type.
+ */
+template <typename T>
+void ComputeClusterMeans(const AbstractDataStore<T>& data, const std::vector<int32>& labels, usize numClusters, std::vector<float64>& means, const std::atomic_bool& shouldCancel)
+{
+  const usize numTuples = data.getNumberOfTuples();
+  const usize numComps = data.getNumberOfComponents();
+  const usize numRows = numClusters + 1;
+  const usize numPartitions = std::clamp<usize>((numTuples + k_BlockTuples - 1) / k_BlockTuples, 1, k_MaxPartialSums);
+  const usize partitionSize = (numTuples + numPartitions - 1) / numPartitions;
+
+  std::vector<float64> sums(numPartitions * numRows * numComps, 0.0);
+  std::vector<usize> counts(numPartitions * numRows, 0);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numPartitions);
+  dataAlg.requireStoresInMemory({&data});
+  dataAlg.execute([&](const Range& range) {
+    for(usize partition = range.min(); partition < range.max(); partition++)
+    {
+      float64* partitionSums = sums.data() + partition * numRows * numComps;
+      usize* partitionCounts = counts.data() + partition * numRows;
+      const Range tuples(std::min(partition * partitionSize, numTuples), std::min((partition + 1) * partitionSize, numTuples));
+      ForEachTupleBlock(data, tuples, shouldCancel, [&](usize blockStart, usize blockEnd, const T* values) {
+        for(usize i = blockStart; i < blockEnd; i++)
+        {
+          const int32 label = labels[i];
+          if(label < 0 || static_cast<usize>(label) >= numRows)
+          {
+            continue;
+          }
+          partitionCounts[label]++;
+          const T* tuple = values + (i - blockStart) * numComps;
+          float64* rowSums = partitionSums + label * numComps;
+          for(usize c = 0; c < numComps; c++)
+          {
+            rowSums[c] += static_cast<float64>(tuple[c]);
+          }
+        }
+      });
+    }
+  });
+
+  means.assign(numRows * numComps, 0.0);
+  for(usize row = 0; row < numRows; row++)
+  {
+    usize count = 0;
+    for(usize partition = 0; partition < numPartitions; partition++)
+    {
+      count += counts[partition * numRows + row];
+    }
+    if(count == 0)
+    {
+      continue;
+    }
+    for(usize c = 0; c < numComps; c++)
+    {
+      float64 sum = 0.0;
+      for(usize partition = 0; partition < numPartitions; partition++)
+      {
+        sum += sums[(partition * numRows + row) * numComps + c];
+      }
+      means[row * numComps + c] = static_cast<float64>(static_cast<T>(sum / static_cast<float64>(count)));
+    }
+  }
+}
+
+/**
+ * @brief Runs K-Means until no tuple changes cluster. means holds numClusters + 1 rows of compDims values,
+ * rows 1 to numClusters hold the initial centers on input and the final means on output. labels are read
+ * for all tuples and updated for the masked tuples.
+ *
+ * The Euclidean metrics use Hamerly's triangle inequality bounds: every tuple keeps an upper bound on the
+ * distance to its own center and a lower bound on the distance to every other center, and the centers are
+ * only searched when the bounds overlap. The resulting clusters are the same as the ones found by comparing
+ * every tuple against every center, which is what the other metrics do.
+ *
+ * progress(iteration, totalMeanShift) is called on the calling thread after every iteration.
+ * @return The number of iterations
+ */
+template <DistanceMetric MetricV, typename T, typename ProgressFuncT>
+usize RunKMeans(const AbstractDataStore<T>& data, const std::vector<uint8>& mask, usize numClusters, std::vector<int32>& labels, std::vector<float64>& means, const std::atomic_bool& shouldCancel,
+                ProgressFuncT&& progress)
+{
+  constexpr bool k_UseBounds = MetricV == Euclidean || MetricV == SquaredEuclidean;
+
+  const usize numTuples = data.getNumberOfTuples();
+  const usize numComps = data.getNumberOfComponents();
+
+  std::vector<float64> upperBounds;
+  std::vector<float64> lowerBounds;
+  std::vector<float64> halfMinSeparation;
+  std::vector<float64> shifts(numClusters, 0.0);
+  std::vector<float64> oldCenters(numClusters * numComps, 0.0);
+  if constexpr(k_UseBounds)
+  {
+    upperBounds.resize(numTuples, 0.0);
+    lowerBounds.resize(numTuples, 0.0);
+    halfMinSeparation.resize(numClusters, 0.0);
+  }
+
+  usize iteration = 1;
+  while(!shouldCancel)
+  {
+    const float64* centers = means.data() + numComps;
+    usize numChanged = 0;
+    if constexpr(k_UseBounds)
+    {
+      const bool boundsValid = iteration > 1;
+      for(usize j = 0; j < numClusters; j++)
+      {
+        float64 minSeparation = std::numeric_limits<float64>::max();
+        for(usize k = 0; k < numClusters; k++)
+        {
+          if(k != j)
+          {
+            minSeparation = std::min(minSeparation, ComputeDistance<Euclidean>(centers, j * numComps, centers, k * numComps, numComps));
+          }
+        }
+        halfMinSeparation[j] = 0.5 * minSeparation;
+      }
+
+      std::atomic<usize> changedCount = 0;
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, numTuples);
+      dataAlg.requireStoresInMemory({&data});
+      dataAlg.execute([&](const Range& range) {
+        usize changed = 0;
+        ForEachTupleBlock(data, range, shouldCancel, [&](usize blockStart, usize blockEnd, const T* values) {
+          for(usize i = blockStart; i < blockEnd; i++)
+          {
+            if(mask[i] == 0)
+            {
+              continue;
+            }
+            const T* tuple = values + (i - blockStart) * numComps;
+            if(boundsValid && labels[i] > 0)
+            {
+              const usize assigned = static_cast<usize>(labels[i] - 1);
+              const float64 bound = std::max(halfMinSeparation[assigned], lowerBounds[i]);
+              if(upperBounds[i] < bound)
+              {
+                continue;
+              }
+              upperBounds[i] = ComputeDistance<Euclidean>(tuple, 0, centers, assigned * numComps, numComps);
+              if(upperBounds[i] < bound)
+              {
+                continue;
+              }
+            }
+
+            float64 minDist = std::numeric_limits<float64>::max();
+            float64 secondDist = std::numeric_limits<float64>::max();
+            int32 label = labels[i];
+            for(usize j = 0; j < numClusters; j++)
+            {
+              const float64 dist = ComputeDistance<Euclidean>(tuple, 0, centers, j * numComps, numComps);
+              if(dist < minDist)
+              {
+                secondDist = minDist;
+                minDist = dist;
+                label = static_cast<int32>(j + 1);
+              }
+              else if(dist < secondDist)
+              {
+                secondDist = dist;
+              }
+            }
+            upperBounds[i] = minDist;
+            lowerBounds[i] = secondDist;
+            if(label != labels[i])
+            {
+              labels[i] = label;
+              changed++;
+            }
+          }
+        });
+        changedCount += changed;
+      });
+      numChanged = changedCount;
+    }
+    else
+    {
+      numChanged = AssignToNearestCenter<MetricV>(data, mask, centers, numClusters, labels, shouldCancel);
+    }
+    if(shouldCancel)
+    {
+      break;
+    }
+
+    std::copy(centers, centers + numClusters * numComps, oldCenters.begin());
+    ComputeClusterMeans(data, labels, numClusters, means, shouldCancel);
+    centers = means.data() + numComps;
+
+    float64 totalShift = 0.0;
+    usize maxShiftIndex = 0;
+    for(usize j = 0; j < numClusters; j++)
+    {
+      shifts[j] = ComputeDistance<Euclidean>(oldCenters.data(), j * numComps, centers, j * numComps, numComps);
+      totalShift += shifts[j];
+      if(shifts[j] > shifts[maxShiftIndex])
+      {
+        maxShiftIndex = j;
+      }
+    }
+
+    if constexpr(k_UseBounds)
+    {
+      float64 secondMaxShift = 0.0;
+      for(usize j = 0; j < numClusters; j++)
+      {
+        if(j != maxShiftIndex)
+        {
+          secondMaxShift = std::max(secondMaxShift, shifts[j]);
+        }
+      }
+      for(usize i = 0; i < numTuples; i++)
+      {
+        if(mask[i] == 0 || labels[i] <= 0)
+        {
+          continue;
+        }
+        const usize assigned = static_cast<usize>(labels[i] - 1);
+        upperBounds[i] += shifts[assigned];
+        lowerBounds[i] -= assigned == maxShiftIndex ? secondMaxShift : shifts[maxShiftIndex];
+      }
+    }
+
+    progress(iteration, totalShift);
+    iteration++;
+
+    if(numChanged == 0)
+    {
+      break;
+    }
+  }
+
+  return iteration - 1;
+}
+
+/**
+ * @brief Moves each medoid to the member of its cluster with the smallest summed distance to the other
+ * members. Ties go to the lowest tuple index. medoidIndices holds the tuple index of the medoid of
+ * clusters 1 to numClusters and is left unchanged for empty clusters. The members of each cluster are
+ * gathered into one contiguous buffer so the candidates can be evaluated in parallel.
+ * @return The cost of each medoid, std::numeric_limits<float64>::max() for empty clusters
+ */
+template <DistanceMetric MetricV, typename T>
+std::vector<float64> UpdateMedoids(const AbstractDataStore<T>& data, const std::vector<uint8>& mask, usize numClusters, const std::vector<int32>& labels, std::vector<usize>& medoidIndices,
+                                   const std::atomic_bool& shouldCancel)
+{
+  const usize numTuples = data.getNumberOfTuples();
+  const usize numComps = data.getNumberOfComponents();
+
+  std::vector<usize> offsets(numClusters + 2, 0);
+  for(usize i = 0; i < numTuples; i++)
+  {
+    const int32 label = labels[i];
+    if(mask[i] != 0 && label > 0 && static_cast<usize>(label) <= numClusters)
+    {
+      offsets[label + 1]++;
+    }
+  }
+  for(usize c = 1; c < offsets.size(); c++)
+  {
+    offsets[c] += offsets[c - 1];
+  }
+
+  const usize numMembers = offsets.back();
+  std::vector<usize> memberIndices(numMembers);
+  std::vector<usize> memberClusters(numMembers);
+  std::vector<float64> memberValues(numMembers * numComps);
+  {
+    std::vector<usize> insertPositions(offsets.begin(), offsets.end() - 1);
+    ForEachTupleBlock(data, Range(0, numTuples), shouldCancel, [&](usize blockStart, usize blockEnd, const T* values) {
+      for(usize i = blockStart; i < blockEnd; i++)
+      {
+        const int32 label = labels[i];
+        if(mask[i] == 0 || label <= 0 || static_cast<usize>(label) > numClusters)
+        {
+          continue;
+        }
+        const usize position = insertPositions[label]++;
+        memberIndices[position] = i;
+        memberClusters[position] = static_cast<usize>(label);
+        std::copy(values + (i - blockStart) * numComps, values + (i - blockStart + 1) * numComps, memberValues.begin() + position * numComps);
+      }
+    });
+  }
+
+  std::vector<float64> costs(numMembers, 0.0);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numMembers);
+  dataAlg.execute([&](const Range& range) {
+    for(usize candidate = range.min(); candidate < range.max(); candidate++)
     {
-      lVal = static_cast<float64>(leftVector[i + leftOffset]);
-      rVal = static_cast<float64>(rightVector[i + rightOffset]);
-      r += (lVal - xAvg) * (rVal - yAvg);
-      x += (lVal - xAvg) * (lVal - xAvg);
-      y += (rVal - yAvg) * (rVal - yAvg);
+      if(shouldCancel)
+      {
+        return;
+      }
+      const usize cluster = memberClusters[candidate];
+      float64 cost = 0.0;
+      for(usize member = offsets[cluster]; member < offsets[cluster + 1]; member++)
+      {
+        cost += ComputeDistance<MetricV>(memberValues.data(), member * numComps, memberValues.data(), candidate * numComps, numComps);
+      }
+      costs[candidate] = cost;
+    }
+  });
+
+  std::vector<float64> minCosts(numClusters, std::numeric_limits<float64>::max());
+  for(usize cluster = 1; cluster <= numClusters; cluster++)
+  {
+    for(usize candidate = offsets[cluster]; candidate < offsets[cluster + 1]; candidate++)
+    {
+      if(costs[candidate] < minCosts[cluster - 1])
+      {
+        minCosts[cluster - 1] = costs[candidate];
+        medoidIndices[cluster - 1] = memberIndices[candidate];
+      }
+    }
+  }
+
+  return minCosts;
+}
+
+/**
+ * @brief Computes the silhouette of one tuple from its average distance to every cluster.
+ * Cluster 0 is never considered as the neighboring cluster, and as in the original filter its
+ * entry holds the total distance to its members rather than the average.
+ */
+inline float64 ComputeSilhouetteValue(const float64* clusterDistances, usize numClusters, int32 label)
+{
+  const float64 inClusterDist = clusterDistances[label];
+  float64 outClusterMinDist = 0.0;
+  float64 minDist = std::numeric_limits<float64>::max();
+  for(usize j = 1; j < numClusters; j++)
+  {
+    if(static_cast<usize>(label) != j && clusterDistances[j] < minDist)
+    {
+      minDist = clusterDistances[j];
+      outClusterMinDist = minDist;
+    }
+  }
+  return (outClusterMinDist - inClusterDist) / std::max(outClusterMinDist, inClusterDist);
+}
+
+/**
+ * @brief Computes the exact silhouette of every masked tuple from its distance to every other masked tuple.
+ * numClusters is the number of labels including 0. The tuples are compared tile by tile so that both tiles
+ * stay in cache, and the distances are summed in tuple order so the result does not depend on threading.
+ */
+template <DistanceMetric MetricV, typename T>
+void ComputeSilhouette(const AbstractDataStore<T>& data, const std::vector<uint8>& mask, usize numClusters, const std::vector<int32>& labels, AbstractDataStore<float64>& output,
+                       const std::atomic_bool& shouldCancel)
+{
+  const usize numTuples = data.getNumberOfTuples();
+  const usize numComps = data.getNumberOfComponents();
+
+  std::vector<float64> numTuplesPerCluster(numClusters, 0.0);
+  for(usize i = 0; i < numTuples; i++)
+  {
+    if(mask[i] != 0 && labels[i] >= 0 && static_cast<usize>(labels[i]) < numClusters)
+    {
+      numTuplesPerCluster[labels[i]]++;
     }
-    dist = 1 - ((r * r) / ((x * y) + epsilon));
-    break;
   }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTuples);
+  dataAlg.requireStoresInMemory({&data, &output});
+  dataAlg.execute([&](const Range& range) {
+    std::vector<float64> clusterDistances(k_BlockTuples * numClusters);
+    ForEachTupleBlock(data, range, shouldCancel, [&](usize rowStart, usize rowEnd, const T* rowValues) {
+      std::fill(clusterDistances.begin(), clusterDistances.end(), 0.0);
+      bool completed = ForEachTupleBlock(data, Range(0, numTuples), shouldCancel, [&](usize colStart, usize colEnd, const T* colValues) {
+        for(usize i = rowStart; i < rowEnd; i++)
+        {
+          if(mask[i] == 0)
+          {
+            continue;
+          }
+          const T* tuple = rowValues + (i - rowStart) * numComps;
+          float64* distances = clusterDistances.data() + (i - rowStart) * numClusters;
+          for(usize j = colStart; j < colEnd; j++)
+          {
+            const int32 label = labels[j];
+            if(mask[j] != 0 && label >= 0 && static_cast<usize>(label) < numClusters)
+            {
+              distances[label] += ComputeDistance<MetricV>(tuple, 0, colValues, (j - colStart) * numComps, numComps);
+            }
+          }
+        }
+      });
+      if(!completed)
+      {
+        return;
+      }
+
+      for(usize i = rowStart; i < rowEnd; i++)
+      {
+        const int32 label = labels[i];
+        if(mask[i] == 0 || label < 0 || static_cast<usize>(label) >= numClusters)
+        {
+          continue;
+        }
+        float64* distances = clusterDistances.data() + (i - rowStart) * numClusters;
+        // Cluster 0 keeps its total distance, see ComputeSilhouetteValue
+        for(usize j = 1; j < numClusters; j++)
+        {
+          distances[j] /= numTuplesPerCluster[j];
+        }
+        output.setValue(i, ComputeSilhouetteValue(distances, numClusters, label));
+      }
+    });
+  });
+}
+
+/**
+ * @brief Approximates the silhouette of every masked tuple by comparing it against at most samplesPerCluster
+ * randomly chosen members of each cluster instead of every tuple, which reduces the cost from
+ * O(tuples^2) to O(tuples * clusters * samplesPerCluster). Clusters with no more members than
+ * samplesPerCluster are compared in full, so the result matches ComputeSilhouette for them.
+ */
+template <DistanceMetric MetricV, typename T>
+void ComputeSampledSilhouette(const AbstractDataStore<T>& data, const std::vector<uint8>& mask, usize numClusters, const std::vector<int32>& labels, usize samplesPerCluster,
+                              std::mt19937_64::result_type seed, AbstractDataStore<float64>& output, const std::atomic_bool& shouldCancel)
+{
+  const usize numTuples = data.getNumberOfTuples();
+  const usize numComps = data.getNumberOfComponents();
+
+  // Reservoir sample every cluster in a single pass over the labels
+  std::mt19937_64 generator(seed);
+  std::vector<std::vector<usize>> samples(numClusters);
+  std::vector<usize> numSeen(numClusters, 0);
+  for(usize i = 0; i < numTuples; i++)
+  {
+    const int32 label = labels[i];
+    if(mask[i] == 0 || label < 0 || static_cast<usize>(label) >= numClusters)
+    {
+      continue;
+    }
+    std::vector<usize>& clusterSamples = samples[label];
+    usize seen = numSeen[label]++;
+    if(clusterSamples.size() < samplesPerCluster)
+    {
+      clusterSamples.push_back(i);
+      continue;
+    }
+    std::uniform_int_distribution<usize> distribution(0, seen);
+    usize slot = distribution(generator);
+    if(slot < samplesPerCluster)
+    {
+      clusterSamples[slot] = i;
+    }
+  }
+
+  std::vector<usize> offsets(numClusters + 1, 0);
+  for(usize c = 0; c < numClusters; c++)
+  {
+    // Sorting keeps the summation in tuple order
+    std::sort(samples[c].begin(), samples[c].end());
+    offsets[c + 1] = offsets[c] + samples[c].size();
+  }
+  std::vector<float64> sampleValues(offsets.back() * numComps);
+  for(usize c = 0; c < numClusters; c++)
+  {
+    for(usize s = 0; s < samples[c].size(); s++)
+    {
+      for(usize comp = 0; comp < numComps; comp++)
+      {
+        sampleValues[(offsets[c] + s) * numComps + comp] = static_cast<float64>(data.getValue(samples[c][s] * numComps + comp));
+      }
+    }
   }
 
-  // Return the correct primitive type for distance
-  return dist;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTuples);
+  dataAlg.requireStoresInMemory({&data, &output});
+  dataAlg.execute([&](const Range& range) {
+    std::vector<float64> clusterDistances(numClusters);
+    ForEachTupleBlock(data, range, shouldCancel, [&](usize blockStart, usize blockEnd, const T* values) {
+      for(usize i = blockStart; i < blockEnd; i++)
+      {
+        const int32 label = labels[i];
+        if(mask[i] == 0 || label < 0 || static_cast<usize>(label) >= numClusters)
+        {
+          continue;
+        }
+        const T* tuple = values + (i - blockStart) * numComps;
+        for(usize c = 0; c < numClusters; c++)
+        {
+          float64 sum = 0.0;
+          for(usize s = offsets[c]; s < offsets[c + 1]; s++)
+          {
+            sum += ComputeDistance<MetricV>(tuple, 0, sampleValues.data(), s * numComps, numComps);
+          }
+          const usize numSamples = offsets[c + 1] - offsets[c];
+          if(c == 0)
+          {
+            // Cluster 0 keeps the total like ComputeSilhouette, so the sampled sum is scaled up to every member
+            clusterDistances[c] = numSamples == numSeen[c] ? sum : sum / static_cast<float64>(numSamples) * static_cast<float64>(numSeen[c]);
+          }
+          else
+          {
+            clusterDistances[c] = numSamples == 0 ? std::numeric_limits<float64>::quiet_NaN() : sum / static_cast<float64>(numSamples);
+          }
+        }
+        output.setValue(i, ComputeSilhouetteValue(clusterDistances.data(), numClusters, label));
+      }
+    });
+  });
 }
 } // namespace nx::core::ClusterUtilities
@@ -28,6 +28,26 @@ struct InitializeNeighborListFunctor
     neighborListPtr->setList(neighborListPtr->getNumberOfTuples() - 1, typename NeighborList<T>::SharedVectorType(new typename NeighborList<T>::VectorType));
   }
 };
+
+template <typename T>
+void PackMaskValues(const IDataArray& maskArray, std::vector<uint64>& words)
+{
+  // Number of values read from the mask per bulk copy. A multiple of 64 so every chunk starts on a word.
+  constexpr usize k_ChunkSize = 65536;
+
+  const auto& maskStore = maskArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+  const usize numValues = maskStore.getSize();
+  for(usize chunkStart = 0; chunkStart < numValues; chunkStart += k_ChunkSize)
+  {
+    const usize chunkSize = std::min(k_ChunkSize, numValues - chunkStart);
+    const auto maskChunk = maskStore.createChunkView(chunkStart, chunkSize);
+    for(usize chunkIndex = 0; chunkIndex < chunkSize; chunkIndex++)
+    {
+      const usize index = chunkStart + chunkIndex;
+      words[index / 64] |= static_cast<uint64>(maskChunk[chunkIndex] != static_cast<T>(0)) << (index % 64);
+    }
+  }
+}
 } // namespace
 
 namespace nx::core
@@ -297,6 +317,26 @@ std::unique_ptr<MaskCompare> InstantiateMaskCompare(IDataArray& maskArray)
   }
 }
 
+//-----------------------------------------------------------------------------
+PackedMaskView::PackedMaskView(const IDataArray& maskArray)
+: m_Words((maskArray.getSize() + 63) / 64, 0)
+, m_Size(maskArray.getSize())
+{
+  switch(maskArray.getDataType())
+  {
+  case DataType::boolean: {
+    PackMaskValues<bool>(maskArray, m_Words);
+    break;
+  }
+  case DataType::uint8: {
+    PackMaskValues<uint8>(maskArray, m_Words);
+    break;
+  }
+  default:
+    throw std::runtime_error("PackedMaskView: The Mask Array being used is NOT of type bool or uint8.");
+  }
+}
+
 //-----------------------------------------------------------------------------
 bool ConvertIDataArray(const std::shared_ptr<IDataArray>& dataArray, const std::string& dataFormat)
 {
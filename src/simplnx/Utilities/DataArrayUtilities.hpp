@@ -803,7 +803,8 @@ SIMPLNX_EXPORT void InitializeNeighborList(DataStructure& dataStructure, const D
 
 /**
  * @brief These structs and functions are meant to make using a "mask array" or "Good Voxels Array" easier
- * for the developer. There is virtual function call overhead with using these structs and functions.
+ * for the developer. There is virtual function call overhead with using these structs and functions. Per
+ * element loops should use the mask views obtained through ExecuteWithMaskView() instead.
  *
  * An example use of these functions would be the following:
  * @code
@@ -958,6 +959,186 @@ SIMPLNX_EXPORT std::unique_ptr<MaskCompare> InstantiateMaskCompare(DataStructure
  */
 SIMPLNX_EXPORT std::unique_ptr<MaskCompare> InstantiateMaskCompare(IDataArray& maskArrayPtr);
 
+/**
+ * @brief Read-only view of a `bool` or `uint8` mask array that is held contiguously in memory. The
+ * values are read straight from the DataStore's memory so isTrue() does not involve any virtual calls.
+ * Use ExecuteWithMaskView() to obtain the view that matches a mask array.
+ * @tparam T bool or uint8
+ */
+template <typename T>
+class MaskView
+{
+public:
+  static_assert(std::is_same_v<T, bool> || std::is_same_v<T, uint8>, "MaskView only supports bool and uint8 mask arrays");
+
+  explicit MaskView(nonstd::span<const T> values)
+  : m_Values(values)
+  {
+  }
+
+  /**
+   * @brief Returns `true` if the value at the index is `true` or non-zero.
+   * @param index
+   * @return bool
+   */
+  bool isTrue(usize index) const
+  {
+    return m_Values[index] != static_cast<T>(0);
+  }
+
+  /**
+   * @brief Returns `true` if both values are `true` or non-zero.
+   * @param indexA
+   * @param indexB
+   * @return bool
+   */
+  bool bothTrue(usize indexA, usize indexB) const
+  {
+    return isTrue(indexA) && isTrue(indexB);
+  }
+
+  /**
+   * @brief Returns `true` if both values are `false` or zero.
+   * @param indexA
+   * @param indexB
+   * @return bool
+   */
+  bool bothFalse(usize indexA, usize indexB) const
+  {
+    return !isTrue(indexA) && !isTrue(indexB);
+  }
+
+  usize size() const
+  {
+    return m_Values.size();
+  }
+
+private:
+  nonstd::span<const T> m_Values;
+};
+
+/**
+ * @brief Read-only copy of a `bool` or `uint8` mask array with one bit per value. It is used for mask
+ * arrays that are not held contiguously in memory, such as out-of-core arrays, and where a single mask
+ * type is needed independent of the type of the mask array.
+ */
+class SIMPLNX_EXPORT PackedMaskView
+{
+public:
+  /**
+   * @brief Reads the mask array in bulk and packs it. Throws a std::runtime_error if the mask array is
+   * not of type bool or uint8.
+   * @param maskArray
+   */
+  explicit PackedMaskView(const IDataArray& maskArray);
+
+  bool isTrue(usize index) const
+  {
+    return ((m_Words[index / 64] >> (index % 64)) & 1) != 0;
+  }
+
+  bool bothTrue(usize indexA, usize indexB) const
+  {
+    return isTrue(indexA) && isTrue(indexB);
+  }
+
+  bool bothFalse(usize indexA, usize indexB) const
+  {
+    return !isTrue(indexA) && !isTrue(indexB);
+  }
+
+  usize size() const
+  {
+    return m_Size;
+  }
+
+private:
+  std::vector<uint64> m_Words;
+  usize m_Size = 0;
+};
+
+/**
+ * @brief Mask view used when no mask array is selected. Every value is `true`, so the mask checks
+ * compile away.
+ */
+struct UnmaskedView
+{
+  constexpr bool isTrue(usize /* index */) const
+  {
+    return true;
+  }
+
+  constexpr bool bothTrue(usize /* indexA */, usize /* indexB */) const
+  {
+    return true;
+  }
+
+  constexpr bool bothFalse(usize /* indexA */, usize /* indexB */) const
+  {
+    return false;
+  }
+};
+
+/**
+ * @brief Calls func(maskView, args...) with the mask view that matches the mask array. The type of the
+ * mask is resolved once so that per element loops inside func only make inline calls:
+ *
+ * - nullptr: UnmaskedView
+ * - `bool` or `uint8` array held contiguously in memory: MaskView<bool> or MaskView<uint8>
+ * - any other `bool` or `uint8` array: PackedMaskView
+ *
+ * An example use of this function would be the following:
+ * @code
+ *  const IDataArray* maskArray = useMask ? dataStructure.getDataAs<IDataArray>(maskArrayPath) : nullptr;
+ *  ExecuteWithMaskView(maskArray, [&](const auto& mask) {
+ *    for(usize i = 0; i < numTuples; i++)
+ *    {
+ *      if(mask.isTrue(i))
+ *      {
+ *        // Do something with the tuple...
+ *      }
+ *    }
+ *  });
+ * @endcode
+ *
+ * Throws a std::runtime_error if the mask array is not of type bool or uint8.
+ * @param maskArray The mask array or nullptr if no mask is used
+ * @param func
+ * @param args
+ */
+template <class FuncT, class... ArgsT>
+auto ExecuteWithMaskView(const IDataArray* maskArray, FuncT&& func, ArgsT&&... args)
+{
+  if(maskArray == nullptr)
+  {
+    return func(UnmaskedView{}, std::forward<ArgsT>(args)...);
+  }
+
+  switch(maskArray->getDataType())
+  {
+  case DataType::boolean: {
+    const nonstd::span<const bool> values = maskArray->template getIDataStoreRefAs<AbstractDataStore<bool>>().getContiguousSpan();
+    if(values.data() != nullptr)
+    {
+      return func(MaskView<bool>(values), std::forward<ArgsT>(args)...);
+    }
+    break;
+  }
+  case DataType::uint8: {
+    const nonstd::span<const uint8> values = maskArray->template getIDataStoreRefAs<AbstractDataStore<uint8>>().getContiguousSpan();
+    if(values.data() != nullptr)
+    {
+      return func(MaskView<uint8>(values), std::forward<ArgsT>(args)...);
+    }
+    break;
+  }
+  default:
+    throw std::runtime_error("ExecuteWithMaskView: The Mask Array being used is NOT of type bool or uint8.");
+  }
+
+  return func(PackedMaskView(*maskArray), std::forward<ArgsT>(args)...);
+}
+
 template <typename T>
 class CopyTupleUsingIndexList
 {
@@ -1394,7 +1575,7 @@ public:
       using NeighborListType = NeighborList<T>;
       auto* destArrayPtr = dynamic_cast<NeighborListType*>(m_DestCellArray);
       // Make sure the destination array is allocated AND each tuple list is initialized, so we can use the [] operator to copy over the data
-      if(destArrayPtr->getValues().empty() || destArrayPtr->getList(0) == nullptr)
+      if(destArrayPtr->getNumberOfLists() == 0 || destArrayPtr->getList(0) == nullptr)
       {
         destArrayPtr->addEntry(destArrayPtr->getNumberOfTuples() - 1, 0);
       }
@@ -1470,7 +1651,7 @@ public:
       using NeighborListT = NeighborList<T>;
       auto* destArray = dynamic_cast<NeighborListT*>(m_DestCellArray);
       // Make sure the destination array is allocated AND each tuple list is initialized, so we can use the [] operator to copy over the data
-      if(destArray->getValues().empty() || destArray->getList(0) == nullptr)
+      if(destArray->getNumberOfLists() == 0 || destArray->getList(0) == nullptr)
       {
         destArray->addEntry(destArray->getNumberOfTuples() - 1, 0);
       }
@@ -6,9 +6,18 @@
 #include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/DataStructure/Geometry/IGeometry.hpp"
 #include "simplnx/Utilities/Math/GeometryMath.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include <Eigen/Dense>
 
+#include <nonstd/span.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
 namespace nx::core
 {
 namespace GeometryHelpers
@@ -216,52 +225,197 @@ ErrorCode FindElementNeighbors(const DataArray<K>* elemList, const DynamicListAr
 }
 
 /**
- * @brief
+ * @brief Local vertex indices of the edges of a tetrahedron
+ */
+inline constexpr std::array<std::array<usize, 2>, 6> k_TetEdgeVertices = {{{0, 1}, {0, 2}, {1, 2}, {0, 3}, {1, 3}, {2, 3}}};
+
+/**
+ * @brief Local vertex indices of the edges of a hexahedron
+ */
+inline constexpr std::array<std::array<usize, 2>, 12> k_HexEdgeVertices = {{{0, 1}, {1, 2}, {2, 3}, {3, 0}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {4, 5}, {5, 6}, {6, 7}, {7, 4}}};
+
+/**
+ * @brief Local vertex indices of the faces of a tetrahedron
+ */
+inline constexpr std::array<std::array<usize, 3>, 4> k_TetFaceVertices = {{{0, 1, 2}, {1, 2, 3}, {0, 2, 3}, {0, 1, 3}}};
+
+/**
+ * @brief Local vertex indices of the faces of a hexahedron
+ */
+inline constexpr std::array<std::array<usize, 4>, 6> k_HexFaceVertices = {{{0, 1, 5, 4}, {1, 2, 6, 5}, {2, 3, 7, 6}, {3, 0, 4, 7}, {0, 1, 2, 3}, {4, 5, 6, 7}}};
+
+/**
+ * @brief Collects the keys (edges or faces) listed in keyVertices from every element of elemList
+ * and writes the distinct keys into keyList. The vertices of each key are sorted ascending and the
+ * keys are written in lexicographic order. If unsharedOnly is true only the keys that occur exactly
+ * once are written.
+ *
+ * The keys are emitted in parallel into a flat array and grouped by their first vertex with a
+ * parallel counting sort, which is a single radix pass keyed on the vertex id. Each group is then
+ * sorted and deduplicated on its own, so no per key allocation is made.
  * @tparam T
- * @param tetList
- * @param edgeList
+ * @tparam KeySize Number of vertices in a key
+ * @param elemList
+ * @param keyVertices Local vertex indices of every key of an element
+ * @param keyList
+ * @param unsharedOnly
  */
-template <typename T>
-void FindTetEdges(const DataArray<T>* tetList, DataArray<T>* edgeList)
+template <typename T, usize KeySize>
+void FindElementKeys(const DataArray<T>* elemList, nonstd::span<const std::array<usize, KeySize>> keyVertices, DataArray<T>* keyList, bool unsharedOnly)
 {
-  const usize numElems = tetList->getNumberOfTuples();
-  const usize numVertsPerTet = tetList->getNumberOfComponents();
-  auto& tets = *tetList;
+  using KeyType = std::array<T, KeySize>;
 
-  std::set<std::pair<T, T>> edgeSet;
+  const AbstractDataStore<T>& elemStore = elemList->getDataStoreRef();
+  const usize numElems = elemList->getNumberOfTuples();
+  const usize numVertsPerElem = elemList->getNumberOfComponents();
+  const usize numKeysPerElem = keyVertices.size();
+  const usize numKeys = numElems * numKeysPerElem;
 
-  for(usize i = 0; i < numElems; i++)
+  if(numKeys == 0)
   {
-    const usize offset = i * numVertsPerTet;
+    keyList->getDataStore()->resizeTuples({0});
+    return;
+  }
 
-    std::vector<T> edge0 = {tets[offset + 0], tets[offset + 1]};
-    std::vector<T> edge1 = {tets[offset + 0], tets[offset + 2]};
-    std::vector<T> edge2 = {tets[offset + 1], tets[offset + 2]};
-    std::vector<T> edge3 = {tets[offset + 0], tets[offset + 3]};
-    std::vector<T> edge4 = {tets[offset + 1], tets[offset + 3]};
-    std::vector<T> edge5 = {tets[offset + 2], tets[offset + 3]};
-    std::list<std::vector<T>> edgeVecList = {edge0, edge1, edge2, edge3, edge4, edge5};
+  // Emit the key of every edge/face of every element with its vertices sorted
+  std::vector<KeyType> keys(numKeys);
+  std::atomic<T> maxFirstVert = 0;
+  ParallelDataAlgorithm emitAlg;
+  emitAlg.setRange(0, numElems);
+  emitAlg.requireStoresInMemory({&elemStore});
+  emitAlg.execute([&](const Range& range) {
+    const auto elemView = elemStore.createChunkView(range.min() * numVertsPerElem, range.size() * numVertsPerElem);
+    T rangeMaxFirstVert = 0;
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      const usize offset = (i - range.min()) * numVertsPerElem;
+      for(usize k = 0; k < numKeysPerElem; k++)
+      {
+        KeyType& key = keys[i * numKeysPerElem + k];
+        for(usize c = 0; c < KeySize; c++)
+        {
+          key[c] = elemView[offset + keyVertices[k][c]];
+        }
+        std::sort(key.begin(), key.end());
+        rangeMaxFirstVert = std::max(rangeMaxFirstVert, key[0]);
+      }
+    }
+    T currentMax = maxFirstVert.load();
+    while(currentMax < rangeMaxFirstVert && !maxFirstVert.compare_exchange_weak(currentMax, rangeMaxFirstVert))
+    {
+    }
+  });
 
-    for(auto&& uEdge : edgeVecList)
+  // Counting sort of the keys on their first vertex
+  const usize numBuckets = static_cast<usize>(maxFirstVert.load()) + 1;
+  std::vector<std::atomic<usize>> bucketCursors(numBuckets);
+  ParallelDataAlgorithm keyAlg;
+  keyAlg.setRange(0, numKeys);
+  keyAlg.execute([&](const Range& range) {
+    for(usize i = range.min(); i < range.max(); i++)
     {
-      std::sort(uEdge.begin(), uEdge.end());
-      std::pair<T, T> edge = std::make_pair(uEdge[0], uEdge[1]);
-      edgeSet.insert(edge);
+      bucketCursors[static_cast<usize>(keys[i][0])].fetch_add(1, std::memory_order_relaxed);
     }
+  });
+
+  std::vector<usize> bucketStarts(numBuckets + 1, 0);
+  for(usize b = 0; b < numBuckets; b++)
+  {
+    bucketStarts[b + 1] = bucketStarts[b] + bucketCursors[b].load(std::memory_order_relaxed);
+    bucketCursors[b].store(bucketStarts[b], std::memory_order_relaxed);
+  }
+
+  std::vector<KeyType> sortedKeys(numKeys);
+  keyAlg.execute([&](const Range& range) {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      sortedKeys[bucketCursors[static_cast<usize>(keys[i][0])].fetch_add(1, std::memory_order_relaxed)] = keys[i];
+    }
+  });
+  keys = std::vector<KeyType>();
+  bucketCursors = std::vector<std::atomic<usize>>();
+
+  // Calls func for every key of the bucket that belongs in the output
+  auto forEachOutputKey = [&](usize bucket, auto&& func) {
+    auto first = sortedKeys.begin() + bucketStarts[bucket];
+    const auto last = sortedKeys.begin() + bucketStarts[bucket + 1];
+    while(first != last)
+    {
+      const auto runEnd = std::find_if(first + 1, last, [&first](const KeyType& key) { return key != *first; });
+      if(!unsharedOnly || runEnd - first == 1)
+      {
+        func(*first);
+      }
+      first = runEnd;
+    }
+  };
+
+  // Sort the keys within each bucket and count the ones that will be written
+  std::vector<usize> bucketOutputStarts(numBuckets + 1, 0);
+  ParallelDataAlgorithm bucketAlg;
+  bucketAlg.setRange(0, numBuckets);
+  bucketAlg.execute([&](const Range& range) {
+    for(usize b = range.min(); b < range.max(); b++)
+    {
+      std::sort(sortedKeys.begin() + bucketStarts[b], sortedKeys.begin() + bucketStarts[b + 1]);
+      usize count = 0;
+      forEachOutputKey(b, [&count](const KeyType&) { count++; });
+      bucketOutputStarts[b + 1] = count;
+    }
+  });
+  for(usize b = 0; b < numBuckets; b++)
+  {
+    bucketOutputStarts[b + 1] += bucketOutputStarts[b];
   }
 
-  edgeList->getDataStore()->resizeTuples({edgeSet.size()});
-  auto& uEdges = *edgeList;
-  T index = 0;
+  const usize numOutputKeys = bucketOutputStarts[numBuckets];
+  std::vector<T> output(numOutputKeys * KeySize);
+  bucketAlg.execute([&](const Range& range) {
+    for(usize b = range.min(); b < range.max(); b++)
+    {
+      usize index = bucketOutputStarts[b] * KeySize;
+      forEachOutputKey(b, [&output, &index](const KeyType& key) {
+        std::copy(key.begin(), key.end(), output.begin() + index);
+        index += KeySize;
+      });
+    }
+  });
 
-  for(auto& edge : edgeSet)
+  keyList->getDataStore()->resizeTuples({numOutputKeys});
+  Result<> result = keyList->getDataStoreRef().copyFromBuffer(0, nonstd::span<const T>(output.data(), output.size()));
+  if(result.invalid())
   {
-    uEdges[2 * index] = edge.first;
-    uEdges[2 * index + 1] = edge.second;
-    ++index;
+    throw std::runtime_error(result.errors()[0].message);
   }
 }
 
+/**
+ * @brief Local vertex indices of the edges of a 2D element with numVertsPerElem vertices
+ * @param numVertsPerElem
+ * @return std::vector<std::array<usize, 2>>
+ */
+inline std::vector<std::array<usize, 2>> Create2DElementEdgeVertices(usize numVertsPerElem)
+{
+  std::vector<std::array<usize, 2>> edgeVertices(numVertsPerElem);
+  for(usize j = 0; j < numVertsPerElem; j++)
+  {
+    edgeVertices[j] = {j, (j + 1) % numVertsPerElem};
+  }
+  return edgeVertices;
+}
+
+/**
+ * @brief
+ * @tparam T
+ * @param tetList
+ * @param edgeList
+ */
+template <typename T>
+void FindTetEdges(const DataArray<T>* tetList, DataArray<T>* edgeList)
+{
+  FindElementKeys<T, 2>(tetList, k_TetEdgeVertices, edgeList, false);
+}
+
 /**
  * @brief
  * @tparam T
@@ -271,53 +425,7 @@ void FindTetEdges(const DataArray<T>* tetList, DataArray<T>* edgeList)
 template <typename T>
 void FindHexEdges(const DataArray<T>* hexList, DataArray<T>* edge_List)
 {
-  const usize numElems = hexList->getNumberOfTuples();
-  const usize numVertsPerHex = hexList->getNumberOfComponents();
-
-  auto& hexas = *hexList;
-
-  std::set<std::pair<T, T>> edgeSet;
-
-  for(usize i = 0; i < numElems; i++)
-  {
-    const usize offset = i * numVertsPerHex;
-
-    std::vector<T> edge0 = {hexas[offset + 0], hexas[offset + 1]};
-    std::vector<T> edge1 = {hexas[offset + 1], hexas[offset + 2]};
-    std::vector<T> edge2 = {hexas[offset + 2], hexas[offset + 3]};
-    std::vector<T> edge3 = {hexas[offset + 3], hexas[offset + 0]};
-
-    std::vector<T> edge4 = {hexas[offset + 0], hexas[offset + 4]};
-    std::vector<T> edge5 = {hexas[offset + 1], hexas[offset + 5]};
-    std::vector<T> edge6 = {hexas[offset + 2], hexas[offset + 6]};
-    std::vector<T> edge7 = {hexas[offset + 3], hexas[offset + 7]};
-
-    std::vector<T> edge8 = {hexas[offset + 4], hexas[offset + 5]};
-    std::vector<T> edge9 = {hexas[offset + 5], hexas[offset + 6]};
-    std::vector<T> edge10 = {hexas[offset + 6], hexas[offset + 7]};
-    std::vector<T> edge11 = {hexas[offset + 7], hexas[offset + 4]};
-
-    std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5, edge6, edge7, edge8, edge9, edge10, edge11};
-
-    for(auto&& uEdge : edgeList)
-    {
-      std::sort(uEdge.begin(), uEdge.end());
-      std::pair<T, T> edge = std::make_pair(uEdge[0], uEdge[1]);
-      edgeSet.insert(edge);
-    }
-  }
-
-  typename std::set<std::pair<T, T>>::iterator setIter;
-  edge_List->getDataStore()->resizeTuples({edgeSet.size()});
-  auto& uEdges = *edge_List;
-  T index = 0;
-
-  for(auto edge : edgeSet)
-  {
-    uEdges[2 * index] = edge.first;
-    uEdges[2 * index + 1] = edge.second;
-    ++index;
-  }
+  FindElementKeys<T, 2>(hexList, k_HexEdgeVertices, edge_List, false);
 }
 
 /**
@@ -329,41 +437,7 @@ void FindHexEdges(const DataArray<T>* hexList, DataArray<T>* edge_List)
 template <typename T>
 void FindTetFaces(const DataArray<T>* tetList, DataArray<T>* faceList)
 {
-  auto& tets = *tetList;
-  const usize numElems = tetList->getNumberOfTuples();
-  const usize numVertsPerTet = tetList->getNumberOfComponents();
-
-  std::set<std::tuple<T, T, T>> faceSet;
-
-  for(usize i = 0; i < numElems; i++)
-  {
-    const usize offset = i * numVertsPerTet;
-
-    std::vector<T> tri0 = {tets[offset + 0], tets[offset + 1], tets[offset + 2]};
-    std::vector<T> tri1 = {tets[offset + 1], tets[offset + 2], tets[offset + 3]};
-    std::vector<T> tri2 = {tets[offset + 0], tets[offset + 2], tets[offset + 3]};
-    std::vector<T> tri3 = {tets[offset + 0], tets[offset + 1], tets[offset + 3]};
-    std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
-
-    for(auto&& tri : triList)
-    {
-      std::sort(tri.begin(), tri.end());
-      std::tuple<T, T, T> face = std::make_tuple(tri[0], tri[1], tri[2]);
-      faceSet.insert(face);
-    }
-  }
-
-  faceList->getDataStore()->resizeTuples({faceSet.size()});
-  auto& uFaces = *faceList;
-  T index = 0;
-
-  for(auto& face : faceSet)
-  {
-    uFaces[3 * index] = std::get<0>(face);
-    uFaces[3 * index + 1] = std::get<1>(face);
-    uFaces[3 * index + 2] = std::get<2>(face);
-    ++index;
-  }
+  FindElementKeys<T, 3>(tetList, k_TetFaceVertices, faceList, false);
 }
 
 /**
@@ -375,45 +449,7 @@ void FindTetFaces(const DataArray<T>* tetList, DataArray<T>* faceList)
 template <typename T>
 void FindHexFaces(const DataArray<T>* hexList, DataArray<T>* faceList)
 {
-  auto& hexas = *hexList;
-  const usize numElems = hexList->getNumberOfTuples();
-  const usize numVertsPerHex = hexList->getNumberOfComponents();
-
-  std::set<std::tuple<T, T, T, T>> faceSet;
-
-  for(usize i = 0; i < numElems; i++)
-  {
-    const usize offset = i * numVertsPerHex;
-
-    std::vector<T> quad0 = {hexas[offset + 0], hexas[offset + 1], hexas[offset + 5], hexas[offset + 4]};
-    std::vector<T> quad1 = {hexas[offset + 1], hexas[offset + 2], hexas[offset + 6], hexas[offset + 5]};
-    std::vector<T> quad2 = {hexas[offset + 2], hexas[offset + 3], hexas[offset + 7], hexas[offset + 6]};
-    std::vector<T> quad3 = {hexas[offset + 3], hexas[offset + 0], hexas[offset + 4], hexas[offset + 7]};
-    std::vector<T> quad4 = {hexas[offset + 0], hexas[offset + 1], hexas[offset + 2], hexas[offset + 3]};
-    std::vector<T> quad5 = {hexas[offset + 4], hexas[offset + 5], hexas[offset + 6], hexas[offset + 7]};
-
-    std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
-
-    for(auto&& quad : quadList)
-    {
-      std::sort(quad.begin(), quad.end());
-      std::tuple<T, T, T, T> face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-      faceSet.insert(face);
-    }
-  }
-
-  faceList->getDataStore()->resizeTuples({faceSet.size()});
-  auto& uFaces = *faceList;
-  T index = 0;
-
-  for(auto& face : faceSet)
-  {
-    uFaces[4 * index] = std::get<0>(face);
-    uFaces[4 * index + 1] = std::get<1>(face);
-    uFaces[4 * index + 2] = std::get<2>(face);
-    uFaces[4 * index + 3] = std::get<3>(face);
-    ++index;
-  }
+  FindElementKeys<T, 4>(hexList, k_HexFaceVertices, faceList, false);
 }
 
 /**
@@ -425,56 +461,7 @@ void FindHexFaces(const DataArray<T>* hexList, DataArray<T>* faceList)
 template <typename T>
 void FindUnsharedTetEdges(const DataArray<T>* tetList, DataArray<T>* edgeList)
 {
-  auto& tets = *tetList;
-  const usize numElems = tetList->getNumberOfTuples();
-  const usize numVertsPerTet = tetList->getNumberOfComponents();
-
-  std::map<std::pair<T, T>, T> edgeMap;
-
-  for(usize i = 0; i < numElems; i++)
-  {
-    const usize offset = i * numVertsPerTet;
-
-    std::vector<T> edge0 = {tets[offset + 0], tets[offset + 1]};
-    std::vector<T> edge1 = {tets[offset + 0], tets[offset + 2]};
-    std::vector<T> edge2 = {tets[offset + 1], tets[offset + 2]};
-    std::vector<T> edge3 = {tets[offset + 0], tets[offset + 3]};
-    std::vector<T> edge4 = {tets[offset + 1], tets[offset + 3]};
-    std::vector<T> edge5 = {tets[offset + 2], tets[offset + 3]};
-    std::list<std::vector<T>> edgeVecList = {edge0, edge1, edge2, edge3, edge4, edge5};
-
-    for(auto&& uEdge : edgeVecList)
-    {
-      std::sort(uEdge.begin(), uEdge.end());
-      std::pair<T, T> edge = std::make_pair(uEdge[0], uEdge[1]);
-      edgeMap[edge]++;
-    }
-  }
-
-  typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-  while(mapIter != edgeMap.end())
-  {
-    if((*mapIter).second > 1)
-    {
-      edgeMap.erase(mapIter++);
-    }
-    else
-    {
-      ++mapIter;
-    }
-  }
-
-  edgeList->getDataStore()->resizeTuples({edgeMap.size()});
-  auto& bEdges = *edgeList;
-  T index = 0;
-
-  for(auto& pair : edgeMap)
-  {
-    bEdges[2 * index] = pair.first.first;
-    bEdges[2 * index + 1] = pair.first.second;
-    ++index;
-  }
+  FindElementKeys<T, 2>(tetList, k_TetEdgeVertices, edgeList, true);
 }
 
 /**
@@ -486,66 +473,7 @@ void FindUnsharedTetEdges(const DataArray<T>* tetList, DataArray<T>* edgeList)
 template <typename T>
 void FindUnsharedHexEdges(const DataArray<T>* hexList, DataArray<T>* edge_List)
 {
-  const usize numElems = hexList->getNumberOfTuples();
-  const usize numVertsPerHex = hexList->getNumberOfComponents();
-  auto& hexas = *hexList;
-
-  std::pair<T, T> edge;
-  std::map<std::pair<T, T>, T> edgeMap;
-
-  for(usize i = 0; i < numElems; i++)
-  {
-    const usize offset = i * numVertsPerHex;
-
-    std::vector<T> edge0 = {hexas[offset + 0], hexas[offset + 1]};
-    std::vector<T> edge1 = {hexas[offset + 1], hexas[offset + 2]};
-    std::vector<T> edge2 = {hexas[offset + 2], hexas[offset + 3]};
-    std::vector<T> edge3 = {hexas[offset + 3], hexas[offset + 0]};
-
-    std::vector<T> edge4 = {hexas[offset + 0], hexas[offset + 4]};
-    std::vector<T> edge5 = {hexas[offset + 1], hexas[offset + 5]};
-    std::vector<T> edge6 = {hexas[offset + 2], hexas[offset + 6]};
-    std::vector<T> edge7 = {hexas[offset + 3], hexas[offset + 7]};
-
-    std::vector<T> edge8 = {hexas[offset + 4], hexas[offset + 5]};
-    std::vector<T> edge9 = {hexas[offset + 5], hexas[offset + 6]};
-    std::vector<T> edge10 = {hexas[offset + 6], hexas[offset + 7]};
-    std::vector<T> edge11 = {hexas[offset + 7], hexas[offset + 4]};
-
-    std::list<std::vector<T>> edgeList = {edge0, edge1, edge2, edge3, edge4, edge5, edge6, edge7, edge8, edge9, edge10, edge11};
-
-    for(auto&& uEdge : edgeList)
-    {
-      std::sort(uEdge.begin(), uEdge.end());
-      edge = std::make_pair(uEdge[0], uEdge[1]);
-      edgeMap[edge]++;
-    }
-  }
-
-  typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-  while(mapIter != edgeMap.end())
-  {
-    if((*mapIter).second > 1)
-    {
-      edgeMap.erase(mapIter++);
-    }
-    else
-    {
-      ++mapIter;
-    }
-  }
-
-  edge_List->getDataStore()->resizeTuples({edgeMap.size()});
-  auto& bEdges = *edge_List;
-  T index = 0;
-
-  for(auto& pair : edgeMap)
-  {
-    bEdges[2 * index] = pair.first.first;
-    bEdges[2 * index + 1] = pair.first.second;
-    ++index;
-  }
+  FindElementKeys<T, 2>(hexList, k_HexEdgeVertices, edge_List, true);
 }
 
 /**
@@ -557,56 +485,7 @@ void FindUnsharedHexEdges(const DataArray<T>* hexList, DataArray<T>* edge_List)
 template <typename T>
 void FindUnsharedTetFaces(const DataArray<T>* tetList, DataArray<T>* faceList)
 {
-  const usize numElems = tetList->getNumberOfTuples();
-  const usize numVertsPerTet = tetList->getNumberOfComponents();
-  auto& tets = *tetList;
-
-  std::tuple<T, T, T> face;
-  std::map<std::tuple<T, T, T>, T> faceMap;
-
-  for(usize i = 0; i < numElems; i++)
-  {
-    const usize offset = i * numVertsPerTet;
-
-    std::vector<T> tri0 = {tets[offset + 0], tets[offset + 1], tets[offset + 2]};
-    std::vector<T> tri1 = {tets[offset + 1], tets[offset + 2], tets[offset + 3]};
-    std::vector<T> tri2 = {tets[offset + 0], tets[offset + 2], tets[offset + 3]};
-    std::vector<T> tri3 = {tets[offset + 0], tets[offset + 1], tets[offset + 3]};
-    std::list<std::vector<T>> triList = {tri0, tri1, tri2, tri3};
-
-    for(auto&& tri : triList)
-    {
-      std::sort(tri.begin(), tri.end());
-      face = std::make_tuple(tri[0], tri[1], tri[2]);
-      faceMap[face]++;
-    }
-  }
-
-  typename std::map<std::tuple<T, T, T>, T>::iterator mapIter = faceMap.begin();
-
-  while(mapIter != faceMap.end())
-  {
-    if((*mapIter).second > 1)
-    {
-      faceMap.erase(mapIter++);
-    }
-    else
-    {
-      ++mapIter;
-    }
-  }
-
-  faceList->getDataStore()->resizeTuples({faceMap.size()});
-  auto& uFaces = *faceList;
-  T index = 0;
-
-  for(auto& pair : faceMap)
-  {
-    uFaces[3 * index] = std::get<0>(pair.first);
-    uFaces[3 * index + 1] = std::get<1>(pair.first);
-    uFaces[3 * index + 2] = std::get<2>(pair.first);
-    ++index;
-  }
+  FindElementKeys<T, 3>(tetList, k_TetFaceVertices, faceList, true);
 }
 
 /**
@@ -618,60 +497,7 @@ void FindUnsharedTetFaces(const DataArray<T>* tetList, DataArray<T>* faceList)
 template <typename T>
 void FindUnsharedHexFaces(const DataArray<T>* hexList, DataArray<T>* faceList)
 {
-  auto& hexas = *hexList;
-  const usize numElems = hexList->getNumberOfTuples();
-  const usize numVertsPerHex = hexList->getNumberOfComponents();
-
-  std::tuple<T, T, T, T> face;
-  std::map<std::tuple<T, T, T, T>, T> faceMap;
-
-  for(usize i = 0; i < numElems; i++)
-  {
-    const usize offset = i * numVertsPerHex;
-
-    std::vector<T> quad0 = {hexas[offset + 0], hexas[offset + 1], hexas[offset + 5], hexas[offset + 4]};
-    std::vector<T> quad1 = {hexas[offset + 1], hexas[offset + 2], hexas[offset + 6], hexas[offset + 5]};
-    std::vector<T> quad2 = {hexas[offset + 2], hexas[offset + 3], hexas[offset + 7], hexas[offset + 6]};
-    std::vector<T> quad3 = {hexas[offset + 3], hexas[offset + 0], hexas[offset + 4], hexas[offset + 7]};
-    std::vector<T> quad4 = {hexas[offset + 0], hexas[offset + 1], hexas[offset + 2], hexas[offset + 3]};
-    std::vector<T> quad5 = {hexas[offset + 4], hexas[offset + 5], hexas[offset + 6], hexas[offset + 7]};
-
-    std::list<std::vector<T>> quadList = {quad0, quad1, quad2, quad3, quad4, quad5};
-
-    for(auto&& quad : quadList)
-    {
-      std::sort(quad.begin(), quad.end());
-      face = std::make_tuple(quad[0], quad[1], quad[2], quad[3]);
-      faceMap[face]++;
-    }
-  }
-
-  typename std::map<std::tuple<T, T, T, T>, T>::iterator mapIter = faceMap.begin();
-
-  while(mapIter != faceMap.end())
-  {
-    if((*mapIter).second > 1)
-    {
-      faceMap.erase(mapIter++);
-    }
-    else
-    {
-      ++mapIter;
-    }
-  }
-
-  faceList->getDataStore()->resizeTuples({faceMap.size()});
-  auto& uFaces = *faceList;
-  T index = 0;
-
-  for(auto& pair : faceMap)
-  {
-    uFaces[4 * index] = std::get<0>(pair.first);
-    uFaces[4 * index + 1] = std::get<1>(pair.first);
-    uFaces[4 * index + 2] = std::get<2>(pair.first);
-    uFaces[4 * index + 3] = std::get<3>(pair.first);
-    ++index;
-  }
+  FindElementKeys<T, 4>(hexList, k_HexFaceVertices, faceList, true);
 }
 
 /**
@@ -683,62 +509,8 @@ void FindUnsharedHexFaces(const DataArray<T>* hexList, DataArray<T>* faceList)
 template <typename T>
 void Find2DElementEdges(const DataArray<T>* elemList, DataArray<T>* edgeList)
 {
-  const usize numElems = elemList->getNumberOfTuples();
-  const usize numVertsPerElem = elemList->getNumberOfComponents();
-  auto& elems = *elemList;
-  T v0 = 0;
-  T v1 = 0;
-
-  std::set<std::pair<T, T>> edgeSet;
-
-  for(usize i = 0; i < numElems; i++)
-  {
-    const usize offset = i * numVertsPerElem;
-
-    for(usize j = 0; j < numVertsPerElem; j++)
-    {
-      if(j == (numVertsPerElem - 1))
-      {
-        if(elems[offset + j] > elems[offset + 0])
-        {
-          v0 = elems[offset + 0];
-          v1 = elems[offset + j];
-        }
-        else
-        {
-          v0 = elems[offset + j];
-          v1 = elems[offset + 0];
-        }
-      }
-      else
-      {
-        if(elems[offset + j] > elems[offset + j + 1])
-        {
-          v0 = elems[offset + j + 1];
-          v1 = elems[offset + j];
-        }
-        else
-        {
-          v0 = elems[offset + j];
-          v1 = elems[offset + j + 1];
-        }
-      }
-      std::pair<T, T> edge = std::make_pair(v0, v1);
-      edgeSet.insert(edge);
-    }
-  }
-
-  typename std::set<std::pair<T, T>>::iterator setIter;
-  edgeList->getDataStore()->resizeTuples({edgeSet.size()});
-  auto& uEdges = *edgeList;
-  T index = 0;
-
-  for(auto& edge : edgeSet)
-  {
-    uEdges[2 * index] = edge.first;
-    uEdges[2 * index + 1] = edge.second;
-    ++index;
-  }
+  const std::vector<std::array<usize, 2>> edgeVertices = Create2DElementEdgeVertices(elemList->getNumberOfComponents());
+  FindElementKeys<T, 2>(elemList, edgeVertices, edgeList, false);
 }
 
 /**
@@ -750,75 +522,8 @@ void Find2DElementEdges(const DataArray<T>* elemList, DataArray<T>* edgeList)
 template <typename T>
 void Find2DUnsharedEdges(const DataArray<T>* elemList, DataArray<T>* edgeList)
 {
-  auto& elems = *elemList;
-  const usize numElems = elemList->getNumberOfTuples();
-  const usize numVertsPerElem = elemList->getNumberOfComponents();
-  T v0 = 0;
-  T v1 = 0;
-
-  std::map<std::pair<T, T>, T> edgeMap;
-
-  for(usize i = 0; i < numElems; i++)
-  {
-    const usize offset = i * numVertsPerElem;
-
-    for(usize j = 0; j < numVertsPerElem; j++)
-    {
-      if(j == (numVertsPerElem - 1))
-      {
-        if(elems[offset + j] > elems[offset + 0])
-        {
-          v0 = elems[offset + 0];
-          v1 = elems[offset + j];
-        }
-        else
-        {
-          v0 = elems[offset + j];
-          v1 = elems[offset + 0];
-        }
-      }
-      else
-      {
-        if(elems[offset + j] > elems[offset + j + 1])
-        {
-          v0 = elems[offset + j + 1];
-          v1 = elems[offset + j];
-        }
-        else
-        {
-          v0 = elems[offset + j];
-          v1 = elems[offset + j + 1];
-        }
-      }
-      std::pair<T, T> edge = std::make_pair(v0, v1);
-      edgeMap[edge]++;
-    }
-  }
-
-  typename std::map<std::pair<T, T>, T>::iterator mapIter = edgeMap.begin();
-
-  while(mapIter != edgeMap.end())
-  {
-    if((*mapIter).second > 1)
-    {
-      edgeMap.erase(mapIter++);
-    }
-    else
-    {
-      ++mapIter;
-    }
-  }
-
-  edgeList->getDataStore()->resizeTuples({edgeMap.size()});
-  auto& bEdges = *edgeList;
-  T index = 0;
-
-  for(auto& edge : edgeMap)
-  {
-    bEdges[2 * index] = edge.first.first;
-    bEdges[2 * index + 1] = edge.first.second;
-    ++index;
-  }
+  const std::vector<std::array<usize, 2>> edgeVertices = Create2DElementEdgeVertices(elemList->getNumberOfComponents());
+  FindElementKeys<T, 2>(elemList, edgeVertices, edgeList, true);
 }
 } // namespace Connectivity
 
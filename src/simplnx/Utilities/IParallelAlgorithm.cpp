@@ -1,6 +1,7 @@
 #include "IParallelAlgorithm.hpp"
 
 #include "simplnx/Core/Application.hpp"
+#include "simplnx/DataStructure/MmapDataStore.hpp"
 
 namespace
 {
@@ -19,7 +20,7 @@ bool CheckStoresInMemory(const nx::core::IParallelAlgorithm::AlgorithmStores& st
       continue;
     }
 
-    if(!storePtr->getDataFormat().empty())
+    if(!nx::core::IParallelAlgorithm::IsParallelSafeFormat(storePtr->getDataFormat()))
     {
       return false;
     }
@@ -43,7 +44,7 @@ bool CheckArraysInMemory(const nx::core::IParallelAlgorithm::AlgorithmArrays& ar
       continue;
     }
 
-    if(!arrayPtr->getIDataStoreRef().getDataFormat().empty())
+    if(!nx::core::IParallelAlgorithm::IsParallelSafeFormat(arrayPtr->getIDataStoreRef().getDataFormat()))
     {
       return false;
     }
@@ -60,13 +61,20 @@ IParallelAlgorithm::IParallelAlgorithm()
 {
 #ifdef SIMPLNX_ENABLE_MULTICORE
   // Do not run OOC data in parallel by default.
-  m_RunParallel = !Application::GetOrCreateInstance()->getPreferences()->useOocData();
+  const Preferences* preferencesPtr = Application::GetOrCreateInstance()->getPreferences();
+  m_RunParallel = !preferencesPtr->useOocData() || IsParallelSafeFormat(preferencesPtr->largeDataFormat());
 #endif
 }
 
 // -----------------------------------------------------------------------------
 IParallelAlgorithm::~IParallelAlgorithm() = default;
 
+// -----------------------------------------------------------------------------
+bool IParallelAlgorithm::IsParallelSafeFormat(const std::string& dataFormat)
+{
+  return dataFormat.empty() || dataFormat == MmapDataStore<uint8>::k_DataFormat.view();
+}
+
 // -----------------------------------------------------------------------------
 bool IParallelAlgorithm::getParallelizationEnabled() const
 {
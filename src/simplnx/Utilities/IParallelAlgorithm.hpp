@@ -5,6 +5,7 @@
 #include "simplnx/DataStructure/IDataStore.hpp"
 #include "simplnx/simplnx_export.hpp"
 
+#include <string>
 #include <vector>
 
 namespace nx::core
@@ -20,6 +21,14 @@ public:
   IParallelAlgorithm& operator=(const IParallelAlgorithm&) = default;
   IParallelAlgorithm& operator=(IParallelAlgorithm&&) noexcept = default;
 
+  /**
+   * @brief Returns true if stores with the given data format can be read and written
+   * from multiple threads. In-memory and memory mapped stores are parallel safe.
+   * @param dataFormat
+   * @return bool
+   */
+  static bool IsParallelSafeFormat(const std::string& dataFormat);
+
   /**
    * @brief Returns true if parallelization is enabled.  Returns false otherwise.
    * @return
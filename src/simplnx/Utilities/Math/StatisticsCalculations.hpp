@@ -9,8 +9,8 @@
 namespace StatisticsCalculations
 {
 // -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename T, typename... Ts>
-T findMin(const C<T, Ts...>& source)
+template <class Container, typename T = std::remove_cv_t<typename Container::value_type>>
+T findMin(const Container& source)
 {
   if(source.empty())
   {
@@ -20,8 +20,8 @@ T findMin(const C<T, Ts...>& source)
 }
 
 // -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename T, typename... Ts>
-T findMax(const C<T, Ts...>& source)
+template <class Container, typename T = std::remove_cv_t<typename Container::value_type>>
+T findMax(const Container& source)
 {
   if(source.empty())
   {
@@ -31,8 +31,8 @@ T findMax(const C<T, Ts...>& source)
 }
 
 // -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename T, typename... Ts>
-std::pair<T, T> FindMinMax(const C<T, Ts...>& source)
+template <class Container, typename T = std::remove_cv_t<typename Container::value_type>>
+std::pair<T, T> FindMinMax(const Container& source)
 {
   if(source.empty())
   {
@@ -47,7 +47,7 @@ std::pair<T, T> FindMinMax(const C<T, Ts...>& source)
 template <class Container>
 auto computeSum(const Container& source)
 {
-  using T = typename Container::value_type;
+  using T = std::remove_cv_t<typename Container::value_type>;
   if constexpr(std::is_integral_v<T>)
   {
     if constexpr(std::is_signed_v<T>)
@@ -66,33 +66,33 @@ auto computeSum(const Container& source)
 }
 
 // -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename T, typename... Ts>
-float findMean(const C<T, Ts...>& source)
+template <class Container, typename T = std::remove_cv_t<typename Container::value_type>>
+auto findMean(const Container& source)
 {
-  if(source.empty())
+  if constexpr(std::is_same_v<T, bool>)
   {
-    return 0.0f;
+    if(source.empty())
+    {
+      return false;
+    }
+    size_t count = std::count(std::cbegin(source), std::cend(source), true);
+    return count >= (source.size() - count);
   }
-  float sum = static_cast<float>(computeSum(source));
-
-  return sum / static_cast<float>(source.size());
-}
-
-// -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename... Ts>
-bool findMean(const C<bool, Ts...>& source)
-{
-  if(source.empty())
+  else
   {
-    return false;
+    if(source.empty())
+    {
+      return 0.0f;
+    }
+    float sum = static_cast<float>(computeSum(source));
+
+    return sum / static_cast<float>(source.size());
   }
-  size_t count = std::count(std::cbegin(source), std::cend(source), true);
-  return count >= (source.size() - count);
 }
 
 // -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename T, typename... Ts>
-std::pair<float, float> FindSumMean(const C<T, Ts...>& source)
+template <class Container, typename T = std::remove_cv_t<typename Container::value_type>>
+std::pair<float, float> FindSumMean(const Container& source)
 {
   if(source.empty())
   {
@@ -103,8 +103,8 @@ std::pair<float, float> FindSumMean(const C<T, Ts...>& source)
 }
 
 // -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename T, typename... Ts>
-float findMedian(const C<T, Ts...>& source)
+template <class Container, typename T = std::remove_cv_t<typename Container::value_type>>
+float findMedian(const Container& source)
 {
   // Need a copy, not a reference, since we will be sorting the input array
   std::vector<T> tmpList{std::cbegin(source), std::cend(source)};
@@ -156,49 +156,49 @@ std::vector<T> computeMode(const Container& source)
 }
 
 // -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename T, typename... Ts>
-std::vector<T> findModes(const C<T, Ts...>& source)
+template <class Container, typename T = std::remove_cv_t<typename Container::value_type>>
+std::vector<T> findModes(const Container& source)
 {
   if(source.empty())
   {
     return {};
   }
 
-  return computeMode<C<T, Ts...>, T>(source);
+  return computeMode<Container, T>(source);
 }
 
 // -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename T, typename... Ts>
-float findStdDeviation(const C<T, Ts...>& source)
+template <class Container, typename T = std::remove_cv_t<typename Container::value_type>>
+auto findStdDeviation(const Container& source)
 {
-  if(source.empty())
+  if constexpr(std::is_same_v<T, bool>)
   {
-    return 0.0f;
+    if(source.empty())
+    {
+      return false;
+    }
+    size_t count = std::count(std::cbegin(source), std::cend(source), true);
+    return count >= (source.size() - count);
   }
-  std::vector<double> difference(source.size());
+  else
+  {
+    if(source.empty())
+    {
+      return 0.0f;
+    }
+    std::vector<double> difference(source.size());
 
-  const std::pair<float, float> sumMeanValues = FindSumMean(source);
+    const std::pair<float, float> sumMeanValues = FindSumMean(source);
 
-  std::transform(std::cbegin(source), std::cend(source), std::begin(difference), [sumMeanValues](T a) { return static_cast<double>(a - sumMeanValues.second); });
-  const double squaredSum = std::inner_product(std::cbegin(difference), std::cend(difference), std::cbegin(difference), 0.0);
-  return static_cast<float>(std::sqrt(squaredSum / static_cast<double>(source.size())));
-}
-
-// -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename... Ts>
-bool findStdDeviation(const C<bool, Ts...>& source)
-{
-  if(source.empty())
-  {
-    return false;
+    std::transform(std::cbegin(source), std::cend(source), std::begin(difference), [sumMeanValues](T a) { return static_cast<double>(a - sumMeanValues.second); });
+    const double squaredSum = std::inner_product(std::cbegin(difference), std::cend(difference), std::cbegin(difference), 0.0);
+    return static_cast<float>(std::sqrt(squaredSum / static_cast<double>(source.size())));
   }
-  size_t count = std::count(std::cbegin(source), std::cend(source), true);
-  return count >= (source.size() - count);
 }
 
 // -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename T, typename... Ts>
-float FindStdDeviation(const C<T, Ts...>& source, const std::pair<float, float> sumMeanValues)
+template <class Container, typename T = std::remove_cv_t<typename Container::value_type>>
+float FindStdDeviation(const Container& source, const std::pair<float, float> sumMeanValues)
 {
   if(source.empty())
   {
@@ -211,8 +211,8 @@ float FindStdDeviation(const C<T, Ts...>& source, const std::pair<float, float>
 }
 
 // -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename T, typename... Ts>
-double findSummation(const C<T, Ts...>& source)
+template <class Container, typename T = std::remove_cv_t<typename Container::value_type>>
+double findSummation(const Container& source)
 {
   if(source.empty())
   {
@@ -223,8 +223,8 @@ double findSummation(const C<T, Ts...>& source)
 }
 
 // -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename T, typename... Ts>
-size_t findNumUniqueValues(const C<T, Ts...>& source)
+template <class Container, typename T = std::remove_cv_t<typename Container::value_type>>
+size_t findNumUniqueValues(const Container& source)
 {
   if(source.empty())
   {
@@ -235,8 +235,8 @@ size_t findNumUniqueValues(const C<T, Ts...>& source)
 }
 
 // -----------------------------------------------------------------------------
-template <template <typename, typename...> class C, typename T, typename... Ts>
-std::pair<T, T> findHistogramRange(const C<T, Ts...>& source, T histmin, T histmax, bool histfullrange)
+template <class Container, typename T = std::remove_cv_t<typename Container::value_type>>
+std::pair<T, T> findHistogramRange(const Container& source, T histmin, T histmax, bool histfullrange)
 {
   if(histfullrange)
   {
@@ -247,8 +247,8 @@ std::pair<T, T> findHistogramRange(const C<T, Ts...>& source, T histmin, T histm
 }
 
 // -----------------------------------------------------------------------------
-template <template <typename, typename...> class Container, typename T, typename... Ts>
-std::pair<T, T> findModalBinRange(const Container<T, Ts...>& source, const std::vector<T>& binRanges, const T& mode)
+template <class Container, typename T = std::remove_cv_t<typename Container::value_type>>
+std::pair<T, T> findModalBinRange(const Container& source, const std::vector<T>& binRanges, const T& mode)
 {
   if(source.empty())
   {
@@ -289,4 +289,5 @@ std::pair<T, T> findModalBinRange(const Container<T, Ts...>& source, const std::
 
   return {};
 }
+
 } // namespace StatisticsCalculations
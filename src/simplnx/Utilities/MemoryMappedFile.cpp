@@ -0,0 +1,318 @@
+#include "MemoryMappedFile.hpp"
+
+#include "simplnx/Common/Uuid.hpp"
+
+#include <fmt/format.h>
+
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <winioctl.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace nx::core
+{
+namespace
+{
+std::filesystem::path CreateScratchFilePath(const std::filesystem::path& directory)
+{
+  return directory / fmt::format("simplnx_{}.mmap", Uuid::GenerateV4().str());
+}
+} // namespace
+
+#if defined(_WIN32)
+// -----------------------------------------------------------------------------
+MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& directory, uint64 numBytes)
+: m_FilePath(CreateScratchFilePath(directory))
+, m_Size(numBytes)
+{
+  HANDLE fileHandle = CreateFileW(m_FilePath.wstring().c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_NEW, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+  if(fileHandle == INVALID_HANDLE_VALUE)
+  {
+    throw std::runtime_error(fmt::format("MemoryMappedFile: Could not create scratch file '{}'. Error code: {}", m_FilePath.string(), GetLastError()));
+  }
+  m_FileHandle = fileHandle;
+
+  // Sparse files are only supported on NTFS. Failure here is not fatal, the file will simply be fully allocated.
+  DWORD bytesReturned = 0;
+  DeviceIoControl(fileHandle, FSCTL_SET_SPARSE, nullptr, 0, nullptr, 0, &bytesReturned, nullptr);
+
+  try
+  {
+    map();
+  } catch(...)
+  {
+    unmap();
+    CloseHandle(fileHandle);
+    throw;
+  }
+}
+
+// -----------------------------------------------------------------------------
+std::unique_ptr<MemoryMappedFile> MemoryMappedFile::OpenReadOnly(const std::filesystem::path& filePath)
+{
+  std::unique_ptr<MemoryMappedFile> mappedFile(new MemoryMappedFile());
+  mappedFile->m_FilePath = filePath;
+  mappedFile->m_ReadOnly = true;
+
+  HANDLE fileHandle = CreateFileW(filePath.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if(fileHandle == INVALID_HANDLE_VALUE)
+  {
+    throw std::runtime_error(fmt::format("MemoryMappedFile: Could not open '{}'. Error code: {}", filePath.string(), GetLastError()));
+  }
+  // From here on the destructor of mappedFile closes the handle if an exception is thrown
+  mappedFile->m_FileHandle = fileHandle;
+
+  LARGE_INTEGER fileSize;
+  if(GetFileSizeEx(fileHandle, &fileSize) == 0)
+  {
+    throw std::runtime_error(fmt::format("MemoryMappedFile: Could not query the size of '{}'. Error code: {}", filePath.string(), GetLastError()));
+  }
+  mappedFile->m_Size = static_cast<uint64>(fileSize.QuadPart);
+  mappedFile->map();
+  return mappedFile;
+}
+
+// -----------------------------------------------------------------------------
+MemoryMappedFile::~MemoryMappedFile() noexcept
+{
+  unmap();
+  if(m_FileHandle != nullptr)
+  {
+    CloseHandle(static_cast<HANDLE>(m_FileHandle));
+  }
+}
+
+// -----------------------------------------------------------------------------
+void MemoryMappedFile::map()
+{
+  if(m_Size == 0)
+  {
+    return;
+  }
+
+  const auto sizeHigh = static_cast<DWORD>(m_Size >> 32);
+  const auto sizeLow = static_cast<DWORD>(m_Size & 0xFFFFFFFFULL);
+  HANDLE mappingHandle = CreateFileMappingW(static_cast<HANDLE>(m_FileHandle), nullptr, m_ReadOnly ? PAGE_READONLY : PAGE_READWRITE, sizeHigh, sizeLow, nullptr);
+  if(mappingHandle == nullptr)
+  {
+    throw std::runtime_error(fmt::format("MemoryMappedFile: Could not create a {} byte mapping of '{}'. Error code: {}", m_Size, m_FilePath.string(), GetLastError()));
+  }
+  m_MappingHandle = mappingHandle;
+
+  m_Data = MapViewOfFile(mappingHandle, m_ReadOnly ? FILE_MAP_READ : FILE_MAP_ALL_ACCESS, 0, 0, 0);
+  if(m_Data == nullptr)
+  {
+    throw std::runtime_error(fmt::format("MemoryMappedFile: Could not map a view of '{}'. Error code: {}", m_FilePath.string(), GetLastError()));
+  }
+}
+
+// -----------------------------------------------------------------------------
+void MemoryMappedFile::unmap() noexcept
+{
+  if(m_Data != nullptr)
+  {
+    UnmapViewOfFile(m_Data);
+    m_Data = nullptr;
+  }
+  if(m_MappingHandle != nullptr)
+  {
+    CloseHandle(static_cast<HANDLE>(m_MappingHandle));
+    m_MappingHandle = nullptr;
+  }
+}
+
+// -----------------------------------------------------------------------------
+void MemoryMappedFile::resize(uint64 numBytes)
+{
+  if(m_ReadOnly)
+  {
+    throw std::runtime_error(fmt::format("MemoryMappedFile: Can not resize the read-only mapping of '{}'", m_FilePath.string()));
+  }
+  if(numBytes == m_Size)
+  {
+    return;
+  }
+
+  unmap();
+
+  LARGE_INTEGER newSize;
+  newSize.QuadPart = static_cast<LONGLONG>(numBytes);
+  if(SetFilePointerEx(static_cast<HANDLE>(m_FileHandle), newSize, nullptr, FILE_BEGIN) == 0 || SetEndOfFile(static_cast<HANDLE>(m_FileHandle)) == 0)
+  {
+    throw std::runtime_error(fmt::format("MemoryMappedFile: Could not resize '{}' to {} bytes. Error code: {}", m_FilePath.string(), numBytes, GetLastError()));
+  }
+
+  m_Size = numBytes;
+  map();
+}
+
+// -----------------------------------------------------------------------------
+bool MemoryMappedFile::flush() const
+{
+  if(m_Data == nullptr || m_ReadOnly)
+  {
+    return true;
+  }
+  return FlushViewOfFile(m_Data, 0) != 0;
+}
+#else
+// -----------------------------------------------------------------------------
+MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& directory, uint64 numBytes)
+: m_FilePath(CreateScratchFilePath(directory))
+, m_Size(numBytes)
+{
+  m_FileDescriptor = ::open(m_FilePath.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if(m_FileDescriptor < 0)
+  {
+    throw std::runtime_error(fmt::format("MemoryMappedFile: Could not create scratch file '{}': {}", m_FilePath.string(), std::strerror(errno)));
+  }
+
+  // The open descriptor keeps the inode alive; unlinking now guarantees the scratch file is reclaimed by the OS.
+  ::unlink(m_FilePath.c_str());
+
+  // ftruncate creates a sparse file, disk blocks are only allocated for pages that get written to.
+  if(::ftruncate(m_FileDescriptor, static_cast<off_t>(m_Size)) != 0)
+  {
+    const int errorCode = errno;
+    ::close(m_FileDescriptor);
+    throw std::runtime_error(fmt::format("MemoryMappedFile: Could not size scratch file '{}' to {} bytes: {}", m_FilePath.string(), m_Size, std::strerror(errorCode)));
+  }
+
+  try
+  {
+    map();
+  } catch(...)
+  {
+    ::close(m_FileDescriptor);
+    throw;
+  }
+}
+
+// -----------------------------------------------------------------------------
+std::unique_ptr<MemoryMappedFile> MemoryMappedFile::OpenReadOnly(const std::filesystem::path& filePath)
+{
+  std::unique_ptr<MemoryMappedFile> mappedFile(new MemoryMappedFile());
+  mappedFile->m_FilePath = filePath;
+  mappedFile->m_ReadOnly = true;
+
+  mappedFile->m_FileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+  if(mappedFile->m_FileDescriptor < 0)
+  {
+    throw std::runtime_error(fmt::format("MemoryMappedFile: Could not open '{}': {}", filePath.string(), std::strerror(errno)));
+  }
+
+  // From here on the destructor of mappedFile closes the descriptor if an exception is thrown
+  struct stat fileStatus = {};
+  if(::fstat(mappedFile->m_FileDescriptor, &fileStatus) != 0)
+  {
+    throw std::runtime_error(fmt::format("MemoryMappedFile: Could not query the size of '{}': {}", filePath.string(), std::strerror(errno)));
+  }
+  mappedFile->m_Size = static_cast<uint64>(fileStatus.st_size);
+  mappedFile->map();
+  return mappedFile;
+}
+
+// -----------------------------------------------------------------------------
+MemoryMappedFile::~MemoryMappedFile() noexcept
+{
+  unmap();
+  if(m_FileDescriptor >= 0)
+  {
+    ::close(m_FileDescriptor);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void MemoryMappedFile::map()
+{
+  if(m_Size == 0)
+  {
+    return;
+  }
+
+  void* data = m_ReadOnly ? ::mmap(nullptr, static_cast<size_t>(m_Size), PROT_READ, MAP_PRIVATE, m_FileDescriptor, 0)
+                          : ::mmap(nullptr, static_cast<size_t>(m_Size), PROT_READ | PROT_WRITE, MAP_SHARED, m_FileDescriptor, 0);
+  if(data == MAP_FAILED)
+  {
+    throw std::runtime_error(fmt::format("MemoryMappedFile: Could not map {} bytes of '{}': {}", m_Size, m_FilePath.string(), std::strerror(errno)));
+  }
+  m_Data = data;
+}
+
+// -----------------------------------------------------------------------------
+void MemoryMappedFile::unmap() noexcept
+{
+  if(m_Data != nullptr)
+  {
+    ::munmap(m_Data, static_cast<size_t>(m_Size));
+    m_Data = nullptr;
+  }
+}
+
+// -----------------------------------------------------------------------------
+void MemoryMappedFile::resize(uint64 numBytes)
+{
+  if(m_ReadOnly)
+  {
+    throw std::runtime_error(fmt::format("MemoryMappedFile: Can not resize the read-only mapping of '{}'", m_FilePath.string()));
+  }
+  if(numBytes == m_Size)
+  {
+    return;
+  }
+
+  unmap();
+  if(::ftruncate(m_FileDescriptor, static_cast<off_t>(numBytes)) != 0)
+  {
+    throw std::runtime_error(fmt::format("MemoryMappedFile: Could not resize '{}' to {} bytes: {}", m_FilePath.string(), numBytes, std::strerror(errno)));
+  }
+
+  m_Size = numBytes;
+  map();
+}
+
+// -----------------------------------------------------------------------------
+bool MemoryMappedFile::flush() const
+{
+  if(m_Data == nullptr || m_ReadOnly)
+  {
+    return true;
+  }
+  return ::msync(m_Data, static_cast<size_t>(m_Size), MS_SYNC) == 0;
+}
+#endif
+
+// -----------------------------------------------------------------------------
+void* MemoryMappedFile::data() const
+{
+  return m_Data;
+}
+
+// -----------------------------------------------------------------------------
+uint64 MemoryMappedFile::size() const
+{
+  return m_Size;
+}
+
+// -----------------------------------------------------------------------------
+bool MemoryMappedFile::isReadOnly() const
+{
+  return m_ReadOnly;
+}
+
+// -----------------------------------------------------------------------------
+const std::filesystem::path& MemoryMappedFile::filePath() const
+{
+  return m_FilePath;
+}
+} // namespace nx::core
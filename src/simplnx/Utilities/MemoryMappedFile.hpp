@@ -0,0 +1,110 @@
+#pragma once
+
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <filesystem>
+#include <memory>
+
+namespace nx::core
+{
+/**
+ * @class MemoryMappedFile
+ * @brief The MemoryMappedFile class owns a read/write shared mapping of a
+ * sparse scratch file. The file is removed from the file system as soon as it
+ * is mapped (POSIX) or when the last handle is closed (Windows) so that no
+ * scratch files are left behind if the application exits unexpectedly.
+ *
+ * Pages are only backed by disk storage once they are written to, which allows
+ * arrays larger than the physical memory of the machine to be allocated.
+ *
+ * OpenReadOnly() instead maps an existing file read-only so that it can be
+ * parsed in place. Such a mapping can not be written to or resized.
+ */
+class SIMPLNX_EXPORT MemoryMappedFile
+{
+public:
+  /**
+   * @brief Creates and maps a new scratch file of the requested size inside the
+   * given directory. Throws a std::runtime_error if the file could not be
+   * created or mapped.
+   * @param directory
+   * @param numBytes
+   */
+  MemoryMappedFile(const std::filesystem::path& directory, uint64 numBytes);
+
+  /**
+   * @brief Maps an existing file read-only. The file is left in place. Empty
+   * files are valid and have a nullptr data(). Throws a std::runtime_error if
+   * the file could not be opened or mapped.
+   * @param filePath
+   * @return std::unique_ptr<MemoryMappedFile>
+   */
+  static std::unique_ptr<MemoryMappedFile> OpenReadOnly(const std::filesystem::path& filePath);
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile(MemoryMappedFile&&) noexcept = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(MemoryMappedFile&&) noexcept = delete;
+
+  ~MemoryMappedFile() noexcept;
+
+  /**
+   * @brief Returns a pointer to the beginning of the mapped region. Returns
+   * nullptr if the mapping is empty. Read-only mappings must not be written through.
+   * @return void*
+   */
+  void* data() const;
+
+  /**
+   * @brief Returns the size of the mapped region in bytes.
+   * @return uint64
+   */
+  uint64 size() const;
+
+  /**
+   * @brief Returns the path of the scratch file backing the mapping.
+   * @return std::filesystem::path
+   */
+  const std::filesystem::path& filePath() const;
+
+  /**
+   * @brief Grows or shrinks the backing file and remaps it. Existing data up
+   * to min(oldSize, numBytes) is preserved. Any pointers previously returned by
+   * data() are invalidated. Throws a std::runtime_error on failure or if the
+   * mapping is read-only.
+   * @param numBytes
+   */
+  void resize(uint64 numBytes);
+
+  /**
+   * @brief Returns true if the mapping was created by OpenReadOnly().
+   * @return bool
+   */
+  bool isReadOnly() const;
+
+  /**
+   * @brief Synchronously writes all dirty pages back to the scratch file
+   * (msync / FlushViewOfFile). Read-only mappings have nothing to write.
+   * @return bool true on success
+   */
+  bool flush() const;
+
+private:
+  MemoryMappedFile() = default;
+
+  void map();
+  void unmap() noexcept;
+
+  std::filesystem::path m_FilePath;
+  void* m_Data = nullptr;
+  uint64 m_Size = 0;
+  bool m_ReadOnly = false;
+#if defined(_WIN32)
+  void* m_FileHandle = nullptr;
+  void* m_MappingHandle = nullptr;
+#else
+  int32 m_FileDescriptor = -1;
+#endif
+};
+} // namespace nx::core
@@ -3,7 +3,10 @@
 #if defined(_WIN32)
 #include <cstdlib>
 #include <windows.h>
+// windows.h must be included before psapi.h
+#include <psapi.h>
 #else
+#include <sys/resource.h>
 #include <unistd.h>
 #endif
 
@@ -42,6 +45,16 @@ dataStorage GetAvailableStorageOnDrive(const std::filesystem::path& path)
 
   return storage;
 }
+
+uint64 GetPeakResidentMemory()
+{
+  PROCESS_MEMORY_COUNTERS counters;
+  if(K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == 0)
+  {
+    return 0;
+  }
+  return static_cast<uint64>(counters.PeakWorkingSetSize);
+}
 #else
 uint64 GetTotalMemory()
 {
@@ -58,5 +71,21 @@ dataStorage GetAvailableStorageOnDrive(const std::filesystem::path& directory)
   storage.total = info.capacity;
   return storage;
 }
+
+uint64 GetPeakResidentMemory()
+{
+  rusage usage{};
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0;
+  }
+#if defined(__APPLE__)
+  // macOS reports ru_maxrss in bytes
+  return static_cast<uint64>(usage.ru_maxrss);
+#else
+  // Linux reports ru_maxrss in kilobytes
+  return static_cast<uint64>(usage.ru_maxrss) * 1024;
+#endif
+}
 #endif
 } // namespace nx::core::Memory
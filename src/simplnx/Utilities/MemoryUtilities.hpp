@@ -18,5 +18,12 @@ struct SIMPLNX_EXPORT dataStorage
 uint64 SIMPLNX_EXPORT GetTotalMemory();
 dataStorage SIMPLNX_EXPORT GetAvailableStorage();
 dataStorage SIMPLNX_EXPORT GetAvailableStorageOnDrive(const std::filesystem::path& path);
+
+/**
+ * @brief Returns the peak resident set size (high water mark of physical
+ * memory) of the current process in bytes. Returns 0 if it cannot be queried.
+ * @return uint64
+ */
+uint64 SIMPLNX_EXPORT GetPeakResidentMemory();
 } // namespace Memory
 } // namespace nx::core
@@ -970,17 +970,14 @@ Result<> createLegacyNeighborList(DataStructure& dataStructure, DataObject ::IdT
 {
   auto numTuples = std::accumulate(tupleDims.cbegin(), tupleDims.cend(), static_cast<usize>(1), std::multiplies<>());
 
-  auto data = HDF5::NeighborListIO<T>::ReadHdf5Data(parentReader, datasetReader);
+  auto compactData = HDF5::NeighborListIO<T>::ReadHdf5CompactData(parentReader, datasetReader);
   auto* neighborList = NeighborList<T>::Create(dataStructure, datasetReader.getName(), numTuples, parentId);
   if(neighborList == nullptr)
   {
     std::string ss = fmt::format("Failed to create NeighborList: '{}'", datasetReader.getName());
     return MakeErrorResult(Legacy::k_FailedCreatingNeighborList_Code, ss);
   }
-  for(usize i = 0; i < data.size(); ++i)
-  {
-    neighborList->setList(i, data[i]);
-  }
+  neighborList->setCompactData(std::move(compactData.values), std::move(compactData.offsets));
   return {};
 }
 
@@ -1389,6 +1386,16 @@ Result<DataStructure> ImportLegacyDataStructure(const nx::core::HDF5::FileReader
 
 Result<DataStructure> DREAM3D::ImportDataStructureFromFile(const nx::core::HDF5::FileReader& fileReader, bool preflight)
 {
+  if(HDF5::Compression::IsBloscAvailable())
+  {
+    // Arrays written with Blosc compression can only be decoded once the filter is registered
+    Result<> registerResult = HDF5::Compression::RegisterBloscFilter();
+    if(registerResult.invalid())
+    {
+      return nx::core::ConvertResultTo<DataStructure>(std::move(registerResult), DataStructure{});
+    }
+  }
+
   const auto fileVersion = GetFileVersion(fileReader);
   if(fileVersion == k_CurrentFileVersion)
   {
@@ -1403,6 +1410,25 @@ Result<DataStructure> DREAM3D::ImportDataStructureFromFile(const nx::core::HDF5:
                                         fmt::format("Could not parse DataStructure version {}. Expected versions: {} or {}", fileVersion, k_CurrentFileVersion, k_LegacyFileVersion));
 }
 
+Result<DataStructure> DREAM3D::ImportDataStructureFromFileLazily(const nx::core::HDF5::FileReader& fileReader)
+{
+  if(HDF5::Compression::IsBloscAvailable())
+  {
+    Result<> registerResult = HDF5::Compression::RegisterBloscFilter();
+    if(registerResult.invalid())
+    {
+      return nx::core::ConvertResultTo<DataStructure>(std::move(registerResult), DataStructure{});
+    }
+  }
+
+  const auto fileVersion = GetFileVersion(fileReader);
+  if(fileVersion == k_CurrentFileVersion)
+  {
+    return HDF5::DataStructureReader::ReadFileLazily(fileReader);
+  }
+  return ImportDataStructureFromFile(fileReader, false);
+}
+
 Result<DataStructure> DREAM3D::ImportDataStructureFromFile(const std::filesystem::path& filePath, bool preflight)
 {
   nx::core::HDF5::FileReader fileReader(filePath);
@@ -1539,9 +1565,9 @@ Result<> WritePipeline(nx::core::HDF5::FileWriter& fileWriter, const Pipeline& p
   return pipelineDatasetWriter.writeString(pipelineString);
 }
 
-Result<> WriteDataStructure(nx::core::HDF5::FileWriter& fileWriter, const DataStructure& dataStructure)
+Result<> WriteDataStructure(nx::core::HDF5::FileWriter& fileWriter, const DataStructure& dataStructure, const HDF5::CompressionSettings& compression, HDF5::WriteStatistics* statistics)
 {
-  return HDF5::DataStructureWriter::WriteFile(dataStructure, fileWriter);
+  return HDF5::DataStructureWriter::WriteFile(dataStructure, fileWriter, compression, statistics);
 }
 
 Result<> WriteFileVersion(nx::core::HDF5::FileWriter& fileWriter)
@@ -1555,7 +1581,8 @@ Result<> DREAM3D::WriteFile(nx::core::HDF5::FileWriter& fileWriter, const FileDa
   return WriteFile(fileWriter, fileData.first, fileData.second);
 }
 
-Result<> DREAM3D::WriteFile(nx::core::HDF5::FileWriter& fileWriter, const Pipeline& pipeline, const DataStructure& dataStructure)
+Result<> DREAM3D::WriteFile(nx::core::HDF5::FileWriter& fileWriter, const Pipeline& pipeline, const DataStructure& dataStructure, const HDF5::CompressionSettings& compression,
+                            HDF5::WriteStatistics* statistics)
 {
   auto result = WriteFileVersion(fileWriter);
   if(result.invalid())
@@ -1568,10 +1595,11 @@ Result<> DREAM3D::WriteFile(nx::core::HDF5::FileWriter& fileWriter, const Pipeli
   {
     return result;
   }
-  return WriteDataStructure(fileWriter, dataStructure);
+  return WriteDataStructure(fileWriter, dataStructure, compression, statistics);
 }
 
-Result<> DREAM3D::WriteFile(const std::filesystem::path& path, const DataStructure& dataStructure, const Pipeline& pipeline, bool writeXdmf)
+Result<> DREAM3D::WriteFile(const std::filesystem::path& path, const DataStructure& dataStructure, const Pipeline& pipeline, bool writeXdmf, const HDF5::CompressionSettings& compression,
+                            HDF5::WriteStatistics* statistics)
 {
   auto fileWriterResult = nx::core::HDF5::FileWriter::CreateFile(path);
   if(fileWriterResult.invalid())
@@ -1581,7 +1609,7 @@ Result<> DREAM3D::WriteFile(const std::filesystem::path& path, const DataStructu
 
   nx::core::HDF5::FileWriter fileWriter = std::move(fileWriterResult.value());
 
-  auto result = WriteFile(fileWriter, pipeline, dataStructure);
+  auto result = WriteFile(fileWriter, pipeline, dataStructure, compression, statistics);
   if(result.invalid())
   {
     return MakeErrorResult(result.errors()[0].code, fmt::format("DREAM3D::WriteFile: Unable to write DREAM3D file with HDF5 error"));
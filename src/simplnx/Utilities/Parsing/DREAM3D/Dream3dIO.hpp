@@ -2,6 +2,7 @@
 
 #include "simplnx/Pipeline/Pipeline.hpp"
 #include "simplnx/Utilities/Parsing/HDF5/H5.hpp"
+#include "simplnx/Utilities/Parsing/HDF5/H5Compression.hpp"
 #include "simplnx/simplnx_export.hpp"
 
 #include <filesystem>
@@ -86,19 +87,26 @@ SIMPLNX_EXPORT Result<> WriteFile(nx::core::HDF5::FileWriter& fileWriter, const
 /**
  * @brief Writes a .dream3d file with the specified data.
  * @param fileWriter
- * @param fileData
+ * @param pipeline
+ * @param dataStructure
+ * @param compression Compression applied to the DataStructure's arrays
+ * @param statistics Optional output for the written sizes and timing
  * @return Result<>
  */
-SIMPLNX_EXPORT Result<> WriteFile(nx::core::HDF5::FileWriter& fileWriter, const Pipeline& pipeline, const DataStructure& dataStructure);
+SIMPLNX_EXPORT Result<> WriteFile(nx::core::HDF5::FileWriter& fileWriter, const Pipeline& pipeline, const DataStructure& dataStructure, const HDF5::CompressionSettings& compression = {},
+                                  HDF5::WriteStatistics* statistics = nullptr);
 
 /**
  * @brief Writes a .dream3d file with the specified data.
  * @param path
  * @param dataStructure
  * @param writeXdmf
+ * @param compression Compression applied to the DataStructure's arrays
+ * @param statistics Optional output for the written sizes and timing
  * @return bool
  */
-SIMPLNX_EXPORT Result<> WriteFile(const std::filesystem::path& path, const DataStructure& dataStructure, const Pipeline& pipeline = {}, bool writeXdmf = false);
+SIMPLNX_EXPORT Result<> WriteFile(const std::filesystem::path& path, const DataStructure& dataStructure, const Pipeline& pipeline = {}, bool writeXdmf = false,
+                                  const HDF5::CompressionSettings& compression = {}, HDF5::WriteStatistics* statistics = nullptr);
 
 /**
  * @brief Imports and returns the DataStructure from the target .dream3d file.
@@ -118,6 +126,17 @@ SIMPLNX_EXPORT Result<DataStructure> ImportDataStructureFromFile(const nx::core:
  */
 SIMPLNX_EXPORT Result<DataStructure> ImportDataStructureFromFile(const std::filesystem::path& filePath, bool preflight = false);
 
+/**
+ * @brief Imports the DataStructure from the target .dream3d file without reading
+ * the array values. Arrays read their values from the file in blocks the first
+ * time they are accessed, so only the data that is actually used is loaded.
+ *
+ * Legacy files do not support lazy reading and are imported in full.
+ * @param fileReader
+ * @return DataStructure
+ */
+SIMPLNX_EXPORT Result<DataStructure> ImportDataStructureFromFileLazily(const nx::core::HDF5::FileReader& fileReader);
+
 /**
  * @brief Imports and returns a Pipeline from the target .dream3d file.
  *
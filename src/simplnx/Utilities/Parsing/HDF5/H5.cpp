@@ -172,3 +172,9 @@ std::string nx::core::HDF5::GetParentPath(const std::string& objectPath)
   }
   return objectPath.substr(0, ++back);
 }
+
+std::recursive_mutex& nx::core::HDF5::GetLibraryMutex()
+{
+  static std::recursive_mutex s_LibraryMutex;
+  return s_LibraryMutex;
+}
@@ -4,6 +4,7 @@
 #include "simplnx/simplnx_export.hpp"
 
 #include <cstdint>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -84,4 +85,13 @@ std::string SIMPLNX_EXPORT GetNameFromId(IdType id);
  */
 std::string SIMPLNX_EXPORT GetParentPath(const std::string& objectPath);
 
+/**
+ * @brief Returns the process wide mutex that serializes HDF5 library calls
+ * made from more than one thread. The HDF5 library is not built thread safe,
+ * so code that may call into it off the main thread (e.g. lazily loaded data
+ * stores) and code writing while such calls may happen must hold this mutex.
+ * @return std::recursive_mutex&
+ */
+std::recursive_mutex& SIMPLNX_EXPORT GetLibraryMutex();
+
 } // namespace nx::core::HDF5
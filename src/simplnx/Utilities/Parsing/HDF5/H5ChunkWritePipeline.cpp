@@ -0,0 +1,43 @@
+#include "H5ChunkWritePipeline.hpp"
+
+using namespace nx::core;
+using namespace nx::core::HDF5;
+
+// -----------------------------------------------------------------------------
+ChunkWritePipeline::ChunkWritePipeline() = default;
+
+// -----------------------------------------------------------------------------
+ChunkWritePipeline::~ChunkWritePipeline() = default;
+
+// -----------------------------------------------------------------------------
+usize ChunkWritePipeline::getMaxBufferedBytes() const
+{
+  return m_MaxBufferedBytes;
+}
+
+// -----------------------------------------------------------------------------
+void ChunkWritePipeline::setMaxBufferedBytes(usize maxBufferedBytes)
+{
+  m_MaxBufferedBytes = maxBufferedBytes;
+}
+
+// -----------------------------------------------------------------------------
+usize ChunkWritePipeline::getMaxThreads() const
+{
+  return m_MaxThreads;
+}
+
+// -----------------------------------------------------------------------------
+void ChunkWritePipeline::setMaxThreads(usize maxThreads)
+{
+  m_MaxThreads = std::clamp<usize>(maxThreads, 1, std::max<usize>(std::thread::hardware_concurrency(), 1));
+}
+
+// -----------------------------------------------------------------------------
+usize ChunkWritePipeline::getQueueDepth(usize bufferBytes) const
+{
+  const usize bufferedChunks = m_MaxBufferedBytes / std::max<usize>(bufferBytes, 1);
+  // Twice as many buffers as workers keeps the workers busy while the writer drains the queue, but the
+  // byte budget is the hard limit
+  return std::max<usize>(std::min<usize>(bufferedChunks, m_MaxThreads * 2), 1);
+}
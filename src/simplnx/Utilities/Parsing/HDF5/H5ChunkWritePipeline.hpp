@@ -0,0 +1,267 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/Utilities/IParallelAlgorithm.hpp"
+#include "simplnx/Utilities/Parsing/HDF5/H5.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <fmt/core.h>
+
+#ifdef SIMPLNX_ENABLE_MULTICORE
+#include <tbb/task_group.h>
+#endif
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nx::core::HDF5
+{
+/**
+ * @class ChunkWritePipeline
+ * @brief The ChunkWritePipeline class overlaps preparing chunk buffers with
+ * writing them to HDF5. TBB tasks prepare (stage and compress) chunks into a
+ * bounded ring of buffers while the calling thread, the only thread that calls
+ * into the HDF5 library, writes the prepared chunks in order. The calling
+ * thread prepares any chunk no task has claimed yet itself, so the pipeline
+ * never waits on tasks the scheduler has not started.
+ *
+ * Tasks never run more than getQueueDepth() chunks ahead of the writer, so
+ * the memory held by the pipeline is bounded by the maximum buffered bytes.
+ * The pipeline falls back to preparing and writing each chunk in turn when
+ * parallelization is disabled or fewer than two chunks can be buffered.
+ */
+class SIMPLNX_EXPORT ChunkWritePipeline : public IParallelAlgorithm
+{
+public:
+  /**
+   * @brief The default upper bound for the memory held by prepared chunks.
+   */
+  static inline constexpr usize k_DefaultMaxBufferedBytes = 256 * 1024 * 1024;
+
+  ChunkWritePipeline();
+  ~ChunkWritePipeline();
+
+  ChunkWritePipeline(const ChunkWritePipeline&) = default;
+  ChunkWritePipeline(ChunkWritePipeline&&) noexcept = default;
+  ChunkWritePipeline& operator=(const ChunkWritePipeline&) = default;
+  ChunkWritePipeline& operator=(ChunkWritePipeline&&) noexcept = default;
+
+  /**
+   * @brief Returns the upper bound for the memory held by prepared chunks.
+   * @return usize
+   */
+  usize getMaxBufferedBytes() const;
+
+  /**
+   * @brief Sets the upper bound for the memory held by prepared chunks. At least
+   * one chunk is always buffered, even if it is larger than the bound.
+   * @param maxBufferedBytes
+   */
+  void setMaxBufferedBytes(usize maxBufferedBytes);
+
+  /**
+   * @brief Returns the number of worker threads preparing chunks.
+   * @return usize
+   */
+  usize getMaxThreads() const;
+
+  /**
+   * @brief Sets the number of worker threads preparing chunks. The value is
+   * clamped to [1, hardware concurrency].
+   * @param maxThreads
+   */
+  void setMaxThreads(usize maxThreads);
+
+  /**
+   * @brief Returns the number of prepared chunks that may be waiting to be written
+   * for chunks that each hold bufferBytes bytes. This is the number of chunks that
+   * fit in the maximum buffered bytes, at most twice the number of worker threads
+   * and at least one.
+   * @param bufferBytes
+   * @return usize
+   */
+  usize getQueueDepth(usize bufferBytes) const;
+
+  /**
+   * @brief Prepares and writes numChunks chunks.
+   *
+   * prepare(chunkIndex, buffer) -> Result<> is called on TBB worker threads and the calling
+   * thread and must not call into the HDF5 library. Callers preparing from stores that may
+   * read HDF5 (anything but an in memory DataStore) must disable parallelization.
+   * write(chunkIndex, buffer) -> Result<> is called on the calling thread in chunk order
+   * while holding HDF5::GetLibraryMutex(). Each BufferT is reused for many chunks. The first
+   * error returned (or exception thrown) by either function stops the pipeline and is returned.
+   * @param numChunks
+   * @param bufferBytes The approximate number of bytes held by one prepared buffer
+   * @param prepare
+   * @param write
+   * @return Result<>
+   */
+  template <typename BufferT, typename PrepareFunc, typename WriteFunc>
+  Result<> execute(usize numChunks, usize bufferBytes, PrepareFunc&& prepare, WriteFunc&& write) const
+  {
+    const usize queueDepth = getQueueDepth(bufferBytes);
+    auto prepareChunk = [&prepare](usize chunkIndex, BufferT& buffer) -> Result<> {
+      try
+      {
+        return prepare(chunkIndex, buffer);
+      } catch(const std::exception& exception)
+      {
+        return MakeErrorResult(-2680, fmt::format("Failed to prepare chunk {}: {}", chunkIndex, exception.what()));
+      }
+    };
+    auto writeChunk = [&write](usize chunkIndex, BufferT& buffer) -> Result<> {
+      std::lock_guard<std::recursive_mutex> libraryLock(GetLibraryMutex());
+      return write(chunkIndex, buffer);
+    };
+
+#ifdef SIMPLNX_ENABLE_MULTICORE
+    if(getParallelizationEnabled() && numChunks > 1 && queueDepth > 1)
+    {
+      return executeParallel<BufferT>(numChunks, queueDepth, prepareChunk, writeChunk);
+    }
+#endif
+
+    BufferT buffer;
+    for(usize chunkIndex = 0; chunkIndex < numChunks; chunkIndex++)
+    {
+      Result<> result = prepareChunk(chunkIndex, buffer);
+      if(result.invalid())
+      {
+        return result;
+      }
+      result = writeChunk(chunkIndex, buffer);
+      if(result.invalid())
+      {
+        return result;
+      }
+    }
+    return {};
+  }
+
+private:
+#ifdef SIMPLNX_ENABLE_MULTICORE
+  template <typename BufferT, typename PrepareFunc, typename WriteFunc>
+  Result<> executeParallel(usize numChunks, usize queueDepth, PrepareFunc& prepare, WriteFunc& write) const
+  {
+    const usize numTasks = std::min({getMaxThreads(), queueDepth, numChunks});
+
+    struct Slot
+    {
+      BufferT buffer;
+      Result<> result;
+      usize chunkIndex = 0;
+      bool ready = false;
+    };
+    std::vector<Slot> slots(queueDepth);
+    std::mutex mutex;
+    std::condition_variable condition;
+    usize nextChunk = 0;
+    usize numWritten = 0;
+    bool stop = false;
+
+    auto task = [&]() {
+      while(true)
+      {
+        usize chunkIndex = 0;
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          // Back-pressure: a chunk may only be claimed once the chunk that last used its slot has been written
+          condition.wait(lock, [&]() { return stop || nextChunk >= numChunks || nextChunk < numWritten + queueDepth; });
+          if(stop || nextChunk >= numChunks)
+          {
+            return;
+          }
+          chunkIndex = nextChunk++;
+        }
+
+        Slot& slot = slots[chunkIndex % queueDepth];
+        Result<> result = prepare(chunkIndex, slot.buffer);
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          slot.result = std::move(result);
+          slot.chunkIndex = chunkIndex;
+          slot.ready = true;
+        }
+        condition.notify_all();
+      }
+    };
+
+    tbb::task_group taskGroup;
+    for(usize i = 0; i < numTasks; i++)
+    {
+      taskGroup.run(task);
+    }
+
+    auto stopTasks = [&]() {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+      }
+      condition.notify_all();
+      taskGroup.wait();
+    };
+
+    Result<> result;
+    try
+    {
+      for(usize chunkIndex = 0; chunkIndex < numChunks; chunkIndex++)
+      {
+        Slot& slot = slots[chunkIndex % queueDepth];
+        bool prepareHere = false;
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          if(nextChunk == chunkIndex)
+          {
+            // No task has claimed the chunk yet, prepare it here instead of waiting for one to start
+            nextChunk++;
+            prepareHere = true;
+          }
+          else
+          {
+            condition.wait(lock, [&]() { return slot.ready && slot.chunkIndex == chunkIndex; });
+          }
+        }
+        if(prepareHere)
+        {
+          slot.result = prepare(chunkIndex, slot.buffer);
+        }
+        if(slot.result.invalid())
+        {
+          result = std::move(slot.result);
+          break;
+        }
+
+        result = write(chunkIndex, slot.buffer);
+        if(result.invalid())
+        {
+          break;
+        }
+
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          slot.ready = false;
+          numWritten++;
+        }
+        condition.notify_all();
+      }
+    } catch(...)
+    {
+      stopTasks();
+      throw;
+    }
+
+    stopTasks();
+    return result;
+  }
+#endif
+
+  usize m_MaxBufferedBytes = k_DefaultMaxBufferedBytes;
+  usize m_MaxThreads = std::max<usize>(std::thread::hardware_concurrency(), 1);
+};
+} // namespace nx::core::HDF5
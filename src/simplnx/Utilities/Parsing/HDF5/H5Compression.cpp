@@ -0,0 +1,289 @@
+#include "H5Compression.hpp"
+
+#include <fmt/core.h>
+
+#include <H5Ppublic.h>
+#include <H5Zpublic.h>
+
+#include <zlib.h>
+
+#ifdef SIMPLNX_ENABLE_COMPRESSORS
+#include <blosc.h>
+
+#include <cstdlib>
+#include <cstring>
+#endif
+
+#include <algorithm>
+
+namespace nx::core::HDF5
+{
+namespace
+{
+#ifdef SIMPLNX_ENABLE_COMPRESSORS
+// Layout of the cd_values used by the reference hdf5-blosc filter so files stay readable by other tools
+constexpr uint32 k_BloscFilterRevision = 2;
+constexpr usize k_BloscNumValues = 7;
+constexpr const char* k_BloscCompressorName = "lz4";
+
+size_t BloscFilter(unsigned int flags, size_t cdNumValues, const unsigned int cdValues[], size_t numBytes, size_t* bufferSize, void** buffer)
+{
+  if(cdNumValues < k_BloscNumValues)
+  {
+    return 0;
+  }
+
+  if((flags & H5Z_FLAG_REVERSE) != 0)
+  {
+    size_t outputBytes = 0;
+    size_t compressedBytes = 0;
+    size_t blockSize = 0;
+    blosc_cbuffer_sizes(*buffer, &outputBytes, &compressedBytes, &blockSize);
+    void* output = std::malloc(outputBytes);
+    if(output == nullptr)
+    {
+      return 0;
+    }
+    const int32 status = blosc_decompress_ctx(*buffer, output, outputBytes, 1);
+    if(status <= 0)
+    {
+      std::free(output);
+      return 0;
+    }
+    std::free(*buffer);
+    *buffer = output;
+    *bufferSize = outputBytes;
+    return static_cast<size_t>(status);
+  }
+
+  const size_t typeSize = cdValues[2];
+  const int32 level = static_cast<int32>(cdValues[4]);
+  const int32 shuffle = static_cast<int32>(cdValues[5]);
+  const size_t outputCapacity = numBytes + BLOSC_MAX_OVERHEAD;
+  void* output = std::malloc(outputCapacity);
+  if(output == nullptr)
+  {
+    return 0;
+  }
+  const int32 status = blosc_compress_ctx(level, shuffle, typeSize, numBytes, *buffer, output, outputCapacity, k_BloscCompressorName, 0, 1);
+  if(status <= 0)
+  {
+    std::free(output);
+    return 0;
+  }
+  std::free(*buffer);
+  *buffer = output;
+  *bufferSize = outputCapacity;
+  return static_cast<size_t>(status);
+}
+#endif
+
+void ShuffleBytes(usize typeSize, nonstd::span<const uint8> input, nonstd::span<uint8> output)
+{
+  // Mirrors the HDF5 shuffle filter: byte j of every element is grouped together, trailing bytes are copied as is
+  const usize numElements = input.size() / typeSize;
+  if(typeSize <= 1 || numElements <= 1)
+  {
+    std::copy(input.begin(), input.end(), output.begin());
+    return;
+  }
+  for(usize byteIndex = 0; byteIndex < typeSize; byteIndex++)
+  {
+    uint8* destination = output.data() + byteIndex * numElements;
+    for(usize i = 0; i < numElements; i++)
+    {
+      destination[i] = input[i * typeSize + byteIndex];
+    }
+  }
+  const usize shuffledBytes = numElements * typeSize;
+  std::copy(input.begin() + shuffledBytes, input.end(), output.begin() + shuffledBytes);
+}
+
+Result<> Deflate(int32 level, nonstd::span<const uint8> input, std::vector<uint8>& output)
+{
+  uLongf outputBytes = compressBound(static_cast<uLong>(input.size()));
+  output.resize(outputBytes);
+  const int32 status = compress2(output.data(), &outputBytes, input.data(), static_cast<uLong>(input.size()), level);
+  if(status != Z_OK)
+  {
+    return MakeErrorResult(Compression::k_CompressionFailedError, fmt::format("zlib failed to compress a {} byte chunk. Error code: {}", input.size(), status));
+  }
+  output.resize(outputBytes);
+  return {};
+}
+} // namespace
+
+bool CompressionSettings::isEnabled() const
+{
+  return type != Type::None;
+}
+
+float64 WriteStatistics::compressionRatio() const
+{
+  if(storedBytes == 0)
+  {
+    return 1.0;
+  }
+  return static_cast<float64>(uncompressedBytes) / static_cast<float64>(storedBytes);
+}
+
+float64 WriteStatistics::throughput() const
+{
+  if(seconds <= 0.0)
+  {
+    return 0.0;
+  }
+  return static_cast<float64>(uncompressedBytes) / (1024.0 * 1024.0) / seconds;
+}
+
+WriteStatistics& WriteStatistics::operator+=(const WriteStatistics& rhs)
+{
+  uncompressedBytes += rhs.uncompressedBytes;
+  storedBytes += rhs.storedBytes;
+  seconds += rhs.seconds;
+  return *this;
+}
+
+bool Compression::IsBloscAvailable()
+{
+#ifdef SIMPLNX_ENABLE_COMPRESSORS
+  return true;
+#else
+  return false;
+#endif
+}
+
+Result<> Compression::RegisterBloscFilter()
+{
+#ifdef SIMPLNX_ENABLE_COMPRESSORS
+  if(H5Zfilter_avail(k_BloscFilterId) > 0)
+  {
+    return {};
+  }
+  H5Z_class2_t filterClass = {H5Z_CLASS_T_VERS, static_cast<H5Z_filter_t>(k_BloscFilterId), 1, 1, "blosc", nullptr, nullptr, BloscFilter};
+  if(H5Zregister(&filterClass) < 0)
+  {
+    return MakeErrorResult(k_FilterSetupError, "Failed to register the Blosc HDF5 filter");
+  }
+  return {};
+#else
+  return MakeErrorResult(k_UnsupportedCompressionError, "Blosc compression is not available. Rebuild with SIMPLNX_ENABLE_COMPRESSORS enabled.");
+#endif
+}
+
+std::vector<SizeType> Compression::ComputeChunkShape(const std::vector<usize>& tupleShape, const std::vector<usize>& componentShape, usize typeSize, usize targetBytes)
+{
+  std::vector<SizeType> chunkShape;
+  chunkShape.reserve(tupleShape.size() + componentShape.size());
+  chunkShape.insert(chunkShape.end(), tupleShape.begin(), tupleShape.end());
+  chunkShape.insert(chunkShape.end(), componentShape.begin(), componentShape.end());
+
+  usize chunkBytes = typeSize;
+  for(usize value : componentShape)
+  {
+    chunkBytes *= std::max<usize>(value, 1);
+  }
+
+  // Tuple dimensions are stored slowest to fastest varying. Whole dimensions are
+  // taken from the fast end until the target size is reached, the dimension that
+  // overflows the target is split and every slower dimension is set to 1.
+  bool isFull = false;
+  for(usize i = tupleShape.size(); i-- > 0;)
+  {
+    const usize dimension = std::max<usize>(tupleShape[i], 1);
+    if(isFull)
+    {
+      chunkShape[i] = 1;
+      continue;
+    }
+    if(chunkBytes * dimension <= targetBytes)
+    {
+      chunkShape[i] = dimension;
+      chunkBytes *= dimension;
+      continue;
+    }
+    chunkShape[i] = std::clamp<usize>(targetBytes / chunkBytes, 1, dimension);
+    isFull = true;
+  }
+
+  // HDF5 does not allow zero sized chunk dimensions
+  for(auto& value : chunkShape)
+  {
+    value = std::max<SizeType>(value, 1);
+  }
+  return chunkShape;
+}
+
+Result<> Compression::ApplyFilters(IdType propertyListId, const CompressionSettings& settings, [[maybe_unused]] usize typeSize, [[maybe_unused]] usize chunkBytes)
+{
+  const uint32 level = static_cast<uint32>(std::clamp(settings.level, CompressionSettings::k_MinLevel, CompressionSettings::k_MaxLevel));
+  switch(settings.type)
+  {
+  case CompressionSettings::Type::None:
+    return {};
+  case CompressionSettings::Type::ShuffleDeflate:
+    if(H5Pset_shuffle(propertyListId) < 0)
+    {
+      return MakeErrorResult(k_FilterSetupError, "Failed to add the shuffle filter to the dataset properties");
+    }
+    [[fallthrough]];
+  case CompressionSettings::Type::Deflate:
+    if(H5Pset_deflate(propertyListId, level) < 0)
+    {
+      return MakeErrorResult(k_FilterSetupError, "Failed to add the deflate filter to the dataset properties");
+    }
+    return {};
+  case CompressionSettings::Type::Blosc: {
+#ifdef SIMPLNX_ENABLE_COMPRESSORS
+    auto registerResult = RegisterBloscFilter();
+    if(registerResult.invalid())
+    {
+      return registerResult;
+    }
+    const unsigned int cdValues[k_BloscNumValues] = {k_BloscFilterRevision, BLOSC_VERSION_FORMAT, static_cast<uint32>(typeSize), static_cast<uint32>(chunkBytes), level, BLOSC_SHUFFLE, BLOSC_LZ4};
+    if(H5Pset_filter(propertyListId, static_cast<H5Z_filter_t>(k_BloscFilterId), H5Z_FLAG_MANDATORY, k_BloscNumValues, cdValues) < 0)
+    {
+      return MakeErrorResult(k_FilterSetupError, "Failed to add the Blosc filter to the dataset properties");
+    }
+    return {};
+#else
+    return RegisterBloscFilter();
+#endif
+  }
+  }
+  return MakeErrorResult(k_UnsupportedCompressionError, fmt::format("Unknown compression type: {}", static_cast<int32>(settings.type)));
+}
+
+Result<> Compression::CompressChunk(const CompressionSettings& settings, usize typeSize, nonstd::span<const uint8> input, std::vector<uint8>& output)
+{
+  const int32 level = std::clamp(settings.level, CompressionSettings::k_MinLevel, CompressionSettings::k_MaxLevel);
+  switch(settings.type)
+  {
+  case CompressionSettings::Type::None:
+    output.assign(input.begin(), input.end());
+    return {};
+  case CompressionSettings::Type::Deflate:
+    return Deflate(level, input, output);
+  case CompressionSettings::Type::ShuffleDeflate: {
+    std::vector<uint8> shuffled(input.size());
+    ShuffleBytes(typeSize, input, shuffled);
+    return Deflate(level, shuffled, output);
+  }
+  case CompressionSettings::Type::Blosc: {
+#ifdef SIMPLNX_ENABLE_COMPRESSORS
+    output.resize(input.size() + BLOSC_MAX_OVERHEAD);
+    const int32 status = blosc_compress_ctx(level, BLOSC_SHUFFLE, typeSize, input.size(), input.data(), output.data(), output.size(), k_BloscCompressorName, 0, 1);
+    if(status <= 0)
+    {
+      return MakeErrorResult(k_CompressionFailedError, fmt::format("Blosc failed to compress a {} byte chunk. Error code: {}", input.size(), status));
+    }
+    output.resize(static_cast<usize>(status));
+    return {};
+#else
+    return RegisterBloscFilter();
+#endif
+  }
+  }
+  return MakeErrorResult(k_UnsupportedCompressionError, fmt::format("Unknown compression type: {}", static_cast<int32>(settings.type)));
+}
+} // namespace nx::core::HDF5
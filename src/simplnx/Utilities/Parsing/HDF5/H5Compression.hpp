@@ -0,0 +1,127 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/Utilities/Parsing/HDF5/H5.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <nonstd/span.hpp>
+
+#include <vector>
+
+namespace nx::core::HDF5
+{
+/**
+ * @brief The CompressionSettings struct describes how DataStore datasets are
+ * compressed when written to HDF5. Compressed datasets are always chunked.
+ */
+struct SIMPLNX_EXPORT CompressionSettings
+{
+  enum class Type : uint8
+  {
+    None = 0,
+    Deflate = 1,
+    ShuffleDeflate = 2,
+    Blosc = 3
+  };
+
+  static inline constexpr int32 k_MinLevel = 1;
+  static inline constexpr int32 k_MaxLevel = 9;
+  static inline constexpr int32 k_DefaultLevel = 4;
+  static inline constexpr usize k_DefaultChunkBytes = 1048576;
+
+  Type type = Type::None;
+  int32 level = k_DefaultLevel;
+  usize targetChunkBytes = k_DefaultChunkBytes;
+
+  /**
+   * @brief Returns true if any compression filter is selected.
+   * @return bool
+   */
+  bool isEnabled() const;
+};
+
+/**
+ * @brief The WriteStatistics struct accumulates the number of bytes handed to
+ * the writer, the number of bytes stored in the file and the time spent
+ * writing DataStore datasets.
+ */
+struct SIMPLNX_EXPORT WriteStatistics
+{
+  uint64 uncompressedBytes = 0;
+  uint64 storedBytes = 0;
+  float64 seconds = 0.0;
+
+  /**
+   * @brief Returns uncompressedBytes / storedBytes or 1.0 if nothing was stored.
+   * @return float64
+   */
+  float64 compressionRatio() const;
+
+  /**
+   * @brief Returns the uncompressed write throughput in MiB/s.
+   * @return float64
+   */
+  float64 throughput() const;
+
+  WriteStatistics& operator+=(const WriteStatistics& rhs);
+};
+
+namespace Compression
+{
+inline constexpr int32 k_BloscFilterId = 32001;
+inline constexpr int32 k_UnsupportedCompressionError = -2670;
+inline constexpr int32 k_CompressionFailedError = -2671;
+inline constexpr int32 k_FilterSetupError = -2672;
+
+/**
+ * @brief Returns true if simplnx was built with the Blosc compressor.
+ * @return bool
+ */
+SIMPLNX_EXPORT bool IsBloscAvailable();
+
+/**
+ * @brief Registers the Blosc HDF5 filter so that Blosc compressed datasets can
+ * be read back. Does nothing if Blosc is not available or already registered.
+ * @return Result<>
+ */
+SIMPLNX_EXPORT Result<> RegisterBloscFilter();
+
+/**
+ * @brief Returns an HDF5 chunk shape for a dataset of shape (tupleShape + componentShape)
+ * that spans close to targetBytes. Components and the fastest varying tuple
+ * dimensions are kept whole and only the slowest partially covered dimension
+ * is split, so every chunk maps onto one contiguous range of the DataStore.
+ * @param tupleShape
+ * @param componentShape
+ * @param typeSize
+ * @param targetBytes
+ * @return std::vector<SizeType>
+ */
+SIMPLNX_EXPORT std::vector<SizeType> ComputeChunkShape(const std::vector<usize>& tupleShape, const std::vector<usize>& componentShape, usize typeSize, usize targetBytes);
+
+/**
+ * @brief Adds the filter pipeline described by the settings to the given
+ * dataset creation property list.
+ * @param propertyListId
+ * @param settings
+ * @param typeSize
+ * @param chunkBytes
+ * @return Result<>
+ */
+SIMPLNX_EXPORT Result<> ApplyFilters(IdType propertyListId, const CompressionSettings& settings, usize typeSize, usize chunkBytes);
+
+/**
+ * @brief Compresses one full chunk exactly the way the HDF5 filter pipeline
+ * created by ApplyFilters would. The output can be passed to H5Dwrite_chunk
+ * with a filter mask of 0. This function is thread safe and does not call
+ * into the HDF5 library.
+ * @param settings
+ * @param typeSize
+ * @param input
+ * @param output
+ * @return Result<>
+ */
+SIMPLNX_EXPORT Result<> CompressChunk(const CompressionSettings& settings, usize typeSize, nonstd::span<const uint8> input, std::vector<uint8>& output);
+} // namespace Compression
+} // namespace nx::core::HDF5
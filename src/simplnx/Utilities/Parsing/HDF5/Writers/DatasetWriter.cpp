@@ -168,6 +168,78 @@ void DatasetWriter::createOrOpenDatasetChunk(IdType typeId, IdType dataspaceId,
   createOrOpenDataset(typeId, dataspaceId, propertiesId);
 }
 
+Result<> DatasetWriter::createCompressedDataset(IdType typeId, const DimsType& dims, const DimsType& chunkShape, const CompressionSettings& compression)
+{
+  if(!isValid())
+  {
+    return MakeErrorResult(-100, "Cannot Write to Invalid DatasetWriter");
+  }
+  if(dims.size() != chunkShape.size())
+  {
+    return MakeErrorResult(-101, fmt::format("Chunk rank {} does not match the dataset rank {}", chunkShape.size(), dims.size()));
+  }
+
+  auto result = findAndDeleteAttribute();
+  if(result.invalid())
+  {
+    return MakeErrorResult(result.errors()[0].code, "Error Removing Existing Attribute");
+  }
+
+  const usize typeSize = H5Tget_size(typeId);
+  usize chunkBytes = typeSize;
+  for(const auto& value : chunkShape)
+  {
+    chunkBytes *= value;
+  }
+
+  std::vector<hsize_t> hDims(dims.begin(), dims.end());
+  std::vector<hsize_t> hChunkDims(chunkShape.begin(), chunkShape.end());
+  hid_t propertiesId = H5Pcreate(H5P_DATASET_CREATE);
+  if(H5Pset_chunk(propertiesId, static_cast<int32>(hChunkDims.size()), hChunkDims.data()) < 0)
+  {
+    H5Pclose(propertiesId);
+    return MakeErrorResult(-102, "Error Setting Dataset Chunk Shape");
+  }
+  result = Compression::ApplyFilters(propertiesId, compression, typeSize, chunkBytes);
+  if(result.invalid())
+  {
+    H5Pclose(propertiesId);
+    return result;
+  }
+
+  hid_t dataspaceId = H5Screate_simple(static_cast<int32>(hDims.size()), hDims.data(), nullptr);
+  if(dataspaceId < 0)
+  {
+    H5Pclose(propertiesId);
+    return MakeErrorResult(dataspaceId, "Error Opening Dataspace");
+  }
+
+  closeHdf5();
+  setId(H5Dcreate(getParentId(), getName().c_str(), typeId, dataspaceId, H5P_DEFAULT, propertiesId, H5P_DEFAULT));
+  H5Sclose(dataspaceId);
+  H5Pclose(propertiesId);
+  if(getId() < 0)
+  {
+    return MakeErrorResult(getId(), "Error Creating Compressed Dataset");
+  }
+  return {};
+}
+
+Result<> DatasetWriter::writeRawChunk(nonstd::span<const hsize_t> offset, nonstd::span<const uint8> bytes)
+{
+  if(getId() <= 0)
+  {
+    return MakeErrorResult(-103, "Cannot Write Chunk: Dataset has not been created");
+  }
+  // A filter mask of 0 tells HDF5 every filter in the pipeline was applied to the chunk
+  herr_t error = H5Dwrite_chunk(getId(), H5P_DEFAULT, 0, offset.data(), bytes.size(), bytes.data());
+  if(error < 0)
+  {
+    return MakeErrorResult(error, "Error Writing Dataset Chunk");
+  }
+  return {};
+}
+
 IdType DatasetWriter::getPListId() const
 {
   return H5Dget_create_plist(getId());
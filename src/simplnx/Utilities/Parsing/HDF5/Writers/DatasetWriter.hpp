@@ -1,5 +1,6 @@
 #pragma once
 
+#include "simplnx/Utilities/Parsing/HDF5/H5Compression.hpp"
 #include "simplnx/Utilities/Parsing/HDF5/H5Support.hpp"
 #include "simplnx/Utilities/Parsing/HDF5/Writers/ObjectWriter.hpp"
 
@@ -202,6 +203,29 @@ public:
     return returnError;
   }
 
+  /**
+   * @brief Creates a chunked dataset of the given type and shape with the
+   * filter pipeline described by the compression settings. The chunk data is
+   * then provided through writeRawChunk. Returns the HDF5 error, should one
+   * occur.
+   * @param typeId
+   * @param dims
+   * @param chunkShape
+   * @param compression
+   * @return Result<>
+   */
+  Result<> createCompressedDataset(IdType typeId, const DimsType& dims, const DimsType& chunkShape, const CompressionSettings& compression);
+
+  /**
+   * @brief Writes a chunk that was already passed through the dataset's filter
+   * pipeline (see Compression::CompressChunk) directly to the file, bypassing
+   * the HDF5 filters. Requires createCompressedDataset to be called first.
+   * @param offset
+   * @param bytes
+   * @return Result<>
+   */
+  Result<> writeRawChunk(nonstd::span<const hsize_t> offset, nonstd::span<const uint8> bytes);
+
   /**
    * @brief Returns the property's HDF5 ID. Returns 0 if the attribute is
    * invalid.
@@ -4,6 +4,9 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/Parsing/Text/MappedTextFile.hpp"
+#include "simplnx/Utilities/Parsing/Text/TextChunks.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 #include "simplnx/simplnx_export.hpp"
 
@@ -13,6 +16,7 @@
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -171,7 +175,8 @@ Result<> ReadFile(const fs::path& filename, AbstractDataStore<T>& data, uint64_t
 }
 
 /**
- * @brief Reads a Text file that contains numeric values into a single DataArray<T> using an intermediate string token and checks for valid conversion to the templated type T.
+ * @brief Reads a Text file that contains numeric values into a single DataArray<T> and checks for valid conversion to the templated type T.
+ * The file is memory mapped, the values of each chunk of lines are counted and then converted in parallel straight into the data store.
  * @tparam T Final Target type of the value being read
  * @param filename The input path to the text file
  * @param data The Target DataArray<T>
@@ -182,58 +187,76 @@ Result<> ReadFile(const fs::path& filename, AbstractDataStore<T>& data, uint64_t
 template <typename T>
 Result<> ReadFile(const fs::path& filename, AbstractDataStore<T>& data, uint64_t skipHeaderLines, char delimiter)
 {
-  int32 err;
   if(!fs::exists(filename))
   {
     return MakeErrorResult(k_RBR_FILE_NOT_EXIST, fmt::format("Input file does not exist: {}", filename.string()));
   }
 
-  std::ifstream in(filename.c_str(), std::ios_base::in | std::ios_base::binary);
-  if(!in.is_open())
+  std::unique_ptr<MappedTextFile> mappedFile;
+  try
   {
-    return MakeErrorResult(k_RBR_FILE_NOT_OPEN, fmt::format("Could not open file for reading: {}", filename.string()));
+    mappedFile = std::make_unique<MappedTextFile>(filename);
+  } catch(const std::exception& exception)
+  {
+    return MakeErrorResult(k_RBR_FILE_NOT_OPEN, fmt::format("Could not open file for reading: {}\n{}", filename.string(), exception.what()));
   }
 
-  in.imbue(std::locale(std::locale(), new nx::core::CsvParser::DelimiterType(delimiter)));
-
-  std::array<char, k_BufferSize> buf = {};
-  char* buffer = buf.data();
-
-  // Skip some header bytes by just reading those bytes into the pointer knowing that the next
-  // thing we are going to do it over write those bytes with the real data that we are after.
-  for(int i = 0; i < skipHeaderLines; i++)
+  const std::string_view text = mappedFile->text();
+  const usize dataStart = TextChunks::FindLineStart(text, skipHeaderLines);
+  if(TextChunks::CountLines(text.substr(0, dataStart)) < skipHeaderLines)
   {
-    buf.fill(0x00);                                                // Splat Null Chars across the line
-    err = nx::core::CsvParser::ReadLine(in, buffer, k_BufferSize); // Read Line 1 - VTK Version Info
-    if(err < 0)
-    {
-      return MakeErrorResult(k_RBR_READ_ERROR, fmt::format("Could not read data from file while skipping header lines: {}", filename.string()));
-    }
+    return MakeErrorResult(k_RBR_READ_ERROR, fmt::format("Could not read data from file while skipping header lines: {}", filename.string()));
   }
+  const std::string_view dataText = text.substr(dataStart);
 
-  size_t numTuples = data.getNumberOfTuples();
-  int scalarNumComp = data.getNumberOfComponents();
-
-  size_t totalSize = numTuples * static_cast<size_t>(scalarNumComp);
-
-  std::string value;
-  for(size_t i = 0; i < totalSize; ++i)
-  {
-    in >> value;
-    Result<T> parseResult = ConvertTo<T>::convert(value);
-    if(parseResult.invalid())
+  // Every value is a row, so each chunk knows the index of its first value
+  const auto countValues = [delimiter](std::string_view chunkText) {
+    usize numValues = 0;
+    usize offset = 0;
+    while(!TextChunks::NextToken(chunkText, offset, delimiter).empty())
     {
-      return ConvertResult(std::move(parseResult));
+      numValues++;
     }
-    data[i] = parseResult.value();
-    err = CheckErrorBits(&in);
-    if(err == k_RBR_READ_EOF && i < totalSize - 1)
+    return numValues;
+  };
+  const std::vector<TextChunks::LineChunk> chunks = TextChunks::SplitIntoLineChunks(dataText, countValues);
+
+  const usize totalSize = data.getNumberOfTuples() * data.getNumberOfComponents();
+  const usize numValues = chunks.empty() ? 0 : chunks.back().firstRow + chunks.back().numRows;
+  if(numValues < totalSize)
+  {
+    return MakeErrorResult(k_RBR_READ_EOF, fmt::format("Read past End Of File (EOF) while parsing file: {}", filename.string()));
+  }
+
+  std::vector<Result<>> chunkResults(chunks.size());
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, chunks.size());
+  dataAlg.requireStoresInMemory({&data});
+  dataAlg.execute([&](const Range& range) {
+    for(usize chunkIndex = range.min(); chunkIndex < range.max(); chunkIndex++)
     {
-      return MakeErrorResult(k_RBR_READ_EOF, fmt::format("Read past End Of File (EOF) while parsing file: {}", filename.string()));
+      const TextChunks::LineChunk& chunk = chunks[chunkIndex];
+      const std::string_view chunkText = dataText.substr(chunk.begin, chunk.end - chunk.begin);
+      usize offset = 0;
+      for(usize index = chunk.firstRow; index < totalSize && index < chunk.firstRow + chunk.numRows; index++)
+      {
+        T value = {};
+        Result<> convertResult = TextChunks::ConvertToken(TextChunks::NextToken(chunkText, offset, delimiter), value);
+        if(convertResult.invalid())
+        {
+          chunkResults[chunkIndex] = std::move(convertResult);
+          break;
+        }
+        data.setValue(index, value);
+      }
     }
-    if(err == k_RBR_READ_ERROR)
+  });
+
+  for(Result<>& chunkResult : chunkResults)
+  {
+    if(chunkResult.invalid())
     {
-      return MakeErrorResult(k_RBR_READ_ERROR, fmt::format("Read error while parsing file: {}", filename.string()));
+      return std::move(chunkResult);
     }
   }
 
@@ -0,0 +1,35 @@
+#include "MappedTextFile.hpp"
+
+namespace nx::core
+{
+// -----------------------------------------------------------------------------
+MappedTextFile::MappedTextFile(const std::filesystem::path& filePath)
+: m_File(MemoryMappedFile::OpenReadOnly(filePath))
+{
+}
+
+// -----------------------------------------------------------------------------
+MappedTextFile::~MappedTextFile() noexcept = default;
+
+// -----------------------------------------------------------------------------
+std::string_view MappedTextFile::text() const
+{
+  if(m_File->data() == nullptr)
+  {
+    return {};
+  }
+  return {static_cast<const char*>(m_File->data()), static_cast<usize>(m_File->size())};
+}
+
+// -----------------------------------------------------------------------------
+uint64 MappedTextFile::size() const
+{
+  return m_File->size();
+}
+
+// -----------------------------------------------------------------------------
+const std::filesystem::path& MappedTextFile::filePath() const
+{
+  return m_File->filePath();
+}
+} // namespace nx::core
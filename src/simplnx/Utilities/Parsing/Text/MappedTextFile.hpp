@@ -0,0 +1,58 @@
+#pragma once
+
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/Utilities/MemoryMappedFile.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <filesystem>
+#include <memory>
+#include <string_view>
+
+namespace nx::core
+{
+/**
+ * @class MappedTextFile
+ * @brief The MappedTextFile class maps an existing file read-only into memory so
+ * that its contents can be parsed in place by several threads without copying
+ * the file into a buffer first. Pages are loaded by the OS on first access.
+ * The mapping itself is a read-only MemoryMappedFile.
+ */
+class SIMPLNX_EXPORT MappedTextFile
+{
+public:
+  /**
+   * @brief Opens and maps the given file. Throws a std::runtime_error if the file
+   * could not be opened or mapped. Empty files are valid and have an empty text().
+   * @param filePath
+   */
+  explicit MappedTextFile(const std::filesystem::path& filePath);
+
+  MappedTextFile(const MappedTextFile&) = delete;
+  MappedTextFile(MappedTextFile&&) noexcept = delete;
+  MappedTextFile& operator=(const MappedTextFile&) = delete;
+  MappedTextFile& operator=(MappedTextFile&&) noexcept = delete;
+
+  ~MappedTextFile() noexcept;
+
+  /**
+   * @brief Returns the contents of the file. The view is valid for the lifetime of this object.
+   * @return std::string_view
+   */
+  std::string_view text() const;
+
+  /**
+   * @brief Returns the size of the file in bytes.
+   * @return uint64
+   */
+  uint64 size() const;
+
+  /**
+   * @brief Returns the path of the mapped file.
+   * @return const std::filesystem::path&
+   */
+  const std::filesystem::path& filePath() const;
+
+private:
+  std::unique_ptr<MemoryMappedFile> m_File;
+};
+} // namespace nx::core
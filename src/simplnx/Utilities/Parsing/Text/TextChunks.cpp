@@ -0,0 +1,88 @@
+#include "TextChunks.hpp"
+
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+namespace nx::core::TextChunks
+{
+// -----------------------------------------------------------------------------
+std::vector<LineChunk> SplitIntoLineChunks(std::string_view text, const RowCounter& countRows, usize chunkSize)
+{
+  chunkSize = std::max<usize>(chunkSize, 1);
+
+  std::vector<LineChunk> chunks;
+  usize chunkStart = 0;
+  while(chunkStart < text.size())
+  {
+    usize chunkEnd = text.size();
+    if(text.size() - chunkStart > chunkSize)
+    {
+      const usize lineEnd = text.find('\n', chunkStart + chunkSize - 1);
+      chunkEnd = (lineEnd == std::string_view::npos) ? text.size() : lineEnd + 1;
+    }
+    chunks.push_back({chunkStart, chunkEnd, 0, 0});
+    chunkStart = chunkEnd;
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, chunks.size());
+  dataAlg.execute([&](const Range& range) {
+    for(usize chunkIndex = range.min(); chunkIndex < range.max(); chunkIndex++)
+    {
+      LineChunk& chunk = chunks[chunkIndex];
+      chunk.numRows = countRows(text.substr(chunk.begin, chunk.end - chunk.begin));
+    }
+  });
+
+  usize firstRow = 0;
+  for(LineChunk& chunk : chunks)
+  {
+    chunk.firstRow = firstRow;
+    firstRow += chunk.numRows;
+  }
+  return chunks;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<LineChunk> SplitIntoLineChunks(std::string_view text, usize chunkSize)
+{
+  return SplitIntoLineChunks(text, CountNonBlankLines, chunkSize);
+}
+
+// -----------------------------------------------------------------------------
+usize CountLines(std::string_view text)
+{
+  if(text.empty())
+  {
+    return 0;
+  }
+  const auto numLineEndings = static_cast<usize>(std::count(text.begin(), text.end(), '\n'));
+  return (text.back() == '\n') ? numLineEndings : numLineEndings + 1;
+}
+
+// -----------------------------------------------------------------------------
+usize CountNonBlankLines(std::string_view text)
+{
+  usize numLines = 0;
+  usize offset = 0;
+  while(offset < text.size())
+  {
+    if(!IsBlank(NextLine(text, offset)))
+    {
+      numLines++;
+    }
+  }
+  return numLines;
+}
+
+// -----------------------------------------------------------------------------
+usize FindLineStart(std::string_view text, usize line)
+{
+  usize offset = 0;
+  for(usize lineIndex = 0; lineIndex < line && offset < text.size(); lineIndex++)
+  {
+    const usize lineEnd = text.find('\n', offset);
+    offset = (lineEnd == std::string_view::npos) ? text.size() : lineEnd + 1;
+  }
+  return offset;
+}
+} // namespace nx::core::TextChunks
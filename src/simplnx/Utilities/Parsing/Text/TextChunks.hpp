@@ -0,0 +1,411 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/Common/TypesUtility.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <fmt/format.h>
+
+#include <nonstd/span.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <functional>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#if !defined(__cpp_lib_to_chars)
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#endif
+
+namespace nx::core::TextChunks
+{
+/**
+ * @brief The target size in bytes of the chunks produced by SplitIntoLineChunks.
+ */
+inline constexpr usize k_DefaultChunkSize = 4 * 1024 * 1024;
+
+/**
+ * @brief A range of bytes [begin, end) of a text that starts and ends on a line boundary.
+ * firstRow is the number of rows in front of the chunk and numRows the number of rows
+ * inside it, as counted by the RowCounter used to split the text.
+ */
+struct LineChunk
+{
+  usize begin = 0;
+  usize end = 0;
+  usize firstRow = 0;
+  usize numRows = 0;
+};
+
+/**
+ * @brief Returns the number of rows held by a chunk of text.
+ */
+using RowCounter = std::function<usize(std::string_view)>;
+
+/**
+ * @brief Splits the text into chunks of roughly chunkSize bytes that start and end on
+ * line boundaries. The rows of every chunk are counted in parallel so that each chunk
+ * knows the index of its first row and can be parsed independently.
+ * @param text
+ * @param countRows
+ * @param chunkSize
+ * @return std::vector<LineChunk>
+ */
+SIMPLNX_EXPORT std::vector<LineChunk> SplitIntoLineChunks(std::string_view text, const RowCounter& countRows, usize chunkSize = k_DefaultChunkSize);
+
+/**
+ * @brief Splits the text into chunks where every non-blank line is a row.
+ * @param text
+ * @param chunkSize
+ * @return std::vector<LineChunk>
+ */
+SIMPLNX_EXPORT std::vector<LineChunk> SplitIntoLineChunks(std::string_view text, usize chunkSize = k_DefaultChunkSize);
+
+/**
+ * @brief Returns the number of lines in the text. A final line without a line ending is counted.
+ * @param text
+ * @return usize
+ */
+SIMPLNX_EXPORT usize CountLines(std::string_view text);
+
+/**
+ * @brief Returns the number of lines in the text that hold more than whitespace.
+ * @param text
+ * @return usize
+ */
+SIMPLNX_EXPORT usize CountNonBlankLines(std::string_view text);
+
+/**
+ * @brief Returns the offset of the start of the given zero based line, or the size of the
+ * text if it has fewer lines.
+ * @param text
+ * @param line
+ * @return usize
+ */
+SIMPLNX_EXPORT usize FindLineStart(std::string_view text, usize line);
+
+/**
+ * @brief Returns the line that starts at offset without its line ending and moves
+ * offset to the start of the next line.
+ * @param text
+ * @param offset
+ * @return std::string_view
+ */
+inline std::string_view NextLine(std::string_view text, usize& offset)
+{
+  const usize lineStart = offset;
+  usize lineEnd = text.find('\n', lineStart);
+  if(lineEnd == std::string_view::npos)
+  {
+    lineEnd = text.size();
+    offset = text.size();
+  }
+  else
+  {
+    offset = lineEnd + 1;
+  }
+  if(lineEnd > lineStart && text[lineEnd - 1] == '\r')
+  {
+    lineEnd--;
+  }
+  return text.substr(lineStart, lineEnd - lineStart);
+}
+
+/**
+ * @brief Returns true if the character separates whitespace delimited tokens.
+ * @param character
+ * @return bool
+ */
+inline constexpr bool IsWhitespace(char character)
+{
+  return character == ' ' || character == '\t' || character == '\r' || character == '\n' || character == '\v' || character == '\f';
+}
+
+/**
+ * @brief Returns true if the line only holds whitespace.
+ * @param line
+ * @return bool
+ */
+inline bool IsBlank(std::string_view line)
+{
+  for(const char character : line)
+  {
+    if(!IsWhitespace(character))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the next whitespace delimited token of the line starting at offset and
+ * moves offset past it. An empty view is returned once the line is exhausted.
+ * @param line
+ * @param offset
+ * @return std::string_view
+ */
+inline std::string_view NextToken(std::string_view line, usize& offset)
+{
+  while(offset < line.size() && IsWhitespace(line[offset]))
+  {
+    offset++;
+  }
+  const usize tokenStart = offset;
+  while(offset < line.size() && !IsWhitespace(line[offset]))
+  {
+    offset++;
+  }
+  return line.substr(tokenStart, offset - tokenStart);
+}
+
+/**
+ * @brief Returns the next token starting at offset that is delimited by whitespace or the
+ * given delimiter and moves offset past it. An empty view is returned once the text is
+ * exhausted.
+ * @param text
+ * @param offset
+ * @param delimiter
+ * @return std::string_view
+ */
+inline std::string_view NextToken(std::string_view text, usize& offset, char delimiter)
+{
+  while(offset < text.size() && (IsWhitespace(text[offset]) || text[offset] == delimiter))
+  {
+    offset++;
+  }
+  const usize tokenStart = offset;
+  while(offset < text.size() && !IsWhitespace(text[offset]) && text[offset] != delimiter)
+  {
+    offset++;
+  }
+  return text.substr(tokenStart, offset - tokenStart);
+}
+
+/**
+ * @brief Splits the line into tokens at any of the delimiters the same way
+ * StringUtilities::split does, but without copying the tokens. When
+ * consecutiveDelimiters is true every delimiter separates two tokens, so empty tokens
+ * are kept. Otherwise empty tokens and a trailing delimiter are dropped.
+ * @param line
+ * @param delimiters
+ * @param consecutiveDelimiters
+ * @param tokens Cleared and filled with views into line
+ */
+inline void SplitDelimited(std::string_view line, nonstd::span<const char> delimiters, bool consecutiveDelimiters, std::vector<std::string_view>& tokens)
+{
+  tokens.clear();
+  if(line.empty())
+  {
+    return;
+  }
+  const auto isDelimiter = [delimiters](char character) { return std::find(delimiters.begin(), delimiters.end(), character) != delimiters.end(); };
+
+  usize tokenStart = 0;
+  usize end = line.size();
+  if(!consecutiveDelimiters && isDelimiter(line.back()))
+  {
+    end--;
+  }
+  while(true)
+  {
+    usize position = tokenStart;
+    while(position < end && !isDelimiter(line[position]))
+    {
+      position++;
+    }
+    if(position != tokenStart || consecutiveDelimiters)
+    {
+      tokens.push_back(line.substr(tokenStart, position - tokenStart));
+    }
+    if(position == end)
+    {
+      break;
+    }
+    tokenStart = position + 1;
+  }
+
+  if(tokens.empty())
+  {
+    tokens.push_back(line);
+  }
+}
+
+/**
+ * @brief Converts the whole token into a number with std::from_chars. A leading '+' is
+ * accepted. Returns false if the token is empty, is not a number, does not fit into T or
+ * has trailing characters.
+ * @tparam T
+ * @param token
+ * @param value
+ * @return bool
+ */
+template <typename T>
+bool ParseValue(std::string_view token, T& value)
+{
+  static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "ParseValue only supports numeric types");
+  if(!token.empty() && token.front() == '+')
+  {
+    token.remove_prefix(1);
+  }
+  if(token.empty())
+  {
+    return false;
+  }
+  const char* first = token.data();
+  const char* last = token.data() + token.size();
+  if constexpr(std::is_floating_point_v<T>)
+  {
+#if defined(__cpp_lib_to_chars)
+    auto [ptr, errorCode] = std::from_chars(first, last, value);
+    return errorCode == std::errc() && ptr == last;
+#else
+    // Standard libraries without floating point from_chars fall back to strtod on a terminated copy
+    std::array<char, 128> buffer = {};
+    if(token.size() >= buffer.size())
+    {
+      return false;
+    }
+    std::copy(first, last, buffer.begin());
+    char* end = nullptr;
+    errno = 0;
+    const double parsed = std::strtod(buffer.data(), &end);
+    if(errno == ERANGE || end != buffer.data() + token.size())
+    {
+      return false;
+    }
+    value = static_cast<T>(parsed);
+    return true;
+#endif
+  }
+  else
+  {
+    auto [ptr, errorCode] = std::from_chars(first, last, value);
+    return errorCode == std::errc() && ptr == last;
+  }
+}
+
+/**
+ * @brief Converts the number at the start of the token with the leniency of std::stoll,
+ * std::stoull and std::stod: leading whitespace and a '+' sign are skipped and any
+ * characters after the number are ignored. Unsigned types reject a leading '-'. Booleans
+ * accept true/false in lower, upper or title case and otherwise compare a number with 0;
+ * tokens that are not a number are true.
+ * @tparam T
+ * @param token
+ * @param value
+ * @return std::errc std::errc::invalid_argument if the token does not start with a number and
+ * std::errc::result_out_of_range if the number does not fit into T
+ */
+template <typename T>
+std::errc ParseLeadingValue(std::string_view token, T& value)
+{
+  if constexpr(std::is_same_v<T, bool>)
+  {
+    if(token == "TRUE" || token == "true" || token == "True")
+    {
+      value = true;
+      return {};
+    }
+    if(token == "FALSE" || token == "false" || token == "False")
+    {
+      value = false;
+      return {};
+    }
+    int64 intValue = 0;
+    if(ParseLeadingValue(token, intValue) == std::errc())
+    {
+      value = intValue != 0;
+      return {};
+    }
+    float64 floatValue = 0.0;
+    if(ParseLeadingValue(token, floatValue) == std::errc())
+    {
+      value = floatValue != 0.0;
+      return {};
+    }
+    value = true;
+    return {};
+  }
+  else
+  {
+    usize start = 0;
+    while(start < token.size() && IsWhitespace(token[start]))
+    {
+      start++;
+    }
+    token.remove_prefix(start);
+    if constexpr(std::is_unsigned_v<T>)
+    {
+      if(!token.empty() && token.front() == '-')
+      {
+        return std::errc::result_out_of_range;
+      }
+    }
+    if(!token.empty() && token.front() == '+')
+    {
+      token.remove_prefix(1);
+    }
+    if(token.empty())
+    {
+      return std::errc::invalid_argument;
+    }
+    if constexpr(std::is_floating_point_v<T>)
+    {
+#if defined(__cpp_lib_to_chars)
+      return std::from_chars(token.data(), token.data() + token.size(), value).ec;
+#else
+      std::array<char, 128> buffer = {};
+      const usize length = std::min(token.size(), buffer.size() - 1);
+      std::copy_n(token.data(), length, buffer.begin());
+      char* end = nullptr;
+      errno = 0;
+      const double parsed = std::strtod(buffer.data(), &end);
+      if(end == buffer.data())
+      {
+        return std::errc::invalid_argument;
+      }
+      if(errno == ERANGE)
+      {
+        return std::errc::result_out_of_range;
+      }
+      value = static_cast<T>(parsed);
+      return {};
+#endif
+    }
+    else
+    {
+      return std::from_chars(token.data(), token.data() + token.size(), value).ec;
+    }
+  }
+}
+
+/**
+ * @brief Converts the token with ParseLeadingValue and reports failures with the same
+ * error codes as ConvertTo<T>::convert.
+ * @tparam T
+ * @param token
+ * @param value
+ * @return Result<>
+ */
+template <typename T>
+Result<> ConvertToken(std::string_view token, T& value)
+{
+  const std::errc errorCode = ParseLeadingValue(token, value);
+  if(errorCode == std::errc::invalid_argument)
+  {
+    return MakeErrorResult(-10351, fmt::format("Error trying to convert '{}' to type '{}'", token, DataTypeToString(GetDataType<T>())));
+  }
+  if(errorCode != std::errc())
+  {
+    return MakeErrorResult(-10353, fmt::format("Overflow error trying to convert '{}' to type '{}'", token, DataTypeToString(GetDataType<T>())));
+  }
+  return {};
+}
+} // namespace nx::core::TextChunks
@@ -1,9 +1,86 @@
 #include "SegmentFeatures.hpp"
 
 #include "simplnx/DataStructure/Geometry/IGridGeometry.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <array>
+#include <atomic>
+#include <thread>
 
 using namespace nx::core;
 
+namespace
+{
+// Number of FeatureIds updated per bulk copy
+constexpr usize k_ChunkSize = 65536;
+
+// Slabs created per hardware thread so that slabs with many features do not stall the labeling
+constexpr usize k_SlabsPerThread = 4;
+
+/**
+ * @brief Lock free union-find over the provisional slab labels. Roots are
+ * always linked to the smaller label so the root of each set is its smallest
+ * label, independent of the order the unions are performed in.
+ */
+class ConcurrentUnionFind
+{
+public:
+  explicit ConcurrentUnionFind(usize size)
+  : m_Parents(size)
+  {
+    for(usize i = 0; i < size; i++)
+    {
+      m_Parents[i].store(static_cast<int64>(i), std::memory_order_relaxed);
+    }
+  }
+
+  int64 find(int64 label)
+  {
+    while(true)
+    {
+      int64 parent = m_Parents[label].load(std::memory_order_relaxed);
+      if(parent == label)
+      {
+        return label;
+      }
+      const int64 grandParent = m_Parents[parent].load(std::memory_order_relaxed);
+      if(grandParent != parent)
+      {
+        // Path halving
+        m_Parents[label].compare_exchange_weak(parent, grandParent, std::memory_order_relaxed);
+      }
+      label = grandParent;
+    }
+  }
+
+  void unite(int64 labelA, int64 labelB)
+  {
+    while(true)
+    {
+      labelA = find(labelA);
+      labelB = find(labelB);
+      if(labelA == labelB)
+      {
+        return;
+      }
+      if(labelA < labelB)
+      {
+        std::swap(labelA, labelB);
+      }
+      // Link the larger root to the smaller one. Fails if labelA stopped being a root in the meantime.
+      int64 expected = labelA;
+      if(m_Parents[labelA].compare_exchange_strong(expected, labelB, std::memory_order_relaxed))
+      {
+        return;
+      }
+    }
+  }
+
+private:
+  std::vector<std::atomic<int64>> m_Parents;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 SegmentFeatures::SegmentFeatures(DataStructure& dataStructure, const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& mesgHandler)
 : m_DataStructure(dataStructure)
@@ -139,6 +216,176 @@ Result<> SegmentFeatures::execute(IGridGeometry* gridGeom)
   return {};
 }
 
+// -----------------------------------------------------------------------------
+Result<> SegmentFeatures::executeParallel(IGridGeometry* gridGeom, Int32Array& featureIdsArray, const IParallelAlgorithm::AlgorithmArrays& inputArrays)
+{
+  const SizeVec3 udims = gridGeom->getDimensions();
+  const std::array<int64, 3> dims = {static_cast<int64>(udims[0]), static_cast<int64>(udims[1]), static_cast<int64>(udims[2])};
+  const std::array<int64, 6> neighPoints = {-(dims[0] * dims[1]), -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
+
+  // Slabs are whole planes along the slowest varying axis that is not flat so 2D images are split by rows
+  usize splitAxis = 2;
+  while(splitAxis > 0 && dims[splitAxis] == 1)
+  {
+    splitAxis--;
+  }
+  const std::array<int64, 3> strides = {1, dims[0], dims[0] * dims[1]};
+  const int64 planeStride = strides[splitAxis];
+  const int64 numPlanes = dims[splitAxis];
+
+  IParallelAlgorithm::AlgorithmArrays algorithmArrays = inputArrays;
+  algorithmArrays.push_back(&featureIdsArray);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.requireArraysInMemory(algorithmArrays);
+
+  // A single slab needs no merging and runs like the serial flood fill
+  const auto maxSlabs = static_cast<int64>(dataAlg.getParallelizationEnabled() ? std::max(1u, std::thread::hardware_concurrency()) * k_SlabsPerThread : 1);
+  const int64 numSlabs = std::max<int64>(1, std::min(numPlanes, maxSlabs));
+  auto slabBegin = [&](int64 slab) { return (slab * numPlanes / numSlabs) * planeStride; };
+
+  auto& featureIds = featureIdsArray.getDataStoreRef();
+
+  // Phase 1: label each slab independently. Labels restart at 1 in every slab and are
+  // assigned in the order of each feature's first voxel.
+  m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Labeling {} slabs", numSlabs));
+  std::vector<int64> slabFeatureCounts(numSlabs, 0);
+  dataAlg.setRange(0, static_cast<usize>(numSlabs));
+  dataAlg.execute([&](const Range& range) {
+    std::vector<int64> voxelsList;
+    for(usize slab = range.min(); slab < range.max(); slab++)
+    {
+      const int64 begin = slabBegin(static_cast<int64>(slab));
+      const int64 end = slabBegin(static_cast<int64>(slab) + 1);
+      int32 localLabel = 0;
+      for(int64 seed = begin; seed < end; seed++)
+      {
+        if(m_ShouldCancel)
+        {
+          return;
+        }
+        if(featureIds.getValue(seed) != 0 || !isValidVoxel(seed))
+        {
+          continue;
+        }
+        localLabel++;
+        featureIds.setValue(seed, localLabel);
+        voxelsList.push_back(seed);
+        while(!voxelsList.empty())
+        {
+          const int64 currentPoint = voxelsList.back();
+          voxelsList.pop_back();
+          const std::array<int64, 3> position = {currentPoint % dims[0], (currentPoint / dims[0]) % dims[1], currentPoint / (dims[0] * dims[1])};
+          for(usize i = 0; i < 6; i++)
+          {
+            // neighPoints are ordered -z, -y, -x, +x, +y, +z
+            const usize axis = i < 3 ? 2 - i : i - 3;
+            const bool lowerSide = i < 3;
+            if((lowerSide && position[axis] == 0) || (!lowerSide && position[axis] == dims[axis] - 1))
+            {
+              continue;
+            }
+            const int64 neighbor = currentPoint + neighPoints[i];
+            if(neighbor < begin || neighbor >= end)
+            {
+              continue;
+            }
+            if(featureIds.getValue(neighbor) == 0 && isValidVoxel(neighbor) && areNeighborsSimilar(currentPoint, neighbor))
+            {
+              featureIds.setValue(neighbor, localLabel);
+              voxelsList.push_back(neighbor);
+            }
+          }
+        }
+      }
+      slabFeatureCounts[slab] = localLabel;
+    }
+  });
+  if(m_ShouldCancel)
+  {
+    return {};
+  }
+
+  // Provisional label of a voxel = labelOffsets[slab] + local label. Label 0 stays unassigned.
+  std::vector<int64> labelOffsets(numSlabs + 1, 0);
+  for(int64 slab = 0; slab < numSlabs; slab++)
+  {
+    labelOffsets[slab + 1] = labelOffsets[slab] + slabFeatureCounts[slab];
+  }
+  const int64 numProvisionalLabels = labelOffsets[numSlabs];
+
+  // Phase 2: merge the labels that touch across each slab boundary
+  m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Merging {} provisional features across slab boundaries", numProvisionalLabels));
+  ConcurrentUnionFind unionFind(static_cast<usize>(numProvisionalLabels + 1));
+  dataAlg.setRange(1, static_cast<usize>(numSlabs));
+  dataAlg.execute([&](const Range& range) {
+    for(usize slab = range.min(); slab < range.max(); slab++)
+    {
+      const int64 begin = slabBegin(static_cast<int64>(slab));
+      int64 lastLowerLabel = 0;
+      int64 lastUpperLabel = 0;
+      for(int64 upperPoint = begin; upperPoint < begin + planeStride; upperPoint++)
+      {
+        const int64 lowerPoint = upperPoint - planeStride;
+        const int32 upperLocal = featureIds.getValue(upperPoint);
+        const int32 lowerLocal = featureIds.getValue(lowerPoint);
+        if(upperLocal == 0 || lowerLocal == 0)
+        {
+          continue;
+        }
+        const int64 upperLabel = labelOffsets[slab] + upperLocal;
+        const int64 lowerLabel = labelOffsets[slab - 1] + lowerLocal;
+        // Large features touch the boundary many times in a row, skip the comparison if nothing changed
+        if(upperLabel == lastUpperLabel && lowerLabel == lastLowerLabel)
+        {
+          continue;
+        }
+        if(areNeighborsSimilar(lowerPoint, upperPoint))
+        {
+          unionFind.unite(lowerLabel, upperLabel);
+          lastLowerLabel = lowerLabel;
+          lastUpperLabel = upperLabel;
+        }
+      }
+    }
+  });
+  if(m_ShouldCancel)
+  {
+    return {};
+  }
+
+  // Phase 3: number the merged features in the order of their smallest provisional label,
+  // which is the order of their first voxel
+  std::vector<int32> finalLabels(static_cast<usize>(numProvisionalLabels + 1), 0);
+  int32 numFeatures = 0;
+  for(int64 label = 1; label <= numProvisionalLabels; label++)
+  {
+    const int64 root = unionFind.find(label);
+    finalLabels[label] = root == label ? ++numFeatures : finalLabels[root];
+  }
+
+  dataAlg.setRange(0, static_cast<usize>(numSlabs));
+  dataAlg.execute([&](const Range& range) {
+    for(usize slab = range.min(); slab < range.max(); slab++)
+    {
+      const int64 end = slabBegin(static_cast<int64>(slab) + 1);
+      for(int64 point = slabBegin(static_cast<int64>(slab)); point < end; point++)
+      {
+        const int32 localLabel = featureIds.getValue(point);
+        if(localLabel != 0)
+        {
+          featureIds.setValue(point, finalLabels[labelOffsets[slab] + localLabel]);
+        }
+      }
+    }
+  });
+
+  // Follow the convention of execute() where the count is one past the last Feature Id
+  const int32 gnum = numFeatures + 1;
+  m_MessageHandler({IFilter::Message::Type::Info, fmt::format("Total Features Found: {}", gnum)});
+  m_FoundFeatures = gnum;
+  return {};
+}
+
 int64 SegmentFeatures::getSeed(int32 gnum, int64 nextSeed) const
 {
   return -1;
@@ -149,6 +396,16 @@ bool SegmentFeatures::determineGrouping(int64 referencePoint, int64 neighborPoin
   return false;
 }
 
+bool SegmentFeatures::isValidVoxel(int64 /*point*/) const
+{
+  return false;
+}
+
+bool SegmentFeatures::areNeighborsSimilar(int64 /*referencePoint*/, int64 /*neighborPoint*/) const
+{
+  return false;
+}
+
 // -----------------------------------------------------------------------------
 SegmentFeatures::SeedGenerator SegmentFeatures::initializeStaticVoxelSeedGenerator() const
 {
@@ -156,7 +413,7 @@ SegmentFeatures::SeedGenerator SegmentFeatures::initializeStaticVoxelSeedGenerat
 }
 
 // -----------------------------------------------------------------------------
-void SegmentFeatures::randomizeFeatureIds(nx::core::Int32Array* featureIds, uint64 totalFeatures) const
+Result<> SegmentFeatures::randomizeFeatureIds(nx::core::Int32Array* featureIds, uint64 totalFeatures) const
 {
   m_MessageHandler(IFilter::Message::Type::Info, "Randomizing Feature Ids");
   // Generate an even distribution of numbers between the min and max range
@@ -187,8 +444,18 @@ void SegmentFeatures::randomizeFeatureIds(nx::core::Int32Array* featureIds, uint
 
   // instead of taking total points as an input just extract the size, so we don't walk of
   usize totalPoints = featureIdsStore.getSize();
-  for(int64 i = 0; i < totalPoints; ++i)
+  for(usize chunkStart = 0; chunkStart < totalPoints; chunkStart += k_ChunkSize)
   {
-    featureIdsStore[i] = randomIds[featureIdsStore[i]];
+    auto featureIdsChunk = featureIdsStore.createChunkView(chunkStart, std::min(k_ChunkSize, totalPoints - chunkStart));
+    for(int32& featureId : featureIdsChunk)
+    {
+      featureId = randomIds[featureId];
+    }
+    Result<> commitResult = featureIdsChunk.commit();
+    if(commitResult.invalid())
+    {
+      return commitResult;
+    }
   }
+  return {};
 }
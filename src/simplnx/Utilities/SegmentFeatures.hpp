@@ -5,6 +5,7 @@
 #include "simplnx/DataStructure/IDataArray.hpp"
 #include "simplnx/Filter/Arguments.hpp"
 #include "simplnx/Filter/IFilter.hpp"
+#include "simplnx/Utilities/IParallelAlgorithm.hpp"
 #include "simplnx/simplnx_export.hpp"
 
 #include <random>
@@ -37,6 +38,25 @@ public:
    */
   Result<> execute(IGridGeometry* gridGeom);
 
+  /**
+   * @brief Labels the features with a parallel connected component engine
+   * instead of the serial seed and flood fill used by execute(). The volume is
+   * split into slabs along its slowest varying axis, each slab is labeled
+   * independently, the labels touching across slab boundaries are merged with a
+   * concurrent union-find and a final pass compacts the labels. Features are
+   * numbered in the order of their first voxel which produces the same Feature
+   * Ids as execute().
+   *
+   * Requires isValidVoxel() and areNeighborsSimilar() to be implemented. The
+   * featureIds array must be filled with zeros.
+   * @param gridGeom
+   * @param featureIds
+   * @param inputArrays Arrays read by the grouping criteria. Parallelization is
+   * disabled if any of them is stored out of core.
+   * @return
+   */
+  Result<> executeParallel(IGridGeometry* gridGeom, Int32Array& featureIds, const IParallelAlgorithm::AlgorithmArrays& inputArrays);
+
   /**
    * @brief Returns the seed for the specified values.
    * @param data
@@ -58,13 +78,34 @@ public:
    */
   virtual bool determineGrouping(int64_t referencePoint, int64_t neighborPoint, int32_t gnum) const;
 
+  /**
+   * @brief Returns true if the voxel can be part of a feature. This is the seed
+   * criteria of getSeed() without the check for an existing Feature Id. Used by
+   * executeParallel() and must be safe to call from multiple threads.
+   * @param point
+   * @return bool
+   */
+  virtual bool isValidVoxel(int64 point) const;
+
+  /**
+   * @brief Returns true if two valid neighboring voxels belong to the same
+   * feature. This is the comparison of determineGrouping() without side effects.
+   * The comparison must be symmetric. Used by executeParallel() and must be safe
+   * to call from multiple threads.
+   * @param referencePoint
+   * @param neighborPoint
+   * @return bool
+   */
+  virtual bool areNeighborsSimilar(int64 referencePoint, int64 neighborPoint) const;
+
   /**
    * @brief
    * @param featureIds
    * @param totalFeatures
    * @param distribution
+   * @return Result<>
    */
-  virtual void randomizeFeatureIds(Int32Array* featureIds, uint64 totalFeatures) const;
+  virtual Result<> randomizeFeatureIds(Int32Array* featureIds, uint64 totalFeatures) const;
 
   /**
    * @brief
@@ -86,6 +127,17 @@ public:
     {
       return false;
     }
+
+    /**
+     * @brief Compares the values at the two indices without modifying any data.
+     * @param index
+     * @param neighIndex
+     * @return bool
+     */
+    virtual bool compare(int64 index, int64 neighIndex) const
+    {
+      return false;
+    }
   };
 
 protected:
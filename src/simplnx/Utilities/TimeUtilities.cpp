@@ -5,8 +5,40 @@
 
 #include <fmt/chrono.h>
 
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
 using namespace nx::core;
 
+// -----------------------------------------------------------------------------
+std::chrono::nanoseconds nx::core::GetProcessCpuTime()
+{
+#if defined(_WIN32)
+  FILETIME creationTime;
+  FILETIME exitTime;
+  FILETIME kernelTime;
+  FILETIME userTime;
+  if(GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime) == 0)
+  {
+    return std::chrono::nanoseconds::zero();
+  }
+  // FILETIME values are in 100 nanosecond intervals
+  auto toTicks = [](const FILETIME& fileTime) { return (static_cast<uint64_t>(fileTime.dwHighDateTime) << 32) | fileTime.dwLowDateTime; };
+  return std::chrono::nanoseconds((toTicks(kernelTime) + toTicks(userTime)) * 100);
+#else
+  rusage usage{};
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return std::chrono::nanoseconds::zero();
+  }
+  auto toDuration = [](const timeval& value) { return std::chrono::seconds(value.tv_sec) + std::chrono::microseconds(value.tv_usec); };
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(toDuration(usage.ru_utime) + toDuration(usage.ru_stime));
+#endif
+}
+
 // -----------------------------------------------------------------------------
 void StopWatch::start()
 {
@@ -34,6 +34,14 @@ inline std::string ConvertMillisToHrsMinSecs(unsigned long long int millis)
   return fmt::format("{:0>2}:{:0>2}:{:0>2}", hours, minutes, seconds);
 }
 
+/**
+ * @brief Returns the CPU time (user + system) consumed by all threads of the
+ * current process. Dividing the difference of two calls by the elapsed wall
+ * time gives the average number of busy threads over that interval.
+ * @return std::chrono::nanoseconds
+ */
+SIMPLNX_EXPORT std::chrono::nanoseconds GetProcessCpuTime();
+
 /**
  * @brief A stopwatch class for measuring durations with high precision.
  *
@@ -2,11 +2,14 @@
 #include "simplnx/Common/Array.hpp"
 #include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/DataStructure/IO/Generic/DataIOCollection.hpp"
+#include "simplnx/DataStructure/MmapDataStore.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 
 #include <catch2/catch.hpp>
 
 #include <cmath>
+#include <numeric>
 #include <vector>
 
 using namespace nx::core;
@@ -148,3 +151,206 @@ TEST_CASE("Copy DataStore", "DataArray")
     REQUIRE(dataStore[i] == dataStore2[i]);
   }
 }
+
+namespace
+{
+// Hides the contiguous storage of a DataStore to exercise the staged code paths
+template <typename T>
+class NonContiguousDataStore : public DataStore<T>
+{
+public:
+  using DataStore<T>::DataStore;
+
+  nonstd::span<T> getContiguousSpan() override
+  {
+    return {};
+  }
+
+  nonstd::span<const T> getContiguousSpan() const override
+  {
+    return {};
+  }
+};
+
+// Staged store whose bulk writes always fail, as an out-of-core write-back could
+template <typename T>
+class FailingWriteDataStore : public NonContiguousDataStore<T>
+{
+public:
+  using NonContiguousDataStore<T>::NonContiguousDataStore;
+
+  Result<> copyFromBuffer(usize /*startIndex*/, nonstd::span<const T> /*buffer*/) override
+  {
+    return MakeErrorResult(-1, "Write failed");
+  }
+};
+} // namespace
+
+TEST_CASE("DataStore Bulk Access", "[simplnx][DataArray]")
+{
+  IDataStore::ShapeType tupleShape{10};
+  IDataStore::ShapeType componentShape{2};
+
+  auto checkBulkAccess = [](AbstractDataStore<int32>& dataStore, bool isContiguous) {
+    const usize size = dataStore.getSize();
+
+    std::vector<int32> buffer(size);
+    std::iota(buffer.begin(), buffer.end(), 0);
+    REQUIRE(dataStore.copyFromBuffer(0, buffer).valid());
+    REQUIRE(dataStore.copyFromBuffer(size - 1, buffer).invalid());
+
+    std::vector<int32> readBuffer(4);
+    REQUIRE(dataStore.copyIntoBuffer(6, readBuffer).valid());
+    REQUIRE(readBuffer == std::vector<int32>{6, 7, 8, 9});
+    REQUIRE(dataStore.copyIntoBuffer(size - 2, readBuffer).invalid());
+
+    {
+      auto chunkView = dataStore.createChunkView(4, 3);
+      REQUIRE(chunkView.isStaged() != isContiguous);
+      REQUIRE(chunkView.size() == 3);
+      REQUIRE(chunkView[0] == 4);
+      chunkView[1] = -5;
+    }
+    REQUIRE(dataStore[5] == -5);
+
+    {
+      auto chunkView = dataStore.createChunkView(0, 2);
+      chunkView[0] = -1;
+      REQUIRE(chunkView.commit().valid());
+    }
+    REQUIRE(dataStore[0] == -1);
+
+    const auto& constStore = dataStore;
+    const auto constView = constStore.createChunkView(0, size);
+    REQUIRE(constView.isStaged() != isContiguous);
+    REQUIRE(std::accumulate(constView.begin(), constView.end(), 0) == 179);
+
+    REQUIRE_THROWS(dataStore.createChunkView(size - 1, 2));
+  };
+
+  SECTION("Contiguous")
+  {
+    DataStore<int32> dataStore(tupleShape, componentShape, 0);
+    checkBulkAccess(dataStore, true);
+  }
+  SECTION("Staged")
+  {
+    NonContiguousDataStore<int32> dataStore(tupleShape, componentShape, 0);
+    checkBulkAccess(dataStore, false);
+  }
+  SECTION("Failed Commit")
+  {
+    FailingWriteDataStore<int32> dataStore(tupleShape, componentShape, 0);
+    auto chunkView = dataStore.createChunkView(0, 4);
+    REQUIRE(chunkView.isStaged());
+    chunkView[0] = 1;
+    REQUIRE(chunkView.commit().invalid());
+  }
+}
+
+TEST_CASE("MmapDataStore", "[simplnx][DataArray]")
+{
+  const std::filesystem::path scratchDirectory = std::filesystem::temp_directory_path();
+  IDataStore::ShapeType tupleShape{4, 3, 2};
+  IDataStore::ShapeType componentShape{3};
+  MmapDataStore<int32> dataStore(tupleShape, componentShape, 7, scratchDirectory);
+  REQUIRE(dataStore.getStoreType() == IDataStore::StoreType::OutOfCore);
+  REQUIRE(dataStore.getDataFormat() == MmapDataStore<int32>::k_DataFormat.str());
+  REQUIRE(dataStore.getSize() == 72);
+  REQUIRE(dataStore[71] == 7);
+
+  usize size = dataStore.getSize();
+  for(usize i = 0; i < size; i++)
+  {
+    dataStore[i] = static_cast<int32>(i);
+  }
+  dataStore.flush();
+
+  auto chunkShape = dataStore.getChunkShape();
+  REQUIRE(chunkShape.has_value());
+  REQUIRE(chunkShape->size() == 4);
+  REQUIRE((*chunkShape)[0] == 4);
+  const std::vector<int32> chunkValues = dataStore.getChunkValues({0, 0, 0, 0});
+  REQUIRE(chunkValues.size() == size);
+  for(usize i = 0; i < size; i++)
+  {
+    REQUIRE(chunkValues[i] == static_cast<int32>(i));
+  }
+
+  auto copyPtr = dataStore.deepCopy();
+  auto& copyStore = dynamic_cast<MmapDataStore<int32>&>(*copyPtr);
+  dataStore[0] = -1;
+  REQUIRE(copyStore[0] == 0);
+  REQUIRE(copyStore[size - 1] == static_cast<int32>(size - 1));
+
+  dataStore.resizeTuples({5, 3, 2});
+  REQUIRE(dataStore.getSize() == 90);
+  REQUIRE(dataStore[71] == 71);
+  REQUIRE(dataStore[89] == 7);
+
+  DataIOCollection ioCollection;
+  auto createdStore = ioCollection.createDataStoreWithType<float32>(MmapDataStore<float32>::k_DataFormat.str(), tupleShape, componentShape);
+  REQUIRE(createdStore != nullptr);
+  REQUIRE(createdStore->getDataFormat() == MmapDataStore<float32>::k_DataFormat.str());
+  REQUIRE(createdStore->getValue(10) == 0.0f);
+}
+
+TEST_CASE("Mask Views", "[simplnx][DataArray]")
+{
+  // Spans several 64 bit words of the packed mask
+  const usize numValues = 150;
+  DataStructure dataStructure;
+  auto* boolArray = BoolArray::CreateWithStore<DataStore<bool>>(dataStructure, "Bool Mask", {numValues}, {1});
+  auto* uint8Array = UInt8Array::Create(dataStructure, "UInt8 Mask", std::make_shared<NonContiguousDataStore<uint8>>(IDataStore::ShapeType{numValues}, IDataStore::ShapeType{1}, 0));
+  auto* floatArray = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "Float Mask", {numValues}, {1});
+  for(usize i = 0; i < numValues; i++)
+  {
+    (*boolArray)[i] = (i % 3) == 0;
+    (*uint8Array)[i] = (i % 3) == 0 ? static_cast<uint8>(i % 7 + 1) : 0;
+  }
+
+  auto readMask = [numValues](const auto& mask) {
+    std::vector<bool> values(numValues);
+    for(usize i = 0; i < numValues; i++)
+    {
+      values[i] = mask.isTrue(i);
+    }
+    return values;
+  };
+  std::vector<bool> expected(numValues);
+  for(usize i = 0; i < numValues; i++)
+  {
+    expected[i] = (i % 3) == 0;
+  }
+
+  SECTION("Contiguous")
+  {
+    ExecuteWithMaskView(boolArray, [](const auto& mask) { REQUIRE(std::is_same_v<std::decay_t<decltype(mask)>, MaskView<bool>>); });
+    REQUIRE(ExecuteWithMaskView(boolArray, readMask) == expected);
+    ExecuteWithMaskView(boolArray, [](const auto& mask) {
+      REQUIRE(mask.bothTrue(0, 3));
+      REQUIRE_FALSE(mask.bothTrue(0, 1));
+      REQUIRE(mask.bothFalse(1, 2));
+    });
+  }
+  SECTION("Packed")
+  {
+    ExecuteWithMaskView(uint8Array, [](const auto& mask) { REQUIRE(std::is_same_v<std::decay_t<decltype(mask)>, PackedMaskView>); });
+    REQUIRE(ExecuteWithMaskView(uint8Array, readMask) == expected);
+
+    const PackedMaskView packedMask(*boolArray);
+    REQUIRE(packedMask.size() == numValues);
+    REQUIRE(readMask(packedMask) == expected);
+    REQUIRE(packedMask.bothTrue(147, 3));
+    REQUIRE(packedMask.bothFalse(148, 149));
+  }
+  SECTION("Unmasked")
+  {
+    REQUIRE(ExecuteWithMaskView(nullptr, readMask) == std::vector<bool>(numValues, true));
+  }
+  SECTION("Invalid Type")
+  {
+    REQUIRE_THROWS(ExecuteWithMaskView(floatArray, readMask));
+    REQUIRE_THROWS(PackedMaskView(*floatArray));
+  }
+}
@@ -12,6 +12,7 @@
 #include "simplnx/DataStructure/Geometry/RectGridGeom.hpp"
 #include "simplnx/DataStructure/Geometry/TetrahedralGeom.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
+#include "simplnx/DataStructure/NeighborList.hpp"
 #include "simplnx/DataStructure/ScalarData.hpp"
 #include "simplnx/DataStructure/StringArray.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
@@ -22,6 +23,8 @@
 #include <catch2/catch.hpp>
 
 #include <memory>
+#include <numeric>
+#include <utility>
 #include <vector>
 
 using namespace nx::core;
@@ -681,6 +684,46 @@ TEST_CASE("DataStructureListenerTest")
   REQUIRE(dsListener.getDataRemovedCount() == 4);
 }
 
+TEST_CASE("DataStructureRenameLookupTest")
+{
+  DataStructure dataStr;
+  DataStructObserver dsListener(dataStr);
+
+  auto group = DataGroup::Create(dataStr, "Foo");
+  auto child1 = DataGroup::Create(dataStr, "Bar1", group->getId());
+  auto child2 = DataGroup::Create(dataStr, "Bar2", group->getId());
+  auto grandchild = DataGroup::Create(dataStr, "Bazz", child1->getId());
+
+  const DataPath grandPath({"Foo", "Bar1", "Bazz"});
+  const DataPath renamedPath({"Foo", "Bar1.3", "Bazz"});
+  REQUIRE(dataStr.getData(grandPath) == grandchild);
+
+  // Renaming updates the parent's name lookup
+  REQUIRE(child1->rename("Bar1.3"));
+  REQUIRE(dsListener.getDataRenamedCount() == 1);
+  REQUIRE(dataStr.getData(grandPath) == nullptr);
+  REQUIRE(dataStr.getData(renamedPath) == grandchild);
+  REQUIRE(group->contains("Bar1.3"));
+  REQUIRE_FALSE(group->contains("Bar1"));
+  REQUIRE(group->getDataMap()["Bar1.3"] == child1);
+
+  // Renaming a top level object updates the DataStructure's own lookup
+  REQUIRE(group->rename("Foo2"));
+  REQUIRE(dataStr.getData(DataPath({"Foo2", "Bar2"})) == child2);
+  REQUIRE(dataStr.getData(DataPath({"Foo", "Bar2"})) == nullptr);
+
+  // The freed name can be reused
+  auto child3 = DataGroup::Create(dataStr, "Bar1", group->getId());
+  REQUIRE(child3 != nullptr);
+  REQUIRE(dataStr.getData(DataPath({"Foo2", "Bar1"})) == child3);
+
+  // Removing by name drops the object from the lookup
+  REQUIRE(dataStr.getData(DataPath({"Foo2", "Bar2"})) == child2);
+  REQUIRE(group->remove("Bar2"));
+  REQUIRE(dataStr.getData(DataPath({"Foo2", "Bar2"})) == nullptr);
+  REQUIRE_FALSE(group->contains("Bar2"));
+}
+
 TEST_CASE("DataStructureCopyTest")
 {
   DataStructure dataStr;
@@ -723,6 +766,48 @@ TEST_CASE("DataStructureCopyTest")
   REQUIRE(dataStrCopy.getData(newId2));
 }
 
+TEST_CASE("DataStructureSnapshotTest")
+{
+  DataStructure dataStr;
+  auto* dataArr = Int32Array::CreateWithStore<Int32DataStore>(dataStr, "array", std::vector<usize>{10}, std::vector<usize>{1});
+  REQUIRE(dataArr != nullptr);
+  dataArr->fill(1);
+  const auto arrayId = dataArr->getId();
+
+  DataStructure snapshot = dataStr.createSnapshot();
+  auto* snapshotArr = snapshot.getDataAs<Int32Array>(arrayId);
+  REQUIRE(snapshotArr != nullptr);
+
+  // Stores are shared until the first write
+  const auto& constArr = *dataArr;
+  REQUIRE(constArr.getDataStore() == std::as_const(*snapshotArr).getDataStore());
+  REQUIRE(dataArr->isCopyOnWrite());
+  REQUIRE(snapshotArr->isCopyOnWrite());
+  REQUIRE(dataArr->copyOnWriteMemoryUsage() == dataArr->memoryUsage());
+
+  // Reading through non-const accessors does not copy the store
+  REQUIRE((*dataArr)[0] == 1);
+  REQUIRE(dataArr->getDataStoreRef()[1] == 1);
+  REQUIRE(dataArr->isCopyOnWrite());
+  REQUIRE(constArr.getDataStore() == std::as_const(*snapshotArr).getDataStore());
+
+  dataArr->setValue(0, 5);
+  REQUIRE(!dataArr->isCopyOnWrite());
+  REQUIRE(dataArr->copyOnWriteMemoryUsage() == 0);
+  REQUIRE(constArr.getDataStore() != std::as_const(*snapshotArr).getDataStore());
+  REQUIRE(dataArr->at(0) == 5);
+  REQUIRE(snapshotArr->at(0) == 1);
+
+  // The snapshot is now the only owner and must not clone its store again
+  const auto* snapshotStore = std::as_const(*snapshotArr).getDataStore();
+  REQUIRE(snapshotArr->copyOnWriteMemoryUsage() == 0);
+  snapshotArr->makeUnique();
+  REQUIRE(!snapshotArr->isCopyOnWrite());
+  REQUIRE(std::as_const(*snapshotArr).getDataStore() == snapshotStore);
+  (*snapshotArr)[1] = 7;
+  REQUIRE(dataArr->at(1) == 1);
+}
+
 TEST_CASE("DataStoreTest")
 {
   const size_t numComponents = 3;
@@ -815,6 +900,101 @@ TEST_CASE("DataArrayTest")
   }
 }
 
+TEST_CASE("NeighborListCompactStorageTest")
+{
+  DataStructure dataStructure;
+  auto* neighborList = NeighborList<int32>::Create(dataStructure, "NeighborList", 5);
+  REQUIRE(neighborList != nullptr);
+
+  // List i holds the values [0, i)
+  NeighborList<int32>::Builder builder(5);
+  for(usize i = 0; i < builder.getNumberOfLists(); i++)
+  {
+    builder.setListSize(i, i);
+  }
+  builder.allocate();
+  for(usize i = 0; i < builder.getNumberOfLists(); i++)
+  {
+    auto list = builder.getListSpan(i);
+    std::iota(list.begin(), list.end(), 0);
+  }
+  builder.commit(*neighborList);
+
+  REQUIRE(neighborList->isCompact());
+  REQUIRE(neighborList->getNumberOfTuples() == 5);
+  REQUIRE(neighborList->getNumberOfLists() == 5);
+  REQUIRE(neighborList->getSize() == 10);
+  const std::vector<usize> expectedOffsets = {0, 0, 1, 3, 6, 10};
+  REQUIRE(std::equal(expectedOffsets.begin(), expectedOffsets.end(), neighborList->getCompactOffsets().begin(), neighborList->getCompactOffsets().end()));
+
+  SECTION("read only access keeps the compact storage")
+  {
+    const auto& constList = *neighborList;
+    for(usize i = 0; i < 5; i++)
+    {
+      REQUIRE(constList.getListSpan(i).size() == i);
+      REQUIRE(constList.getListSize(static_cast<int32>(i)) == static_cast<int32>(i));
+      REQUIRE(constList.at(i).size() == i);
+      const std::vector<int32> copy = constList.copyOfList(static_cast<int32>(i));
+      for(usize j = 0; j < i; j++)
+      {
+        REQUIRE(copy[j] == static_cast<int32>(j));
+      }
+    }
+    bool ok = true;
+    REQUIRE(constList.getValue(4, 3, ok) == 3);
+    REQUIRE(ok);
+    REQUIRE(constList.isCompact());
+  }
+
+  SECTION("mutable access converts to one vector per list")
+  {
+    (*neighborList)[2].push_back(7);
+    REQUIRE_FALSE(neighborList->isCompact());
+    REQUIRE(neighborList->getListSize(2) == 3);
+    REQUIRE(neighborList->getListSpan(2)[2] == 7);
+    REQUIRE(neighborList->getSize() == 11);
+
+    neighborList->compact();
+    REQUIRE(neighborList->isCompact());
+    REQUIRE(neighborList->getSize() == 11);
+    REQUIRE(neighborList->getListSpan(2)[2] == 7);
+    REQUIRE(neighborList->getListSpan(3).size() == 3);
+  }
+
+  SECTION("non-const list accessors keep writes")
+  {
+    const auto& constList = *neighborList;
+    REQUIRE(constList.getListReference(3).size() == 3);
+    REQUIRE(constList.getList(3)->size() == 3);
+    REQUIRE(neighborList->isCompact());
+
+    neighborList->getListReference(3).push_back(8);
+    REQUIRE_FALSE(neighborList->isCompact());
+    neighborList->getList(4)->push_back(9);
+    REQUIRE(neighborList->getListSpan(3)[3] == 8);
+    REQUIRE(neighborList->getListSpan(4)[4] == 9);
+    REQUIRE(neighborList->getSize() == 12);
+  }
+
+  SECTION("deep copy shares nothing mutable")
+  {
+    const DataPath copyPath({"NeighborList Copy"});
+    auto copy = std::dynamic_pointer_cast<NeighborList<int32>>(neighborList->deepCopy(copyPath));
+    REQUIRE(copy != nullptr);
+    copy->addEntry(1, 42);
+    REQUIRE(neighborList->isCompact());
+    REQUIRE(neighborList->getListSize(1) == 1);
+    REQUIRE(copy->getListSize(1) == 2);
+  }
+
+  SECTION("invalid offsets are rejected")
+  {
+    REQUIRE_THROWS(neighborList->setCompactData({1, 2, 3}, {0, 2}));
+    REQUIRE_THROWS(neighborList->setCompactData({1, 2, 3}, {0, 2, 1, 3}));
+  }
+}
+
 TEST_CASE("ScalarDataTest")
 {
   DataStructure dataStr;
@@ -10,6 +10,7 @@
 #include "simplnx/DataStructure/Geometry/TetrahedralGeom.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
 #include "simplnx/DataStructure/Geometry/VertexGeom.hpp"
+#include "simplnx/Utilities/GeometryHelpers.hpp"
 
 #include <catch2/catch.hpp>
 
@@ -257,3 +258,84 @@ TEST_CASE("VertexGeomTest")
     REQUIRE(geom->getTypeName() == "VertexGeom");
   }
 }
+
+TEST_CASE("GeometryHelpersConnectivityTest")
+{
+  using MeshIndexType = IGeometry::MeshIndexType;
+  DataStructure dataStructure;
+
+  auto createList = [&dataStructure](const std::string& name, usize numComps, const std::vector<MeshIndexType>& values) {
+    auto* list = DataArray<MeshIndexType>::CreateWithStore<DataStore<MeshIndexType>>(dataStructure, name, {values.size() / numComps}, {numComps});
+    REQUIRE(list != nullptr);
+    for(usize i = 0; i < values.size(); i++)
+    {
+      (*list)[i] = values[i];
+    }
+    return list;
+  };
+  auto requireValues = [](const DataArray<MeshIndexType>& list, const std::vector<MeshIndexType>& expected) {
+    REQUIRE(list.getSize() == expected.size());
+    for(usize i = 0; i < expected.size(); i++)
+    {
+      REQUIRE(list[i] == expected[i]);
+    }
+  };
+
+  SECTION("Tetrahedra")
+  {
+    // Two tetrahedra sharing the face (0, 1, 2)
+    const auto* tets = createList("Tets", 4, {0, 1, 2, 3, 2, 1, 0, 4});
+
+    auto* edges = createList("Edges", 2, {});
+    GeometryHelpers::Connectivity::FindTetEdges(tets, edges);
+    requireValues(*edges, {0, 1, 0, 2, 0, 3, 0, 4, 1, 2, 1, 3, 1, 4, 2, 3, 2, 4});
+
+    auto* unsharedEdges = createList("UnsharedEdges", 2, {});
+    GeometryHelpers::Connectivity::FindUnsharedTetEdges(tets, unsharedEdges);
+    requireValues(*unsharedEdges, {0, 3, 0, 4, 1, 3, 1, 4, 2, 3, 2, 4});
+
+    auto* faces = createList("Faces", 3, {});
+    GeometryHelpers::Connectivity::FindTetFaces(tets, faces);
+    requireValues(*faces, {0, 1, 2, 0, 1, 3, 0, 1, 4, 0, 2, 3, 0, 2, 4, 1, 2, 3, 1, 2, 4});
+
+    auto* unsharedFaces = createList("UnsharedFaces", 3, {});
+    GeometryHelpers::Connectivity::FindUnsharedTetFaces(tets, unsharedFaces);
+    requireValues(*unsharedFaces, {0, 1, 3, 0, 1, 4, 0, 2, 3, 0, 2, 4, 1, 2, 3, 1, 2, 4});
+  }
+
+  SECTION("Hexahedra")
+  {
+    // Two hexahedra sharing the face (1, 2, 6, 5)
+    const auto* hexes = createList("Hexes", 8, {0, 1, 2, 3, 4, 5, 6, 7, 1, 8, 9, 2, 5, 10, 11, 6});
+
+    auto* edges = createList("Edges", 2, {});
+    GeometryHelpers::Connectivity::FindHexEdges(hexes, edges);
+    requireValues(*edges, {0, 1, 0, 3, 0, 4, 1, 2, 1, 5, 1, 8, 2, 3, 2, 6, 2, 9, 3, 7, 4, 5, 4, 7, 5, 6, 5, 10, 6, 7, 6, 11, 8, 9, 8, 10, 9, 11, 10, 11});
+
+    auto* unsharedEdges = createList("UnsharedEdges", 2, {});
+    GeometryHelpers::Connectivity::FindUnsharedHexEdges(hexes, unsharedEdges);
+    requireValues(*unsharedEdges, {0, 1, 0, 3, 0, 4, 1, 8, 2, 3, 2, 9, 3, 7, 4, 5, 4, 7, 5, 10, 6, 7, 6, 11, 8, 9, 8, 10, 9, 11, 10, 11});
+
+    auto* faces = createList("Faces", 4, {});
+    GeometryHelpers::Connectivity::FindHexFaces(hexes, faces);
+    requireValues(*faces, {0, 1, 2, 3, 0, 1, 4, 5, 0, 3, 4, 7, 1, 2, 5, 6, 1, 2, 8, 9, 1, 5, 8, 10, 2, 3, 6, 7, 2, 6, 9, 11, 4, 5, 6, 7, 5, 6, 10, 11, 8, 9, 10, 11});
+
+    auto* unsharedFaces = createList("UnsharedFaces", 4, {});
+    GeometryHelpers::Connectivity::FindUnsharedHexFaces(hexes, unsharedFaces);
+    requireValues(*unsharedFaces, {0, 1, 2, 3, 0, 1, 4, 5, 0, 3, 4, 7, 1, 2, 8, 9, 1, 5, 8, 10, 2, 3, 6, 7, 2, 6, 9, 11, 4, 5, 6, 7, 5, 6, 10, 11, 8, 9, 10, 11});
+  }
+
+  SECTION("Quads")
+  {
+    // Two quads sharing the edge (1, 2)
+    const auto* quads = createList("Quads", 4, {0, 1, 2, 3, 1, 4, 5, 2});
+
+    auto* edges = createList("Edges", 2, {});
+    GeometryHelpers::Connectivity::Find2DElementEdges(quads, edges);
+    requireValues(*edges, {0, 1, 0, 3, 1, 2, 1, 4, 2, 3, 2, 5, 4, 5});
+
+    auto* unsharedEdges = createList("UnsharedEdges", 2, {});
+    GeometryHelpers::Connectivity::Find2DUnsharedEdges(quads, unsharedEdges);
+    requireValues(*unsharedEdges, {0, 1, 0, 3, 1, 4, 2, 3, 2, 5, 4, 5});
+  }
+}
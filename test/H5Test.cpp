@@ -13,13 +13,16 @@
 #include "simplnx/DataStructure/Geometry/VertexGeom.hpp"
 #include "simplnx/DataStructure/IO/HDF5/DataStructureReader.hpp"
 #include "simplnx/DataStructure/IO/HDF5/DataStructureWriter.hpp"
+#include "simplnx/DataStructure/IO/HDF5/LazyDataStore.hpp"
 #include "simplnx/DataStructure/Montage/GridMontage.hpp"
 #include "simplnx/DataStructure/ScalarData.hpp"
 #include "simplnx/DataStructure/StringArray.hpp"
 #include "simplnx/Filter/Actions/CreateImageGeometryAction.hpp"
+#include "simplnx/Filter/Actions/ImportH5ObjectPathsAction.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/Parsing/DREAM3D/Dream3dIO.hpp"
+#include "simplnx/Utilities/Parsing/HDF5/H5ChunkWritePipeline.hpp"
 #include "simplnx/Utilities/Parsing/HDF5/IO/FileIO.hpp"
 #include "simplnx/Utilities/Parsing/HDF5/Readers/FileReader.hpp"
 #include "simplnx/Utilities/Parsing/HDF5/Writers/FileWriter.hpp"
@@ -31,6 +34,8 @@
 
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <string>
 #include <type_traits>
 
@@ -790,9 +795,19 @@ TEST_CASE("NeighborList IO")
     SIMPLNX_RESULT_REQUIRE_VALID(readResult);
     DataStructure dataStructure = std::move(readResult.value());
 
-    // auto neighborList = dataStructure.getDataAs<NeighborList<int64>>(DataPath({k_NeighborGroupName, "NeighborList"}));
-    auto neighborList = dataStructure.getData(DataPath({k_NeighborGroupName, "NeighborList"}));
+    auto* neighborList = dataStructure.getDataAs<NeighborList<int64>>(DataPath({k_NeighborGroupName, "NeighborList"}));
     REQUIRE(neighborList != nullptr);
+
+    // The linear dataset is read straight into the compact layout. List j holds j from every
+    // outer iteration i >= j of CreateNeighborList()
+    REQUIRE(neighborList->isCompact());
+    REQUIRE(neighborList->getNumberOfLists() == 50);
+    for(usize j = 0; j < 50; j++)
+    {
+      auto list = neighborList->getListSpan(j);
+      REQUIRE(list.size() == 50 - j);
+      REQUIRE(std::all_of(list.begin(), list.end(), [j](int64 value) { return value == static_cast<int64>(j); }));
+    }
   } catch(const std::exception& e)
   {
     FAIL(e.what());
@@ -887,6 +902,243 @@ TEST_CASE("DataArray<bool> IO")
   }
 }
 
+TEST_CASE("Compressed DataStructure IO")
+{
+  auto app = Application::GetOrCreateInstance();
+
+  const std::vector<usize> tupleShape = {20, 30, 40};
+  const std::vector<usize> componentShape = {2};
+
+  // Chunks keep the components and fast tuple dimensions whole and only split the slowest dimension needed
+  auto chunkShape = HDF5::Compression::ComputeChunkShape(tupleShape, componentShape, sizeof(int32), 30 * 40 * 2 * sizeof(int32) * 3);
+  REQUIRE(chunkShape == std::vector<HDF5::SizeType>{3, 30, 40, 2});
+  chunkShape = HDF5::Compression::ComputeChunkShape(tupleShape, componentShape, sizeof(int32), 1);
+  REQUIRE(chunkShape == std::vector<HDF5::SizeType>{1, 1, 1, 2});
+
+  fs::path dataDir = GetDataDir();
+  if(!fs::exists(dataDir))
+  {
+    REQUIRE(fs::create_directories(dataDir));
+  }
+  fs::path filePath = GetDataDir() / "CompressedArrayTest.dream3d";
+  const DataPath arrayPath({"FeatureIds"});
+
+  HDF5::CompressionSettings compression;
+  compression.type = HDF5::CompressionSettings::Type::ShuffleDeflate;
+  compression.targetChunkBytes = 4096;
+
+  // Write HDF5 file
+  HDF5::WriteStatistics statistics;
+  usize numValues = 0;
+  {
+    DataStructure dataStructure;
+    auto* dataArray = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, arrayPath.getTargetName(), tupleShape, componentShape);
+    REQUIRE(dataArray != nullptr);
+    auto& dataStore = dataArray->getDataStoreRef();
+    numValues = dataStore.getSize();
+    for(usize i = 0; i < numValues; i++)
+    {
+      dataStore[i] = static_cast<int32>(i / 500);
+    }
+
+    Result<> writeResult = DREAM3D::WriteFile(filePath, dataStructure, {}, false, compression, &statistics);
+    SIMPLNX_RESULT_REQUIRE_VALID(writeResult);
+  }
+  REQUIRE(statistics.uncompressedBytes == numValues * sizeof(int32));
+  REQUIRE(statistics.storedBytes > 0);
+  REQUIRE(statistics.storedBytes < statistics.uncompressedBytes);
+  REQUIRE(statistics.compressionRatio() > 1.0);
+
+  // Read HDF5 file
+  {
+    auto readResult = DREAM3D::ImportDataStructureFromFile(filePath);
+    SIMPLNX_RESULT_REQUIRE_VALID(readResult);
+    DataStructure dataStructure = std::move(readResult.value());
+
+    auto* dataArray = dataStructure.getDataAs<Int32Array>(arrayPath);
+    REQUIRE(dataArray != nullptr);
+    REQUIRE(dataArray->getTupleShape() == tupleShape);
+    REQUIRE(dataArray->getComponentShape() == componentShape);
+    const auto& dataStore = dataArray->getDataStoreRef();
+    for(usize i = 0; i < numValues; i++)
+    {
+      REQUIRE(dataStore[i] == static_cast<int32>(i / 500));
+    }
+  }
+}
+
+TEST_CASE("Lazy DataStructure IO")
+{
+  auto app = Application::GetOrCreateInstance();
+
+  // Rows of 100 x 60 int32 values span three lazily loaded blocks
+  const std::vector<usize> tupleShape = {400, 100, 60};
+  const std::vector<usize> componentShape = {1};
+  const DataPath featureIdsPath({"FeatureIds"});
+  const DataPath phasesPath({"Phases"});
+
+  fs::path dataDir = GetDataDir();
+  if(!fs::exists(dataDir))
+  {
+    REQUIRE(fs::create_directories(dataDir));
+  }
+  fs::path filePath = GetDataDir() / "LazyArrayTest.dream3d";
+
+  // Write HDF5 file
+  usize numValues = 0;
+  {
+    DataStructure dataStructure;
+    auto* featureIds = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, featureIdsPath.getTargetName(), tupleShape, componentShape);
+    REQUIRE(featureIds != nullptr);
+    auto& featureIdsStore = featureIds->getDataStoreRef();
+    numValues = featureIdsStore.getSize();
+    for(usize i = 0; i < numValues; i++)
+    {
+      featureIdsStore[i] = static_cast<int32>(i);
+    }
+    auto* phases = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, phasesPath.getTargetName(), std::vector<usize>{10}, componentShape);
+    REQUIRE(phases != nullptr);
+    phases->fill(2);
+
+    HDF5::CompressionSettings compression;
+    compression.type = HDF5::CompressionSettings::Type::ShuffleDeflate;
+    Result<> writeResult = DREAM3D::WriteFile(filePath, dataStructure, {}, false, compression);
+    SIMPLNX_RESULT_REQUIRE_VALID(writeResult);
+  }
+
+  // Values are only read from the blocks that are accessed
+  {
+    HDF5::FileReader fileReader(filePath);
+    REQUIRE(fileReader.isValid());
+    auto readResult = DREAM3D::ImportDataStructureFromFileLazily(fileReader);
+    SIMPLNX_RESULT_REQUIRE_VALID(readResult);
+    DataStructure dataStructure = std::move(readResult.value());
+
+    auto* featureIds = dataStructure.getDataAs<Int32Array>(featureIdsPath);
+    REQUIRE(featureIds != nullptr);
+    REQUIRE(featureIds->getTupleShape() == tupleShape);
+    const auto* lazyStore = dynamic_cast<const HDF5::LazyDataStore<int32>*>(featureIds->getDataStore());
+    REQUIRE(lazyStore != nullptr);
+    REQUIRE(lazyStore->getNumberOfBlocks() == 3);
+    REQUIRE(lazyStore->getNumberOfLoadedBlocks() == 0);
+    REQUIRE(lazyStore->getContiguousSpan().empty());
+
+    REQUIRE(lazyStore->getValue(numValues - 1) == static_cast<int32>(numValues - 1));
+    REQUIRE(lazyStore->getNumberOfLoadedBlocks() == 1);
+
+    std::vector<int32> buffer(100);
+    Result<> copyResult = lazyStore->copyIntoBuffer(50, nonstd::span<int32>(buffer.data(), buffer.size()));
+    SIMPLNX_RESULT_REQUIRE_VALID(copyResult);
+    REQUIRE(buffer.front() == 50);
+    REQUIRE(buffer.back() == 149);
+    REQUIRE(lazyStore->getNumberOfLoadedBlocks() == 2);
+
+    for(usize i = 0; i < numValues; i++)
+    {
+      REQUIRE((*lazyStore)[i] == static_cast<int32>(i));
+    }
+    REQUIRE(lazyStore->isFullyLoaded());
+    REQUIRE(lazyStore->getContiguousSpan().size() == numValues);
+
+    // Lazy stores are not DataStores and say so; loading replaces them with one
+    REQUIRE(lazyStore->getStoreType() == IDataStore::StoreType::Lazy);
+    REQUIRE(HDF5::LoadLazyDataArray(*featureIds));
+    REQUIRE(dynamic_cast<const Int32DataStore*>(featureIds->getDataStore()) != nullptr);
+    REQUIRE(featureIds->getStoreType() == IDataStore::StoreType::InMemory);
+    REQUIRE(featureIds->getDataStoreRef()[numValues - 1] == static_cast<int32>(numValues - 1));
+    REQUIRE_FALSE(HDF5::LoadLazyDataArray(*featureIds));
+  }
+
+  // The import action only reads the selected arrays
+  for(bool deferLoading : {false, true})
+  {
+    DataStructure dataStructure;
+    ImportH5ObjectPathsAction action(filePath, std::vector<DataPath>{featureIdsPath}, deferLoading);
+    Result<> importResult = action.apply(dataStructure, IDataAction::Mode::Execute);
+    SIMPLNX_RESULT_REQUIRE_VALID(importResult);
+    REQUIRE(dataStructure.getDataAs<Int32Array>(phasesPath) == nullptr);
+
+    auto* featureIds = dataStructure.getDataAs<Int32Array>(featureIdsPath);
+    REQUIRE(featureIds != nullptr);
+    const auto* lazyStore = dynamic_cast<const HDF5::LazyDataStore<int32>*>(featureIds->getDataStore());
+    REQUIRE((lazyStore != nullptr) == deferLoading);
+    const auto& featureIdsStore = featureIds->getDataStoreRef();
+    for(usize i = 0; i < numValues; i += 997)
+    {
+      REQUIRE(featureIdsStore[i] == static_cast<int32>(i));
+    }
+  }
+}
+
+TEST_CASE("HDF5 Chunk Write Pipeline")
+{
+  constexpr usize k_NumChunks = 200;
+  constexpr usize k_ChunkSize = 1024;
+
+  HDF5::ChunkWritePipeline pipeline;
+  pipeline.setMaxBufferedBytes(4 * k_ChunkSize * sizeof(usize));
+  const usize queueDepth = pipeline.getQueueDepth(k_ChunkSize * sizeof(usize));
+  REQUIRE(queueDepth >= 1);
+  REQUIRE(queueDepth <= 4);
+  REQUIRE(queueDepth <= pipeline.getMaxThreads() * 2);
+
+  std::atomic<usize> numPrepared = 0;
+  usize numWritten = 0;
+  usize maxAhead = 0;
+  auto prepare = [&](usize chunkIndex, std::vector<usize>& buffer) -> Result<> {
+    buffer.assign(k_ChunkSize, chunkIndex);
+    numPrepared++;
+    return {};
+  };
+  auto write = [&](usize chunkIndex, std::vector<usize>& buffer) -> Result<> {
+    if(chunkIndex != numWritten || buffer.size() != k_ChunkSize || buffer.front() != chunkIndex || buffer.back() != chunkIndex)
+    {
+      return MakeErrorResult(-1, fmt::format("Chunk {} written out of order", chunkIndex));
+    }
+    maxAhead = std::max<usize>(maxAhead, numPrepared - numWritten);
+    numWritten++;
+    return {};
+  };
+
+  SECTION("Ordered")
+  {
+    auto result = pipeline.execute<std::vector<usize>>(k_NumChunks, k_ChunkSize * sizeof(usize), prepare, write);
+    SIMPLNX_RESULT_REQUIRE_VALID(result);
+    REQUIRE(numWritten == k_NumChunks);
+    REQUIRE(numPrepared == k_NumChunks);
+    // Back-pressure keeps the workers at most one queue ahead of the writer
+    REQUIRE(maxAhead <= queueDepth);
+  }
+  SECTION("Prepare Error")
+  {
+    auto failingPrepare = [&](usize chunkIndex, std::vector<usize>& buffer) -> Result<> {
+      if(chunkIndex == 50)
+      {
+        return MakeErrorResult(-2, "Prepare failed");
+      }
+      return prepare(chunkIndex, buffer);
+    };
+    auto result = pipeline.execute<std::vector<usize>>(k_NumChunks, k_ChunkSize * sizeof(usize), failingPrepare, write);
+    SIMPLNX_RESULT_REQUIRE_INVALID(result);
+    REQUIRE(result.errors()[0].code == -2);
+    REQUIRE(numWritten == 50);
+  }
+  SECTION("Byte Budget")
+  {
+    // The byte budget bounds the queue even when it holds fewer chunks than there are threads
+    pipeline.setMaxBufferedBytes(k_ChunkSize * sizeof(usize) / 2);
+    REQUIRE(pipeline.getQueueDepth(k_ChunkSize * sizeof(usize)) == 1);
+    pipeline.setMaxThreads(1);
+    pipeline.setMaxBufferedBytes(100 * k_ChunkSize * sizeof(usize));
+    REQUIRE(pipeline.getQueueDepth(k_ChunkSize * sizeof(usize)) == 2);
+
+    auto result = pipeline.execute<std::vector<usize>>(k_NumChunks, k_ChunkSize * sizeof(usize), prepare, write);
+    SIMPLNX_RESULT_REQUIRE_VALID(result);
+    REQUIRE(numWritten == k_NumChunks);
+    REQUIRE(maxAhead <= 2);
+  }
+}
+
 TEST_CASE("xdmf")
 {
   DataStructure dataStructure;
@@ -1,5 +1,7 @@
 #include "simplnx/Core/Application.hpp"
+#include "simplnx/Filter/Actions/CreateArrayAction.hpp"
 #include "simplnx/Pipeline/Pipeline.hpp"
+#include "simplnx/Pipeline/PipelineProfiler.hpp"
 #include "simplnx/Pipeline/PlaceholderFilter.hpp"
 
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
@@ -9,6 +11,7 @@
 #include <nlohmann/json.hpp>
 
 using namespace nx::core;
+namespace fs = std::filesystem;
 
 namespace
 {
@@ -72,6 +75,26 @@ protected:
   }
 };
 
+class CreateArrayTestFilter : public TestFilter
+{
+public:
+  static inline const DataPath k_ArrayPath = DataPath({"Profiled Array"});
+  static constexpr usize k_NumTuples = 1000;
+
+  UniquePointer clone() const override
+  {
+    return std::make_unique<CreateArrayTestFilter>();
+  }
+
+protected:
+  PreflightResult preflightImpl(const nx::core::DataStructure& data, const nx::core::Arguments& args, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const override
+  {
+    OutputActions actions;
+    actions.appendAction(std::make_unique<CreateArrayAction>(DataType::float32, std::vector<usize>{k_NumTuples}, std::vector<usize>{1}, k_ArrayPath));
+    return {std::move(actions)};
+  }
+};
+
 class TestPlugin : public AbstractPlugin
 {
 public:
@@ -194,3 +217,57 @@ TEST_CASE("PlaceholderFilter")
 
   REQUIRE(placeholderPipelineJson == pipelineJson);
 }
+
+TEST_CASE("Pipeline Profiling")
+{
+  Pipeline pipeline("Profiled Pipeline");
+  REQUIRE(pipeline.push_back(std::make_unique<TestFilter>()));
+  REQUIRE(pipeline.push_back(std::make_unique<CreateArrayTestFilter>()));
+
+  {
+    PipelineProfiler profiler(&pipeline);
+    REQUIRE(pipeline.isProfilingEnabled());
+
+    DataStructure dataStructure;
+    REQUIRE(pipeline.execute(dataStructure, false));
+
+    const auto& profiles = profiler.getProfiles();
+    REQUIRE(profiles.size() == 2);
+
+    REQUIRE(profiles[0].index == 0);
+    REQUIRE(profiles[0].name == "Test Filter");
+    REQUIRE(profiles[0].succeeded);
+    REQUIRE(profiles[0].createdArrays.empty());
+    REQUIRE(profiles[0].memoryDelta() == 0);
+
+    const FilterProfile& createProfile = profiles[1];
+    REQUIRE(createProfile.index == 1);
+    REQUIRE(createProfile.succeeded);
+    REQUIRE(createProfile.startTime >= profiles[0].startTime + profiles[0].wallTime);
+    REQUIRE(createProfile.preflightTime + createProfile.executeTime <= createProfile.wallTime);
+    REQUIRE(createProfile.memoryDelta() == static_cast<int64>(CreateArrayTestFilter::k_NumTuples * sizeof(float32)));
+    REQUIRE(createProfile.peakResidentMemory > 0);
+    REQUIRE(createProfile.createdArrays.size() == 1);
+    REQUIRE(createProfile.createdArrays[0].path == CreateArrayTestFilter::k_ArrayPath);
+    REQUIRE(createProfile.createdArrays[0].bytes == CreateArrayTestFilter::k_NumTuples * sizeof(float32));
+
+    nlohmann::json trace = profiler.toChromeTraceJson();
+    REQUIRE(trace.contains("traceEvents"));
+    usize numFilterEvents = 0;
+    for(const auto& event : trace["traceEvents"])
+    {
+      if(event["ph"] == "X" && event["cat"] == "filter")
+      {
+        REQUIRE(event["args"].contains("memory_delta_bytes"));
+        numFilterEvents++;
+      }
+    }
+    REQUIRE(numFilterEvents == 2);
+
+    const fs::path tracePath = fs::path(unit_test::k_BinaryTestOutputDir.view()) / "pipeline_profile.json";
+    SIMPLNX_RESULT_REQUIRE_VALID(profiler.writeChromeTrace(tracePath));
+    REQUIRE(fs::exists(tracePath));
+  }
+
+  REQUIRE_FALSE(pipeline.isProfilingEnabled());
+}
@@ -0,0 +1,207 @@
+#include "simplnx/Utilities/MemoryMappedFile.hpp"
+#include "simplnx/Utilities/Parsing/Text/MappedTextFile.hpp"
+#include "simplnx/Utilities/Parsing/Text/TextChunks.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace nx::core;
+
+namespace
+{
+std::filesystem::path WriteTextFile(const std::string& fileName, const std::string& contents)
+{
+  const std::filesystem::path filePath = std::filesystem::temp_directory_path() / fileName;
+  std::ofstream outFile(filePath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  outFile << contents;
+  return filePath;
+}
+} // namespace
+
+TEST_CASE("TextChunks: Lines", "[simplnx][TextChunks]")
+{
+  SECTION("LF and CRLF line endings")
+  {
+    const std::string_view text = "a b\r\nc d\n\r\ne";
+    usize offset = 0;
+    REQUIRE(TextChunks::NextLine(text, offset) == "a b");
+    REQUIRE(TextChunks::NextLine(text, offset) == "c d");
+    REQUIRE(TextChunks::NextLine(text, offset).empty());
+    REQUIRE(TextChunks::NextLine(text, offset) == "e");
+    REQUIRE(offset == text.size());
+
+    REQUIRE(TextChunks::CountLines(text) == 4);
+    REQUIRE(TextChunks::CountNonBlankLines(text) == 3);
+    REQUIRE(TextChunks::FindLineStart(text, 1) == 5);
+    REQUIRE(TextChunks::FindLineStart(text, 10) == text.size());
+  }
+
+  SECTION("Missing final newline")
+  {
+    REQUIRE(TextChunks::CountLines("1\n2\n3") == 3);
+    REQUIRE(TextChunks::CountLines("1\n2\n3\n") == 3);
+    REQUIRE(TextChunks::CountLines("") == 0);
+  }
+}
+
+TEST_CASE("TextChunks: SplitIntoLineChunks", "[simplnx][TextChunks]")
+{
+  std::string text;
+  for(usize row = 0; row < 100; row++)
+  {
+    text += std::to_string(row);
+    text += (row % 2 == 0) ? "\r\n" : "\n";
+    if(row % 10 == 0)
+    {
+      text += "   \n";
+    }
+  }
+
+  // Chunks smaller than a line still end on line boundaries and every non-blank line is counted once
+  for(usize chunkSize : {usize(1), usize(7), usize(64), text.size() * 2})
+  {
+    const std::vector<TextChunks::LineChunk> chunks = TextChunks::SplitIntoLineChunks(text, chunkSize);
+    REQUIRE(!chunks.empty());
+    REQUIRE(chunks.front().begin == 0);
+    REQUIRE(chunks.back().end == text.size());
+    usize expectedRow = 0;
+    for(usize chunkIndex = 0; chunkIndex < chunks.size(); chunkIndex++)
+    {
+      const TextChunks::LineChunk& chunk = chunks[chunkIndex];
+      if(chunkIndex > 0)
+      {
+        REQUIRE(chunk.begin == chunks[chunkIndex - 1].end);
+      }
+      REQUIRE(text[chunk.end - 1] == '\n');
+      REQUIRE(chunk.firstRow == expectedRow);
+
+      // The first non-blank line of a chunk holds its first row
+      const std::string_view chunkText = std::string_view(text).substr(chunk.begin, chunk.end - chunk.begin);
+      usize offset = 0;
+      std::string_view line = TextChunks::NextLine(chunkText, offset);
+      while(TextChunks::IsBlank(line) && offset < chunkText.size())
+      {
+        line = TextChunks::NextLine(chunkText, offset);
+      }
+      if(chunk.numRows > 0)
+      {
+        REQUIRE(line == std::to_string(chunk.firstRow));
+      }
+      expectedRow += chunk.numRows;
+    }
+    REQUIRE(expectedRow == 100);
+  }
+
+  REQUIRE(TextChunks::SplitIntoLineChunks("").empty());
+}
+
+TEST_CASE("TextChunks: Tokens", "[simplnx][TextChunks]")
+{
+  SECTION("Whitespace tokens")
+  {
+    const std::string_view line = "  1.5\t-2  abc \r";
+    usize offset = 0;
+    REQUIRE(TextChunks::NextToken(line, offset) == "1.5");
+    REQUIRE(TextChunks::NextToken(line, offset) == "-2");
+    REQUIRE(TextChunks::NextToken(line, offset) == "abc");
+    REQUIRE(TextChunks::NextToken(line, offset).empty());
+  }
+
+  SECTION("Consecutive delimiters")
+  {
+    const std::vector<char> delimiters = {','};
+    std::vector<std::string_view> tokens;
+    TextChunks::SplitDelimited("1,,3,", delimiters, true, tokens);
+    REQUIRE(tokens == std::vector<std::string_view>{"1", "", "3", ""});
+    TextChunks::SplitDelimited("1,,3,", delimiters, false, tokens);
+    REQUIRE(tokens == std::vector<std::string_view>{"1", "3"});
+    TextChunks::SplitDelimited(",", delimiters, false, tokens);
+    REQUIRE(tokens == std::vector<std::string_view>{","});
+  }
+
+  SECTION("Strict values")
+  {
+    float32 floatValue = 0.0f;
+    REQUIRE(TextChunks::ParseValue("+2.5", floatValue));
+    REQUIRE(floatValue == 2.5f);
+    REQUIRE_FALSE(TextChunks::ParseValue("2.5x", floatValue));
+    REQUIRE_FALSE(TextChunks::ParseValue("", floatValue));
+    int32 intValue = 0;
+    REQUIRE(TextChunks::ParseValue("-17", intValue));
+    REQUIRE(intValue == -17);
+    REQUIRE_FALSE(TextChunks::ParseValue("1.0", intValue));
+    REQUIRE_FALSE(TextChunks::ParseValue("99999999999", intValue));
+  }
+
+  SECTION("Lenient values")
+  {
+    int32 intValue = 0;
+    REQUIRE(TextChunks::ParseLeadingValue(" 12abc", intValue) == std::errc());
+    REQUIRE(intValue == 12);
+    REQUIRE(TextChunks::ParseLeadingValue("abc", intValue) == std::errc::invalid_argument);
+    uint8 uint8Value = 0;
+    REQUIRE(TextChunks::ParseLeadingValue("-1", uint8Value) == std::errc::result_out_of_range);
+    REQUIRE(TextChunks::ParseLeadingValue("256", uint8Value) == std::errc::result_out_of_range);
+    bool boolValue = false;
+    REQUIRE(TextChunks::ParseLeadingValue("True", boolValue) == std::errc());
+    REQUIRE(boolValue);
+    REQUIRE(TextChunks::ParseLeadingValue("0", boolValue) == std::errc());
+    REQUIRE_FALSE(boolValue);
+
+    REQUIRE(TextChunks::ConvertToken("x", intValue).errors()[0].code == -10351);
+    REQUIRE(TextChunks::ConvertToken("300", uint8Value).errors()[0].code == -10353);
+  }
+}
+
+TEST_CASE("MappedTextFile", "[simplnx][TextChunks]")
+{
+  SECTION("Contents")
+  {
+    const std::string contents = "line 1\r\nline 2\nline 3";
+    const std::filesystem::path filePath = WriteTextFile("simplnx_mapped_text_file.txt", contents);
+    {
+      MappedTextFile mappedFile(filePath);
+      REQUIRE(mappedFile.size() == contents.size());
+      REQUIRE(mappedFile.text() == contents);
+      REQUIRE(mappedFile.filePath() == filePath);
+      REQUIRE(TextChunks::CountLines(mappedFile.text()) == 3);
+    }
+    // Read-only mappings leave the file in place
+    REQUIRE(std::filesystem::exists(filePath));
+    std::filesystem::remove(filePath);
+  }
+
+  SECTION("Empty file")
+  {
+    const std::filesystem::path filePath = WriteTextFile("simplnx_mapped_text_file_empty.txt", "");
+    {
+      MappedTextFile mappedFile(filePath);
+      REQUIRE(mappedFile.size() == 0);
+      REQUIRE(mappedFile.text().empty());
+    }
+    std::filesystem::remove(filePath);
+  }
+
+  SECTION("Missing file")
+  {
+    REQUIRE_THROWS_AS(MappedTextFile(std::filesystem::temp_directory_path() / "simplnx_mapped_text_file_missing.txt"), std::runtime_error);
+  }
+
+  SECTION("Read-only MemoryMappedFile")
+  {
+    const std::filesystem::path filePath = WriteTextFile("simplnx_mapped_text_file_readonly.txt", "0123456789");
+    {
+      std::unique_ptr<MemoryMappedFile> mappedFile = MemoryMappedFile::OpenReadOnly(filePath);
+      REQUIRE(mappedFile->isReadOnly());
+      REQUIRE(mappedFile->size() == 10);
+      REQUIRE(mappedFile->flush());
+      REQUIRE_THROWS_AS(mappedFile->resize(20), std::runtime_error);
+      REQUIRE(std::string_view(static_cast<const char*>(mappedFile->data()), 10) == "0123456789");
+    }
+    std::filesystem::remove(filePath);
+  }
+}
@@ -585,17 +585,20 @@ void CompareNeighborListFloatArraysWithNans(const DataStructure& dataStructure,
 
   for(usize i = 0; i < exemplaryList.getNumberOfTuples(); i++)
   {
-    const auto exemplary = exemplaryList.getList(i);
-    const auto computed = computedNeighborList.getList(i);
-    if(exemplary.get() != nullptr && computed.get() != nullptr)
+    const auto exemplaryPtr = exemplaryList.getList(i);
+    const auto computedPtr = computedNeighborList.getList(i);
+    if(exemplaryPtr != nullptr && computedPtr != nullptr)
     {
-      REQUIRE(exemplary->size() == computed->size());
-      std::sort(exemplary->begin(), exemplary->end());
-      std::sort(computed->begin(), computed->end());
-      for(usize j = 0; j < exemplary->size(); ++j)
+      // Sort copies, the lists may be read only views of compact storage
+      std::vector<T> exemplary(exemplaryPtr->begin(), exemplaryPtr->end());
+      std::vector<T> computed(computedPtr->begin(), computedPtr->end());
+      REQUIRE(exemplary.size() == computed.size());
+      std::sort(exemplary.begin(), exemplary.end());
+      std::sort(computed.begin(), computed.end());
+      for(usize j = 0; j < exemplary.size(); ++j)
       {
-        auto exemplaryVal = exemplary->at(j);
-        auto computedVal = computed->at(j);
+        auto exemplaryVal = exemplary.at(j);
+        auto computedVal = computed.at(j);
         if(!checkNans && (std::isnan(computedVal) || std::isnan(exemplaryVal)))
         {
           continue;
@@ -608,8 +611,8 @@ void CompareNeighborListFloatArraysWithNans(const DataStructure& dataStructure,
         if(exemplaryVal != computedVal)
         {
           float diff = std::fabs(static_cast<float>(exemplaryVal - computedVal));
-          INFO(fmt::format("Bad Neighborlist Comparison\n  Exemplary NeighborList:'{}'  size:{}\n  Computed NeighborList: '{}' size:{} ", exemplaryDataPath.toString(), exemplary->size(),
-                           computedPath.toString(), computed->size()));
+          INFO(fmt::format("Bad Neighborlist Comparison\n  Exemplary NeighborList:'{}'  size:{}\n  Computed NeighborList: '{}' size:{} ", exemplaryDataPath.toString(), exemplary.size(),
+                           computedPath.toString(), computed.size()));
           INFO(fmt::format("  NeighborList {}, Index {} Exemplary Value: {} Computed Value: {}", i, j, exemplaryVal, computedVal))
 
           REQUIRE(diff < epsilon);
@@ -644,22 +647,25 @@ void CompareNeighborLists(const INeighborList* exemplaryData, const INeighborLis
 
     for(usize i = 0; i < exemplaryList.getNumberOfTuples(); i++)
     {
-      const auto exemplary = exemplaryList.getList(i);
-      const auto computed = computedList.getList(i);
-      if(exemplary.get() != nullptr && computed.get() != nullptr)
+      const auto exemplaryPtr = exemplaryList.getList(i);
+      const auto computedPtr = computedList.getList(i);
+      if(exemplaryPtr != nullptr && computedPtr != nullptr)
       {
-        REQUIRE(exemplary->size() == computed->size());
-        std::sort(exemplary->begin(), exemplary->end());
-        std::sort(computed->begin(), computed->end());
-        for(usize j = 0; j < exemplary->size(); ++j)
+        // Sort copies, the lists may be read only views of compact storage
+        std::vector<T> exemplary(exemplaryPtr->begin(), exemplaryPtr->end());
+        std::vector<T> computed(computedPtr->begin(), computedPtr->end());
+        REQUIRE(exemplary.size() == computed.size());
+        std::sort(exemplary.begin(), exemplary.end());
+        std::sort(computed.begin(), computed.end());
+        for(usize j = 0; j < exemplary.size(); ++j)
         {
-          auto exemplaryVal = exemplary->at(j);
-          auto computedVal = computed->at(j);
+          auto exemplaryVal = exemplary.at(j);
+          auto computedVal = computed.at(j);
           if(exemplaryVal != computedVal)
           {
             float diff = std::fabs(static_cast<float>(exemplaryVal - computedVal));
             INFO(fmt::format("Bad Neighborlist Comparison\n  Exemplary NeighborList:'{}'  size:{}\n  Computed NeighborList: '{}' size:{} ", exemplaryList.getDataPaths()[0].toString(),
-                             exemplary->size(), computedList.getDataPaths()[0].toString(), computed->size()));
+                             exemplary.size(), computedList.getDataPaths()[0].toString(), computed.size()));
             INFO(fmt::format("  NeighborList {}, Index {} Exemplary Value: {} Computed Value: {}", i, j, exemplaryVal, computedVal))
 
             REQUIRE(diff < EPSILON);
@@ -691,22 +697,25 @@ void CompareNeighborLists(const DataStructure& dataStructure, const DataPath& ex
 
   for(usize i = 0; i < exemplaryList.getNumberOfTuples(); i++)
   {
-    const auto exemplary = exemplaryList.getList(i);
-    const auto computed = computedNeighborList.getList(i);
-    if(exemplary.get() != nullptr && computed.get() != nullptr)
+    const auto exemplaryPtr = exemplaryList.getList(i);
+    const auto computedPtr = computedNeighborList.getList(i);
+    if(exemplaryPtr != nullptr && computedPtr != nullptr)
     {
-      REQUIRE(exemplary->size() == computed->size());
-      std::sort(exemplary->begin(), exemplary->end());
-      std::sort(computed->begin(), computed->end());
-      for(usize j = 0; j < exemplary->size(); ++j)
+      // Sort copies, the lists may be read only views of compact storage
+      std::vector<T> exemplary(exemplaryPtr->begin(), exemplaryPtr->end());
+      std::vector<T> computed(computedPtr->begin(), computedPtr->end());
+      REQUIRE(exemplary.size() == computed.size());
+      std::sort(exemplary.begin(), exemplary.end());
+      std::sort(computed.begin(), computed.end());
+      for(usize j = 0; j < exemplary.size(); ++j)
       {
-        auto exemplaryVal = exemplary->at(j);
-        auto computedVal = computed->at(j);
+        auto exemplaryVal = exemplary.at(j);
+        auto computedVal = computed.at(j);
         if(exemplaryVal != computedVal)
         {
           float diff = std::fabs(static_cast<float>(exemplaryVal - computedVal));
-          INFO(fmt::format("Bad Neighborlist Comparison\n  Exemplary NeighborList:'{}'  size:{}\n  Computed NeighborList: '{}' size:{} ", exemplaryDataPath.toString(), exemplary->size(),
-                           computedPath.toString(), computed->size()));
+          INFO(fmt::format("Bad Neighborlist Comparison\n  Exemplary NeighborList:'{}'  size:{}\n  Computed NeighborList: '{}' size:{} ", exemplaryDataPath.toString(), exemplary.size(),
+                           computedPath.toString(), computed.size()));
           INFO(fmt::format("  NeighborList {}, Index {} Exemplary Value: {} Computed Value: {}", i, j, exemplaryVal, computedVal))
 
           REQUIRE(diff < EPSILON);
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "simplnx/Common/Types.hpp"
+
+#include <vector>
+
+namespace nx::core::Benchmark
+{
+/**
+ * @brief Registers the SimplnxCore filter benchmarks for every image dimension.
+ * @param dimensions
+ */
+void RegisterFilterBenchmarks(const std::vector<usize>& dimensions);
+
+/**
+ * @brief Registers the .dream3d write / import round trip benchmarks for every image dimension.
+ * @param dimensions
+ */
+void RegisterIOBenchmarks(const std::vector<usize>& dimensions);
+
+/**
+ * @brief Registers the benchmarks comparing MaskCompare with the typed mask views for every image dimension.
+ * @param dimensions
+ */
+void RegisterMaskBenchmarks(const std::vector<usize>& dimensions);
+} // namespace nx::core::Benchmark
@@ -0,0 +1,185 @@
+#include "Benchmarks.hpp"
+#include "SyntheticData.hpp"
+
+#include "SimplnxCore/Filters/ComputeArrayStatisticsFilter.hpp"
+#include "SimplnxCore/Filters/ComputeEuclideanDistMapFilter.hpp"
+#include "SimplnxCore/Filters/ComputeFeatureNeighborsFilter.hpp"
+#include "SimplnxCore/Filters/FlyingEdges3DFilter.hpp"
+#include "SimplnxCore/Filters/QuickSurfaceMeshFilter.hpp"
+#include "SimplnxCore/Filters/ScalarSegmentFeaturesFilter.hpp"
+#include "SimplnxCore/Filters/SurfaceNetsFilter.hpp"
+
+#include "simplnx/Parameters/MultiArraySelectionParameter.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <fmt/format.h>
+
+#include <functional>
+#include <optional>
+
+namespace nx::core::Benchmark
+{
+namespace
+{
+const DataPath k_TriangleGeomPath({"Triangle Geometry"});
+
+/**
+ * @brief Creates a snapshot of the structure and detaches every DataObject from
+ * it, so the copy does not share any store with the synthetic structure.
+ */
+DataStructure CreateUniqueCopy(const DataStructure& baseStructure)
+{
+  DataStructure dataStructure = baseStructure.createSnapshot();
+  for(const auto& identifier : dataStructure.getAllDataObjectIds())
+  {
+    if(DataObject* dataObject = dataStructure.getData(identifier); dataObject != nullptr)
+    {
+      dataObject->makeUnique();
+    }
+  }
+  return dataStructure;
+}
+
+/**
+ * @brief Times IFilter::execute on a copy of the synthetic structure. Copying
+ * and releasing the structure is excluded from the timing, so the filter
+ * neither pays for the copies nor modifies the cached synthetic data.
+ */
+void RunFilter(benchmark::State& state, const IFilter& filter, const Arguments& args)
+{
+  const auto dimension = static_cast<usize>(state.range(0));
+  const DataStructure& baseStructure = GetSyntheticImageData(dimension);
+  const usize numVoxels = dimension * dimension * dimension;
+
+  for(auto _ : state)
+  {
+    state.PauseTiming();
+    std::optional<DataStructure> dataStructure = CreateUniqueCopy(baseStructure);
+    state.ResumeTiming();
+
+    auto executeResult = filter.execute(*dataStructure, args);
+
+    state.PauseTiming();
+    dataStructure.reset();
+    if(executeResult.result.invalid())
+    {
+      const auto& error = executeResult.result.errors().front();
+      state.SkipWithError(fmt::format("{} failed with error {}: {}", filter.humanName(), error.code, error.message).c_str());
+      break;
+    }
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(static_cast<int64>(state.iterations() * numVoxels));
+  state.counters["voxels"] = static_cast<double>(numVoxels);
+  state.counters["grains"] = static_cast<double>(GetNumberOfGrains(dimension));
+}
+
+void ScalarSegmentFeatures(benchmark::State& state)
+{
+  ScalarSegmentFeaturesFilter filter;
+  Arguments args = filter.getDefaultArguments();
+  args.insertOrAssign(ScalarSegmentFeaturesFilter::k_GridGeomPath_Key, std::make_any<DataPath>(k_ImageGeomPath));
+  args.insertOrAssign(ScalarSegmentFeaturesFilter::k_InputArrayPathKey, std::make_any<DataPath>(k_GrainValuesPath));
+  args.insertOrAssign(ScalarSegmentFeaturesFilter::k_ScalarToleranceKey, std::make_any<int32>(1));
+  args.insertOrAssign(ScalarSegmentFeaturesFilter::k_FeatureIdsName_Key, std::make_any<std::string>("SegmentedFeatureIds"));
+  args.insertOrAssign(ScalarSegmentFeaturesFilter::k_CellFeatureName_Key, std::make_any<std::string>("Segmented Feature Data"));
+  RunFilter(state, filter, args);
+}
+
+void ComputeFeatureNeighbors(benchmark::State& state)
+{
+  ComputeFeatureNeighborsFilter filter;
+  Arguments args = filter.getDefaultArguments();
+  args.insertOrAssign(ComputeFeatureNeighborsFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(k_ImageGeomPath));
+  args.insertOrAssign(ComputeFeatureNeighborsFilter::k_FeatureIdsPath_Key, std::make_any<DataPath>(k_FeatureIdsPath));
+  args.insertOrAssign(ComputeFeatureNeighborsFilter::k_CellFeaturesPath_Key, std::make_any<DataPath>(k_CellFeatureDataPath));
+  args.insertOrAssign(ComputeFeatureNeighborsFilter::k_StoreBoundary_Key, std::make_any<bool>(true));
+  args.insertOrAssign(ComputeFeatureNeighborsFilter::k_StoreSurface_Key, std::make_any<bool>(true));
+  RunFilter(state, filter, args);
+}
+
+void ComputeArrayStatistics(benchmark::State& state)
+{
+  ComputeArrayStatisticsFilter filter;
+  Arguments args = filter.getDefaultArguments();
+  args.insertOrAssign(ComputeArrayStatisticsFilter::k_SelectedArrayPath_Key, std::make_any<DataPath>(k_DistancePath));
+  args.insertOrAssign(ComputeArrayStatisticsFilter::k_DestinationAttributeMatrixPath_Key, std::make_any<DataPath>(k_ImageGeomPath.createChildPath("Distance Statistics")));
+  args.insertOrAssign(ComputeArrayStatisticsFilter::k_ComputeByIndex_Key, std::make_any<bool>(true));
+  args.insertOrAssign(ComputeArrayStatisticsFilter::k_CellFeatureIdsArrayPath_Key, std::make_any<DataPath>(k_FeatureIdsPath));
+  for(const auto& key : {ComputeArrayStatisticsFilter::k_FindHistogram_Key, ComputeArrayStatisticsFilter::k_FindLength_Key, ComputeArrayStatisticsFilter::k_FindMin_Key,
+                         ComputeArrayStatisticsFilter::k_FindMax_Key, ComputeArrayStatisticsFilter::k_FindMean_Key, ComputeArrayStatisticsFilter::k_FindMedian_Key,
+                         ComputeArrayStatisticsFilter::k_FindStdDeviation_Key, ComputeArrayStatisticsFilter::k_FindSummation_Key})
+  {
+    args.insertOrAssign(key, std::make_any<bool>(true));
+  }
+  args.insertOrAssign(ComputeArrayStatisticsFilter::k_UseFullRange_Key, std::make_any<bool>(true));
+  RunFilter(state, filter, args);
+}
+
+void QuickSurfaceMesh(benchmark::State& state)
+{
+  QuickSurfaceMeshFilter filter;
+  Arguments args = filter.getDefaultArguments();
+  args.insertOrAssign(QuickSurfaceMeshFilter::k_GridGeometryDataPath_Key, std::make_any<DataPath>(k_ImageGeomPath));
+  args.insertOrAssign(QuickSurfaceMeshFilter::k_CellFeatureIdsArrayPath_Key, std::make_any<DataPath>(k_FeatureIdsPath));
+  args.insertOrAssign(QuickSurfaceMeshFilter::k_SelectedDataArrayPaths_Key, std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{}));
+  args.insertOrAssign(QuickSurfaceMeshFilter::k_CreatedTriangleGeometryPath_Key, std::make_any<DataPath>(k_TriangleGeomPath));
+  RunFilter(state, filter, args);
+}
+
+void SurfaceNets(benchmark::State& state)
+{
+  SurfaceNetsFilter filter;
+  Arguments args = filter.getDefaultArguments();
+  args.insertOrAssign(SurfaceNetsFilter::k_GridGeometryDataPath_Key, std::make_any<DataPath>(k_ImageGeomPath));
+  args.insertOrAssign(SurfaceNetsFilter::k_CellFeatureIdsArrayPath_Key, std::make_any<DataPath>(k_FeatureIdsPath));
+  args.insertOrAssign(SurfaceNetsFilter::k_SelectedDataArrayPaths_Key, std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{}));
+  args.insertOrAssign(SurfaceNetsFilter::k_CreatedTriangleGeometryPath_Key, std::make_any<DataPath>(k_TriangleGeomPath));
+  RunFilter(state, filter, args);
+}
+
+void FlyingEdges3D(benchmark::State& state)
+{
+  FlyingEdges3DFilter filter;
+  Arguments args = filter.getDefaultArguments();
+  args.insertOrAssign(FlyingEdges3DFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(k_ImageGeomPath));
+  args.insertOrAssign(FlyingEdges3DFilter::k_SelectedDataArrayPath_Key, std::make_any<DataPath>(k_DistancePath));
+  args.insertOrAssign(FlyingEdges3DFilter::k_IsoVal_Key, std::make_any<float64>(0.5));
+  args.insertOrAssign(FlyingEdges3DFilter::k_CreatedTriangleGeometryPath_Key, std::make_any<DataPath>(k_TriangleGeomPath));
+  RunFilter(state, filter, args);
+}
+
+void ComputeEuclideanDistMap(benchmark::State& state)
+{
+  ComputeEuclideanDistMapFilter filter;
+  Arguments args = filter.getDefaultArguments();
+  args.insertOrAssign(ComputeEuclideanDistMapFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(k_ImageGeomPath));
+  args.insertOrAssign(ComputeEuclideanDistMapFilter::k_CellFeatureIdsArrayPath_Key, std::make_any<DataPath>(k_FeatureIdsPath));
+  args.insertOrAssign(ComputeEuclideanDistMapFilter::k_DoBoundaries_Key, std::make_any<bool>(true));
+  args.insertOrAssign(ComputeEuclideanDistMapFilter::k_DoTripleLines_Key, std::make_any<bool>(true));
+  args.insertOrAssign(ComputeEuclideanDistMapFilter::k_DoQuadPoints_Key, std::make_any<bool>(true));
+  RunFilter(state, filter, args);
+}
+} // namespace
+
+void RegisterFilterBenchmarks(const std::vector<usize>& dimensions)
+{
+  const std::vector<std::pair<std::string, std::function<void(benchmark::State&)>>> benchmarks = {
+      {"ScalarSegmentFeatures", ScalarSegmentFeatures}, {"ComputeFeatureNeighbors", ComputeFeatureNeighbors},
+      {"ComputeArrayStatistics", ComputeArrayStatistics}, {"QuickSurfaceMesh", QuickSurfaceMesh},
+      {"SurfaceNets", SurfaceNets}, {"FlyingEdges3D", FlyingEdges3D},
+      {"ComputeEuclideanDistMap", ComputeEuclideanDistMap}};
+
+  for(const auto& [name, function] : benchmarks)
+  {
+    auto* registeredBenchmark = benchmark::RegisterBenchmark(name.c_str(), function);
+    for(usize dimension : dimensions)
+    {
+      registeredBenchmark->Arg(static_cast<int64>(dimension));
+    }
+    registeredBenchmark->ArgName("dim")->Unit(benchmark::kMillisecond)->UseRealTime();
+  }
+}
+} // namespace nx::core::Benchmark
@@ -0,0 +1,107 @@
+#include "Benchmarks.hpp"
+#include "SyntheticData.hpp"
+
+#include "simplnx/Utilities/Parsing/DREAM3D/Dream3dIO.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <fmt/format.h>
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+namespace nx::core::Benchmark
+{
+namespace
+{
+fs::path GetOutputPath(usize dimension, HDF5::CompressionSettings::Type compressionType)
+{
+  return fs::temp_directory_path() / fmt::format("simplnx_benchmark_{}_{}.dream3d", dimension, static_cast<int32>(compressionType));
+}
+
+HDF5::CompressionSettings GetCompression(const benchmark::State& state)
+{
+  HDF5::CompressionSettings compression;
+  compression.type = static_cast<HDF5::CompressionSettings::Type>(state.range(1));
+  return compression;
+}
+
+void WriteDream3dFile(benchmark::State& state)
+{
+  const auto dimension = static_cast<usize>(state.range(0));
+  const DataStructure& dataStructure = GetSyntheticImageData(dimension);
+  const HDF5::CompressionSettings compression = GetCompression(state);
+  const fs::path filePath = GetOutputPath(dimension, compression.type);
+
+  HDF5::WriteStatistics statistics;
+  for(auto _ : state)
+  {
+    auto result = DREAM3D::WriteFile(filePath, dataStructure, {}, false, compression, &statistics);
+    if(result.invalid())
+    {
+      state.SkipWithError(fmt::format("DREAM3D::WriteFile failed: {}", result.errors().front().message).c_str());
+      break;
+    }
+  }
+
+  // WriteFile overwrites the statistics on every call, so they describe a single iteration
+  state.SetBytesProcessed(static_cast<int64>(statistics.uncompressedBytes) * state.iterations());
+  state.counters["file_bytes"] = static_cast<double>(fs::exists(filePath) ? fs::file_size(filePath) : 0);
+  state.counters["compression_ratio"] = statistics.compressionRatio();
+}
+
+void ImportDream3dFile(benchmark::State& state)
+{
+  const auto dimension = static_cast<usize>(state.range(0));
+  const HDF5::CompressionSettings compression = GetCompression(state);
+  const fs::path filePath = GetOutputPath(dimension, compression.type);
+
+  // The file written by WriteDream3dFile is reused when it exists
+  if(!fs::exists(filePath))
+  {
+    auto writeResult = DREAM3D::WriteFile(filePath, GetSyntheticImageData(dimension), {}, false, compression);
+    if(writeResult.invalid())
+    {
+      state.SkipWithError(fmt::format("DREAM3D::WriteFile failed: {}", writeResult.errors().front().message).c_str());
+      return;
+    }
+  }
+
+  usize numBytes = 0;
+  for(auto _ : state)
+  {
+    auto result = DREAM3D::ImportDataStructureFromFile(filePath);
+    if(result.invalid())
+    {
+      state.SkipWithError(fmt::format("DREAM3D::ImportDataStructureFromFile failed: {}", result.errors().front().message).c_str());
+      break;
+    }
+    numBytes += result.value().memoryUsage();
+  }
+
+  state.SetBytesProcessed(static_cast<int64>(numBytes));
+  state.counters["file_bytes"] = static_cast<double>(fs::file_size(filePath));
+
+  std::error_code errorCode;
+  fs::remove(filePath, errorCode);
+}
+} // namespace
+
+void RegisterIOBenchmarks(const std::vector<usize>& dimensions)
+{
+  const std::vector<HDF5::CompressionSettings::Type> compressionTypes = {HDF5::CompressionSettings::Type::None, HDF5::CompressionSettings::Type::ShuffleDeflate};
+
+  for(auto* registeredBenchmark : {benchmark::RegisterBenchmark("WriteDream3dFile", WriteDream3dFile), benchmark::RegisterBenchmark("ImportDream3dFile", ImportDream3dFile)})
+  {
+    for(usize dimension : dimensions)
+    {
+      for(auto compressionType : compressionTypes)
+      {
+        registeredBenchmark->Args({static_cast<int64>(dimension), static_cast<int64>(compressionType)});
+      }
+    }
+    registeredBenchmark->ArgNames({"dim", "compression"})->Unit(benchmark::kMillisecond)->UseRealTime();
+  }
+}
+} // namespace nx::core::Benchmark
@@ -0,0 +1,108 @@
+#include "Benchmarks.hpp"
+#include "SyntheticData.hpp"
+
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/Utilities/DataArrayUtilities.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+
+namespace nx::core::Benchmark
+{
+namespace
+{
+/**
+ * @brief Distance (in units of k_GrainSize) below which a voxel is part of the mask. Selects
+ * roughly half of the voxels in blobs around the grain seeds so the branches are not trivially predicted.
+ */
+constexpr float32 k_MaskDistance = 0.6f;
+
+/**
+ * @brief Sums the distances of the masked voxels. This is the shape of the per voxel loops in
+ * ComputeArrayStatistics and the segment features filters.
+ */
+template <class MaskT>
+float64 SumMaskedDistances(const MaskT& mask, nonstd::span<const float32> distances)
+{
+  float64 sum = 0.0;
+  for(usize i = 0; i < distances.size(); i++)
+  {
+    if(mask.isTrue(i))
+    {
+      sum += distances[i];
+    }
+  }
+  return sum;
+}
+
+/**
+ * @brief Builds a uint8 mask from the synthetic Distance array and times func(maskArray, distances).
+ * Building the mask is excluded from the timing.
+ */
+void RunMaskLoop(benchmark::State& state, const std::function<float64(const IDataArray&, nonstd::span<const float32>)>& func)
+{
+  const auto dimension = static_cast<usize>(state.range(0));
+  const DataStructure& baseStructure = GetSyntheticImageData(dimension);
+  const auto& distanceStore = baseStructure.getDataRefAs<Float32Array>(k_DistancePath).getDataStoreRef();
+  const nonstd::span<const float32> distances = distanceStore.getContiguousSpan();
+  const usize numVoxels = distances.size();
+
+  DataStructure dataStructure;
+  auto* maskArray = UInt8Array::CreateWithStore<UInt8DataStore>(dataStructure, "Mask", {numVoxels}, {1});
+  auto& maskStore = maskArray->getDataStoreRef();
+  for(usize i = 0; i < numVoxels; i++)
+  {
+    maskStore[i] = distances[i] < k_MaskDistance ? 1 : 0;
+  }
+
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(func(*maskArray, distances));
+  }
+
+  state.SetItemsProcessed(static_cast<int64>(state.iterations() * numVoxels));
+  state.counters["voxels"] = static_cast<double>(numVoxels);
+}
+
+void MaskCompareLoop(benchmark::State& state)
+{
+  RunMaskLoop(state, [](const IDataArray& maskArray, nonstd::span<const float32> distances) {
+    std::unique_ptr<MaskCompare> maskCompare = InstantiateMaskCompare(const_cast<IDataArray&>(maskArray));
+    return SumMaskedDistances(*maskCompare, distances);
+  });
+}
+
+void MaskViewLoop(benchmark::State& state)
+{
+  RunMaskLoop(state, [](const IDataArray& maskArray, nonstd::span<const float32> distances) {
+    return ExecuteWithMaskView(&maskArray, [distances](const auto& mask) { return SumMaskedDistances(mask, distances); });
+  });
+}
+
+void PackedMaskViewLoop(benchmark::State& state)
+{
+  // Includes packing the mask, which every filter using PackedMaskView pays once
+  RunMaskLoop(state, [](const IDataArray& maskArray, nonstd::span<const float32> distances) {
+    const PackedMaskView mask(maskArray);
+    return SumMaskedDistances(mask, distances);
+  });
+}
+} // namespace
+
+void RegisterMaskBenchmarks(const std::vector<usize>& dimensions)
+{
+  const std::vector<std::pair<std::string, std::function<void(benchmark::State&)>>> benchmarks = {
+      {"Mask/MaskCompare", MaskCompareLoop}, {"Mask/MaskView", MaskViewLoop}, {"Mask/PackedMaskView", PackedMaskViewLoop}};
+
+  for(const auto& [name, function] : benchmarks)
+  {
+    auto* registeredBenchmark = benchmark::RegisterBenchmark(name.c_str(), function);
+    for(usize dimension : dimensions)
+    {
+      registeredBenchmark->Arg(static_cast<int64>(dimension));
+    }
+    registeredBenchmark->ArgName("dim")->Unit(benchmark::kMillisecond)->UseRealTime();
+  }
+}
+} // namespace nx::core::Benchmark
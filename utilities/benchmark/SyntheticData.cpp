@@ -0,0 +1,134 @@
+#include "SyntheticData.hpp"
+
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace nx::core::Benchmark
+{
+namespace
+{
+uint64 SplitMix64(uint64 value)
+{
+  value += 0x9E3779B97F4A7C15ULL;
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+  return value ^ (value >> 31);
+}
+
+float32 UnitValue(uint64 hash)
+{
+  return static_cast<float32>(hash >> 40) / static_cast<float32>(1ULL << 24);
+}
+
+usize GridCellsPerAxis(usize dimension)
+{
+  return (dimension + k_GrainSize - 1) / k_GrainSize;
+}
+
+std::unique_ptr<DataStructure> CreateSyntheticImageData(usize dimension)
+{
+  auto dataStructure = std::make_unique<DataStructure>();
+  const std::vector<usize> tupleShape = {dimension, dimension, dimension};
+
+  auto* imageGeom = ImageGeom::Create(*dataStructure, k_ImageGeomPath.getTargetName());
+  imageGeom->setDimensions({dimension, dimension, dimension});
+  imageGeom->setOrigin({0.0f, 0.0f, 0.0f});
+  imageGeom->setSpacing({1.0f, 1.0f, 1.0f});
+
+  auto* cellData = AttributeMatrix::Create(*dataStructure, k_CellDataPath.getTargetName(), tupleShape, imageGeom->getId());
+  imageGeom->setCellData(*cellData);
+
+  auto* featureIdsArray = Int32Array::CreateWithStore<Int32DataStore>(*dataStructure, k_FeatureIdsPath.getTargetName(), tupleShape, {1}, cellData->getId());
+  auto* grainValuesArray = Int32Array::CreateWithStore<Int32DataStore>(*dataStructure, k_GrainValuesPath.getTargetName(), tupleShape, {1}, cellData->getId());
+  auto* distanceArray = Float32Array::CreateWithStore<Float32DataStore>(*dataStructure, k_DistancePath.getTargetName(), tupleShape, {1}, cellData->getId());
+  auto& featureIds = featureIdsArray->getDataStoreRef();
+  auto& grainValues = grainValuesArray->getDataStoreRef();
+  auto& distances = distanceArray->getDataStoreRef();
+
+  // One jittered Voronoi seed per grid cell, every voxel searches the 27 surrounding grid cells for its closest seed
+  const auto gridCells = static_cast<int64>(GridCellsPerAxis(dimension));
+  const auto grainSize = static_cast<float32>(k_GrainSize);
+  auto seedPosition = [grainSize](int64 cell, int64 axis, uint64 gridIndex) {
+    return (static_cast<float32>(cell) + UnitValue(SplitMix64(gridIndex * 3 + static_cast<uint64>(axis)))) * grainSize;
+  };
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, dimension);
+  dataAlg.execute([&](const Range& range) {
+    for(usize z = range.min(); z < range.max(); z++)
+    {
+      const auto cz = static_cast<int64>(z / k_GrainSize);
+      for(usize y = 0; y < dimension; y++)
+      {
+        const auto cy = static_cast<int64>(y / k_GrainSize);
+        for(usize x = 0; x < dimension; x++)
+        {
+          const auto cx = static_cast<int64>(x / k_GrainSize);
+          float32 bestDistance = std::numeric_limits<float32>::max();
+          uint64 bestGrid = 0;
+          for(int64 gz = std::max<int64>(cz - 1, 0); gz <= std::min(cz + 1, gridCells - 1); gz++)
+          {
+            for(int64 gy = std::max<int64>(cy - 1, 0); gy <= std::min(cy + 1, gridCells - 1); gy++)
+            {
+              for(int64 gx = std::max<int64>(cx - 1, 0); gx <= std::min(cx + 1, gridCells - 1); gx++)
+              {
+                const auto gridIndex = static_cast<uint64>((gz * gridCells + gy) * gridCells + gx);
+                const float32 dx = seedPosition(gx, 0, gridIndex) - static_cast<float32>(x);
+                const float32 dy = seedPosition(gy, 1, gridIndex) - static_cast<float32>(y);
+                const float32 dz = seedPosition(gz, 2, gridIndex) - static_cast<float32>(z);
+                const float32 distance = dx * dx + dy * dy + dz * dz;
+                if(distance < bestDistance)
+                {
+                  bestDistance = distance;
+                  bestGrid = gridIndex;
+                }
+              }
+            }
+          }
+
+          const usize index = (z * dimension + y) * dimension + x;
+          const auto featureId = static_cast<int32>(bestGrid + 1);
+          featureIds[index] = featureId;
+          grainValues[index] = featureId * 3 + static_cast<int32>(SplitMix64(index) & 1);
+          distances[index] = std::sqrt(bestDistance) / grainSize;
+        }
+      }
+    }
+  });
+
+  AttributeMatrix::Create(*dataStructure, k_CellFeatureDataPath.getTargetName(), {GetNumberOfGrains(dimension) + 1}, imageGeom->getId());
+
+  return dataStructure;
+}
+} // namespace
+
+usize GetNumberOfGrains(usize dimension)
+{
+  const usize gridCells = GridCellsPerAxis(dimension);
+  return gridCells * gridCells * gridCells;
+}
+
+const DataStructure& GetSyntheticImageData(usize dimension)
+{
+  static std::mutex s_Mutex;
+  static std::map<usize, std::unique_ptr<DataStructure>> s_Cache;
+
+  std::lock_guard<std::mutex> lock(s_Mutex);
+  auto iter = s_Cache.find(dimension);
+  if(iter == s_Cache.end())
+  {
+    // Only keep one size alive, the largest sizes need several GB each
+    s_Cache.clear();
+    iter = s_Cache.emplace(dimension, CreateSyntheticImageData(dimension)).first;
+  }
+  return *iter->second;
+}
+} // namespace nx::core::Benchmark
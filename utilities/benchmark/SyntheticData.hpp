@@ -0,0 +1,42 @@
+#pragma once
+
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/DataPath.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+
+namespace nx::core::Benchmark
+{
+inline const DataPath k_ImageGeomPath({"Synthetic Image"});
+inline const DataPath k_CellDataPath = k_ImageGeomPath.createChildPath("Cell Data");
+inline const DataPath k_CellFeatureDataPath = k_ImageGeomPath.createChildPath("Cell Feature Data");
+inline const DataPath k_FeatureIdsPath = k_CellDataPath.createChildPath("FeatureIds");
+inline const DataPath k_GrainValuesPath = k_CellDataPath.createChildPath("GrainValues");
+inline const DataPath k_DistancePath = k_CellDataPath.createChildPath("Distance");
+
+/**
+ * @brief Edge length, in voxels, of the jittered grid the Voronoi seeds are placed on.
+ */
+inline constexpr usize k_GrainSize = 16;
+
+/**
+ * @brief Returns a cubic Image Geometry of dimension^3 cells holding a Voronoi
+ * microstructure with roughly one grain per k_GrainSize^3 voxels:
+ * - FeatureIds (int32): 1 based grain id
+ * - GrainValues (int32): grain id * 3 plus 0/1 noise, segments back into the grains with a tolerance of 1
+ * - Distance (float32): distance to the grain's seed in units of k_GrainSize
+ * - Cell Feature Data: feature attribute matrix with one tuple per grain plus 0
+ *
+ * The structure is generated once per dimension with a fixed seed and cached
+ * so that repeated benchmarks compare identical inputs.
+ * @param dimension
+ * @return const DataStructure&
+ */
+const DataStructure& GetSyntheticImageData(usize dimension);
+
+/**
+ * @brief Returns the number of grains generated for a given dimension.
+ * @param dimension
+ * @return usize
+ */
+usize GetNumberOfGrains(usize dimension);
+} // namespace nx::core::Benchmark
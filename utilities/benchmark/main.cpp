@@ -1,28 +1,88 @@
+#include "Benchmarks.hpp"
+
+#include "simplnx/Core/Application.hpp"
+
 #include <benchmark/benchmark.h>
 
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace nx::core;
+
 namespace
 {
-void BenchmarkCaseA(benchmark::State& state)
+constexpr usize k_MinDimension = 64;
+constexpr usize k_DefaultMaxDimension = 256;
+constexpr usize k_MaxDimension = 1024;
+constexpr const char* k_MaxDimensionFlag = "--max_dimension=";
+
+/**
+ * @brief Removes --max_dimension=N from the command line and returns N (or
+ * the default). Google Benchmark rejects flags it does not know about.
+ */
+usize ParseMaxDimension(int& argc, char** argv)
 {
-  for(auto _ : state)
+  usize maxDimension = k_DefaultMaxDimension;
+  const usize flagLength = std::strlen(k_MaxDimensionFlag);
+  int outIndex = 1;
+  for(int i = 1; i < argc; i++)
   {
-    std::string x("foo");
-    benchmark::DoNotOptimize(x);
+    if(std::strncmp(argv[i], k_MaxDimensionFlag, flagLength) == 0)
+    {
+      maxDimension = std::stoull(argv[i] + flagLength);
+      continue;
+    }
+    argv[outIndex++] = argv[i];
   }
+  argc = outIndex;
+  return std::clamp(maxDimension, k_MinDimension, k_MaxDimension);
 }
+} // namespace
 
-void BenchmarkCaseB(benchmark::State& state)
+/**
+ * Usage:
+ *   simplnx_benchmark [--max_dimension=N] [google benchmark flags]
+ *
+ * Synthetic image geometries from 64^3 up to N^3 (power of two steps, N <= 1024,
+ * default 256) are generated. Use --benchmark_out=results.json
+ * --benchmark_out_format=json to store results that can be diffed between
+ * releases with Google Benchmark's tools/compare.py.
+ */
+int main(int argc, char** argv)
 {
-  std::string x = "foo";
-  for(auto _ : state)
+  const usize maxDimension = ParseMaxDimension(argc, argv);
+  std::vector<usize> dimensions;
+  for(usize dimension = k_MinDimension; dimension <= maxDimension; dimension *= 2)
   {
-    std::string copy(x);
-    benchmark::DoNotOptimize(copy);
+    dimensions.push_back(dimension);
   }
-}
-} // namespace
 
-BENCHMARK(BenchmarkCaseA);
-BENCHMARK(BenchmarkCaseB);
+  // Filters look up the DataIOCollection and Preferences through the Application instance
+  Application::GetOrCreateInstance();
+
+  Benchmark::RegisterFilterBenchmarks(dimensions);
+  Benchmark::RegisterIOBenchmarks(dimensions);
+  Benchmark::RegisterMaskBenchmarks(dimensions);
 
-BENCHMARK_MAIN();
+  benchmark::Initialize(&argc, argv);
+  if(benchmark::ReportUnrecognizedArguments(argc, argv))
+  {
+    return 1;
+  }
+  benchmark::AddCustomContext("simplnx_version", SIMPLNX_BENCHMARK_VERSION);
+  benchmark::AddCustomContext("max_dimension", std::to_string(maxDimension));
+  benchmark::AddCustomContext("hardware_threads", std::to_string(std::thread::hardware_concurrency()));
+#ifdef SIMPLNX_ENABLE_MULTICORE
+  benchmark::AddCustomContext("multicore", "true");
+#else
+  benchmark::AddCustomContext("multicore", "false");
+#endif
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}